@@ -25,7 +25,9 @@
 //     <1=> STM32 F4
 //     <2=> STM32 H7
 //     <3=> STM32 G4
+//     <4=> Host (Linux/POSIX 模拟器)
 // <i> 选择所使用的 MCU 型号
+// <i> Host: 使用 port/GCC/Posix 移植在 PC/CI 主机上运行内核, 不包含 STM32 库
 #define configMCU_TYPE 1
 
 // <o> STM32开发库选择
@@ -42,7 +44,10 @@
 #define configUSE_LIBSTM 1
 // </e> !libstm
 
-#if (configSTM32_LIB == 0)
+#if (configMCU_TYPE == 4)
+/* 主机模拟器无需包含 STM32 开发库 */
+
+#elif (configSTM32_LIB == 0)
 #if (configMCU_TYPE == 0)
 #include "stm32f10x.h"
 
@@ -131,6 +136,43 @@ extern uint32_t SystemCoreClock;
 // <i> 因此, 请根据具体硬件情况选择合适的方法!
 #define configUSE_PORT_OPTIMISED_TASK_SELECTION	1
 
+// <o> 处理器核心数 (SMP) <1-32>
+// <i> configNUMBER_OF_CORES
+// <i> 默认: 1 (单核调度器)
+// <i> 大于 1 时启用对称多处理 (SMP) 调度器:
+// <i>   1. 每个核心各有一个当前任务与一个绑定在该核心上的空闲任务
+// <i>   2. 全局临界区改为内核自旋锁 (任务锁 + 中断锁), 需移植层提供
+// <i>   3. 任务可通过 vTaskCoreAffinitySet() 设置核心亲和性掩码
+// <i>   4. 唤醒高优先级任务时会向运行最低优先级任务的核心发送切换请求
+// <i> 启用时须将 configUSE_PORT_OPTIMISED_TASK_SELECTION 设为 0
+// <i> 且不支持低功耗 tickless 模式, 目前仅主机模拟器移植支持
+#define configNUMBER_OF_CORES 1
+
+// <e> 最早截止期优先 (EDF) 调度
+// <i> configUSE_EDF_SCHEDULING
+// <i> 0 Disable: 仅按固定优先级调度
+// <i> 1 Enable: 保留一个优先级 configEDF_PRIORITY 作为 EDF 调度带
+// <i> 通过 xTaskCreateWithDeadline() 创建的任务带有相对截止期与周期,
+// <i> 在该优先级内按绝对截止期先后运行, 不做时间片轮转
+// <i> vTaskDelayUntil() 释放下一作业时自动推进截止期, 节拍中断检测截止期错失
+// <i> 仅支持单核 (configNUMBER_OF_CORES 为 1)
+#define configUSE_EDF_SCHEDULING 0
+// <o> EDF 调度带优先级
+// <i> configEDF_PRIORITY
+// <i> 须大于空闲任务优先级且小于 configMAX_PRIORITIES, 不应再用于普通任务
+#define configEDF_PRIORITY (configMAX_PRIORITIES - 2)
+// </e> !最早截止期优先 (EDF) 调度
+
+// <e> 任务执行预算
+// <i> configUSE_TASK_BUDGETS
+// <i> 0 Disable: 不限制任务占用的 CPU 时间
+// <i> 1 Enable: 可通过 vTaskSetBudget() 为任务设置每周期可运行的节拍数
+// <i> 节拍中断把每个节拍计入当时运行的任务, 预算用完的任务被挂起 (节流)
+// <i> 直到下一周期补充预算, 使低优先级任务在每个周期内都能得到剩余的 CPU 时间
+// <i> 持有互斥量的任务在释放全部互斥量之前不会被节流
+#define configUSE_TASK_BUDGETS 0
+// </e> !任务执行预算
+
 // <e> 低功耗 tickless 模式
 // <i> configUSE_TICKLESS_IDLE
 // <i> 0 Disable: 保持系统节拍 (tick) 中断一直运行
@@ -140,6 +182,18 @@ extern uint32_t SystemCoreClock;
 #define configUSE_TICKLESS_IDLE 0
 // </e> !低功耗 tickless 模式
 
+// <e> 时间轮延时列表
+// <i> configUSE_TIMING_WHEEL_DELAYS
+// <i> 0 Disable: 延时任务按唤醒时间插入有序链表, 插入开销随阻塞任务数线性增长
+// <i> 1 Enable: 延时任务挂入分层时间轮, 插入为 O(1), 节拍中断只处理当前槽
+// <i> 阻塞任务较多时建议开启, 代价是额外占用 (层数 x 槽数) 个 List_t 的 RAM
+#define configUSE_TIMING_WHEEL_DELAYS 0
+// <o> 时间轮每层槽数 (2 的幂) <1-5>
+// <i> configTIMING_WHEEL_SLOT_BITS
+// <i> 每层 2^n 个槽, 层数 = 节拍位数 / n (向上取整)
+#define configTIMING_WHEEL_SLOT_BITS 4
+// </e> !时间轮延时列表
+
 // <o> CPU 内核时钟频率 (MHz)
 // <i> configCPU_CLOCK_HZ
 // <i> 自动获取, 无需更改
@@ -192,11 +246,54 @@ extern uint32_t SystemCoreClock;
 #define configUSE_QUEUE_SETS 1
 // </e> !启用队列
 
+// <e> 使能多对象等待
+// <i> configUSE_MULTIPLE_OBJECT_WAITS
+// <i> 提供 multi_wait.h, 任务可同时等待多个队列、信号量、事件组位和任务通知, 任一就绪即返回其序号
+// <i> 等待记录直接挂入各对象的等待链表, 与队列集不同, 发送路径没有额外开销; 不能等待互斥量
+#define configUSE_MULTIPLE_OBJECT_WAITS 0
+// </e> !使能多对象等待
+
+// <e> 队列零拷贝借用接口
+// <i> configUSE_QUEUE_LOANS
+// <i> 提供 xQueueLoanSlot/xQueueCommitSlot 与 xQueueBorrowSlot/xQueueReleaseSlot
+// <i> 生产者直接在队列存储区内填写数据项, 消费者直接在存储区内读取, 省去两次 uxItemSize 字节的拷贝
+#define configUSE_QUEUE_LOANS 0
+// </e> !队列零拷贝借用接口
+
+// <e> 队列批量收发接口
+// <i> configUSE_QUEUE_BATCHES
+// <i> 提供 xQueueSendMultiple/xQueueReceiveMultiple 及其 FromISR 版本
+// <i> 一次进入内核即可收发多个连续数据项, 每批只唤醒一次等待任务
+#define configUSE_QUEUE_BATCHES 0
+// </e> !队列批量收发接口
+
+// <e> 队列直接交付
+// <i> configUSE_QUEUE_HAND_OFF
+// <i> 有任务阻塞在空队列上接收时, 发送方直接把数据项拷贝到该任务的接收缓冲区, 不经过队列存储区
+// <i> 有任务阻塞在满队列上发送时, 接收方取走数据项后直接替该任务完成发送
+#define configUSE_QUEUE_HAND_OFF 0
+// </e> !队列直接交付
+
 // <e> 使能任务通知功能
 // <i> configUSE_TASK_NOTIFICATIONS
 #define configUSE_TASK_NOTIFICATIONS 0
 // </e> !使能任务通知功能
 
+// <e> 使能流缓冲区
+// <i> configUSE_STREAM_BUFFERS
+// <i> 单生产者/单消费者字节流, 收发数据不进入临界区, 仅在需要唤醒阻塞任务时才操作调度器
+// <i> 同时提供基于流缓冲区的变长消息缓冲区 (message_buffer.h), 每条消息前缀 configMESSAGE_BUFFER_LENGTH_TYPE 长度
+// <i> 依赖任务通知, 开启时须同时使能 configUSE_TASK_NOTIFICATIONS
+#define configUSE_STREAM_BUFFERS 0
+// </e> !使能流缓冲区
+
+// <e> 事件组按位索引等待任务
+// <i> configUSE_EVENT_GROUP_BIT_INDEX
+// <i> 按事件位把等待任务分别挂到各自的列表上, xEventGroupSetBits 只检查等待被置位事件位的任务
+// <i> 每个事件组增加每个事件位一个列表的内存开销, 适用于大量任务等待同一事件组的场合
+#define configUSE_EVENT_GROUP_BIT_INDEX 0
+// </e> !事件组按位索引等待任务
+
 // <e> 使能二值信号量
 // <i> configUSE_BINARY_SEMAPHORES
 #define configUSE_BINARY_SEMAPHORES 1
@@ -205,8 +302,43 @@ extern uint32_t SystemCoreClock;
 // <e> 使能互斥信号量
 // <i> configUSE_MUTEXES
 #define configUSE_MUTEXES 1
+
+// <o> 优先级继承深度 <1-16>
+// <i> configPRIORITY_INHERITANCE_DEPTH
+// <i> 互斥量持有者自身阻塞在另一个互斥量上时, 沿持有链继续继承优先级的最大层数, 为 1 时只提升直接持有者
+// <i> 快速互斥量不参与持有链, 只提升其直接持有者
+#define configPRIORITY_INHERITANCE_DEPTH 1
 // </e> !使能互斥信号量
 
+// <e> 使能优先级天花板互斥信号量
+// <i> configUSE_CEILING_MUTEXES
+// <i> 使能 xSemaphoreCreateMutexWithCeiling(), 任务获取互斥量时立即提升到天花板优先级, 释放时恢复, 不使用优先级继承
+// <i> 需要使能互斥信号量
+#define configUSE_CEILING_MUTEXES 0
+// </e> !使能优先级天花板互斥信号量
+
+// <e> 使能快速互斥量
+// <i> configUSE_FAST_MUTEXES
+// <i> 提供 fast_mutex.h, 无竞争时加锁/解锁只需一次原子比较交换, 不进入临界区; 有竞争时阻塞并使用优先级继承
+// <i> 需要使能互斥信号量, 多核时移植层须提供 portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE (指针为 32 位时提供 portATOMIC_COMPARE_AND_SWAP_U32 即可)
+#define configUSE_FAST_MUTEXES 0
+// </e> !使能快速互斥量
+
+// <e> 使能读写锁
+// <i> configUSE_RW_LOCKS
+// <i> 提供 rw_lock.h, 多个读者可同时持有, 写者独占; 写者优先, 支持超时, 等待任务按优先级唤醒
+// <i> 需要使能互斥信号量, 持有写锁的任务使用优先级继承
+#define configUSE_RW_LOCKS 0
+// </e> !使能读写锁
+
+// <e> 使能条件变量
+// <i> configUSE_CONDITION_VARIABLES
+// <i> 提供 condition_variable.h, 等待时原子地释放互斥量并阻塞, 返回前重新获取互斥量
+// <i> 发信号时若互斥量仍被持有, 等待任务直接转入互斥量的等待链表并参与优先级继承, 避免多余的任务切换
+// <i> 需要使能互斥信号量
+#define configUSE_CONDITION_VARIABLES 0
+// </e> !使能条件变量
+
 // <e> 使能递归互斥信号量
 // <i> configUSE_RECURSIVE_MUTEXES
 #define configUSE_RECURSIVE_MUTEXES	0
@@ -275,6 +407,15 @@ extern uint32_t SystemCoreClock;
 #define configUSE_TICK_HOOK	0
 // </e> !使能时间片钩子
 
+// <e> 使能截止期错失钩子
+// <i> configUSE_DEADLINE_MISS_HOOK
+// <i> 需开启 configUSE_EDF_SCHEDULING
+// <i> FreeRTOS 规定了函数的名字和参数: void vApplicationDeadlineMissHook(TaskHandle_t xTask)
+// <i> EDF 任务在截止期到达时仍处于就绪态即视为错失, 每个作业只调用一次
+// <i> 在节拍中断中调用, 函数必须短小且不能调用会阻塞的 API
+#define configUSE_DEADLINE_MISS_HOOK 0
+// </e> !使能截止期错失钩子
+
 // <e> 使能内存申请失败钩子
 // <i> configUSE_MALLOC_FAILED_HOOK
 #define configUSE_MALLOC_FAILED_HOOK	0
@@ -294,6 +435,19 @@ extern uint32_t SystemCoreClock;
 // <e> 运行时间统计功能
 // <i> configGENERATE_RUN_TIME_STATS
 #define configGENERATE_RUN_TIME_STATS 0
+
+// <q> 64 位运行时间计数
+// <i> configUSE_64_BIT_RUN_TIME_COUNTERS
+// <i> 以 64 位累计任务运行时间, 内核会处理 32 位硬件计数器的回绕
+// <i> 关闭时 1 MHz 统计时钟下约 71 分钟后统计值溢出
+#define configUSE_64_BIT_RUN_TIME_COUNTERS 0
+
+// <q> 中断运行时间统计
+// <i> configGENERATE_ISR_RUN_TIME_STATS
+// <i> 中断服务函数首尾调用 vTaskISREnter()/vTaskISRExit(), 中断占用的时间单独统计
+// <i> 不再计入被打断的任务, vTaskGetRunTimeStats() 中以 ISR 一行显示
+// <i> 各移植层的节拍中断已调用上述函数
+#define configGENERATE_ISR_RUN_TIME_STATS 0
 // </e> !运行时间统计功能
 
 /* 启用可视化跟踪调试 */
@@ -303,6 +457,73 @@ extern uint32_t SystemCoreClock;
 #define configUSE_TRACE_FACILITY 0
 // </e> !可视化跟踪调试
 
+// <e> 分段任务状态快照
+// <i> configUSE_TASK_SNAPSHOTS
+// <i> 需同时启用可视化跟踪调试
+// <i> 通过 vTaskSnapshotBegin()/uxTaskSnapshotRead() 分批读取任务状态, 每次临界区只读取一个任务
+// <i> 不像 uxTaskGetSystemState() 那样在遍历全部任务期间挂起调度器
+// <i> 读取期间有任务创建或删除时快照失效, 可由 xTaskSnapshotIsValid() 检测并重新读取
+#define configUSE_TASK_SNAPSHOTS 0
+// </e> !分段任务状态快照
+
+// <e> 二进制任务统计导出
+// <i> configUSE_BINARY_TASK_STATS
+// <i> 需同时启用分段任务状态快照
+// <i> 通过 vTaskStatsBegin()/xTaskGetStatsRecords() 以定长二进制记录输出任务统计, 每次只写入缓冲区能容纳的完整记录
+// <i> 不依赖 sprintf(), 主机端用 tools/freertos_stats.py 解码为表格或 CSV
+#define configUSE_BINARY_TASK_STATS 0
+// </e> !二进制任务统计导出
+
+// <e> 内核事件跟踪记录
+// <i> configUSE_TRACE_RECORDER
+// <i> 需同时启用可视化跟踪调试, 时间戳默认使用运行时间统计时钟 portGET_RUN_TIME_COUNTER_VALUE()
+// <i> 由跟踪宏把任务切换、队列收发、内存分配等事件以定长记录写入 RAM 环形缓冲区 xTraceRecorder, 缓冲区满时覆盖最旧的事件
+// <i> 移植层提供 portATOMIC_COMPARE_AND_SWAP_U32() 时写入不进入临界区, 可在中断中使用
+// <i> 主机端用 tools/freertos_trace.py 把导出的缓冲区转换为 Chrome/Perfetto 跟踪文件
+#define configUSE_TRACE_RECORDER 0
+
+// <o> 事件缓冲区长度 <16-65536>
+// <i> configTRACE_RECORDER_EVENTS
+// <i> 可记录的事件数, 必须是 2 的幂, 每个事件占用 20 字节
+#define configTRACE_RECORDER_EVENTS 512
+
+// <o> 任务名称表长度 <1-256>
+// <i> configTRACE_RECORDER_TASK_NAMES
+// <i> 保存最近创建的任务的名称, 必须是 2 的幂
+#define configTRACE_RECORDER_TASK_NAMES 32
+// </e> !内核事件跟踪记录
+
+// <e> 中断唤醒延迟统计
+// <i> configUSE_WAKE_LATENCY_STATS
+// <i> 中断通过队列/信号量/任务通知等 FromISR 函数使任务就绪时记录时间戳, 任务被切换运行时把经过的时间计入该任务的对数刻度直方图
+// <i> 通过 vTaskGetWakeLatencyStats()/vTaskResetWakeLatencyStats() 读取和清零, ulTaskGetWakeLatencyPercentile() 计算百分位
+// <i> 时间戳默认使用运行时间统计时钟, 需要微秒级分辨率时可定义 configWAKE_LATENCY_TIMESTAMP() 为 DWT 周期计数器
+#define configUSE_WAKE_LATENCY_STATS 0
+
+// <o> 直方图桶数 <2-32>
+// <i> configWAKE_LATENCY_BUCKETS
+// <i> 第 n 个桶统计 2^(n-1) 至 2^n - 1 个时钟计数的延迟, 最后一个桶包含所有更长的延迟, 每个桶在每个任务中占用 4 字节
+#define configWAKE_LATENCY_BUCKETS 16
+// </e> !中断唤醒延迟统计
+
+// <e> 临界区与调度器挂起时长分析
+// <i> configUSE_CRITICAL_PROFILER
+// <i> 按调用位置 (__FILE__/__LINE__) 统计 taskENTER_CRITICAL()/taskEXIT_CRITICAL() 及 vTaskSuspendAll()/xTaskResumeAll() 之间的时长, 记录次数、最大值和对数刻度直方图
+// <i> 通过 uxTaskGetCriticalProfile() 读取, vTaskResetCriticalProfile() 清零, 用于查找造成中断延迟的长临界区
+// <i> 时间戳默认使用运行时间统计时钟, 可定义 configCRITICAL_PROFILER_TIMESTAMP() 为 DWT 周期计数器
+#define configUSE_CRITICAL_PROFILER 0
+
+// <o> 调用位置数量 <8-256>
+// <i> configCRITICAL_PROFILER_SITES
+// <i> 必须是 2 的幂, 调用位置表满后新位置的时长只计入未记录次数
+#define configCRITICAL_PROFILER_SITES 32
+
+// <o> 直方图桶数 <2-32>
+// <i> configCRITICAL_PROFILER_BUCKETS
+// <i> 第 n 个桶统计 2^(n-1) 至 2^n - 1 个时钟计数的时长, 最后一个桶包含所有更长的时长
+#define configCRITICAL_PROFILER_BUCKETS 16
+// </e> !临界区与调度器挂起时长分析
+
 // <e> 统计格式化函数
 // <i> configUSE_STATS_FORMATTING_FUNCTIONS
 // <i> 与运行时间统计功能同时使能时启用任务跟踪功能
@@ -315,10 +536,17 @@ extern uint32_t SystemCoreClock;
 // </h> !FreeRTOS 与运行时间和任务状态收集有关的配置选项
 
 #if (configGENERATE_RUN_TIME_STATS)
+#if (configMCU_TYPE == 4)
+/* 主机模拟器使用 port/GCC/Posix 提供的微秒计数器 */
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE() ulPortGetRunTimeCounterValue()
+#define configTRACE_RECORDER_TIMESTAMP_HZ 1000000UL
+#else
 extern volatile uint32_t CPU_RunTime;
 
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() (CPU_RunTime = 0ul)
 #define portGET_RUN_TIME_COUNTER_VALUE() CPU_RunTime
+#endif /* configMCU_TYPE */
 #endif /* configGENERATE_RUN_TIME_STATS */
 
 // <h> FreeRTOS 与协程有关的配置选项
@@ -355,6 +583,14 @@ extern volatile uint32_t CPU_RunTime;
 // <i> configTIMER_TASK_STACK_DEPTH
 // <i> 默认: 2 (2 * configMINIMAL_STACK_SIZE(空闲任务使用的堆栈大小))
 #define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE * 2)
+
+// <e> 软件定时器时间轮
+// <i> configUSE_TIMING_WHEEL_TIMERS
+// <i> 0 Disable: 活动定时器按到期时间插入有序链表, 启动/复位开销随活动定时器数线性增长
+// <i> 1 Enable: 活动定时器挂入分层时间轮, 启动/停止/复位为 O(1), 到期时间相同的定时器仍按启动顺序回调
+// <i> 每层槽数与时间轮延时列表共用 configTIMING_WHEEL_SLOT_BITS, 额外占用 (层数 x 槽数) 个 List_t 的 RAM
+#define configUSE_TIMING_WHEEL_TIMERS 0
+// </e> !软件定时器时间轮
 // </h> !FreeRTOS 与软件定时器有关的配置选项
 
 // <h> FreeRTOS 可选函数配置选项
@@ -100,6 +100,12 @@ extern "C" {
 /* Basic FreeRTOS definitions. */
 #include "projdefs.h"
 
+/* Must be defaulted before portable.h is included as SMP capable ports test it
+in portmacro.h. */
+#ifndef configNUMBER_OF_CORES
+	#define configNUMBER_OF_CORES 1
+#endif
+
 /* Definitions specific to the port being used. */
 #include "portable.h"
 
@@ -240,10 +246,38 @@ extern "C" {
 	#define configUSE_RECURSIVE_MUTEXES 0
 #endif
 
+#ifndef configUSE_CEILING_MUTEXES
+	#define configUSE_CEILING_MUTEXES 0
+#endif
+
+#ifndef configUSE_FAST_MUTEXES
+	#define configUSE_FAST_MUTEXES 0
+#endif
+
+#ifndef configUSE_RW_LOCKS
+	#define configUSE_RW_LOCKS 0
+#endif
+
+#ifndef configUSE_CONDITION_VARIABLES
+	#define configUSE_CONDITION_VARIABLES 0
+#endif
+
+#ifndef configUSE_MULTIPLE_OBJECT_WAITS
+	#define configUSE_MULTIPLE_OBJECT_WAITS 0
+#endif
+
 #ifndef configUSE_MUTEXES
 	#define configUSE_MUTEXES 0
 #endif
 
+#ifndef configPRIORITY_INHERITANCE_DEPTH
+	#define configPRIORITY_INHERITANCE_DEPTH 1
+#endif
+
+#if( configPRIORITY_INHERITANCE_DEPTH < 1 )
+	#error configPRIORITY_INHERITANCE_DEPTH must be at least 1
+#endif
+
 #ifndef configUSE_TIMERS
 	#define configUSE_TIMERS 0
 #endif
@@ -252,6 +286,17 @@ extern "C" {
 	#define configUSE_COUNTING_SEMAPHORES 0
 #endif
 
+#ifndef configUSE_STREAM_BUFFERS
+	#define configUSE_STREAM_BUFFERS 0
+#endif
+
+#ifndef configMESSAGE_BUFFER_LENGTH_TYPE
+	/* The type used to hold the length prefix of each message in a message
+	buffer.  A smaller type saves RAM per message but limits the maximum
+	message size. */
+	#define configMESSAGE_BUFFER_LENGTH_TYPE size_t
+#endif
+
 #ifndef configUSE_ALTERNATIVE_API
 	#define configUSE_ALTERNATIVE_API 0
 #endif
@@ -296,6 +341,11 @@ extern "C" {
 
 #endif /* configUSE_TIMERS */
 
+/* Stream buffers block and unblock tasks using direct to task notifications. */
+#if ( configUSE_STREAM_BUFFERS == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error If configUSE_STREAM_BUFFERS is set to 1 then configUSE_TASK_NOTIFICATIONS must also be set to 1.
+#endif
+
 #ifndef portSET_INTERRUPT_MASK_FROM_ISR
 	#define portSET_INTERRUPT_MASK_FROM_ISR() 0
 #endif
@@ -312,6 +362,12 @@ extern "C" {
 	#define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxYieldPending )
 #endif
 
+#ifndef portWAIT_FOR_INTERRUPT
+	/* Called by the idle task of an SMP build when nothing else is ready to
+	run on its core.  The port can stop the core until its next interrupt. */
+	#define portWAIT_FOR_INTERRUPT()
+#endif
+
 #ifndef portSETUP_TCB
 	#define portSETUP_TCB( pxTCB ) ( void ) pxTCB
 #endif
@@ -328,6 +384,22 @@ extern "C" {
 
 #ifndef portPOINTER_SIZE_TYPE
 	#define portPOINTER_SIZE_TYPE uint32_t
+
+	/* Pointers are 32 bits, so a port that can compare and swap a 32 bit value
+	can also compare and swap a pointer sized value. */
+	#if( defined( portATOMIC_COMPARE_AND_SWAP_U32 ) && !defined( portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE ) )
+		#define portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE( puxDestination, uxExchange, uxComparand ) portATOMIC_COMPARE_AND_SWAP_U32( ( puxDestination ), ( uxExchange ), ( uxComparand ) )
+	#endif
+#endif
+
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER 0
+#endif
+
+/* The trace recorder implements the trace macros, so must be included before
+the unused trace macros are removed. */
+#if( configUSE_TRACE_RECORDER == 1 )
+	#include "trace_recorder.h"
 #endif
 
 /* Remove any unused trace macros. */
@@ -506,6 +578,62 @@ extern "C" {
 	#define traceQUEUE_DELETE( pxQueue )
 #endif
 
+#ifndef traceQUEUE_LOAN
+	#define traceQUEUE_LOAN( pxQueue )
+#endif
+
+#ifndef traceQUEUE_LOAN_FAILED
+	#define traceQUEUE_LOAN_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_COMMIT
+	#define traceQUEUE_COMMIT( pxQueue )
+#endif
+
+#ifndef traceQUEUE_BORROW
+	#define traceQUEUE_BORROW( pxQueue )
+#endif
+
+#ifndef traceQUEUE_BORROW_FAILED
+	#define traceQUEUE_BORROW_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_RELEASE
+	#define traceQUEUE_RELEASE( pxQueue )
+#endif
+
+#ifndef traceQUEUE_SEND_MULTIPLE
+	#define traceQUEUE_SEND_MULTIPLE( pxQueue, uxCount )
+#endif
+
+#ifndef traceQUEUE_SEND_MULTIPLE_FAILED
+	#define traceQUEUE_SEND_MULTIPLE_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_SEND_MULTIPLE_FROM_ISR
+	#define traceQUEUE_SEND_MULTIPLE_FROM_ISR( pxQueue, uxCount )
+#endif
+
+#ifndef traceQUEUE_SEND_MULTIPLE_FROM_ISR_FAILED
+	#define traceQUEUE_SEND_MULTIPLE_FROM_ISR_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_MULTIPLE
+	#define traceQUEUE_RECEIVE_MULTIPLE( pxQueue, uxCount )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_MULTIPLE_FAILED
+	#define traceQUEUE_RECEIVE_MULTIPLE_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_MULTIPLE_FROM_ISR
+	#define traceQUEUE_RECEIVE_MULTIPLE_FROM_ISR( pxQueue, uxCount )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_MULTIPLE_FROM_ISR_FAILED
+	#define traceQUEUE_RECEIVE_MULTIPLE_FROM_ISR_FAILED( pxQueue )
+#endif
+
 #ifndef traceTASK_CREATE
 	#define traceTASK_CREATE( pxNewTCB )
 #endif
@@ -518,6 +646,18 @@ extern "C" {
 	#define traceTASK_DELETE( pxTaskToDelete )
 #endif
 
+#ifndef traceTASK_DEADLINE_MISSED
+	#define traceTASK_DEADLINE_MISSED( pxTCB )
+#endif
+
+#ifndef traceTASK_BUDGET_EXHAUSTED
+	#define traceTASK_BUDGET_EXHAUSTED( pxTCB )
+#endif
+
+#ifndef traceTASK_BUDGET_REPLENISHED
+	#define traceTASK_BUDGET_REPLENISHED( pxTCB )
+#endif
+
 #ifndef traceTASK_DELAY_UNTIL
 	#define traceTASK_DELAY_UNTIL( x )
 #endif
@@ -618,6 +758,58 @@ extern "C" {
 	#define traceEVENT_GROUP_DELETE( xEventGroup )
 #endif
 
+#ifndef traceSTREAM_BUFFER_CREATE
+	#define traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE_FAILED
+	#define traceSTREAM_BUFFER_CREATE_FAILED( xIsMessageBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE_STATIC_FAILED
+	#define traceSTREAM_BUFFER_CREATE_STATIC_FAILED( xReturn )
+#endif
+
+#ifndef traceSTREAM_BUFFER_DELETE
+	#define traceSTREAM_BUFFER_DELETE( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RESET
+	#define traceSTREAM_BUFFER_RESET( xStreamBuffer )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_SEND
+	#define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND
+	#define traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesSent )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND_FAILED
+	#define traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND_FROM_ISR
+	#define traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesSent )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_RECEIVE
+	#define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE
+	#define traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE_FAILED
+	#define traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE_FROM_ISR
+	#define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
+#endif
+
 #ifndef tracePEND_FUNC_CALL
 	#define tracePEND_FUNC_CALL(xFunctionToPend, pvParameter1, ulParameter2, ret)
 #endif
@@ -680,6 +872,27 @@ extern "C" {
 	#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
 #endif
 
+#ifndef configUSE_64_BIT_RUN_TIME_COUNTERS
+	#define configUSE_64_BIT_RUN_TIME_COUNTERS 0
+#endif
+
+#ifndef configGENERATE_ISR_RUN_TIME_STATS
+	#define configGENERATE_ISR_RUN_TIME_STATS 0
+#endif
+
+#if( ( configGENERATE_ISR_RUN_TIME_STATS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+	#error configGENERATE_ISR_RUN_TIME_STATS requires configGENERATE_RUN_TIME_STATS to be set to 1
+#endif
+
+/* The type used to accumulate run time statistics.  The port run time counter
+is extended to this width by the kernel, so a 32-bit hardware counter can be
+used with 64-bit run time counters. */
+#if( configUSE_64_BIT_RUN_TIME_COUNTERS == 1 )
+	typedef uint64_t RunTimeCounter_t;
+#else
+	typedef uint32_t RunTimeCounter_t;
+#endif
+
 #ifndef configUSE_MALLOC_FAILED_HOOK
 	#define configUSE_MALLOC_FAILED_HOOK 0
 #endif
@@ -688,10 +901,24 @@ extern "C" {
 	#define portPRIVILEGE_BIT ( ( UBaseType_t ) 0x00 )
 #endif
 
+#if( configNUMBER_OF_CORES > 1 )
+	/* A yield requested from inside a critical section cannot be performed
+	while the kernel locks are held, so the kernel records it and performs it
+	when the critical section is exited. */
+	#undef portYIELD_WITHIN_API
+	#define portYIELD_WITHIN_API vTaskYieldWithinAPI
+#endif
+
 #ifndef portYIELD_WITHIN_API
 	#define portYIELD_WITHIN_API portYIELD
 #endif
 
+#ifndef portMEMORY_BARRIER
+	/* Only needed by ports on which data written by one context may be
+	observed out of order by another, as is the case for the host simulator. */
+	#define portMEMORY_BARRIER()
+#endif
+
 #ifndef portSUPPRESS_TICKS_AND_SLEEP
 	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )
 #endif
@@ -708,6 +935,31 @@ extern "C" {
 	#define configUSE_TICKLESS_IDLE 0
 #endif
 
+/* The tick count the scheduler starts from.  Setting it a little below
+portMAX_DELAY makes the tick count overflow soon after the scheduler starts,
+which is useful for testing the handling of the overflow. */
+#ifndef configINITIAL_TICK_COUNT
+	#define configINITIAL_TICK_COUNT 0
+#endif
+
+#ifndef configUSE_TIMING_WHEEL_DELAYS
+	#define configUSE_TIMING_WHEEL_DELAYS 0
+#endif
+
+#ifndef configTIMING_WHEEL_SLOT_BITS
+	#define configTIMING_WHEEL_SLOT_BITS 4
+#endif
+
+#ifndef configUSE_TIMING_WHEEL_TIMERS
+	#define configUSE_TIMING_WHEEL_TIMERS 0
+#endif
+
+#if( ( configUSE_TIMING_WHEEL_DELAYS == 1 ) || ( configUSE_TIMING_WHEEL_TIMERS == 1 ) )
+	#if( ( configTIMING_WHEEL_SLOT_BITS < 1 ) || ( configTIMING_WHEEL_SLOT_BITS > 5 ) )
+		#error configTIMING_WHEEL_SLOT_BITS must be between 1 and 5 (2 to 32 slots per wheel level)
+	#endif
+#endif
+
 #ifndef configPRE_SLEEP_PROCESSING
 	#define configPRE_SLEEP_PROCESSING( x )
 #endif
@@ -720,6 +972,126 @@ extern "C" {
 	#define configUSE_QUEUE_SETS 0
 #endif
 
+#ifndef configUSE_QUEUE_LOANS
+	#define configUSE_QUEUE_LOANS 0
+#endif
+
+#ifndef configUSE_QUEUE_BATCHES
+	#define configUSE_QUEUE_BATCHES 0
+#endif
+
+#ifndef configUSE_QUEUE_HAND_OFF
+	#define configUSE_QUEUE_HAND_OFF 0
+#endif
+
+#ifndef configUSE_EVENT_GROUP_BIT_INDEX
+	#define configUSE_EVENT_GROUP_BIT_INDEX 0
+#endif
+
+#ifndef configUSE_EDF_SCHEDULING
+	#define configUSE_EDF_SCHEDULING 0
+#endif
+
+#ifndef configEDF_PRIORITY
+	#define configEDF_PRIORITY ( configMAX_PRIORITIES - 2 )
+#endif
+
+#ifndef configUSE_DEADLINE_MISS_HOOK
+	#define configUSE_DEADLINE_MISS_HOOK 0
+#endif
+
+#ifndef configUSE_TASK_BUDGETS
+	#define configUSE_TASK_BUDGETS 0
+#endif
+
+#ifndef configUSE_TASK_SNAPSHOTS
+	#define configUSE_TASK_SNAPSHOTS 0
+#endif
+
+#if( ( configUSE_TASK_SNAPSHOTS == 1 ) && ( configUSE_TRACE_FACILITY != 1 ) )
+	#error configUSE_TASK_SNAPSHOTS requires configUSE_TRACE_FACILITY to be set to 1
+#endif
+
+#ifndef configUSE_BINARY_TASK_STATS
+	#define configUSE_BINARY_TASK_STATS 0
+#endif
+
+#if( configUSE_BINARY_TASK_STATS == 1 )
+	#if( configUSE_TASK_SNAPSHOTS != 1 )
+		#error configUSE_BINARY_TASK_STATS requires configUSE_TASK_SNAPSHOTS to be set to 1
+	#endif
+
+	#if( configMAX_TASK_NAME_LEN > 236 )
+		#error configMAX_TASK_NAME_LEN must not exceed 236 when configUSE_BINARY_TASK_STATS is set to 1, as the length of a task record is stored in a byte
+	#endif
+#endif
+
+#ifndef configUSE_WAKE_LATENCY_STATS
+	#define configUSE_WAKE_LATENCY_STATS 0
+#endif
+
+#if( configUSE_WAKE_LATENCY_STATS == 1 )
+	#ifndef configWAKE_LATENCY_BUCKETS
+		#define configWAKE_LATENCY_BUCKETS 16
+	#endif
+
+	#if( ( configWAKE_LATENCY_BUCKETS < 2 ) || ( configWAKE_LATENCY_BUCKETS > 32 ) )
+		#error configWAKE_LATENCY_BUCKETS must be between 2 and 32
+	#endif
+
+	#ifndef configWAKE_LATENCY_TIMESTAMP
+		#ifdef portGET_RUN_TIME_COUNTER_VALUE
+			#define configWAKE_LATENCY_TIMESTAMP() portGET_RUN_TIME_COUNTER_VALUE()
+		#else
+			#error configWAKE_LATENCY_TIMESTAMP() must be defined when configUSE_WAKE_LATENCY_STATS is set to 1, unless portGET_RUN_TIME_COUNTER_VALUE() is defined
+		#endif
+	#endif
+#endif
+
+#ifndef configUSE_CRITICAL_PROFILER
+	#define configUSE_CRITICAL_PROFILER 0
+#endif
+
+#if( configUSE_CRITICAL_PROFILER == 1 )
+	#ifndef configCRITICAL_PROFILER_SITES
+		#define configCRITICAL_PROFILER_SITES 32
+	#endif
+
+	#if( ( configCRITICAL_PROFILER_SITES & ( configCRITICAL_PROFILER_SITES - 1 ) ) != 0 )
+		#error configCRITICAL_PROFILER_SITES must be a power of 2
+	#endif
+
+	#ifndef configCRITICAL_PROFILER_BUCKETS
+		#define configCRITICAL_PROFILER_BUCKETS 16
+	#endif
+
+	#if( ( configCRITICAL_PROFILER_BUCKETS < 2 ) || ( configCRITICAL_PROFILER_BUCKETS > 32 ) )
+		#error configCRITICAL_PROFILER_BUCKETS must be between 2 and 32
+	#endif
+
+	#ifndef configCRITICAL_PROFILER_TIMESTAMP
+		#ifdef portGET_RUN_TIME_COUNTER_VALUE
+			#define configCRITICAL_PROFILER_TIMESTAMP() portGET_RUN_TIME_COUNTER_VALUE()
+		#else
+			#error configCRITICAL_PROFILER_TIMESTAMP() must be defined when configUSE_CRITICAL_PROFILER is set to 1, unless portGET_RUN_TIME_COUNTER_VALUE() is defined
+		#endif
+	#endif
+
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		#error configUSE_CRITICAL_PROFILER cannot be used with the MPU wrappers
+	#endif
+#endif
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+	#if( configNUMBER_OF_CORES > 1 )
+		#error configUSE_EDF_SCHEDULING is only supported when configNUMBER_OF_CORES is 1
+	#endif
+
+	#if( ( configEDF_PRIORITY < 1 ) || ( configEDF_PRIORITY >= configMAX_PRIORITIES ) )
+		#error configEDF_PRIORITY must be above the idle priority and below configMAX_PRIORITIES
+	#endif
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
 	#define portTASK_USES_FLOATING_POINT()
 #endif
@@ -783,6 +1155,54 @@ extern "C" {
 #endif
 
 /* Sanity check the configuration. */
+#if( configNUMBER_OF_CORES > 1 )
+	#if( configNUMBER_OF_CORES > 32 )
+		#error configNUMBER_OF_CORES cannot exceed 32 as core affinity masks are held in a UBaseType_t
+	#endif
+
+	/* The SMP scheduler needs the port to identify the executing core, to
+	interrupt another core so it reschedules, and to provide two kernel
+	spinlocks.  The locks need not be recursive - the kernel tracks nesting. */
+	#ifndef portGET_CORE_ID
+		#error portGET_CORE_ID() must be defined by the port when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	#ifndef portYIELD_CORE
+		#error portYIELD_CORE( xCoreID ) must be defined by the port when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	#if !defined( portGET_TASK_LOCK ) || !defined( portRELEASE_TASK_LOCK ) || !defined( portGET_ISR_LOCK ) || !defined( portRELEASE_ISR_LOCK )
+		#error The port must define portGET_TASK_LOCK(), portRELEASE_TASK_LOCK(), portGET_ISR_LOCK() and portRELEASE_ISR_LOCK() when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	/* portSET_INTERRUPT_MASK() and portCLEAR_INTERRUPT_MASK() only mask the
+	interrupts of the calling core.  portSET_INTERRUPT_MASK_FROM_ISR() must map
+	to uxTaskEnterCriticalFromISR() so it also takes the kernel ISR lock. */
+	#if !defined( portSET_INTERRUPT_MASK ) || !defined( portCLEAR_INTERRUPT_MASK )
+		#error The port must define portSET_INTERRUPT_MASK() and portCLEAR_INTERRUPT_MASK() when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	#if( portCRITICAL_NESTING_IN_TCB != 1 )
+		#error portCRITICAL_NESTING_IN_TCB must be 1, and portENTER_CRITICAL()/portEXIT_CRITICAL() must map to vTaskEnterCritical()/vTaskExitCritical(), when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	#if( configUSE_PORT_OPTIMISED_TASK_SELECTION != 0 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION must be 0 when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	#if( configUSE_TICKLESS_IDLE != 0 )
+		#error configUSE_TICKLESS_IDLE must be 0 when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	#if( configUSE_NEWLIB_REENTRANT != 0 )
+		#error configUSE_NEWLIB_REENTRANT must be 0 when configNUMBER_OF_CORES is greater than 1 as newlib has a single _impure_ptr
+	#endif
+
+	#if( portUSING_MPU_WRAPPERS != 0 )
+		#error The MPU wrappers are not supported when configNUMBER_OF_CORES is greater than 1
+	#endif
+#endif /* configNUMBER_OF_CORES */
+
 #if( configUSE_TICKLESS_IDLE != 0 )
 	#if( INCLUDE_vTaskSuspend != 1 )
 		#error INCLUDE_vTaskSuspend must be set to 1 if configUSE_TICKLESS_IDLE is not set to 0
@@ -797,6 +1217,48 @@ extern "C" {
 	#error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
 
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_MUTEXES must be set to 1 to use priority ceiling mutexes
+#endif
+
+#if( configUSE_FAST_MUTEXES == 1 )
+	#if( configUSE_MUTEXES != 1 )
+		#error configUSE_MUTEXES must be set to 1 to use fast mutexes
+	#endif
+
+	#if( ( configNUMBER_OF_CORES > 1 ) && !defined( portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE ) )
+		#error configUSE_FAST_MUTEXES requires the port to define portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE(), or portATOMIC_COMPARE_AND_SWAP_U32() if pointers are 32 bits, when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		#error configUSE_FAST_MUTEXES cannot be used with the MPU wrappers
+	#endif
+#endif
+
+#if( configUSE_RW_LOCKS == 1 )
+	#if( configUSE_MUTEXES != 1 )
+		#error configUSE_MUTEXES must be set to 1 to use reader-writer locks
+	#endif
+
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		#error configUSE_RW_LOCKS cannot be used with the MPU wrappers
+	#endif
+#endif
+
+#if( configUSE_CONDITION_VARIABLES == 1 )
+	#if( configUSE_MUTEXES != 1 )
+		#error configUSE_MUTEXES must be set to 1 to use condition variables
+	#endif
+
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		#error configUSE_CONDITION_VARIABLES cannot be used with the MPU wrappers
+	#endif
+#endif
+
+#if( ( configUSE_MULTIPLE_OBJECT_WAITS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+	#error configUSE_MULTIPLE_OBJECT_WAITS cannot be used with the MPU wrappers
+#endif
+
 #if( portTICK_TYPE_IS_ATOMIC == 0 )
 	/* Either variables of tick type cannot be read atomically, or
 	portTICK_TYPE_IS_ATOMIC was not set - map the critical sections used when
@@ -928,6 +1390,7 @@ typedef struct xSTATIC_TCB
 	#endif
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t		uxDummy12[ 2 ];
+		void			*pvDummy38;
 	#endif
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
 		void			*pxDummy14;
@@ -936,7 +1399,7 @@ typedef struct xSTATIC_TCB
 		void			*pvDummy15[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
 	#endif
 	#if ( configGENERATE_RUN_TIME_STATS == 1 )
-		uint32_t		ulDummy16;
+		RunTimeCounter_t	ulDummy16;
 	#endif
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
 		struct	_reent	xDummy17;
@@ -945,6 +1408,43 @@ typedef struct xSTATIC_TCB
 		uint32_t 		ulDummy18;
 		uint8_t 		ucDummy19;
 	#endif
+	#if ( configUSE_QUEUE_HAND_OFF == 1 )
+		void			*pvDummy22;
+	#endif
+	#if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+		TickType_t		xDummy23;
+	#endif
+	#if( configUSE_EDF_SCHEDULING == 1 )
+		TickType_t		xDummy26[ 3 ];
+		BaseType_t		xDummy41;
+		UBaseType_t		uxDummy27;
+		uint8_t			ucDummy28;
+	#endif
+	#if( configUSE_TASK_BUDGETS == 1 )
+		TickType_t		xDummy29[ 4 ];
+		UBaseType_t		uxDummy30;
+	#endif
+	#if( configUSE_TASK_SNAPSHOTS == 1 )
+		StaticListItem_t	xDummy31;
+	#endif
+	#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+		void			*pvDummy39;
+		UBaseType_t		uxDummy40;
+	#endif
+	#if( configUSE_WAKE_LATENCY_STATS == 1 )
+		uint32_t		ulDummy32;
+		BaseType_t		xDummy33;
+		uint32_t		ulDummy34[ 2 + configWAKE_LATENCY_BUCKETS ];
+	#endif
+	#if( configUSE_CRITICAL_PROFILER == 1 )
+		UBaseType_t		uxDummy35[ 2 ];
+		uint32_t		ulDummy36;
+		const void		*pvDummy37;
+	#endif
+	#if( configNUMBER_OF_CORES > 1 )
+		BaseType_t		xDummy24;
+		UBaseType_t		uxDummy25;
+	#endif
 	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 		uint8_t			uxDummy20;
 	#endif
@@ -979,6 +1479,18 @@ typedef struct xSTATIC_QUEUE
 	UBaseType_t uxDummy4[ 3 ];
 	uint8_t ucDummy5[ 2 ];
 
+	#if( configUSE_WAKE_LATENCY_STATS == 1 )
+		uint8_t ucDummy12;
+	#endif
+
+	#if( configUSE_QUEUE_LOANS == 1 )
+		void *pvDummy10[ 2 ];
+	#endif
+
+	#if( configUSE_CEILING_MUTEXES == 1 )
+		UBaseType_t uxDummy11[ 2 ];
+	#endif
+
 	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 		uint8_t ucDummy6;
 	#endif
@@ -1014,6 +1526,15 @@ typedef struct xSTATIC_EVENT_GROUP
 	TickType_t xDummy1;
 	StaticList_t xDummy2;
 
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+		StaticList_t xDummy5[ ( sizeof( TickType_t ) * 8 ) - 8 ];
+		TickType_t xDummy6[ 2 ];
+	#endif
+
+	#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+		StaticList_t xDummy7;
+	#endif
+
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxDummy3;
 	#endif
@@ -1055,6 +1576,76 @@ typedef struct xSTATIC_TIMER
 
 } StaticTimer_t;
 
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the stream buffer structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create a stream buffer then the size of the stream buffer object needs to be
+ * known.  The StaticStreamBuffer_t structure below is provided for this
+ * purpose.  Its size and alignment requirements are guaranteed to match those
+ * of the genuine structure, no matter which architecture is being used, and no
+ * matter how the values in FreeRTOSConfig.h are set.  Its contents are somewhat
+ * obfuscated in the hope users will recognise that it would be unwise to make
+ * direct use of the structure members.
+ */
+typedef struct xSTATIC_STREAM_BUFFER
+{
+	size_t uxDummy1[ 4 ];
+	void * pvDummy2[ 3 ];
+	uint8_t ucDummy3;
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t uxDummy4;
+	#endif
+} StaticStreamBuffer_t;
+
+/* Message buffers are built on top of stream buffers. */
+typedef StaticStreamBuffer_t StaticMessageBuffer_t;
+
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real fast mutex structure is not accessible to the
+ * application.  The StaticFastMutex_t structure below is provided so the
+ * application writer can statically allocate the memory required to create a
+ * fast mutex.  Its size and alignment requirements are guaranteed to match
+ * those of the genuine structure, no matter which architecture is being used,
+ * and no matter how the values in FreeRTOSConfig.h are set.
+ */
+typedef struct xSTATIC_FAST_MUTEX
+{
+	portPOINTER_SIZE_TYPE uxDummy1;
+	StaticList_t xDummy2;
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy3;
+	#endif
+} StaticFastMutex_t;
+
+/* As for StaticFastMutex_t, the StaticRWLock_t structure below is provided so
+the application writer can statically allocate the memory required to create a
+reader-writer lock without access to the genuine structure. */
+typedef struct xSTATIC_RW_LOCK
+{
+	UBaseType_t uxDummy1[ 2 ];
+	void *pvDummy2;
+	StaticList_t xDummy3[ 2 ];
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy4;
+	#endif
+} StaticRWLock_t;
+
+/* As for StaticFastMutex_t, the StaticCondVar_t structure below is provided so
+the application writer can statically allocate the memory required to create a
+condition variable without access to the genuine structure. */
+typedef struct xSTATIC_CONDITION_VARIABLE
+{
+	StaticList_t xDummy1;
+	void *pvDummy2;
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy3;
+	#endif
+} StaticCondVar_t;
+
 #ifdef __cplusplus
 }
 #endif
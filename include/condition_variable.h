@@ -0,0 +1,296 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef CONDITION_VARIABLE_H
+#define CONDITION_VARIABLE_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include condition_variable.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+#include "semphr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A condition variable lets a task that holds a mutex wait for the data the
+ * mutex protects to reach some state, without holding the mutex while it
+ * waits.  xCondVarWait() gives the mutex back and blocks the calling task as
+ * one atomic operation, so a signal sent by a task that takes the mutex
+ * immediately afterwards cannot be missed, and takes the mutex back before
+ * returning.  Waiting tasks are held in priority order, so vCondVarSignal()
+ * unblocks the highest priority of them.
+ *
+ * Normally a task signals a condition variable while it holds the mutex, and
+ * a task unblocked by the signal would only block again straight away on the
+ * mutex.  Instead, if the mutex is held when the condition variable is
+ * signalled, the waiting task is moved directly onto the list of tasks waiting
+ * for the mutex without being unblocked.  The holder of the mutex inherits the
+ * priority of the moved task, just as it would had the task tried to take the
+ * mutex itself, and the task runs once, when the mutex is given back.
+ *
+ * As with any condition variable, a task can return from xCondVarWait() when
+ * the condition it waits for is not true - for example because another task
+ * took the mutex and changed the data first - so should test the condition in
+ * a loop.  The mutex must be one created by xSemaphoreCreateMutex() or
+ * xSemaphoreCreateMutexStatic(), and all the tasks waiting on a condition
+ * variable at any one time must use the same mutex.  Condition variables
+ * cannot be used from an interrupt.  configUSE_CONDITION_VARIABLES must be set
+ * to 1 in FreeRTOSConfig.h for the condition variable API to be available.
+ *
+ * \defgroup CondVar
+ */
+
+/**
+ * condition_variable.h
+ *
+ * Type by which condition variables are referenced.  For example, a call to
+ * xCondVarCreate() returns a CondVarHandle_t variable that can then be used as
+ * a parameter to xCondVarWait() and vCondVarSignal().
+ *
+ * \defgroup CondVarHandle_t CondVarHandle_t
+ * \ingroup CondVar
+ */
+typedef void * CondVarHandle_t;
+
+/**
+ * condition_variable.h
+ *<pre>
+ CondVarHandle_t xCondVarCreate( void );
+ </pre>
+ *
+ * Creates a new condition variable using dynamically allocated memory.  See
+ * xCondVarCreateStatic() for a version that uses statically allocated memory.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 or left undefined in
+ * FreeRTOSConfig.h for xCondVarCreate() to be available.
+ *
+ * @return If NULL is returned then the condition variable cannot be created
+ * because there is insufficient heap memory available for FreeRTOS to allocate
+ * its data structure.  A non-NULL value being returned indicates the condition
+ * variable has been created successfully.
+ *
+ * \defgroup xCondVarCreate xCondVarCreate
+ * \ingroup CondVar
+ */
+CondVarHandle_t xCondVarCreate( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ *<pre>
+ CondVarHandle_t xCondVarCreateStatic( StaticCondVar_t *pxCondVarBuffer );
+ </pre>
+ *
+ * Creates a new condition variable using statically allocated memory.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xCondVarCreateStatic() to be available.
+ *
+ * @param pxCondVarBuffer Must point to a variable of type StaticCondVar_t,
+ * which will be used to hold the condition variable's data structure.
+ *
+ * @return If the condition variable is created successfully then a handle to
+ * the created condition variable is returned.  If pxCondVarBuffer is NULL then
+ * NULL is returned.
+ *
+ * \defgroup xCondVarCreateStatic xCondVarCreateStatic
+ * \ingroup CondVar
+ */
+CondVarHandle_t xCondVarCreateStatic( StaticCondVar_t *pxCondVarBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ *<pre>
+ BaseType_t xCondVarWait( CondVarHandle_t xCondVar, SemaphoreHandle_t xMutex, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Gives back xMutex, which the calling task must hold, and blocks the calling
+ * task until the condition variable is signalled or xTicksToWait ticks pass.
+ * In both cases the mutex is taken back before the function returns, however
+ * long that takes.
+ *
+ * @param xCondVar The handle of the condition variable to wait on.
+ *
+ * @param xMutex The handle of the mutex that protects the condition being
+ * waited for.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should remain
+ * in the Blocked state to wait for the condition variable to be signalled.
+ * Setting xTicksToWait to portMAX_DELAY will cause the task to wait
+ * indefinitely (without timing out), provided INCLUDE_vTaskSuspend is set to 1
+ * in FreeRTOSConfig.h.  If xTicksToWait is 0 then the function returns pdFAIL
+ * immediately, without giving back the mutex.
+ *
+ * @return pdPASS if the condition variable was signalled, or pdFAIL if
+ * xTicksToWait expired first or the calling task could not give back the
+ * mutex.  A signal that arrives as the wait times out can be reported as a
+ * timeout.
+ *
+ * Example usage:
+   <pre>
+ SemaphoreHandle_t xMutex;
+ CondVarHandle_t xNotEmpty;
+ UBaseType_t uxItemsAvailable = 0;
+
+ void vAConsumerTask( void *pvParameters )
+ {
+     for( ;; )
+     {
+         xSemaphoreTake( xMutex, portMAX_DELAY );
+
+         while( uxItemsAvailable == 0 )
+         {
+             xCondVarWait( xNotEmpty, xMutex, portMAX_DELAY );
+         }
+
+         uxItemsAvailable--;
+         xSemaphoreGive( xMutex );
+     }
+ }
+
+ void vAProducerTask( void *pvParameters )
+ {
+     for( ;; )
+     {
+         xSemaphoreTake( xMutex, portMAX_DELAY );
+         uxItemsAvailable++;
+         vCondVarSignal( xNotEmpty );
+         xSemaphoreGive( xMutex );
+     }
+ }
+   </pre>
+ * \defgroup xCondVarWait xCondVarWait
+ * \ingroup CondVar
+ */
+BaseType_t xCondVarWait( CondVarHandle_t xCondVar, SemaphoreHandle_t xMutex, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ *<pre>
+ void vCondVarSignal( CondVarHandle_t xCondVar );
+ </pre>
+ *
+ * Unblocks the highest priority task waiting on the condition variable, if
+ * any.  The calling task need not hold the mutex used with the condition
+ * variable, but usually should, as otherwise a task that is about to wait can
+ * miss the signal.
+ *
+ * @param xCondVar The handle of the condition variable to signal.
+ *
+ * \defgroup vCondVarSignal vCondVarSignal
+ * \ingroup CondVar
+ */
+void vCondVarSignal( CondVarHandle_t xCondVar ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ *<pre>
+ void vCondVarBroadcast( CondVarHandle_t xCondVar );
+ </pre>
+ *
+ * Unblocks every task waiting on the condition variable.  As with
+ * vCondVarSignal(), waiting tasks are moved directly onto the list of tasks
+ * waiting for the mutex while the mutex is held, so they take the mutex one at
+ * a time, in priority order, without being unblocked in between.
+ *
+ * @param xCondVar The handle of the condition variable to broadcast.
+ *
+ * \defgroup vCondVarBroadcast vCondVarBroadcast
+ * \ingroup CondVar
+ */
+void vCondVarBroadcast( CondVarHandle_t xCondVar ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ *<pre>
+ void vCondVarDelete( CondVarHandle_t xCondVar );
+ </pre>
+ *
+ * Deletes a condition variable that was previously created using a call to
+ * xCondVarCreate() or xCondVarCreateStatic().  If the condition variable was
+ * created using dynamic memory then the allocated memory is freed.  No task
+ * may be waiting on the condition variable when it is deleted.
+ *
+ * @param xCondVar The handle of the condition variable to be deleted.
+ *
+ * \defgroup vCondVarDelete vCondVarDelete
+ * \ingroup CondVar
+ */
+void vCondVarDelete( CondVarHandle_t xCondVar ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !defined( CONDITION_VARIABLE_H ) */
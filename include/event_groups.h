@@ -783,6 +783,13 @@ void vEventGroupDelete( EventGroupHandle_t xEventGroup ) PRIVILEGED_FUNCTION;
 void vEventGroupSetBitsCallback( void *pvEventGroup, const uint32_t ulBitsToSet ) PRIVILEGED_FUNCTION;
 void vEventGroupClearBitsCallback( void *pvEventGroup, const uint32_t ulBitsToClear ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+	/* For internal use only.  Used by xWaitForMultipleObjects() to add a wait
+	record to the event group, unless the wait condition is already met - in
+	which case pdTRUE is returned and the record is not added. */
+	BaseType_t xEventGroupAddMultipleObjectWait( EventGroupHandle_t xEventGroup, ListItem_t * const pxWaitListItem, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
+#endif
+
 
 #if (configUSE_TRACE_FACILITY == 1)
 	UBaseType_t uxEventGroupGetNumber( void* xEventGroup ) PRIVILEGED_FUNCTION;
@@ -0,0 +1,282 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef FAST_MUTEX_H
+#define FAST_MUTEX_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include fast_mutex.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A fast mutex provides the same mutual exclusion and priority inheritance as
+ * a mutex created with xSemaphoreCreateMutex(), but is taken and given back
+ * without entering a critical section while no other task wants it.
+ *
+ * The state of a fast mutex is held in a single word that is either empty, or
+ * holds the handle of the holding task and a flag that is set while tasks are
+ * waiting.  A task that finds the mutex unlocked takes it by writing its own
+ * handle to the word using one atomic compare and swap operation, and a task
+ * that gives back a mutex no other task has waited for empties the word again
+ * the same way.  Only a task that finds the mutex locked enters the kernel -
+ * it marks the word as having tasks waiting, raises the priority of the holder
+ * named in the word to its own as a mutex would, and blocks.  The holder then
+ * finds the word marked when it gives the mutex back, so also enters the
+ * kernel to unblock the highest priority waiting task and drop any priority it
+ * inherited.
+ *
+ * Priority inheritance through a fast mutex is not transitive.  Only the holder
+ * of the fast mutex inherits the priority of the tasks waiting for it, even if
+ * the holder is itself blocked on another mutex, and a task blocked on a fast
+ * mutex ends the chain of holders that configPRIORITY_INHERITANCE_DEPTH follows
+ * through mutexes created with xSemaphoreCreateMutex().
+ *
+ * The port should define portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE(), or
+ * portATOMIC_COMPARE_AND_SWAP_U32() if pointers are 32 bits.  If it does not
+ * then, on a single core, the compare and swap is performed with interrupts
+ * masked, which is still cheaper than a critical section on most ports.
+ *
+ * Fast mutexes cannot be used from an interrupt, and a fast mutex must be given
+ * back by the task that took it.  configUSE_FAST_MUTEXES must be set to 1 in
+ * FreeRTOSConfig.h for the fast mutex API to be available.
+ *
+ * \defgroup FastMutex
+ */
+
+/**
+ * fast_mutex.h
+ *
+ * Type by which fast mutexes are referenced.  For example, a call to
+ * xFastMutexCreate() returns a FastMutexHandle_t variable that can then be
+ * used as a parameter to xFastMutexLock() and xFastMutexUnlock().
+ *
+ * \defgroup FastMutexHandle_t FastMutexHandle_t
+ * \ingroup FastMutex
+ */
+typedef void * FastMutexHandle_t;
+
+/**
+ * fast_mutex.h
+ *<pre>
+ FastMutexHandle_t xFastMutexCreate( void );
+ </pre>
+ *
+ * Creates a new fast mutex using dynamically allocated memory.  See
+ * xFastMutexCreateStatic() for a version that uses statically allocated memory.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 or left undefined in
+ * FreeRTOSConfig.h for xFastMutexCreate() to be available.
+ *
+ * @return If NULL is returned then the fast mutex cannot be created because
+ * there is insufficient heap memory available for FreeRTOS to allocate its
+ * data structure.  A non-NULL value being returned indicates the mutex has been
+ * created successfully, and is not held by any task.
+ *
+ * \defgroup xFastMutexCreate xFastMutexCreate
+ * \ingroup FastMutex
+ */
+FastMutexHandle_t xFastMutexCreate( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_mutex.h
+ *<pre>
+ FastMutexHandle_t xFastMutexCreateStatic( StaticFastMutex_t *pxFastMutexBuffer );
+ </pre>
+ *
+ * Creates a new fast mutex using statically allocated memory.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xFastMutexCreateStatic() to be available.
+ *
+ * @param pxFastMutexBuffer Must point to a variable of type StaticFastMutex_t,
+ * which will be used to hold the fast mutex's data structure.
+ *
+ * @return If the fast mutex is created successfully then a handle to the
+ * created mutex is returned.  If pxFastMutexBuffer is NULL then NULL is
+ * returned.
+ *
+ * \defgroup xFastMutexCreateStatic xFastMutexCreateStatic
+ * \ingroup FastMutex
+ */
+FastMutexHandle_t xFastMutexCreateStatic( StaticFastMutex_t *pxFastMutexBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_mutex.h
+ *<pre>
+ BaseType_t xFastMutexLock( FastMutexHandle_t xFastMutex, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Takes a fast mutex, blocking for up to xTicksToWait ticks if it is held by
+ * another task.  While the calling task is blocked the holder runs at no less
+ * than the priority of the calling task.
+ *
+ * A fast mutex is not recursive - the holder must not attempt to take it again
+ * before giving it back.
+ *
+ * @param xFastMutex The handle of the fast mutex to take.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should remain
+ * in the Blocked state to wait for the mutex to become available.  Setting
+ * xTicksToWait to portMAX_DELAY will cause the task to wait indefinitely
+ * (without timing out), provided INCLUDE_vTaskSuspend is set to 1 in
+ * FreeRTOSConfig.h.
+ *
+ * @return pdPASS if the mutex was taken, or pdFAIL if xTicksToWait expired
+ * before the mutex became available.
+ *
+ * Example usage:
+   <pre>
+ FastMutexHandle_t xFastMutex;
+
+ void vATask( void *pvParameters )
+ {
+     xFastMutex = xFastMutexCreate();
+     configASSERT( xFastMutex );
+
+     for( ;; )
+     {
+         if( xFastMutexLock( xFastMutex, portMAX_DELAY ) == pdPASS )
+         {
+             // Access the shared resource here, then give the mutex back.
+             xFastMutexUnlock( xFastMutex );
+         }
+     }
+ }
+   </pre>
+ * \defgroup xFastMutexLock xFastMutexLock
+ * \ingroup FastMutex
+ */
+BaseType_t xFastMutexLock( FastMutexHandle_t xFastMutex, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_mutex.h
+ *<pre>
+ BaseType_t xFastMutexUnlock( FastMutexHandle_t xFastMutex );
+ </pre>
+ *
+ * Gives back a fast mutex previously taken using xFastMutexLock().
+ *
+ * @param xFastMutex The handle of the fast mutex to give back.
+ *
+ * @return pdPASS if the mutex was given back, or pdFAIL if the calling task
+ * was not the holder of the mutex.
+ *
+ * \defgroup xFastMutexUnlock xFastMutexUnlock
+ * \ingroup FastMutex
+ */
+BaseType_t xFastMutexUnlock( FastMutexHandle_t xFastMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_mutex.h
+ *<pre>
+ TaskHandle_t xFastMutexGetHolder( FastMutexHandle_t xFastMutex );
+ </pre>
+ *
+ * Returns the handle of the task that holds the fast mutex, or NULL if the
+ * mutex is not held.  As with xSemaphoreGetMutexHolder(), this is a good way of
+ * determining whether the calling task is the holder, but not a good way of
+ * determining the identity of the holder, as the holder may change between the
+ * function exiting and the returned value being tested.
+ *
+ * \defgroup xFastMutexGetHolder xFastMutexGetHolder
+ * \ingroup FastMutex
+ */
+TaskHandle_t xFastMutexGetHolder( FastMutexHandle_t xFastMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_mutex.h
+ *<pre>
+ void vFastMutexDelete( FastMutexHandle_t xFastMutex );
+ </pre>
+ *
+ * Deletes a fast mutex that was previously created using a call to
+ * xFastMutexCreate() or xFastMutexCreateStatic().  If the mutex was created
+ * using dynamic memory then the allocated memory is freed.  The mutex must not
+ * be held, or waited for, when it is deleted.
+ *
+ * @param xFastMutex The handle of the fast mutex to be deleted.
+ *
+ * \defgroup vFastMutexDelete vFastMutexDelete
+ * \ingroup FastMutex
+ */
+void vFastMutexDelete( FastMutexHandle_t xFastMutex ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !defined( FAST_MUTEX_H ) */
@@ -0,0 +1,240 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef MULTI_WAIT_H
+#define MULTI_WAIT_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include multi_wait.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+#include "queue.h"
+#include "event_groups.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * xWaitForMultipleObjects() blocks the calling task until any one of several
+ * objects - queues, semaphores, event group bits and the task's own
+ * notification, in any mix - is ready, or a timeout expires.  Unlike a queue
+ * set it costs nothing when the objects are used in the normal way: instead of
+ * each queue posting its handle to a set as every item is sent, the waiting
+ * task links a wait record into the list of tasks waiting on each object, and
+ * an object only finds the record when it would otherwise have unblocked a
+ * task waiting on it directly.
+ *
+ * xWaitForMultipleObjects() reports which object is ready without receiving
+ * from it, taking it, clearing its bits or clearing the notification.  The task
+ * then reads the object using the normal API function with a block time of 0.
+ * As with a queue set, if another task reads the object first then that call
+ * will fail, so the result should be checked.  Objects must not be deleted
+ * while a task is waiting for them, and mutexes cannot be waited for.  A
+ * waiting task can be deleted, and its priority can change while it waits, in
+ * which case it keeps its place among the tasks waiting on each queue in the
+ * same way as a task waiting on the queue directly.
+ * event_groups.c must be built when configUSE_MULTIPLE_OBJECT_WAITS is set to 1
+ * in FreeRTOSConfig.h, which is required for the API to be available.
+ *
+ * \defgroup MultiWait
+ */
+
+/**
+ * multi_wait.h
+ *
+ * The type of an object described by a WaitObject_t structure.
+ *
+ * \ingroup MultiWait
+ */
+typedef enum
+{
+	eWaitForQueue = 0,		/* Ready while a queue holds an item, or a semaphore other than a mutex is available. */
+	eWaitForEventBits,		/* Ready while the bits in uxBitsToWaitFor are set in an event group. */
+	eWaitForNotification	/* Ready while the calling task has a notification pending.  Requires configUSE_TASK_NOTIFICATIONS. */
+} eWaitObjectType;
+
+/**
+ * multi_wait.h
+ *
+ * Describes one of the objects passed to xWaitForMultipleObjects().  The
+ * calling task sets eType, pvObject and, for event groups, uxBitsToWaitFor and
+ * xWaitForAllBits.  xWaitListItem is the wait record and is only used by the
+ * kernel, while the task is in xWaitForMultipleObjects().
+ *
+ * \ingroup MultiWait
+ */
+typedef struct xWAIT_OBJECT
+{
+	eWaitObjectType eType;			/*< The type of the object. */
+	void *pvObject;					/*< The QueueHandle_t, SemaphoreHandle_t or EventGroupHandle_t of the object.  Not used for notifications. */
+	EventBits_t uxBitsToWaitFor;	/*< The event group bits to wait for.  Only used for event groups. */
+	BaseType_t xWaitForAllBits;		/*< pdTRUE to wait for all of uxBitsToWaitFor, pdFALSE to wait for any of them.  Only used for event groups. */
+	ListItem_t xWaitListItem;		/*< Used by the kernel. */
+} WaitObject_t;
+
+/* The value returned by xWaitForMultipleObjects() when none of the objects
+became ready before the timeout expired. */
+#define waitTIMED_OUT	( ( BaseType_t ) -1 )
+
+/**
+ * multi_wait.h
+ *<pre>
+ BaseType_t xWaitForMultipleObjects( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Blocks the calling task until at least one of the objects described by
+ * pxObjects is ready, or xTicksToWait ticks pass.  Must not be called from an
+ * interrupt.
+ *
+ * @param pxObjects An array of uxObjectCount WaitObject_t structures that
+ * describe the objects to wait for.  Where more than one object is ready, the
+ * one that appears first in the array is reported.
+ *
+ * @param uxObjectCount The number of objects in pxObjects.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should remain
+ * in the Blocked state to wait for one of the objects to become ready.  Setting
+ * xTicksToWait to portMAX_DELAY will cause the task to wait indefinitely
+ * (without timing out), provided INCLUDE_vTaskSuspend is set to 1 in
+ * FreeRTOSConfig.h.  If xTicksToWait is 0 then the objects are only tested.
+ *
+ * @return The index within pxObjects of the object that is ready, or
+ * waitTIMED_OUT if none of the objects became ready in time.
+ *
+ * Example usage:
+   <pre>
+ QueueHandle_t xCommandQueue;
+ EventGroupHandle_t xEvents;
+
+ void vATask( void *pvParameters )
+ {
+ WaitObject_t xObjects[ 3 ];
+ Command_t xCommand;
+
+     xObjects[ 0 ].eType = eWaitForQueue;
+     xObjects[ 0 ].pvObject = xCommandQueue;
+     xObjects[ 1 ].eType = eWaitForEventBits;
+     xObjects[ 1 ].pvObject = xEvents;
+     xObjects[ 1 ].uxBitsToWaitFor = BIT_0 | BIT_1;
+     xObjects[ 1 ].xWaitForAllBits = pdFALSE;
+     xObjects[ 2 ].eType = eWaitForNotification;
+
+     for( ;; )
+     {
+         switch( xWaitForMultipleObjects( xObjects, 3, portMAX_DELAY ) )
+         {
+             case 0:
+                 if( xQueueReceive( xCommandQueue, &xCommand, 0 ) == pdPASS )
+                 {
+                     // Process the command.
+                 }
+                 break;
+
+             case 1:
+                 // Process the bits returned by xEventGroupClearBits().
+                 break;
+
+             case 2:
+                 // Process the value returned by ulTaskNotifyTake( pdTRUE, 0 ).
+                 break;
+         }
+     }
+ }
+   </pre>
+ * \defgroup xWaitForMultipleObjects xWaitForMultipleObjects
+ * \ingroup MultiWait
+ */
+BaseType_t xWaitForMultipleObjects( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THESE FUNCTIONS MUST BE CALLED FROM A CRITICAL SECTION.
+ *
+ * Called by tasks.c for a task that is blocked in xWaitForMultipleObjects(),
+ * with the objects the task is waiting for.
+ * vMultipleObjectWaitRemoveRecords() removes the task's wait records from the
+ * objects when the task is deleted, as the records are held on the task's
+ * stack.  vMultipleObjectWaitReorderRecords() moves the records held in
+ * queues to the position for xItemValue, the new value of the task's event
+ * list item.
+ */
+void vMultipleObjectWaitRemoveRecords( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount ) PRIVILEGED_FUNCTION;
+void vMultipleObjectWaitReorderRecords( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount, const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !defined( MULTI_WAIT_H ) */
@@ -113,6 +113,7 @@ typedef void * QueueSetMemberHandle_t;
 #define queueQUEUE_TYPE_COUNTING_SEMAPHORE	( ( uint8_t ) 2U )
 #define queueQUEUE_TYPE_BINARY_SEMAPHORE	( ( uint8_t ) 3U )
 #define queueQUEUE_TYPE_RECURSIVE_MUTEX		( ( uint8_t ) 4U )
+#define queueQUEUE_TYPE_CEILING_MUTEX		( ( uint8_t ) 5U )
 
 /**
  * queue. h
@@ -1012,6 +1013,368 @@ BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue, void * const pvBuffer ) PRIV
  */
 BaseType_t xQueueGenericReceive( QueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait, const BaseType_t xJustPeek ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueLoanSlot(
+							   QueueHandle_t xQueue,
+							   void **ppvSlot,
+							   TickType_t xTicksToWait
+						   );
+ * </pre>
+ *
+ * Loan the caller the next free slot in the queue's storage area so an item
+ * can be written in place, rather than being built in a local variable and
+ * then copied into the queue.  The item is not visible to receivers until the
+ * slot is passed to xQueueCommitSlot(), at which point it is placed at the
+ * back of the queue.
+ *
+ * Only one slot can be on loan at a time, and no other item can be sent to the
+ * queue while a slot is on loan - other senders (including those using
+ * xQueueLoanSlot()) behave as if the queue were full until the slot is
+ * committed.  Loaned slots should therefore be committed promptly.
+ *
+ * configUSE_QUEUE_LOANS must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.  This function must not be called from an interrupt service
+ * routine, and cannot be used with semaphores or mutexes.
+ *
+ * @param xQueue The handle to the queue from which the slot is to be loaned.
+ *
+ * @param ppvSlot Set to point to the loaned slot if the call succeeds.  The
+ * slot is uxItemSize bytes long, and is aligned as the queue storage area is.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for a slot to become available, exactly as for xQueueSend().
+ *
+ * @return pdPASS if a slot was loaned, otherwise errQUEUE_FULL.
+ *
+ * Example usage:
+   <pre>
+ struct ASensorRecord
+ {
+	uint32_t ulTimeStamp;
+	uint8_t ucSamples[ 252 ];
+ };
+
+ void vAProducerTask( void *pvParameters )
+ {
+ struct ASensorRecord *pxRecord;
+
+	for( ;; )
+	{
+		// Obtain a slot in the queue and fill it in place.
+		if( xQueueLoanSlot( xQueue, ( void ** ) &pxRecord, portMAX_DELAY ) == pdPASS )
+		{
+			pxRecord->ulTimeStamp = xTaskGetTickCount();
+			vReadSamples( pxRecord->ucSamples );
+
+			// Make the record available to the receiving task.
+			xQueueCommitSlot( xQueue, pxRecord );
+		}
+	}
+ }
+   </pre>
+ * \defgroup xQueueLoanSlot xQueueLoanSlot
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueLoanSlot( QueueHandle_t xQueue, void ** const ppvSlot, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueCommitSlot(
+								 QueueHandle_t xQueue,
+								 void *pvSlot
+							 );
+ * </pre>
+ *
+ * Place the item that has been written into a slot obtained from
+ * xQueueLoanSlot() at the back of the queue.  A task that is blocked waiting
+ * to receive from the queue is unblocked exactly as if the item had been sent
+ * using xQueueSend().
+ *
+ * @param xQueue The handle to the queue from which the slot was loaned.
+ *
+ * @param pvSlot The slot returned by xQueueLoanSlot().
+ *
+ * @return pdPASS.
+ *
+ * \defgroup xQueueCommitSlot xQueueCommitSlot
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueCommitSlot( QueueHandle_t xQueue, void * const pvSlot ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueBorrowSlot(
+								 QueueHandle_t xQueue,
+								 void **ppvSlot,
+								 TickType_t xTicksToWait
+							 );
+ * </pre>
+ *
+ * Remove the item at the head of the queue, but rather than copying it into a
+ * buffer provided by the caller, give the caller a pointer to the slot in the
+ * queue's storage area that holds it.  The slot is not reused until it is
+ * passed to xQueueReleaseSlot().
+ *
+ * Only one slot can be borrowed at a time - other tasks that try to borrow or
+ * receive an item block until it is released, and xQueueReceiveFromISR() fails,
+ * although items can still be peeked.  While a slot is borrowed it does not
+ * count as free space, and items cannot be sent to the front of the queue or
+ * overwritten, so borrowed slots should be released promptly.
+ *
+ * configUSE_QUEUE_LOANS must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.  This function must not be called from an interrupt service
+ * routine, and cannot be used with semaphores or mutexes.
+ *
+ * @param xQueue The handle to the queue from which the item is to be borrowed.
+ *
+ * @param ppvSlot Set to point to the slot holding the item if the call
+ * succeeds.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for an item to become available, exactly as for xQueueReceive().
+ *
+ * @return pdPASS if an item was borrowed, otherwise errQUEUE_EMPTY.
+ *
+ * Example usage:
+   <pre>
+ void vAConsumerTask( void *pvParameters )
+ {
+ struct ASensorRecord *pxRecord;
+
+	for( ;; )
+	{
+		if( xQueueBorrowSlot( xQueue, ( void ** ) &pxRecord, portMAX_DELAY ) == pdPASS )
+		{
+			// Process the record where it is, then give the slot back.
+			vProcessRecord( pxRecord );
+			xQueueReleaseSlot( xQueue, pxRecord );
+		}
+	}
+ }
+   </pre>
+ * \defgroup xQueueBorrowSlot xQueueBorrowSlot
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueBorrowSlot( QueueHandle_t xQueue, void ** const ppvSlot, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReleaseSlot(
+								  QueueHandle_t xQueue,
+								  void *pvSlot
+							  );
+ * </pre>
+ *
+ * Return a slot obtained from xQueueBorrowSlot() to the queue.  A task that is
+ * blocked waiting to send to the queue is unblocked exactly as if the item had
+ * been received using xQueueReceive().
+ *
+ * @param xQueue The handle to the queue from which the slot was borrowed.
+ *
+ * @param pvSlot The slot returned by xQueueBorrowSlot().
+ *
+ * @return pdPASS.
+ *
+ * \defgroup xQueueReleaseSlot xQueueReleaseSlot
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReleaseSlot( QueueHandle_t xQueue, void * const pvSlot ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ size_t xQueueSendMultiple(
+							   QueueHandle_t xQueue,
+							   const void *pvItems,
+							   size_t xItemCount,
+							   TickType_t xTicksToWait
+						   );
+ * </pre>
+ *
+ * Post up to xItemCount items, held one after another in pvItems, to the back
+ * of a queue.  The items are copied in a single critical section, and tasks
+ * that are blocked waiting for data are unblocked - with at most one context
+ * switch - once the whole batch is in the queue, rather than once per item.
+ *
+ * If there is not room for all the items then as many as fit are sent.  The
+ * calling task only blocks if the queue is full, and stops waiting as soon as
+ * at least one item can be sent.
+ *
+ * configUSE_QUEUE_BATCHES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  This function must not be called from an
+ * interrupt service routine - see xQueueSendMultipleFromISR(), and cannot be
+ * used with semaphores or mutexes.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to the first of the items to be placed on the
+ * queue.  The items must be contiguous, each being the size the queue was
+ * defined to hold.
+ *
+ * @param xItemCount The number of items in pvItems.  Must be at least 1.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for space to become available on the queue, exactly as for xQueueSend().
+ *
+ * @return The number of items that were posted, which is 0 if the queue
+ * remained full for the whole of the block time.
+ *
+ * Example usage:
+   <pre>
+ void vAProducerTask( void *pvParameters )
+ {
+ uint16_t usSamples[ 32 ];
+ size_t xSent;
+
+	for( ;; )
+	{
+		vReadSamples( usSamples, 32 );
+
+		// Send the samples in as few calls as possible.
+		for( xSent = 0; xSent < 32; )
+		{
+			xSent += xQueueSendMultiple( xQueue, &( usSamples[ xSent ] ), 32 - xSent, portMAX_DELAY );
+		}
+	}
+ }
+   </pre>
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+size_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, size_t xItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ size_t xQueueSendMultipleFromISR(
+									  QueueHandle_t xQueue,
+									  const void *pvItems,
+									  size_t xItemCount,
+									  BaseType_t *pxHigherPriorityTaskWoken
+								  );
+ * </pre>
+ *
+ * A version of xQueueSendMultiple() that can be called from an interrupt
+ * service routine.  As many of the items as fit are posted without blocking.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to the first of the contiguous items to post.
+ *
+ * @param xItemCount The number of items in pvItems.  Must be at least 1.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if posting the items
+ * unblocked a task that has a priority above the currently running task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @return The number of items that were posted.
+ *
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+size_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItems, size_t xItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ size_t xQueueReceiveMultiple(
+								  QueueHandle_t xQueue,
+								  void *pvBuffer,
+								  size_t xBufferItems,
+								  TickType_t xTicksToWait
+							  );
+ * </pre>
+ *
+ * Receive up to xBufferItems items from the front of a queue into pvBuffer.
+ * The items are copied in a single critical section, and tasks that are
+ * blocked waiting for space are unblocked - with at most one context switch -
+ * once the whole batch has been removed, rather than once per item.
+ *
+ * The calling task only blocks if the queue is empty, and stops waiting as soon
+ * as at least one item is available.
+ *
+ * configUSE_QUEUE_BATCHES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  This function must not be called from an
+ * interrupt service routine - see xQueueReceiveMultipleFromISR(), and cannot
+ * be used with semaphores or mutexes.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will be
+ * copied, one after another.
+ *
+ * @param xBufferItems The number of items pvBuffer can hold.  Must be at
+ * least 1.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for an item to receive, exactly as for xQueueReceive().
+ *
+ * @return The number of items that were received, which is 0 if the queue
+ * remained empty for the whole of the block time.
+ *
+ * Example usage:
+   <pre>
+ void vAConsumerTask( void *pvParameters )
+ {
+ uint16_t usSamples[ 32 ];
+ size_t xReceived;
+
+	for( ;; )
+	{
+		// Drain everything that is waiting in one call.
+		xReceived = xQueueReceiveMultiple( xQueue, usSamples, 32, portMAX_DELAY );
+		vProcessSamples( usSamples, xReceived );
+	}
+ }
+   </pre>
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+size_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, size_t xBufferItems, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ size_t xQueueReceiveMultipleFromISR(
+										 QueueHandle_t xQueue,
+										 void *pvBuffer,
+										 size_t xBufferItems,
+										 BaseType_t *pxHigherPriorityTaskWoken
+									 );
+ * </pre>
+ *
+ * A version of xQueueReceiveMultiple() that can be called from an interrupt
+ * service routine.  As many items as are available, up to xBufferItems, are
+ * received without blocking.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will be
+ * copied, one after another.
+ *
+ * @param xBufferItems The number of items pvBuffer can hold.  Must be at
+ * least 1.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if removing the items
+ * unblocked a task that has a priority above the currently running task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @return The number of items that were received.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+size_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, size_t xBufferItems, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * queue. h
  * <pre>UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue );</pre>
@@ -1558,6 +1921,8 @@ BaseType_t xQueueCRReceive( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTi
  */
 QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateCeilingMutex( const UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateCeilingMutexStatic( const UBaseType_t uxCeilingPriority, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 void* xQueueGetMutexHolder( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
@@ -1569,6 +1934,26 @@ void* xQueueGetMutexHolder( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
 BaseType_t xQueueTakeMutexRecursive( QueueHandle_t xMutex, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 BaseType_t xQueueGiveMutexRecursive( QueueHandle_t pxMutex ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Called by the condition variable implementation from
+ * a critical section.  If xMutex is held, moves the highest priority task
+ * waiting on pxEventList, which must not be empty, onto the list of tasks
+ * waiting for the mutex, and returns pdTRUE.  Returns pdFALSE, and moves
+ * nothing, if the mutex is not held.  List_t is declared in list.h, which this
+ * header does not include.
+ */
+struct xLIST;
+BaseType_t xQueueMoveWaitingTaskToMutex( QueueHandle_t xMutex, const struct xLIST * const pxEventList ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Called by xWaitForMultipleObjects() from a critical
+ * section.  Returns pdTRUE if the queue or semaphore, which must not be a
+ * mutex, is not empty.  Otherwise adds the wait record pxWaitListItem to the
+ * list of tasks waiting to receive from the queue and returns pdFALSE.
+ */
+struct xLIST_ITEM;
+BaseType_t xQueueAddMultipleObjectWait( QueueHandle_t xQueue, struct xLIST_ITEM * const pxWaitListItem ) PRIVILEGED_FUNCTION;
+
 /*
  * Reset a queue back to its original empty state.  The return value is now
  * obsolete and is always set to pdPASS.
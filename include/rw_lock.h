@@ -0,0 +1,310 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef RW_LOCK_H
+#define RW_LOCK_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include rw_lock.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A reader-writer lock protects data that is read far more often than it is
+ * written.  Any number of tasks can hold the lock for reading at the same time,
+ * whereas a task that holds the lock for writing excludes all other readers and
+ * writers.  Tasks that are unable to take the lock block on one of two event
+ * lists - one for readers and one for writers - in the same way a task blocks
+ * on a queue, so the lock supports timeouts and wakes waiting tasks in priority
+ * order.
+ *
+ * Writers are preferred.  Once a task is waiting to write, tasks that ask to
+ * read block until the writer has taken and given back the lock, even if the
+ * lock is currently held by other readers, so a steady stream of readers cannot
+ * starve a writer.  When a writer gives the lock back the highest priority
+ * waiting writer is unblocked if there is one, otherwise every waiting reader is
+ * unblocked at once.
+ *
+ * A task that holds the lock for writing inherits the priority of higher
+ * priority tasks that block waiting for the lock, exactly as the holder of a
+ * mutex does.  Tasks that hold the lock for reading are not tracked
+ * individually, so do not inherit priority.
+ *
+ * The lock is not recursive.  In particular, a task that holds the lock for
+ * reading must not ask to read again, as it will deadlock if a writer starts
+ * waiting in between.  Reader-writer locks cannot be used from an interrupt.
+ * configUSE_RW_LOCKS must be set to 1 in FreeRTOSConfig.h for the
+ * reader-writer lock API to be available.
+ *
+ * \defgroup RWLock
+ */
+
+/**
+ * rw_lock.h
+ *
+ * Type by which reader-writer locks are referenced.  For example, a call to
+ * xRWLockCreate() returns an RWLockHandle_t variable that can then be used as a
+ * parameter to xRWLockReadLock() and xRWLockWriteLock().
+ *
+ * \defgroup RWLockHandle_t RWLockHandle_t
+ * \ingroup RWLock
+ */
+typedef void * RWLockHandle_t;
+
+/**
+ * rw_lock.h
+ *<pre>
+ RWLockHandle_t xRWLockCreate( void );
+ </pre>
+ *
+ * Creates a new reader-writer lock using dynamically allocated memory.  See
+ * xRWLockCreateStatic() for a version that uses statically allocated memory.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 or left undefined in
+ * FreeRTOSConfig.h for xRWLockCreate() to be available.
+ *
+ * @return If NULL is returned then the lock cannot be created because there is
+ * insufficient heap memory available for FreeRTOS to allocate its data
+ * structure.  A non-NULL value being returned indicates the lock has been
+ * created successfully, and is not held by any task.
+ *
+ * \defgroup xRWLockCreate xRWLockCreate
+ * \ingroup RWLock
+ */
+RWLockHandle_t xRWLockCreate( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t *pxRWLockBuffer );
+ </pre>
+ *
+ * Creates a new reader-writer lock using statically allocated memory.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xRWLockCreateStatic() to be available.
+ *
+ * @param pxRWLockBuffer Must point to a variable of type StaticRWLock_t, which
+ * will be used to hold the lock's data structure.
+ *
+ * @return If the lock is created successfully then a handle to the created lock
+ * is returned.  If pxRWLockBuffer is NULL then NULL is returned.
+ *
+ * \defgroup xRWLockCreateStatic xRWLockCreateStatic
+ * \ingroup RWLock
+ */
+RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t *pxRWLockBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ BaseType_t xRWLockReadLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Takes a reader-writer lock for reading, blocking for up to xTicksToWait
+ * ticks if the lock is held for writing or a task is waiting to write.
+ *
+ * @param xRWLock The handle of the lock to take.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should remain
+ * in the Blocked state to wait for the lock to become available.  Setting
+ * xTicksToWait to portMAX_DELAY will cause the task to wait indefinitely
+ * (without timing out), provided INCLUDE_vTaskSuspend is set to 1 in
+ * FreeRTOSConfig.h.
+ *
+ * @return pdPASS if the lock was taken for reading, or pdFAIL if xTicksToWait
+ * expired before the lock became available.
+ *
+ * Example usage:
+   <pre>
+ RWLockHandle_t xTableLock;
+
+ void vAReaderTask( void *pvParameters )
+ {
+     for( ;; )
+     {
+         if( xRWLockReadLock( xTableLock, portMAX_DELAY ) == pdPASS )
+         {
+             // Look up the table here.  Other readers can do the same
+             // concurrently.
+             xRWLockReadUnlock( xTableLock );
+         }
+     }
+ }
+
+ void vAWriterTask( void *pvParameters )
+ {
+     for( ;; )
+     {
+         if( xRWLockWriteLock( xTableLock, portMAX_DELAY ) == pdPASS )
+         {
+             // Update the table here.  No other task can access it.
+             xRWLockWriteUnlock( xTableLock );
+         }
+     }
+ }
+   </pre>
+ * \defgroup xRWLockReadLock xRWLockReadLock
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockReadLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ BaseType_t xRWLockReadUnlock( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Gives back a reader-writer lock previously taken using xRWLockReadLock().
+ * When the last reader gives the lock back the highest priority task waiting
+ * to write is unblocked.
+ *
+ * @param xRWLock The handle of the lock to give back.
+ *
+ * @return pdPASS if the lock was given back, or pdFAIL if the lock was not
+ * held for reading.
+ *
+ * \defgroup xRWLockReadUnlock xRWLockReadUnlock
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockReadUnlock( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ BaseType_t xRWLockWriteLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Takes a reader-writer lock for writing, blocking for up to xTicksToWait
+ * ticks if the lock is held by any other task.  While the calling task is
+ * waiting, tasks that ask to read the lock block behind it.
+ *
+ * @param xRWLock The handle of the lock to take.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should remain
+ * in the Blocked state to wait for the lock to become available, as for
+ * xRWLockReadLock().
+ *
+ * @return pdPASS if the lock was taken for writing, or pdFAIL if xTicksToWait
+ * expired before the lock became available.
+ *
+ * \defgroup xRWLockWriteLock xRWLockWriteLock
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockWriteLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ BaseType_t xRWLockWriteUnlock( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Gives back a reader-writer lock previously taken using xRWLockWriteLock(),
+ * and drops any priority the calling task inherited while holding it.
+ *
+ * @param xRWLock The handle of the lock to give back.
+ *
+ * @return pdPASS if the lock was given back, or pdFAIL if the calling task did
+ * not hold the lock for writing.
+ *
+ * \defgroup xRWLockWriteUnlock xRWLockWriteUnlock
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockWriteUnlock( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ void vRWLockDelete( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Deletes a reader-writer lock that was previously created using a call to
+ * xRWLockCreate() or xRWLockCreateStatic().  If the lock was created using
+ * dynamic memory then the allocated memory is freed.  The lock must not be
+ * held, or waited for, when it is deleted.
+ *
+ * @param xRWLock The handle of the lock to be deleted.
+ *
+ * \defgroup vRWLockDelete vRWLockDelete
+ * \ingroup RWLock
+ */
+void vRWLockDelete( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !defined( RW_LOCK_H ) */
@@ -819,6 +819,93 @@ typedef QueueHandle_t SemaphoreHandle_t;
 	#define xSemaphoreCreateMutexStatic( pxMutexBuffer ) xQueueCreateMutexStatic( queueQUEUE_TYPE_MUTEX, ( pxMutexBuffer ) )
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateMutexWithCeiling( UBaseType_t uxCeilingPriority )</pre>
+ *
+ * Creates a mutex that uses the immediate priority ceiling protocol instead
+ * of priority inheritance, and returns a handle by which the mutex can be
+ * referenced.
+ *
+ * A task that takes the mutex is raised to uxCeilingPriority straight away,
+ * and is returned to its previous priority when it gives the mutex back.  If
+ * the ceiling is above the priority of every task that uses the mutex then no
+ * task that uses the mutex can run while it is held, so on a single core the
+ * mutex is never found to be held and a take never blocks.  (A task with the
+ * same priority as the ceiling can still be selected to run while the mutex is
+ * held, as tasks of equal priority share the processor.)  Taking and
+ * giving the mutex only ever changes the priority of the calling task, so,
+ * unlike a priority inheritance mutex, the lists of other tasks are never
+ * changed, and the time a task can be blocked by lower priority tasks is
+ * bounded by the longest time any one of them holds the mutex.
+ *
+ * A task whose priority is above the ceiling must not take the mutex.  If a
+ * task holds more than one ceiling mutex at a time then it must give them back
+ * in the reverse of the order in which it took them.  On a multicore system
+ * the mutex can be held by a task running on another core, in which case a
+ * task that attempts to take it blocks without raising the priority of the
+ * holder.
+ *
+ * configUSE_CEILING_MUTEXES must be set to 1 in FreeRTOSConfig.h for this
+ * macro to be available.  The mutex is accessed using xSemaphoreTake() and
+ * xSemaphoreGive(), and cannot be used from an interrupt.
+ *
+ * @param uxCeilingPriority The priority a task holding the mutex runs at.
+ * Must be above tskIDLE_PRIORITY and below configMAX_PRIORITIES.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * mutex is returned.  If there was not enough heap to allocate the mutex data
+ * structures then NULL is returned.
+ *
+ * Example usage:
+ <pre>
+ SemaphoreHandle_t xSemaphore;
+
+ void vATask( void * pvParameters )
+ {
+    // The tasks that use the mutex run at priority 2 or below.
+    xSemaphore = xSemaphoreCreateMutexWithCeiling( 3 );
+
+    if( xSemaphore != NULL )
+    {
+        if( xSemaphoreTake( xSemaphore, portMAX_DELAY ) == pdTRUE )
+        {
+            // This task now runs at priority 3.
+
+            xSemaphoreGive( xSemaphore );
+        }
+    }
+ }
+ </pre>
+ * \defgroup xSemaphoreCreateMutexWithCeiling xSemaphoreCreateMutexWithCeiling
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_CEILING_MUTEXES == 1 ) )
+	#define xSemaphoreCreateMutexWithCeiling( uxCeilingPriority ) xQueueCreateCeilingMutex( ( uxCeilingPriority ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateMutexWithCeilingStatic( UBaseType_t uxCeilingPriority, StaticSemaphore_t *pxMutexBuffer )</pre>
+ *
+ * As xSemaphoreCreateMutexWithCeiling(), but the application writer provides
+ * the memory used to hold the mutex's data structure.
+ *
+ * @param uxCeilingPriority The priority a task holding the mutex runs at.
+ *
+ * @param pxMutexBuffer Must point to a variable of type StaticSemaphore_t,
+ * which will be used to hold the mutex's data structure.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * mutex is returned.  If pxMutexBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xSemaphoreCreateMutexWithCeilingStatic xSemaphoreCreateMutexWithCeilingStatic
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_CEILING_MUTEXES == 1 ) )
+	#define xSemaphoreCreateMutexWithCeilingStatic( uxCeilingPriority, pxMutexBuffer ) xQueueCreateCeilingMutexStatic( ( uxCeilingPriority ), ( pxMutexBuffer ) )
+#endif
+
 
 /**
  * semphr. h
@@ -119,6 +119,45 @@ typedef enum
 	eInvalid			/* Used as an 'invalid state' value. */
 } eTaskState;
 
+/* The layout of the records written by xTaskGetStatsRecords().  Every record
+starts with a type byte and a length byte, the length including those two bytes.
+Multi-byte values are little endian.  The layout of each record type only
+changes when tskSTATS_FORMAT_VERSION changes.
+
+Header (once, first):
+	char	 magic[ 4 ]		"FRTS"
+	uint8_t  version		tskSTATS_FORMAT_VERSION
+	uint8_t  cores			configNUMBER_OF_CORES
+	uint8_t  name_length	configMAX_TASK_NAME_LEN
+	uint8_t  flags			tskSTATS_FLAG_xxx bits
+	uint32_t tick_rate_hz
+	uint32_t tick_count
+
+Task (one per task, in the order the tasks were created):
+	uint32_t task_number
+	uint64_t run_time
+	uint16_t stack_high_water_mark
+	uint8_t  state			eTaskState value
+	uint8_t  priority
+	uint8_t  base_priority
+	char	 name[ name_length ]	zero padded
+
+End (once, last):
+	uint64_t total_run_time
+	uint64_t isr_run_time
+	uint16_t task_count
+	uint8_t  complete		0 if the set of tasks changed part way through */
+#define tskSTATS_FORMAT_VERSION			( ( uint8_t ) 1 )
+#define tskSTATS_RECORD_HEADER			( ( uint8_t ) 1 )
+#define tskSTATS_RECORD_TASK			( ( uint8_t ) 2 )
+#define tskSTATS_RECORD_END				( ( uint8_t ) 3 )
+#define tskSTATS_FLAG_RUN_TIME			( ( uint8_t ) 0x01 )
+#define tskSTATS_FLAG_ISR_RUN_TIME		( ( uint8_t ) 0x02 )
+#define tskSTATS_HEADER_RECORD_LENGTH	( ( size_t ) 18 )
+#define tskSTATS_TASK_RECORD_LENGTH		( ( size_t ) ( 19 + configMAX_TASK_NAME_LEN ) )
+#define tskSTATS_END_RECORD_LENGTH		( ( size_t ) 21 )
+#define tskSTATS_MAX_RECORD_LENGTH		( ( tskSTATS_TASK_RECORD_LENGTH > tskSTATS_END_RECORD_LENGTH ) ? tskSTATS_TASK_RECORD_LENGTH : tskSTATS_END_RECORD_LENGTH )
+
 /* Actions that can be performed when vTaskNotify() is called. */
 typedef enum
 {
@@ -172,11 +211,70 @@ typedef struct xTASK_STATUS
 	eTaskState eCurrentState;		/* The state in which the task existed when the structure was populated. */
 	UBaseType_t uxCurrentPriority;	/* The priority at which the task was running (may be inherited) when the structure was populated. */
 	UBaseType_t uxBasePriority;		/* The priority to which the task will return if the task's current priority has been inherited to avoid unbounded priority inversion when obtaining a mutex.  Only valid if configUSE_MUTEXES is defined as 1 in FreeRTOSConfig.h. */
-	uint32_t ulRunTimeCounter;		/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
+	RunTimeCounter_t ulRunTimeCounter;	/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
 	StackType_t *pxStackBase;		/* Points to the lowest address of the task's stack area. */
 	uint16_t usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
+/* Used with vTaskSnapshotBegin() and uxTaskSnapshotRead() to read the state of
+the tasks in the system a few tasks at a time. */
+typedef struct xTASK_SNAPSHOT
+{
+	UBaseType_t uxGeneration;		/* The generation of the task list when the snapshot was started.  The generation changes each time a task is created or deleted. */
+	void *pvNextItem;				/* Private to the kernel - references the next task to be read. */
+	RunTimeCounter_t ulTotalRunTime;	/* The total run time when the last task was read, for comparison with the ulRunTimeCounter values returned.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
+} TaskSnapshot_t;
+
+/* Used with vTaskStatsBegin() and xTaskGetStatsRecords() to write the binary
+task statistics record stream a buffer at a time.  All members are private to
+the kernel. */
+typedef struct xTASK_STATS_CURSOR
+{
+	TaskSnapshot_t xSnapshot;
+	BaseType_t xStage;
+	UBaseType_t uxTasksWritten;
+} TaskStatsCursor_t;
+
+#if( configUSE_WAKE_LATENCY_STATS == 1 )
+	/* Used with vTaskGetWakeLatencyStats() to return the histogram of the time
+	taken for a task to run after an interrupt moved it to the Ready state.
+	Latencies are measured in configWAKE_LATENCY_TIMESTAMP() counts.
+	ulBuckets[ 0 ] counts latencies of 0, and ulBuckets[ n ] latencies from
+	2^(n-1) to 2^n - 1 - except the last bucket, which also counts all the
+	longer latencies. */
+	typedef struct xWAKE_LATENCY_STATS
+	{
+		uint32_t ulWakes;			/* The number of latencies recorded. */
+		uint32_t ulMaxLatency;		/* The longest latency recorded. */
+		uint32_t ulBuckets[ configWAKE_LATENCY_BUCKETS ];
+	} WakeLatencyStats_t;
+#endif
+
+#if( configUSE_CRITICAL_PROFILER == 1 )
+	/* The kinds of code region timed by the critical section profiler. */
+	typedef enum
+	{
+		eProfiledCriticalSection = 0,	/* From taskENTER_CRITICAL() to the matching taskEXIT_CRITICAL(). */
+		eProfiledSchedulerSuspension	/* From vTaskSuspendAll() to the matching xTaskResumeAll(). */
+	} eProfiledRegion;
+
+	/* Used with uxTaskGetCriticalProfile() to return the durations recorded for
+	one call site.  Durations are measured in configCRITICAL_PROFILER_TIMESTAMP()
+	counts, and bucketed in the same way as the latencies of
+	WakeLatencyStats_t - ulBuckets[ 0 ] counts durations of 0, ulBuckets[ n ]
+	durations from 2^(n-1) to 2^n - 1, and the last bucket also counts all
+	the longer durations. */
+	typedef struct xCRITICAL_PROFILE_SITE
+	{
+		const char *pcFile;			/* The source file of the outermost taskENTER_CRITICAL() or vTaskSuspendAll() call. */
+		UBaseType_t uxLine;			/* The line of that call. */
+		eProfiledRegion eRegion;	/* Whether the site enters a critical section or suspends the scheduler. */
+		uint32_t ulCount;			/* The number of durations recorded. */
+		uint32_t ulMaxDuration;		/* The longest duration recorded. */
+		uint32_t ulBuckets[ configCRITICAL_PROFILER_BUCKETS ];
+	} CriticalProfileSite_t;
+#endif
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -192,6 +290,14 @@ typedef enum
  */
 #define tskIDLE_PRIORITY			( ( UBaseType_t ) 0U )
 
+/**
+ * Core affinity mask that allows a task to run on any core.  Only used when
+ * configNUMBER_OF_CORES is greater than 1.
+ *
+ * \ingroup TaskUtils
+ */
+#define tskNO_AFFINITY				( ( UBaseType_t ) -1 )
+
 /**
  * task. h
  *
@@ -214,7 +320,15 @@ typedef enum
  * \defgroup taskENTER_CRITICAL taskENTER_CRITICAL
  * \ingroup SchedulerControl
  */
-#define taskENTER_CRITICAL()		portENTER_CRITICAL()
+#if( configUSE_CRITICAL_PROFILER == 1 )
+	#define taskENTER_CRITICAL()											\
+	{																		\
+		portENTER_CRITICAL();												\
+		vTaskProfileEnterCritical( __FILE__, ( UBaseType_t ) __LINE__ );	\
+	}
+#else
+	#define taskENTER_CRITICAL()	portENTER_CRITICAL()
+#endif
 #define taskENTER_CRITICAL_FROM_ISR() portSET_INTERRUPT_MASK_FROM_ISR()
 
 /**
@@ -229,7 +343,15 @@ typedef enum
  * \defgroup taskEXIT_CRITICAL taskEXIT_CRITICAL
  * \ingroup SchedulerControl
  */
-#define taskEXIT_CRITICAL()			portEXIT_CRITICAL()
+#if( configUSE_CRITICAL_PROFILER == 1 )
+	#define taskEXIT_CRITICAL()				\
+	{										\
+		vTaskProfileExitCritical();			\
+		portEXIT_CRITICAL();				\
+	}
+#else
+	#define taskEXIT_CRITICAL()		portEXIT_CRITICAL()
+#endif
 #define taskEXIT_CRITICAL_FROM_ISR( x ) portCLEAR_INTERRUPT_MASK_FROM_ISR( x )
 /**
  * task. h
@@ -482,6 +604,120 @@ is used in assert() statements. */
 									StaticTask_t * const pxTaskBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskCreateWithDeadline(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  uint16_t usStackDepth,
+							  void *pvParameters,
+							  TickType_t xRelativeDeadline,
+							  TickType_t xPeriod,
+							  TaskHandle_t *pvCreatedTask
+						  );</pre>
+ *
+ * configUSE_EDF_SCHEDULING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Creates a task that is scheduled by earliest deadline first.  The task is
+ * given the priority configEDF_PRIORITY, which is reserved for such tasks.
+ * While tasks of higher priority run before it and tasks of lower priority
+ * run after it as normal, the tasks of configEDF_PRIORITY run in the order of
+ * their absolute deadlines, with no time slicing between them.
+ *
+ * The first job of the task is released when the task is created, and each
+ * call the task makes to vTaskDelayUntil() releases the next job at the wake
+ * time, setting the absolute deadline to the wake time plus
+ * xRelativeDeadline.  A task that blocks in any other way, for example on a
+ * queue or with vTaskDelay(), stays in its current job, but if the deadline of
+ * that job has passed by the time the task is unblocked then the task starts a
+ * new job, with a deadline xRelativeDeadline from when it was unblocked.
+ *
+ * A task that is still in the Ready state when its absolute deadline is
+ * reached has missed the deadline.  Misses are counted, see
+ * uxTaskGetDeadlineMisses(), and if configUSE_DEADLINE_MISS_HOOK is 1 reported
+ * to vApplicationDeadlineMissHook( TaskHandle_t xTask ), which is called from
+ * the tick interrupt.
+ *
+ * The parameters are as for xTaskCreate(), except the priority is replaced by:
+ *
+ * @param xRelativeDeadline The time, in ticks, within which each job of the
+ * task must complete after it is released.  Passing 0 sets the deadline equal
+ * to the period.
+ *
+ * @param xPeriod The time, in ticks, between the releases of the task's jobs.
+ * This is normally also the xTimeIncrement the task passes to
+ * vTaskDelayUntil().
+ *
+ * @return pdPASS if the task was successfully created and added to a ready
+ * list, otherwise an error code defined in the file projdefs.h
+ *
+ * Example usage:
+   <pre>
+ // A control loop that runs every 10 ticks and must finish within 4.
+ void vControlLoop( void * pvParameters )
+ {
+ TickType_t xLastWakeTime = xTaskGetTickCount();
+
+	 for( ;; )
+	 {
+		 // Run the loop, then wait for the next period.
+		 vTaskDelayUntil( &xLastWakeTime, 10 );
+	 }
+ }
+
+ void vAFunction( void )
+ {
+	 xTaskCreateWithDeadline( vControlLoop, "CTRL", 200, NULL, 4, 10, NULL );
+ }
+   </pre>
+ * \defgroup xTaskCreateWithDeadline xTaskCreateWithDeadline
+ * \ingroup Tasks
+ */
+#if( ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+	BaseType_t xTaskCreateWithDeadline(	TaskFunction_t pxTaskCode,
+										const char * const pcName,
+										const uint16_t usStackDepth,
+										void * const pvParameters,
+										const TickType_t xRelativeDeadline,
+										const TickType_t xPeriod,
+										TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#endif
+
+/**
+ * task. h
+ *<pre>
+ TaskHandle_t xTaskCreateStaticWithDeadline( TaskFunction_t pvTaskCode,
+								 const char * const pcName,
+								 uint32_t ulStackDepth,
+								 void *pvParameters,
+								 TickType_t xRelativeDeadline,
+								 TickType_t xPeriod,
+								 StackType_t *pxStackBuffer,
+								 StaticTask_t *pxTaskBuffer );</pre>
+ *
+ * As xTaskCreateWithDeadline(), but the memory for the task is provided by the
+ * application as for xTaskCreateStatic().  configUSE_EDF_SCHEDULING and
+ * configSUPPORT_STATIC_ALLOCATION must both be set to 1 in FreeRTOSConfig.h
+ * for this function to be available.
+ *
+ * @return The handle of the created task, or NULL if either buffer is NULL.
+ *
+ * \defgroup xTaskCreateStaticWithDeadline xTaskCreateStaticWithDeadline
+ * \ingroup Tasks
+ */
+#if( ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	TaskHandle_t xTaskCreateStaticWithDeadline(	TaskFunction_t pxTaskCode,
+												const char * const pcName,
+												const uint32_t ulStackDepth,
+												void * const pvParameters,
+												const TickType_t xRelativeDeadline,
+												const TickType_t xPeriod,
+												StackType_t * const puxStackBuffer,
+												StaticTask_t * const pxTaskBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#endif
+
 /**
  * task. h
  *<pre>
@@ -729,6 +965,10 @@ void vTaskDelay( const TickType_t xTicksToDelay ) PRIVILEGED_FUNCTION;
  * same xTimeIncrement parameter value will cause the task to execute with
  * a fixed interface period.
  *
+ * If the calling task was created by xTaskCreateWithDeadline() then the job it
+ * starts when it is unblocked is given an absolute deadline of
+ * *pxPreviousWakeTime + xTimeIncrement plus the task's relative deadline.
+ *
  * Example usage:
    <pre>
  // Perform an action every 10 ticks.
@@ -1272,6 +1512,13 @@ void vTaskSuspendAll( void ) PRIVILEGED_FUNCTION;
  */
 BaseType_t xTaskResumeAll( void ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_CRITICAL_PROFILER == 1 )
+	/* Pass the call site to the scheduler so the time the scheduler is
+	suspended for can be recorded against it. */
+	void vTaskSuspendAllFromSite( const char * const pcFile, const UBaseType_t uxLine ) PRIVILEGED_FUNCTION;
+	#define vTaskSuspendAll()	vTaskSuspendAllFromSite( __FILE__, ( UBaseType_t ) __LINE__ )
+#endif
+
 /*-----------------------------------------------------------
  * TASK UTILITIES
  *----------------------------------------------------------*/
@@ -1429,6 +1676,268 @@ BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask, void *pvParameter )
  */
 TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	/**
+	 * task. h
+	 * <pre>UBaseType_t uxTaskGetDeadlineMisses( TaskHandle_t xTask );</pre>
+	 *
+	 * Only available when configUSE_EDF_SCHEDULING is 1.
+	 *
+	 * Returns the number of jobs of a task created by xTaskCreateWithDeadline()
+	 * that were still in the Ready state when their deadline was reached.  A
+	 * job is counted once however long it overruns.  Passing NULL returns the
+	 * count of the calling task.
+	 *
+	 * \ingroup TaskUtils
+	 */
+	UBaseType_t uxTaskGetDeadlineMisses( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+#if( configUSE_TASK_BUDGETS == 1 )
+
+	/**
+	 * task. h
+	 * <pre>void vTaskSetBudget( TaskHandle_t xTask, TickType_t xBudget, TickType_t xPeriod );</pre>
+	 *
+	 * Only available when configUSE_TASK_BUDGETS is 1.
+	 *
+	 * Limits the processor time a task can use.  Each tick is charged to the
+	 * task that was running when the tick occurred.  Once a task has been
+	 * charged xBudget ticks within a period it is throttled - held in the
+	 * Blocked state - until the start of the next period, when its budget is
+	 * replenished.  Periods start at the time vTaskSetBudget() is called.
+	 * Tasks of lower priority therefore get at least the remainder of each
+	 * period, however long a budgeted task wants to run for.
+	 *
+	 * A task that holds a mutex is not throttled until it has released all the
+	 * mutexes it holds.  xTaskAbortDelay() does not release a throttled task.
+	 *
+	 * @param xTask The handle of the task being limited.  Passing NULL limits
+	 * the calling task.
+	 *
+	 * @param xBudget The number of ticks the task may run for in each period.
+	 * Passing 0 removes the limit.
+	 *
+	 * @param xPeriod The period, in ticks, at which the budget is replenished.
+	 * Must not be less than xBudget.
+	 *
+	 * Example usage:
+	   <pre>
+	 // Allow the analytics task 20 ticks of every 100.
+	 vTaskSetBudget( xAnalyticsTask, 20, 100 );
+	   </pre>
+	 *
+	 * \ingroup TaskCtrl
+	 */
+	void vTaskSetBudget( TaskHandle_t xTask, const TickType_t xBudget, const TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task. h
+	 * <pre>UBaseType_t uxTaskGetBudgetOverruns( TaskHandle_t xTask );</pre>
+	 *
+	 * Only available when configUSE_TASK_BUDGETS is 1.
+	 *
+	 * Returns the number of times a task has been throttled for using up its
+	 * budget.  Passing NULL returns the count of the calling task.
+	 *
+	 * \ingroup TaskUtils
+	 */
+	UBaseType_t uxTaskGetBudgetOverruns( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_BUDGETS */
+
+#if( configUSE_WAKE_LATENCY_STATS == 1 )
+
+	/**
+	 * task. h
+	 * <pre>void vTaskGetWakeLatencyStats( TaskHandle_t xTask, WakeLatencyStats_t *pxStats );</pre>
+	 *
+	 * Only available when configUSE_WAKE_LATENCY_STATS is 1.
+	 *
+	 * Each time an interrupt moves a task from the Blocked or Suspended state to
+	 * the Ready state - by xQueueSendFromISR(), xSemaphoreGiveFromISR(),
+	 * xTaskNotifyFromISR(), vTaskNotifyGiveFromISR(), xTaskResumeFromISR() or
+	 * any of the other queue FromISR functions - the time is recorded against
+	 * the task.  When the task is next switched in the time it took to run is
+	 * added to a log scale histogram held by the task.  If the queue was locked
+	 * when the interrupt accessed it then the time is recorded when the queue
+	 * is unlocked, as that is when the task is moved to the Ready state.
+	 *
+	 * vTaskGetWakeLatencyStats() copies the histogram of a task into pxStats.
+	 * See the definition of WakeLatencyStats_t for the bucket limits.
+	 *
+	 * @param xTask The handle of the task.  Passing NULL returns the histogram
+	 * of the calling task.
+	 *
+	 * @param pxStats The structure into which the histogram is copied.
+	 *
+	 * Example usage:
+	   <pre>
+	 WakeLatencyStats_t xStats;
+
+		vTaskGetWakeLatencyStats( xUARTTask, &xStats );
+
+		// The 99.9th percentile, in configWAKE_LATENCY_TIMESTAMP() counts.
+		ulP999 = ulTaskGetWakeLatencyPercentile( &xStats, 999000UL );
+	   </pre>
+	 *
+	 * \ingroup TaskUtils
+	 */
+	void vTaskGetWakeLatencyStats( TaskHandle_t xTask, WakeLatencyStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task. h
+	 * <pre>void vTaskResetWakeLatencyStats( TaskHandle_t xTask );</pre>
+	 *
+	 * Only available when configUSE_WAKE_LATENCY_STATS is 1.
+	 *
+	 * Clears the wake latency histogram of a task.  Passing NULL clears the
+	 * histogram of the calling task.
+	 *
+	 * \ingroup TaskUtils
+	 */
+	void vTaskResetWakeLatencyStats( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task. h
+	 * <pre>uint32_t ulTaskGetWakeLatencyPercentile( const WakeLatencyStats_t * const pxStats, uint32_t ulPartsPerMillion );</pre>
+	 *
+	 * Only available when configUSE_WAKE_LATENCY_STATS is 1.
+	 *
+	 * Returns a latency that at least ulPartsPerMillion / 1000000 of the
+	 * latencies in pxStats did not exceed - for example 999000 for the 99.9th
+	 * percentile.  As only the bucket of each latency is known, the upper limit
+	 * of the bucket is returned, or ulMaxLatency if that is lower.  Returns 0
+	 * if no latencies have been recorded.
+	 *
+	 * \ingroup TaskUtils
+	 */
+	uint32_t ulTaskGetWakeLatencyPercentile( const WakeLatencyStats_t * const pxStats, const uint32_t ulPartsPerMillion ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_WAKE_LATENCY_STATS */
+
+#if( configUSE_CRITICAL_PROFILER == 1 )
+
+	/**
+	 * task. h
+	 * <pre>UBaseType_t uxTaskGetCriticalProfile( CriticalProfileSite_t * const pxSiteArray, const UBaseType_t uxArraySize, uint32_t * const pulUnrecorded );</pre>
+	 *
+	 * Only available when configUSE_CRITICAL_PROFILER is 1.
+	 *
+	 * While the scheduler is running, the time from each outermost
+	 * taskENTER_CRITICAL() to the matching taskEXIT_CRITICAL(), and from each
+	 * outermost vTaskSuspendAll() to the matching xTaskResumeAll(), is added to
+	 * a log scale histogram kept for the source file and line of the
+	 * taskENTER_CRITICAL() or vTaskSuspendAll() call.  That includes the
+	 * critical sections and scheduler suspensions of the kernel itself, and of
+	 * the heap implementations.  If a task is switched out from within a
+	 * critical section then the time up to the switch and the time after the
+	 * task is switched back in are recorded separately.  Critical sections
+	 * entered with taskENTER_CRITICAL_FROM_ISR() and portENTER_CRITICAL() are
+	 * not timed.
+	 *
+	 * Up to configCRITICAL_PROFILER_SITES call sites are recorded.  Once that
+	 * many have been seen the durations of any further sites are only counted
+	 * in *pulUnrecorded.
+	 *
+	 * uxTaskGetCriticalProfile() copies the histogram of each call site seen so
+	 * far into pxSiteArray.
+	 *
+	 * @param pxSiteArray The array into which the histograms are copied.
+	 *
+	 * @param uxArraySize The number of entries in pxSiteArray.  If there are
+	 * more call sites than entries then only uxArraySize of them are copied.
+	 *
+	 * @param pulUnrecorded Set to the number of durations that were not recorded
+	 * because the table of call sites was full.  Can be NULL.
+	 *
+	 * @return The number of entries written to pxSiteArray.
+	 *
+	 * Example usage:
+	   <pre>
+	 CriticalProfileSite_t xSites[ configCRITICAL_PROFILER_SITES ];
+	 UBaseType_t uxSites, x;
+
+		uxSites = uxTaskGetCriticalProfile( xSites, configCRITICAL_PROFILER_SITES, NULL );
+
+		for( x = 0; x < uxSites; x++ )
+		{
+			printf( "%s:%u %s max %u\r\n", xSites[ x ].pcFile, ( unsigned ) xSites[ x ].uxLine,
+					( xSites[ x ].eRegion == eProfiledCriticalSection ) ? "critical" : "suspended",
+					( unsigned ) xSites[ x ].ulMaxDuration );
+		}
+	   </pre>
+	 *
+	 * \ingroup TaskUtils
+	 */
+	UBaseType_t uxTaskGetCriticalProfile( CriticalProfileSite_t * const pxSiteArray, const UBaseType_t uxArraySize, uint32_t * const pulUnrecorded ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task. h
+	 * <pre>void vTaskResetCriticalProfile( void );</pre>
+	 *
+	 * Only available when configUSE_CRITICAL_PROFILER is 1.
+	 *
+	 * Forgets all the call sites recorded by the critical section profiler.
+	 *
+	 * \ingroup TaskUtils
+	 */
+	void vTaskResetCriticalProfile( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_CRITICAL_PROFILER */
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	/**
+	 * task. h
+	 * <pre>void vTaskCoreAffinitySet( const TaskHandle_t xTask, UBaseType_t uxCoreAffinityMask );</pre>
+	 *
+	 * Only available when configNUMBER_OF_CORES is greater than 1.
+	 *
+	 * Sets the cores on which a task is allowed to run.  Bit n of
+	 * uxCoreAffinityMask set means the task may run on core n.  Tasks are
+	 * created with an affinity of tskNO_AFFINITY.  If the task is running on a
+	 * core that is removed from its mask then that core is made to reschedule.
+	 *
+	 * @param xTask The handle of the task being updated.  Passing NULL causes
+	 * the affinity of the calling task to be set.
+	 *
+	 * @param uxCoreAffinityMask The new affinity mask.
+	 *
+	 * \ingroup TaskUtils
+	 */
+	void vTaskCoreAffinitySet( const TaskHandle_t xTask, UBaseType_t uxCoreAffinityMask ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task. h
+	 * <pre>UBaseType_t uxTaskCoreAffinityGet( const TaskHandle_t xTask );</pre>
+	 *
+	 * Only available when configNUMBER_OF_CORES is greater than 1.
+	 *
+	 * Returns the core affinity mask of a task.  Passing NULL returns the mask
+	 * of the calling task.
+	 *
+	 * \ingroup TaskUtils
+	 */
+	UBaseType_t uxTaskCoreAffinityGet( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Only available when configNUMBER_OF_CORES is greater than 1.  Returns
+	 * the handle of the idle task that is bound to core xCoreID.
+	 * xTaskGetIdleTaskHandle() returns the idle task of core 0.
+	 */
+	TaskHandle_t xTaskGetIdleTaskHandleForCore( const BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Only available when configNUMBER_OF_CORES is greater than 1.  Returns
+	 * the handle of the task running on core xCoreID.
+	 */
+	TaskHandle_t xTaskGetCurrentTaskHandleForCore( const BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+#endif /* configNUMBER_OF_CORES */
+
 /**
  * configUSE_TRACE_FACILITY must be defined as 1 in FreeRTOSConfig.h for
  * uxTaskGetSystemState() to be available.
@@ -1456,6 +1965,9 @@ TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
  * FreeRTOSConfig.h then *pulTotalRunTime is set by uxTaskGetSystemState() to the
  * total run time (as defined by the run time stats clock, see
  * http://www.freertos.org/rtos-run-time-stats.html) since the target booted.
+ * The run time is accumulated in a RunTimeCounter_t, which is 64 bits wide
+ * when configUSE_64_BIT_RUN_TIME_COUNTERS is set to 1, so it does not wrap
+ * with the run time stats clock.
  * pulTotalRunTime can be set to NULL to omit the total run time information.
  *
  * @return The number of TaskStatus_t structures that were populated by
@@ -1472,7 +1984,8 @@ TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
 	{
 	TaskStatus_t *pxTaskStatusArray;
 	volatile UBaseType_t uxArraySize, x;
-	uint32_t ulTotalRunTime, ulStatsAsPercentage;
+	RunTimeCounter_t ulTotalRunTime;
+	uint32_t ulStatsAsPercentage;
 
 		// Make sure the write buffer does not contain a string.
 		*pcWriteBuffer = 0x00;
@@ -1503,17 +2016,17 @@ TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
 					// What percentage of the total run time has the task used?
 					// This will always be rounded down to the nearest integer.
 					// ulTotalRunTimeDiv100 has already been divided by 100.
-					ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalRunTime;
+					ulStatsAsPercentage = ( uint32_t ) ( pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalRunTime );
 
 					if( ulStatsAsPercentage > 0UL )
 					{
-						sprintf( pcWriteBuffer, "%s\t\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
+						sprintf( pcWriteBuffer, "%s\t\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].pcTaskName, ( unsigned long ) pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
 					}
 					else
 					{
 						// If the percentage is zero here then the task has
 						// consumed less than 1% of the total run time.
-						sprintf( pcWriteBuffer, "%s\t\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter );
+						sprintf( pcWriteBuffer, "%s\t\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, ( unsigned long ) pxTaskStatusArray[ x ].ulRunTimeCounter );
 					}
 
 					pcWriteBuffer += strlen( ( char * ) pcWriteBuffer );
@@ -1526,7 +2039,79 @@ TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
 	}
 	</pre>
  */
-UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, RunTimeCounter_t * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskSnapshotBegin( TaskSnapshot_t * const pxSnapshot );</PRE>
+ * <PRE>UBaseType_t uxTaskSnapshotRead( TaskSnapshot_t * const pxSnapshot, TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, const BaseType_t xGetFreeStackSpace );</PRE>
+ * <PRE>BaseType_t xTaskSnapshotIsValid( const TaskSnapshot_t * const pxSnapshot );</PRE>
+ *
+ * configUSE_TRACE_FACILITY and configUSE_TASK_SNAPSHOTS must both be defined
+ * as 1 in FreeRTOSConfig.h for these functions to be available.
+ *
+ * An alternative to uxTaskGetSystemState() for systems with many tasks.
+ * uxTaskGetSystemState() keeps the scheduler suspended while it reads every
+ * task.  A snapshot instead reads the tasks in chunks of any size, and only
+ * disables interrupts for the time it takes to read a single task, so it can
+ * be called periodically without adding to the scheduling latency.
+ *
+ * vTaskSnapshotBegin() starts a snapshot.  Each call to uxTaskSnapshotRead()
+ * then fills in up to uxArraySize TaskStatus_t structures with the next tasks,
+ * in the order the tasks were created, and returns the number filled in.  It
+ * returns 0 when every task has been read.
+ *
+ * Each TaskStatus_t describes its task at the moment it was read, but different
+ * tasks are read at different times.  If a task is created or deleted while a
+ * snapshot is being read then the snapshot cannot be continued, and
+ * uxTaskSnapshotRead() returns 0.  xTaskSnapshotIsValid() returns pdTRUE if no
+ * task has been created or deleted since vTaskSnapshotBegin() was called, so
+ * calling it after uxTaskSnapshotRead() has returned 0 tells a complete
+ * snapshot from one that was abandoned and should be started again.
+ *
+ * @param pxSnapshot The snapshot being read.
+ *
+ * @param pxTaskStatusArray The array the tasks are written to.
+ *
+ * @param uxArraySize The number of TaskStatus_t structures in the array.
+ *
+ * @param xGetFreeStackSpace Set to pdTRUE to obtain the high water mark of the
+ * stack of each task, which takes time.  The stack is checked with interrupts
+ * enabled, but with the scheduler suspended so the task cannot be deleted
+ * while its stack is being checked.  If set to pdFALSE then
+ * usStackHighWaterMark is set to 0.
+ *
+ * Example usage:
+   <pre>
+	void vMonitorTasks( void )
+	{
+	static TaskStatus_t xChunk[ 8 ];
+	TaskSnapshot_t xSnapshot;
+	UBaseType_t uxCount, x;
+
+		do
+		{
+			vTaskSnapshotBegin( &xSnapshot );
+
+			while( ( uxCount = uxTaskSnapshotRead( &xSnapshot, xChunk, 8, pdFALSE ) ) > 0 )
+			{
+				for( x = 0; x < uxCount; x++ )
+				{
+					// Record xChunk[ x ].
+				}
+			}
+
+			// Start again if the set of tasks changed part way through.
+		} while( xTaskSnapshotIsValid( &xSnapshot ) == pdFALSE );
+	}
+   </pre>
+ *
+ * \defgroup vTaskSnapshotBegin vTaskSnapshotBegin
+ * \ingroup TaskUtils
+ */
+void vTaskSnapshotBegin( TaskSnapshot_t * const pxSnapshot ) PRIVILEGED_FUNCTION;
+UBaseType_t uxTaskSnapshotRead( TaskSnapshot_t * const pxSnapshot, TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, const BaseType_t xGetFreeStackSpace ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskSnapshotIsValid( const TaskSnapshot_t * const pxSnapshot ) PRIVILEGED_FUNCTION;
 
 /**
  * task. h
@@ -1629,6 +2214,94 @@ void vTaskList( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unquali
  */
 void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/**
+ * task. h
+ * <PRE>void vTaskStatsBegin( TaskStatsCursor_t * const pxCursor );</PRE>
+ * <PRE>size_t xTaskGetStatsRecords( TaskStatsCursor_t * const pxCursor, uint8_t * const pucBuffer, const size_t xBufferLength );</PRE>
+ *
+ * configUSE_BINARY_TASK_STATS must be defined as 1 for these functions to be
+ * available.
+ *
+ * A binary alternative to vTaskList() and vTaskGetRunTimeStats().  Instead of
+ * formatting text with sprintf() into a buffer of unchecked size, the same
+ * information is written as a stream of fixed layout records (see
+ * tskSTATS_FORMAT_VERSION), which tools/freertos_stats.py decodes on the host
+ * into the familiar tables or into CSV.
+ *
+ * vTaskStatsBegin() starts a new stream.  Each call to xTaskGetStatsRecords()
+ * then writes as many whole records as fit in pucBuffer and returns the number
+ * of bytes written, so the stream can be sent a buffer at a time.  It returns 0
+ * once the end record has been written.  The tasks are read using a snapshot
+ * (see vTaskSnapshotBegin()), so the scheduler is not suspended while the
+ * stream is written.
+ *
+ * @param pxCursor Records the position in the stream between calls.
+ *
+ * @param pucBuffer The buffer the records are written to.
+ *
+ * @param xBufferLength The size of pucBuffer in bytes.  Must be at least
+ * tskSTATS_MAX_RECORD_LENGTH.
+ *
+ * Example usage:
+   <pre>
+	void vSendStats( void )
+	{
+	TaskStatsCursor_t xCursor;
+	uint8_t ucBuffer[ 64 ];
+	size_t xLength;
+
+		vTaskStatsBegin( &xCursor );
+
+		while( ( xLength = xTaskGetStatsRecords( &xCursor, ucBuffer, sizeof( ucBuffer ) ) ) > 0 )
+		{
+			vUARTSend( ucBuffer, xLength );
+		}
+	}
+   </pre>
+ *
+ * \defgroup xTaskGetStatsRecords xTaskGetStatsRecords
+ * \ingroup TaskUtils
+ */
+void vTaskStatsBegin( TaskStatsCursor_t * const pxCursor ) PRIVILEGED_FUNCTION;
+size_t xTaskGetStatsRecords( TaskStatsCursor_t * const pxCursor, uint8_t * const pucBuffer, const size_t xBufferLength ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskISREnter( void );</PRE>
+ * <PRE>void vTaskISRExit( void );</PRE>
+ *
+ * configGENERATE_ISR_RUN_TIME_STATS must be defined as 1 for these functions
+ * to be available.
+ *
+ * Call vTaskISREnter() first thing in an interrupt service routine and
+ * vTaskISRExit() as the last thing before it returns (and before it requests
+ * a context switch).  The run time between the two calls is then accumulated
+ * separately, rather than being billed to the task that was interrupted.
+ * Calls can be nested, and only the outermost pair is timed.  The tick
+ * interrupt of the ports provided already makes the calls.
+ *
+ * \defgroup vTaskISREnter vTaskISREnter
+ * \ingroup TaskUtils
+ */
+void vTaskISREnter( void ) PRIVILEGED_FUNCTION;
+void vTaskISRExit( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>RunTimeCounter_t ulTaskGetISRRunTimeCounter( void );</PRE>
+ *
+ * configGENERATE_ISR_RUN_TIME_STATS must be defined as 1 for this function to
+ * be available.
+ *
+ * @return The total run time, as defined by the run time stats clock, spent
+ * between vTaskISREnter() and vTaskISRExit() calls.  vTaskGetRunTimeStats()
+ * reports it on a row named "ISR".
+ *
+ * \defgroup ulTaskGetISRRunTimeCounter ulTaskGetISRRunTimeCounter
+ * \ingroup TaskUtils
+ */
+RunTimeCounter_t ulTaskGetISRRunTimeCounter( void ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
@@ -2132,6 +2805,82 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
  */
 void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * vTaskPlaceOnEventListWithHandOff() performs the same function as
+ * vTaskPlaceOnEventList(), but also records pvHandOff against the calling task.
+ * The queue implementation uses it to describe the send or receive the task is
+ * blocked on, so another task or an interrupt can complete the operation on the
+ * blocked task's behalf.  pvTaskGetEventListHandOff() returns the value
+ * recorded by the task at the head of pxEventList - the task
+ * xTaskRemoveFromEventList() would unblock next - or NULL if the list is empty
+ * or that task was placed on the list using another function.
+ */
+void vTaskPlaceOnEventListWithHandOff( List_t * const pxEventList, void * const pvHandOff, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void *pvTaskGetEventListHandOff( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.
+ *
+ * Moves the highest priority task waiting on pxEventList, which must not be
+ * empty, onto pxMutexEventList - the list of tasks waiting to take a mutex -
+ * without unblocking it, so the task keeps its timeout and is next unblocked
+ * when the mutex is given back.  If pxMutexHolder is not NULL it inherits the
+ * priority of the moved task, as though the task had blocked on the mutex
+ * itself.  Used by condition variables to avoid unblocking a task that would
+ * immediately block again on a mutex that is still held.
+ */
+void vTaskMoveToMutexEventList( const List_t * const pxEventList, List_t * const pxMutexEventList, TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THESE FUNCTIONS MUST BE CALLED FROM A CRITICAL SECTION.
+ *
+ * Used by xWaitForMultipleObjects(), which blocks the calling task on an event
+ * list of its own and links a wait record into the event list of each object
+ * it waits for.  vTaskSetMultipleObjectWaitOwner() makes pxWaitListItem a
+ * record of the calling task, ordered by the task's priority.
+ * xTaskRemoveMultipleObjectWaitItem() removes a record from the list it is in
+ * and, if the task it belongs to is still waiting, unblocks the task -
+ * returning pdTRUE if a context switch is required.  xTaskRemoveFromEventList()
+ * treats a record at the head of an event list in the same way.
+ * xTaskNotifyAddMultipleObjectWait() returns pdTRUE if the calling task has a
+ * notification pending, and otherwise marks the task as waiting for one, so it
+ * is unblocked when notified.  vTaskNotifyRemoveMultipleObjectWait() clears
+ * that mark.  Notifications are not consumed.
+ * vTaskSetMultipleObjectWaitObjects() records the WaitObject_t array of a
+ * calling task that is about to block, or NULL once it no longer has records
+ * linked into any object, so the records can be removed if the task is
+ * deleted and reordered if its priority changes.
+ */
+void vTaskSetMultipleObjectWaitOwner( ListItem_t * const pxWaitListItem ) PRIVILEGED_FUNCTION;
+void vTaskSetMultipleObjectWaitObjects( void *pvWaitObjects, const UBaseType_t uxWaitObjectCount ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskRemoveMultipleObjectWaitItem( ListItem_t * const pxWaitListItem ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskNotifyAddMultipleObjectWait( void ) PRIVILEGED_FUNCTION;
+void vTaskNotifyRemoveMultipleObjectWait( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.
+ *
+ * Returns a value that orders the tasks placed on unordered event lists by the
+ * time at which they were placed there - the lower the value the longer the
+ * task has been waiting.  The event groups implementation uses it to unblock
+ * tasks held in different lists in the order in which they started to wait.
+ * pxEventListItem must be the event list item of a task that was placed on an
+ * unordered event list and has not yet been removed from the Blocked state.
+ */
+TickType_t xTaskGetEventListItemOrder( const ListItem_t * const pxEventListItem ) PRIVILEGED_FUNCTION;
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
  * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
@@ -2167,7 +2916,13 @@ BaseType_t xTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, cons
  * Sets the pointer to the current TCB to the TCB of the highest priority task
  * that is ready to run.
  */
-void vTaskSwitchContext( void ) PRIVILEGED_FUNCTION;
+#if( configNUMBER_OF_CORES == 1 )
+	void vTaskSwitchContext( void ) PRIVILEGED_FUNCTION;
+#else
+	/* In an SMP build the port passes the ID of the core that is switching
+	context, which must be the calling core. */
+	void vTaskSwitchContext( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
@@ -2205,9 +2960,11 @@ BaseType_t xTaskGetSchedulerState( void ) PRIVILEGED_FUNCTION;
 
 /*
  * Raises the priority of the mutex holder to that of the calling task should
- * the mutex holder have a priority less than the calling task.
+ * the mutex holder have a priority less than the calling task.  Returns pdTRUE
+ * if the priority of the mutex holder depends on the calling task - that is if
+ * the calling task has a priority above the base priority of the holder.
  */
-void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
 
 /*
  * Set the priority of a task back to its proper priority in the case that it
@@ -2215,6 +2972,48 @@ void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTIO
  */
 BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
 
+/*
+ * Called, from within a critical section, when a task gives up waiting for a
+ * mutex.  Lowers the priority of the mutex holder to the higher of its base
+ * priority and uxHighestPriorityWaitingTask, the priority of the highest
+ * priority task still waiting for the mutex.  The priority is only lowered if
+ * the mutex is the only one the holder holds, as otherwise it is not known
+ * which mutex the priority was inherited through.  Returns pdTRUE if the
+ * priority was lowered.
+ */
+BaseType_t xTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, const UBaseType_t uxHighestPriorityWaitingTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called, from within a critical section, when the calling task takes a
+ * priority ceiling mutex.  Raises the priority of the calling task to
+ * uxCeilingPriority if it is not already at or above it, and returns the
+ * priority the task had before the call.
+ */
+UBaseType_t uxTaskPriorityRaiseToCeiling( const UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called, from within a critical section, when the holder of a priority
+ * ceiling mutex gives the mutex back.  uxPriorityBeforeCeiling is the value
+ * uxTaskPriorityRaiseToCeiling() returned when the mutex was taken.  If the
+ * holder holds no other mutexes it returns to its base priority, otherwise it
+ * returns to uxPriorityBeforeCeiling if nothing has raised it above the
+ * ceiling since.  Returns pdTRUE if the priority was lowered.
+ */
+BaseType_t xTaskPriorityCeilingRelease( TaskHandle_t const pxMutexHolder, const UBaseType_t uxCeilingPriority, const UBaseType_t uxPriorityBeforeCeiling ) PRIVILEGED_FUNCTION;
+
+/*
+ * Records the mutex the calling task is about to block on, or NULL once it is
+ * no longer blocked on it, so priority inheritance can follow chains of
+ * mutexes from a mutex holder to the holder of the mutex it is waiting for.
+ */
+void vTaskSetBlockingMutex( void *pvMutex ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the mutex set by vTaskSetBlockingMutex() if xTask is still blocked
+ * on it, otherwise NULL.  Must be called from within a critical section.
+ */
+void *pvTaskGetBlockingMutex( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
 /*
  * Get the uxTCBNumber assigned to the task referenced by the xTask parameter.
  */
@@ -2258,6 +3057,92 @@ eSleepModeStatus eTaskConfirmSleepModeStatus( void ) PRIVILEGED_FUNCTION;
  */
 void *pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Called without a critical section by a task that has
+ * just taken a fast mutex, passing its own handle as xMutexHolder so, on more
+ * than one core, the current task is not looked up again.  Increments the mutex
+ * held count of the calling task.
+ */
+void vTaskIncrementMutexHeldCount( TaskHandle_t xMutexHolder ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Called without a critical section when a fast mutex
+ * that no other task waited for is given back, passing the handle of the
+ * calling task as xMutexHolder.  Decrements the mutex held count of the
+ * calling task and returns pdTRUE, unless the mutex is the last one the task
+ * holds and the task is still above its base priority - which can happen if
+ * mutexes were given back in a different order to that in which they were
+ * taken - in which case the count is left unchanged, pdFALSE is returned, and
+ * xTaskPriorityDisinherit() must be called from a critical section instead.
+ */
+BaseType_t xTaskDecrementMutexHeldCount( TaskHandle_t xMutexHolder ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_WAKE_LATENCY_STATS == 1 )
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * THIS FUNCTION MUST BE CALLED WITH INTERRUPTS MASKED.
+	 *
+	 * The queue implementation sets xWaking to pdTRUE while it might unblock
+	 * tasks on behalf of an interrupt, and back to pdFALSE afterwards, so
+	 * xTaskRemoveFromEventList() records the time at which it unblocks them for
+	 * the wake latency statistics.
+	 */
+	void vTaskSetWakingFromISR( BaseType_t xWaking ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * THIS FUNCTION MUST BE CALLED WITH INTERRUPTS MASKED.
+	 *
+	 * Returns the value last set by vTaskSetWakingFromISR(), so the queue
+	 * implementation can tell whether it was called on behalf of an interrupt.
+	 */
+	BaseType_t xTaskGetWakingFromISR( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_WAKE_LATENCY_STATS */
+
+#if( configUSE_CRITICAL_PROFILER == 1 )
+
+	/*
+	 * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  They are called
+	 * by taskENTER_CRITICAL() and taskEXIT_CRITICAL(), from within the critical
+	 * section, to time it.
+	 */
+	void vTaskProfileEnterCritical( const char * const pcFile, const UBaseType_t uxLine ) PRIVILEGED_FUNCTION;
+	void vTaskProfileExitCritical( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_CRITICAL_PROFILER */
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	/*
+	 * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  They implement
+	 * the critical sections of the SMP scheduler, and the ports map
+	 * portENTER_CRITICAL(), portEXIT_CRITICAL(),
+	 * portSET_INTERRUPT_MASK_FROM_ISR() and portCLEAR_INTERRUPT_MASK_FROM_ISR()
+	 * onto them.  A task level critical section holds both the kernel task lock
+	 * and the kernel ISR lock, an interrupt level critical section holds only
+	 * the ISR lock.
+	 */
+	void vTaskEnterCritical( void ) PRIVILEGED_FUNCTION;
+	void vTaskExitCritical( void ) PRIVILEGED_FUNCTION;
+	UBaseType_t uxTaskEnterCriticalFromISR( void ) PRIVILEGED_FUNCTION;
+	void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * For internal use only.  portYIELD_WITHIN_API() maps to this function in
+	 * an SMP build.  If the calling task is inside a critical section the yield
+	 * is held pending until the critical section is exited, otherwise it is
+	 * performed immediately.
+	 */
+	void vTaskYieldWithinAPI( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configNUMBER_OF_CORES */
+
 #ifdef __cplusplus
 }
 #endif
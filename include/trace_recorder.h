@@ -0,0 +1,355 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include trace_recorder.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The trace recorder implements the trace macros by writing a fixed size,
+ * timestamped event record into a ring buffer in RAM each time one of them is
+ * called.  This header is included by FreeRTOS.h when configUSE_TRACE_RECORDER
+ * is set to 1 in FreeRTOSConfig.h, before FreeRTOS.h removes the unused trace
+ * macros, so the macros below take precedence.  Trace macros defined in
+ * FreeRTOSConfig.h take precedence over those below.
+ *
+ * Writing an event does not enter a critical section on ports that define
+ * portATOMIC_COMPARE_AND_SWAP_U32() - a slot is claimed by atomically
+ * incrementing the write index, and the slot's sequence number is written
+ * last to mark it complete.  Events can therefore be written from interrupts,
+ * and from several cores, at the same time.  When the buffer is full the
+ * oldest events are overwritten.
+ *
+ * The buffer is held in the xTraceRecorder structure, which is laid out so it
+ * can be dumped from RAM by a debugger, or sent from the target using
+ * pvTraceRecorderGetData() and traceRECORDER_DATA_SIZE, and converted to the
+ * Chrome/Perfetto trace format on the host by tools/freertos_trace.py.
+ */
+
+#ifndef configTRACE_RECORDER_EVENTS
+	#define configTRACE_RECORDER_EVENTS 512
+#endif
+
+#ifndef configTRACE_RECORDER_TASK_NAMES
+	#define configTRACE_RECORDER_TASK_NAMES 32
+#endif
+
+#ifndef configTRACE_RECORDER_TIMESTAMP
+	#ifdef portGET_RUN_TIME_COUNTER_VALUE
+		#define configTRACE_RECORDER_TIMESTAMP() portGET_RUN_TIME_COUNTER_VALUE()
+	#else
+		#error configTRACE_RECORDER_TIMESTAMP() must be defined when configUSE_TRACE_RECORDER is set to 1, unless portGET_RUN_TIME_COUNTER_VALUE() is defined
+	#endif
+#endif
+
+#ifndef configTRACE_RECORDER_TIMESTAMP_HZ
+	/* 0 means the frequency is not known, in which case it must be given to
+	the host tool. */
+	#define configTRACE_RECORDER_TIMESTAMP_HZ 0
+#endif
+
+#if( configUSE_TRACE_FACILITY != 1 )
+	#error configUSE_TRACE_RECORDER requires configUSE_TRACE_FACILITY to be set to 1, as tasks are identified by their task number
+#endif
+
+#if( ( configTRACE_RECORDER_EVENTS & ( configTRACE_RECORDER_EVENTS - 1 ) ) != 0 )
+	#error configTRACE_RECORDER_EVENTS must be a power of 2
+#endif
+
+#if( ( configTRACE_RECORDER_TASK_NAMES & ( configTRACE_RECORDER_TASK_NAMES - 1 ) ) != 0 )
+	#error configTRACE_RECORDER_TASK_NAMES must be a power of 2
+#endif
+
+#if( ( configNUMBER_OF_CORES > 1 ) && !defined( portATOMIC_COMPARE_AND_SWAP_U32 ) )
+	#error configUSE_TRACE_RECORDER requires the port to define portATOMIC_COMPARE_AND_SWAP_U32() when configNUMBER_OF_CORES is greater than 1
+#endif
+
+/* The layout of the recorder data.  It starts with the 8 byte magic string
+"FRTRACE" (including the terminating null), followed by the header words and
+the two tables below.  All the fields are 32-bit words in the byte order of the
+target, except those of TraceEvent_t that are marked otherwise.  Increment
+traceRECORDER_FORMAT_VERSION whenever the layout changes. */
+#define traceRECORDER_FORMAT_VERSION	1UL
+
+/* The task name table holds the names of the most recently created tasks.  The
+name of the task with task number N is held in entry
+( N - 1 ) % configTRACE_RECORDER_TASK_NAMES, so an entry is only valid for the
+task number it holds. */
+#define traceRECORDER_NAME_LENGTH		( ( configMAX_TASK_NAME_LEN + 3 ) & ~3 )
+
+/* Event codes, as held in TraceEvent_t.ucEvent.  A task is identified by its
+task number, a queue, timer or event group by its address. */
+#define traceEVENT_TASK_SWITCHED_IN			1U	/* Param1: task, Param2: priority. */
+#define traceEVENT_TASK_CREATE				2U	/* Param1: task, Param2: priority. */
+#define traceEVENT_TASK_DELETE				3U	/* Param1: task. */
+#define traceEVENT_TASK_READY				4U	/* Param1: task. */
+#define traceEVENT_TASK_DELAY				5U	/* Param1: task. */
+#define traceEVENT_TASK_DELAY_UNTIL			6U	/* Param1: task, Param2: tick time to wake. */
+#define traceEVENT_TASK_SUSPEND				7U	/* Param1: task. */
+#define traceEVENT_TASK_RESUME				8U	/* Param1: task. */
+#define traceEVENT_TASK_RESUME_FROM_ISR		9U	/* Param1: task. */
+#define traceEVENT_TASK_PRIORITY_SET		10U	/* Param1: task, Param2: new priority. */
+#define traceEVENT_TASK_PRIORITY_INHERIT	11U	/* Param1: mutex holder, Param2: inherited priority. */
+#define traceEVENT_TASK_PRIORITY_DISINHERIT	12U	/* Param1: mutex holder, Param2: restored priority. */
+#define traceEVENT_TASK_DEADLINE_MISSED		13U	/* Param1: task. */
+#define traceEVENT_TASK_BUDGET_EXHAUSTED	14U	/* Param1: task. */
+#define traceEVENT_QUEUE_SEND				20U	/* Param1: queue, Param2: items in the queue before the send. */
+#define traceEVENT_QUEUE_SEND_FAILED		21U	/* Param1: queue. */
+#define traceEVENT_QUEUE_SEND_FROM_ISR		22U	/* Param1: queue, Param2: items in the queue before the send. */
+#define traceEVENT_QUEUE_RECEIVE			23U	/* Param1: queue, Param2: items in the queue before the receive. */
+#define traceEVENT_QUEUE_RECEIVE_FAILED		24U	/* Param1: queue. */
+#define traceEVENT_QUEUE_RECEIVE_FROM_ISR	25U	/* Param1: queue, Param2: items in the queue before the receive. */
+#define traceEVENT_QUEUE_BLOCK_ON_SEND		26U	/* Param1: queue. */
+#define traceEVENT_QUEUE_BLOCK_ON_RECEIVE	27U	/* Param1: queue. */
+#define traceEVENT_TIMER_EXPIRED			30U	/* Param1: timer. */
+#define traceEVENT_EVENT_GROUP_SET_BITS		31U	/* Param1: event group, Param2: bits set. */
+#define traceEVENT_MALLOC					40U	/* Param1: address, Param2: size. */
+#define traceEVENT_FREE						41U	/* Param1: address, Param2: size. */
+
+typedef struct xTRACE_EVENT
+{
+	uint32_t ulSequence;		/* One more than the index of the event, or 0 if the slot is empty or being written. */
+	uint32_t ulTimestamp;		/* configTRACE_RECORDER_TIMESTAMP() when the event was recorded. */
+	uint32_t ulParam1;
+	uint32_t ulParam2;
+	uint8_t ucEvent;			/* One of the traceEVENT_ codes above (byte). */
+	uint8_t ucCore;				/* The core on which the event was recorded (byte). */
+	uint16_t usReserved;
+} TraceEvent_t;
+
+typedef struct xTRACE_TASK_NAME
+{
+	uint32_t ulTaskNumber;		/* 0 if the entry is not used. */
+	char cName[ traceRECORDER_NAME_LENGTH ];
+} TraceTaskName_t;
+
+typedef struct xTRACE_RECORDER
+{
+	char cMagic[ 8 ];
+	uint32_t ulVersion;
+	uint32_t ulEvents;				/* configTRACE_RECORDER_EVENTS. */
+	uint32_t ulTaskNames;			/* configTRACE_RECORDER_TASK_NAMES. */
+	uint32_t ulNameLength;			/* traceRECORDER_NAME_LENGTH. */
+	uint32_t ulTimestampHz;			/* configTRACE_RECORDER_TIMESTAMP_HZ. */
+	uint32_t ulCores;				/* configNUMBER_OF_CORES. */
+	volatile uint32_t ulEnabled;
+	volatile uint32_t ulWriteIndex;	/* The index of the next event to be written.  Event N is held in xEvents[ N % configTRACE_RECORDER_EVENTS ]. */
+	TraceTaskName_t xTaskNames[ configTRACE_RECORDER_TASK_NAMES ];
+	volatile TraceEvent_t xEvents[ configTRACE_RECORDER_EVENTS ];
+} TraceRecorder_t;
+
+#define traceRECORDER_DATA_SIZE		sizeof( TraceRecorder_t )
+
+/*
+ * Called by the trace macros below - not for use by application code.
+ */
+void vTraceRecordEvent( uint8_t ucEvent, uint32_t ulParam1, uint32_t ulParam2 ) PRIVILEGED_FUNCTION;
+void vTraceRecordTaskName( uint32_t ulTaskNumber, const char *pcName ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+/*
+ * Start or stop recording events.  Events are recorded from reset, so the
+ * creation of the tasks is recorded too.  The recorder can be stopped to
+ * freeze the buffer before it is dumped - for example from an assert handler
+ * or when a fault is detected.  Task names are recorded even while the
+ * recorder is stopped.
+ */
+void vTraceRecorderStart( void ) PRIVILEGED_FUNCTION;
+void vTraceRecorderStop( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the address of the recorder data, which is traceRECORDER_DATA_SIZE
+ * bytes long, so it can be written to a file or sent to a host.  The recorder
+ * should be stopped first.
+ */
+const void *pvTraceRecorderGetData( void ) PRIVILEGED_FUNCTION;
+
+#define traceRECORD_TASK( ucEvent, pxTCB, ulParam2 ) vTraceRecordEvent( ( ucEvent ), ( uint32_t ) ( pxTCB )->uxTCBNumber, ( uint32_t ) ( ulParam2 ) )
+#define traceRECORD_OBJECT( ucEvent, pvObject, ulParam2 ) vTraceRecordEvent( ( ucEvent ), ( uint32_t ) ( portPOINTER_SIZE_TYPE ) ( pvObject ), ( uint32_t ) ( ulParam2 ) )
+
+#ifndef traceTASK_SWITCHED_IN
+	#define traceTASK_SWITCHED_IN() traceRECORD_TASK( traceEVENT_TASK_SWITCHED_IN, pxCurrentTCB, pxCurrentTCB->uxPriority )
+#endif
+
+#ifndef traceTASK_CREATE
+	#define traceTASK_CREATE( pxNewTCB )														\
+	{																							\
+		vTraceRecordTaskName( ( uint32_t ) ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->pcTaskName );	\
+		traceRECORD_TASK( traceEVENT_TASK_CREATE, pxNewTCB, ( pxNewTCB )->uxPriority );		\
+	}
+#endif
+
+#ifndef traceTASK_DELETE
+	#define traceTASK_DELETE( pxTaskToDelete ) traceRECORD_TASK( traceEVENT_TASK_DELETE, pxTaskToDelete, 0 )
+#endif
+
+#ifndef traceMOVED_TASK_TO_READY_STATE
+	#define traceMOVED_TASK_TO_READY_STATE( pxTCB ) traceRECORD_TASK( traceEVENT_TASK_READY, pxTCB, 0 )
+#endif
+
+#ifndef traceTASK_DELAY
+	#define traceTASK_DELAY() traceRECORD_TASK( traceEVENT_TASK_DELAY, pxCurrentTCB, 0 )
+#endif
+
+#ifndef traceTASK_DELAY_UNTIL
+	#define traceTASK_DELAY_UNTIL( xTimeToWake ) traceRECORD_TASK( traceEVENT_TASK_DELAY_UNTIL, pxCurrentTCB, xTimeToWake )
+#endif
+
+#ifndef traceTASK_SUSPEND
+	#define traceTASK_SUSPEND( pxTaskToSuspend ) traceRECORD_TASK( traceEVENT_TASK_SUSPEND, pxTaskToSuspend, 0 )
+#endif
+
+#ifndef traceTASK_RESUME
+	#define traceTASK_RESUME( pxTaskToResume ) traceRECORD_TASK( traceEVENT_TASK_RESUME, pxTaskToResume, 0 )
+#endif
+
+#ifndef traceTASK_RESUME_FROM_ISR
+	#define traceTASK_RESUME_FROM_ISR( pxTaskToResume ) traceRECORD_TASK( traceEVENT_TASK_RESUME_FROM_ISR, pxTaskToResume, 0 )
+#endif
+
+#ifndef traceTASK_PRIORITY_SET
+	#define traceTASK_PRIORITY_SET( pxTask, uxNewPriority ) traceRECORD_TASK( traceEVENT_TASK_PRIORITY_SET, pxTask, uxNewPriority )
+#endif
+
+#ifndef traceTASK_PRIORITY_INHERIT
+	#define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority ) traceRECORD_TASK( traceEVENT_TASK_PRIORITY_INHERIT, pxTCBOfMutexHolder, uxInheritedPriority )
+#endif
+
+#ifndef traceTASK_PRIORITY_DISINHERIT
+	#define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority ) traceRECORD_TASK( traceEVENT_TASK_PRIORITY_DISINHERIT, pxTCBOfMutexHolder, uxOriginalPriority )
+#endif
+
+#ifndef traceTASK_DEADLINE_MISSED
+	#define traceTASK_DEADLINE_MISSED( pxTCB ) traceRECORD_TASK( traceEVENT_TASK_DEADLINE_MISSED, pxTCB, 0 )
+#endif
+
+#ifndef traceTASK_BUDGET_EXHAUSTED
+	#define traceTASK_BUDGET_EXHAUSTED( pxTCB ) traceRECORD_TASK( traceEVENT_TASK_BUDGET_EXHAUSTED, pxTCB, 0 )
+#endif
+
+#ifndef traceQUEUE_SEND
+	#define traceQUEUE_SEND( pxQueue ) traceRECORD_OBJECT( traceEVENT_QUEUE_SEND, pxQueue, ( pxQueue )->uxMessagesWaiting )
+#endif
+
+#ifndef traceQUEUE_SEND_FAILED
+	#define traceQUEUE_SEND_FAILED( pxQueue ) traceRECORD_OBJECT( traceEVENT_QUEUE_SEND_FAILED, pxQueue, 0 )
+#endif
+
+#ifndef traceQUEUE_SEND_FROM_ISR
+	#define traceQUEUE_SEND_FROM_ISR( pxQueue ) traceRECORD_OBJECT( traceEVENT_QUEUE_SEND_FROM_ISR, pxQueue, ( pxQueue )->uxMessagesWaiting )
+#endif
+
+#ifndef traceQUEUE_RECEIVE
+	#define traceQUEUE_RECEIVE( pxQueue ) traceRECORD_OBJECT( traceEVENT_QUEUE_RECEIVE, pxQueue, ( pxQueue )->uxMessagesWaiting )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_FAILED
+	#define traceQUEUE_RECEIVE_FAILED( pxQueue ) traceRECORD_OBJECT( traceEVENT_QUEUE_RECEIVE_FAILED, pxQueue, 0 )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_FROM_ISR
+	#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue ) traceRECORD_OBJECT( traceEVENT_QUEUE_RECEIVE_FROM_ISR, pxQueue, ( pxQueue )->uxMessagesWaiting )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_SEND
+	#define traceBLOCKING_ON_QUEUE_SEND( pxQueue ) traceRECORD_OBJECT( traceEVENT_QUEUE_BLOCK_ON_SEND, pxQueue, 0 )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_RECEIVE
+	#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue ) traceRECORD_OBJECT( traceEVENT_QUEUE_BLOCK_ON_RECEIVE, pxQueue, 0 )
+#endif
+
+#ifndef traceTIMER_EXPIRED
+	#define traceTIMER_EXPIRED( pxTimer ) traceRECORD_OBJECT( traceEVENT_TIMER_EXPIRED, pxTimer, 0 )
+#endif
+
+#ifndef traceEVENT_GROUP_SET_BITS
+	#define traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet ) traceRECORD_OBJECT( traceEVENT_EVENT_GROUP_SET_BITS, xEventGroup, uxBitsToSet )
+#endif
+
+#ifndef traceMALLOC
+	#define traceMALLOC( pvAddress, uiSize ) traceRECORD_OBJECT( traceEVENT_MALLOC, pvAddress, uiSize )
+#endif
+
+#ifndef traceFREE
+	#define traceFREE( pvAddress, uiSize ) traceRECORD_OBJECT( traceEVENT_FREE, pvAddress, uiSize )
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_RECORDER_H */
+
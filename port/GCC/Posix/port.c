@@ -0,0 +1,924 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the Linux/POSIX
+ * simulator port.
+ *
+ * Each task is backed by a host pthread.  Only the thread of the task
+ * referenced by pxCurrentTCB is ever allowed to run kernel or application
+ * code, every other task thread is parked on its own wake event.  A context
+ * switch therefore wakes the thread of the task being switched in, then parks
+ * the thread of the task being switched out.
+ *
+ * The tick interrupt is generated by an ITIMER_REAL interval timer.  The
+ * SIGALRM signal it raises plays the part of the tick interrupt, so disabling
+ * interrupts is implemented by blocking SIGALRM in the calling thread.  Task
+ * threads only ever unblock SIGALRM while they are the running task, so the
+ * signal is always delivered to (and handled on) the running task's thread.
+ *
+ * When configNUMBER_OF_CORES is greater than 1 the thread of the task running
+ * on each core executes concurrently, so each running thread is a simulated
+ * core.  Cores interrupt each other with SIGUSR1, which is masked along with
+ * SIGALRM when interrupts are disabled.
+ *
+ * Host C library functions that take internal locks (printf(), malloc(),
+ * etc.) must not be interrupted by a context switch, otherwise the task that
+ * is switched in can deadlock on the lock held by the task that was switched
+ * out.  Call such functions from within a critical section, or with the
+ * scheduler suspended.
+ *----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The signal used to simulate the tick interrupt. */
+#define portTICK_SIGNAL				SIGALRM
+
+/* The signal used to simulate the inter-core interrupt of SMP builds. */
+#define portYIELD_CORE_SIGNAL		SIGUSR1
+
+/* The critical nesting count is initialised to a non zero value so interrupts
+are not accidentally enabled before the scheduler starts. */
+#define portINITIAL_CRITICAL_NESTING	( ( UBaseType_t ) 0xaaaaaaaa )
+
+/* A binary wake event that a task thread is parked on while it is not the
+running task. */
+typedef struct EVENT
+{
+	pthread_mutex_t xMutex;
+	pthread_cond_t xCond;
+	BaseType_t xSignalled;
+} Event_t;
+
+/* The per task data maintained by the port.  It is stored at the top of the
+FreeRTOS stack allocated for the task, and the task's pxTopOfStack is set to
+point just below it, so it can always be located from the TCB. */
+typedef struct THREAD
+{
+	pthread_t xThread;
+	TaskFunction_t pxCode;
+	void *pvParameters;
+	volatile BaseType_t xDying;
+	Event_t xWakeEvent;
+	#if( configNUMBER_OF_CORES > 1 )
+		volatile BaseType_t xCoreID;	/*< The core the thread was last switched in on. */
+	#endif
+} Thread_t;
+
+/* pxTopOfStack is the first member of the TCB, and this port never moves it
+after pxPortInitialiseStack() has set it. */
+#define prvGetThreadFromTask( xTask ) ( ( Thread_t * ) ( ( *( StackType_t ** ) ( xTask ) ) + 1 ) )
+
+#if( configNUMBER_OF_CORES == 1 )
+
+	/* Pointer to the TCB of the currently executing task. */
+	extern void * volatile pxCurrentTCB;
+
+	/* Each task maintains its own interrupt status in the critical nesting
+	variable.  The value is saved on the host stack of a thread that is
+	switched out, and restored when that thread is switched back in. */
+	static volatile UBaseType_t uxCriticalNesting = portINITIAL_CRITICAL_NESTING;
+
+#else
+
+	/* Pointers to the TCBs of the tasks running on each core. */
+	extern void * volatile pxCurrentTCBs[];
+
+	/* The core the calling thread is running on.  Only valid in the thread of
+	a task that is running. */
+	static __thread BaseType_t xThreadCoreID = 0;
+
+	/* The kernel spinlocks. */
+	static volatile int iPortLocks[ 2 ] = { 0, 0 };
+
+	/* Set by vPortEndScheduler() to stop the other cores. */
+	static volatile BaseType_t xSchedulerEnded = pdFALSE;
+
+#endif /* configNUMBER_OF_CORES */
+
+/* The set of signals that are masked when interrupts are disabled. */
+static sigset_t xInterruptSignals;
+
+/* Set once the signal handling has been configured. */
+static BaseType_t xSignalsInitialised = pdFALSE;
+
+/* The thread that called vTaskStartScheduler() waits on this event until
+vTaskEndScheduler() is called. */
+static Event_t xSchedulerEndEvent;
+
+/* The host monotonic time at which the port was initialised, used as the
+zero point of the run time counter. */
+static struct timespec xStartTime;
+
+/*
+ * Setup the timer to generate the tick interrupts.
+ */
+static void prvSetupTimerInterrupt( void );
+
+/*
+ * Install the simulated tick interrupt handler and mask the simulated
+ * interrupts in the thread that is creating the tasks.
+ */
+static void prvSetupSignals( void );
+
+/*
+ * The simulated tick interrupt handler.
+ */
+static void prvTickSignalHandler( int iSignal );
+
+/*
+ * The part of the simulated tick interrupt that increments the RTOS tick,
+ * bracketed by vTaskISREnter() and vTaskISRExit() when interrupt run time is
+ * being recorded.
+ */
+static BaseType_t prvIncrementTick( void );
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	/*
+	 * The simulated inter-core interrupt handler.  Reschedules the core it
+	 * runs on.
+	 */
+	static void prvYieldCoreSignalHandler( int iSignal );
+
+#endif
+
+/*
+ * The entry point of every task thread.  The thread parks itself until the
+ * scheduler switches to it for the first time, then calls the task function.
+ */
+static void *prvWaitForStart( void *pvParameters );
+
+/*
+ * Wake the thread of the task being switched in, then park the thread of the
+ * task being switched out.
+ */
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend );
+
+/*
+ * Wake event primitives.
+ */
+static void prvEventInit( Event_t *pxEvent );
+static void prvEventDelete( Event_t *pxEvent );
+static void prvEventSignal( Event_t *pxEvent );
+static void prvEventWait( Event_t *pxEvent );
+static void prvEventUnlockOnCancel( void *pvMutex );
+
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+pthread_attr_t xThreadAttributes;
+size_t xThreadStackSize;
+UBaseType_t uxSavedInterruptStatus;
+int iReturned;
+
+	if( xSignalsInitialised == pdFALSE )
+	{
+		prvSetupSignals();
+	}
+
+	/* Store the thread data at the top of the stack.  The address is aligned
+	down as the thread data contains host synchronisation objects. */
+	pxThread = ( Thread_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxTopOfStack + 1 ) - sizeof( Thread_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+	pxTopOfStack = ( StackType_t * ) pxThread - 1;
+
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xDying = pdFALSE;
+	prvEventInit( &( pxThread->xWakeEvent ) );
+
+	#if( configNUMBER_OF_CORES > 1 )
+	{
+		pxThread->xCoreID = 0;
+	}
+	#endif
+
+	xThreadStackSize = ( size_t ) portPOSIX_THREAD_STACK_SIZE;
+	if( xThreadStackSize < ( size_t ) PTHREAD_STACK_MIN )
+	{
+		xThreadStackSize = ( size_t ) PTHREAD_STACK_MIN;
+	}
+
+	( void ) pthread_attr_init( &xThreadAttributes );
+	( void ) pthread_attr_setstacksize( &xThreadAttributes, xThreadStackSize );
+
+	/* The new thread inherits the signal mask of the creating thread, so the
+	thread is created with the simulated interrupts masked. */
+	uxSavedInterruptStatus = uxPortSetInterruptMask();
+	{
+		iReturned = pthread_create( &( pxThread->xThread ), &xThreadAttributes, prvWaitForStart, pxThread );
+	}
+	vPortClearInterruptMask( uxSavedInterruptStatus );
+
+	( void ) pthread_attr_destroy( &xThreadAttributes );
+	configASSERT( iReturned == 0 );
+	( void ) iReturned;
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvWaitForStart( void *pvParameters )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParameters;
+
+	/* Park until the scheduler selects this task for the first time. */
+	prvEventWait( &( pxThread->xWakeEvent ) );
+
+	/* This thread is now the running task.  A task always starts with
+	interrupts enabled. */
+	#if( configNUMBER_OF_CORES == 1 )
+	{
+		uxCriticalNesting = 0;
+	}
+	#else
+	{
+		xThreadCoreID = pxThread->xCoreID;
+	}
+	#endif
+	vPortEnableInterrupts();
+
+	pxThread->pxCode( pxThread->pvParameters );
+
+	/* A function that implements a task must not exit or attempt to return to
+	its caller as there is nothing to return to.  If a task wants to exit it
+	should instead call vTaskDelete( NULL ). */
+	#if( INCLUDE_vTaskDelete == 1 )
+	{
+		vTaskDelete( NULL );
+	}
+	#else
+	{
+		#if( configNUMBER_OF_CORES == 1 )
+		{
+			configASSERT( uxCriticalNesting == ~0UL );
+		}
+		#else
+		{
+			configASSERT( xSchedulerEnded != pdFALSE );
+		}
+		#endif
+		portDISABLE_INTERRUPTS();
+		for( ;; );
+	}
+	#endif
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+Thread_t *pxFirstThread;
+#if( configNUMBER_OF_CORES > 1 )
+	BaseType_t xCoreID;
+#endif
+
+	if( xSignalsInitialised == pdFALSE )
+	{
+		prvSetupSignals();
+	}
+
+	/* Start the timer that generates the tick ISR.  Interrupts are disabled
+	here already. */
+	prvSetupTimerInterrupt();
+
+	/* Start the first task.  From here on the calling thread takes no further
+	part in scheduling, it just waits for vTaskEndScheduler() to be called. */
+	#if( configNUMBER_OF_CORES == 1 )
+	{
+		pxFirstThread = prvGetThreadFromTask( pxCurrentTCB );
+		prvEventSignal( &( pxFirstThread->xWakeEvent ) );
+	}
+	#else
+	{
+		/* Start the first task of every core.  Only the thread of a core can
+		change the task selected for that core, so none of the selections can
+		change until the thread has been started. */
+		for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+		{
+			pxFirstThread = prvGetThreadFromTask( pxCurrentTCBs[ xCoreID ] );
+			pxFirstThread->xCoreID = xCoreID;
+			prvEventSignal( &( pxFirstThread->xWakeEvent ) );
+		}
+	}
+	#endif
+
+	prvEventWait( &xSchedulerEndEvent );
+
+	return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer;
+Thread_t *pxThread;
+#if( configNUMBER_OF_CORES > 1 )
+	BaseType_t xCoreID;
+#endif
+
+	/* Stop the tick. */
+	( void ) memset( &xTimer, 0x00, sizeof( xTimer ) );
+	( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	#if( configNUMBER_OF_CORES == 1 )
+	{
+		pxThread = prvGetThreadFromTask( pxCurrentTCB );
+	}
+	#else
+	{
+		/* Interrupt the other cores so they park themselves. */
+		xSchedulerEnded = pdTRUE;
+		pxThread = prvGetThreadFromTask( pxCurrentTCBs[ xThreadCoreID ] );
+
+		for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+		{
+			if( xCoreID != xThreadCoreID )
+			{
+				vPortYieldCore( xCoreID );
+			}
+		}
+	}
+	#endif
+
+	/* Let the thread that started the scheduler return from
+	vTaskStartScheduler(), then park the calling task for good. */
+	prvEventSignal( &xSchedulerEndEvent );
+
+	if( pthread_equal( pthread_self(), pxThread->xThread ) != 0 )
+	{
+		for( ;; )
+		{
+			prvEventWait( &( pxThread->xWakeEvent ) );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES == 1 )
+
+	void vPortYield( void )
+	{
+	Thread_t *pxThreadToSuspend, *pxThreadToResume;
+
+		vPortEnterCritical();
+		{
+			pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCB );
+			vTaskSwitchContext();
+			pxThreadToResume = prvGetThreadFromTask( pxCurrentTCB );
+
+			prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+		}
+		vPortExitCritical();
+	}
+
+#else
+
+	void vPortYield( void )
+	{
+	Thread_t *pxThreadToSuspend, *pxThreadToResume;
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* The interrupt mask is saved on the host stack of the calling thread,
+		so it is restored when the thread is switched back in.  Only the thread
+		of a core switches the task running on that core, so pxCurrentTCBs[]
+		can be read here without holding a kernel lock. */
+		uxSavedInterruptStatus = uxPortSetInterruptMask();
+		{
+			pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCBs[ xThreadCoreID ] );
+			vTaskSwitchContext( xThreadCoreID );
+			pxThreadToResume = prvGetThreadFromTask( pxCurrentTCBs[ xThreadCoreID ] );
+
+			prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+		}
+		vPortClearInterruptMask( uxSavedInterruptStatus );
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	( void ) pthread_sigmask( SIG_BLOCK, &xInterruptSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	( void ) pthread_sigmask( SIG_UNBLOCK, &xInterruptSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES == 1 )
+
+	void vPortEnterCritical( void )
+	{
+		portDISABLE_INTERRUPTS();
+		uxCriticalNesting++;
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES == 1 )
+
+	void vPortExitCritical( void )
+	{
+		configASSERT( uxCriticalNesting );
+		uxCriticalNesting--;
+		if( uxCriticalNesting == 0 )
+		{
+			portENABLE_INTERRUPTS();
+		}
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+sigset_t xPreviousSignals;
+
+	( void ) pthread_sigmask( SIG_BLOCK, &xInterruptSignals, &xPreviousSignals );
+
+	/* Return 1 if the simulated interrupts were already masked, in which case
+	vPortClearInterruptMask() must leave them masked. */
+	return ( UBaseType_t ) ( sigismember( &xPreviousSignals, portTICK_SIGNAL ) == 1 );
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxMask )
+{
+	if( uxMask == 0U )
+	{
+		portENABLE_INTERRUPTS();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvIncrementTick( void )
+{
+BaseType_t xSwitchRequired;
+
+	#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+	{
+		vTaskISREnter();
+	}
+	#endif
+
+	xSwitchRequired = xTaskIncrementTick();
+
+	#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+	{
+		vTaskISRExit();
+	}
+	#endif
+
+	return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES == 1 )
+
+	static void prvTickSignalHandler( int iSignal )
+	{
+	Thread_t *pxThreadToSuspend, *pxThreadToResume;
+
+		( void ) iSignal;
+
+		/* The tick signal is blocked while its handler executes, which is the
+		equivalent of the tick interrupt running with interrupts masked. */
+		uxCriticalNesting++;
+
+		pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCB );
+
+		/* Increment the RTOS tick.  The context switch is left out of the
+		interrupt run time, as the thread switched to does not return through
+		this handler. */
+		if( prvIncrementTick() != pdFALSE )
+		{
+			vTaskSwitchContext();
+			pxThreadToResume = prvGetThreadFromTask( pxCurrentTCB );
+
+			prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+		}
+
+		uxCriticalNesting--;
+	}
+
+#else
+
+	static void prvTickSignalHandler( int iSignal )
+	{
+	Thread_t *pxThreadToSuspend, *pxThreadToResume;
+
+		( void ) iSignal;
+
+		/* The tick is handled by whichever core the host delivers it to.
+		xTaskIncrementTick() interrupts any other core that has to switch
+		task. */
+		pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCBs[ xThreadCoreID ] );
+
+		if( prvIncrementTick() != pdFALSE )
+		{
+			vTaskSwitchContext( xThreadCoreID );
+			pxThreadToResume = prvGetThreadFromTask( pxCurrentTCBs[ xThreadCoreID ] );
+
+			prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+		}
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	static void prvYieldCoreSignalHandler( int iSignal )
+	{
+	Thread_t *pxThreadToSuspend, *pxThreadToResume;
+
+		( void ) iSignal;
+
+		pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCBs[ xThreadCoreID ] );
+
+		if( xSchedulerEnded != pdFALSE )
+		{
+			/* vTaskEndScheduler() was called on another core. */
+			for( ;; )
+			{
+				prvEventWait( &( pxThreadToSuspend->xWakeEvent ) );
+			}
+		}
+
+		vTaskSwitchContext( xThreadCoreID );
+		pxThreadToResume = prvGetThreadFromTask( pxCurrentTCBs[ xThreadCoreID ] );
+
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	BaseType_t xPortGetCoreID( void )
+	{
+		return xThreadCoreID;
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	void vPortYieldCore( BaseType_t xCoreID )
+	{
+	Thread_t *pxThread;
+
+		/* Called with the kernel locks held, so the task running on the core
+		cannot change.  If the thread of that task has not been woken yet then
+		the signal stays pending until it unmasks interrupts. */
+		pxThread = prvGetThreadFromTask( pxCurrentTCBs[ xCoreID ] );
+		( void ) pthread_kill( pxThread->xThread, portYIELD_CORE_SIGNAL );
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	void vPortWaitForInterrupt( void )
+	{
+	struct timespec xTickPeriod;
+
+		/* Called by an idle task, so the simulated interrupts are not masked.
+		A yield request from another core, or the tick, ends the sleep and
+		switches the thread out from within the signal handler.  The tick is
+		delivered to only one of the threads, so the sleep is bounded by the
+		tick period, which keeps time slicing and the clean up of deleted tasks
+		going on every core. */
+		xTickPeriod.tv_sec = ( time_t ) ( portTICK_PERIOD_US / 1000000UL );
+		xTickPeriod.tv_nsec = ( long ) ( portTICK_PERIOD_US % 1000000UL ) * 1000L;
+		( void ) nanosleep( &xTickPeriod, NULL );
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	void vPortGetLock( BaseType_t xLock )
+	{
+		while( __sync_lock_test_and_set( &( iPortLocks[ xLock ] ), 1 ) != 0 )
+		{
+			/* The host may have descheduled the thread that holds the lock,
+			so give the host CPU away while waiting. */
+			while( iPortLocks[ xLock ] != 0 )
+			{
+				( void ) sched_yield();
+			}
+		}
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	void vPortReleaseLock( BaseType_t xLock )
+	{
+		__sync_lock_release( &( iPortLocks[ xLock ] ) );
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend )
+{
+#if( configNUMBER_OF_CORES == 1 )
+	UBaseType_t uxSavedCriticalNesting;
+#endif
+
+	if( pxThreadToSuspend != pxThreadToResume )
+	{
+		#if( configNUMBER_OF_CORES == 1 )
+		{
+			/* The critical nesting count is per task, so save it on the host
+			stack of the thread being switched out. */
+			uxSavedCriticalNesting = uxCriticalNesting;
+		}
+		#else
+		{
+			/* The task being switched in runs on the calling thread's core. */
+			pxThreadToResume->xCoreID = xThreadCoreID;
+		}
+		#endif
+
+		prvEventSignal( &( pxThreadToResume->xWakeEvent ) );
+
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			/* The task deleted itself - its resources are freed by
+			vPortCancelThread() when the TCB is deleted. */
+			pthread_exit( NULL );
+		}
+
+		prvEventWait( &( pxThreadToSuspend->xWakeEvent ) );
+
+		#if( configNUMBER_OF_CORES == 1 )
+		{
+			uxCriticalNesting = uxSavedCriticalNesting;
+		}
+		#else
+		{
+			/* The task may have been switched back in on a different core. */
+			xThreadCoreID = pxThreadToSuspend->xCoreID;
+		}
+		#endif
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void *pvTaskToDelete, volatile BaseType_t *pxPendYield )
+{
+Thread_t *pxThread = prvGetThreadFromTask( pvTaskToDelete );
+
+	pxThread->xDying = pdTRUE;
+
+	/* The yield is performed by vTaskDelete() once the critical section is
+	exited. */
+	( void ) pxPendYield;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void *pvTaskToDelete )
+{
+Thread_t *pxThread = prvGetThreadFromTask( pvTaskToDelete );
+UBaseType_t uxSavedInterruptStatus;
+
+	/* The thread is either parked on its wake event, or has already exited
+	because the task deleted itself.  Either way it can be reaped here.  The
+	idle task calls this function outside of a critical section, but
+	pthread_join() takes C library locks, so the simulated interrupts are
+	masked to stop the calling task being switched out while holding them. */
+	uxSavedInterruptStatus = uxPortSetInterruptMask();
+	{
+		( void ) pthread_cancel( pxThread->xThread );
+		( void ) pthread_join( pxThread->xThread, NULL );
+	}
+	vPortClearInterruptMask( uxSavedInterruptStatus );
+
+	prvEventDelete( &( pxThread->xWakeEvent ) );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortGetRunTimeCounterValue( void )
+{
+struct timespec xNow;
+uint64_t ullMicroseconds;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+	ullMicroseconds = ( ( uint64_t ) ( xNow.tv_sec - xStartTime.tv_sec ) * 1000000ULL );
+	ullMicroseconds += ( uint64_t ) ( ( xNow.tv_nsec - xStartTime.tv_nsec ) / 1000L );
+
+	return ( uint32_t ) ullMicroseconds;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignals( void )
+{
+struct sigaction xTickAction;
+#if( configNUMBER_OF_CORES > 1 )
+	struct sigaction xYieldCoreAction;
+#endif
+
+	xSignalsInitialised = pdTRUE;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xStartTime );
+	prvEventInit( &xSchedulerEndEvent );
+
+	( void ) sigemptyset( &xInterruptSignals );
+	( void ) sigaddset( &xInterruptSignals, portTICK_SIGNAL );
+	#if( configNUMBER_OF_CORES > 1 )
+	{
+		( void ) sigaddset( &xInterruptSignals, portYIELD_CORE_SIGNAL );
+	}
+	#endif
+
+	/* Mask the simulated interrupts in the thread that creates the tasks.
+	Every task thread inherits the mask, and only unmasks the simulated
+	interrupts once it is running. */
+	( void ) pthread_sigmask( SIG_BLOCK, &xInterruptSignals, NULL );
+
+	( void ) memset( &xTickAction, 0x00, sizeof( xTickAction ) );
+	xTickAction.sa_handler = prvTickSignalHandler;
+	xTickAction.sa_flags = SA_RESTART;
+	( void ) sigfillset( &( xTickAction.sa_mask ) );
+	( void ) sigaction( portTICK_SIGNAL, &xTickAction, NULL );
+
+	#if( configNUMBER_OF_CORES > 1 )
+	{
+		( void ) memset( &xYieldCoreAction, 0x00, sizeof( xYieldCoreAction ) );
+		xYieldCoreAction.sa_handler = prvYieldCoreSignalHandler;
+		xYieldCoreAction.sa_flags = SA_RESTART;
+		( void ) sigfillset( &( xYieldCoreAction.sa_mask ) );
+		( void ) sigaction( portYIELD_CORE_SIGNAL, &xYieldCoreAction, NULL );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Setup the interval timer to generate the tick interrupts at the required
+ * frequency.
+ */
+static void prvSetupTimerInterrupt( void )
+{
+struct itimerval xTimer;
+
+	xTimer.it_interval.tv_sec = ( time_t ) ( portTICK_PERIOD_US / 1000000UL );
+	xTimer.it_interval.tv_usec = ( suseconds_t ) ( portTICK_PERIOD_US % 1000000UL );
+	xTimer.it_value = xTimer.it_interval;
+
+	( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventInit( Event_t *pxEvent )
+{
+	( void ) pthread_mutex_init( &( pxEvent->xMutex ), NULL );
+	( void ) pthread_cond_init( &( pxEvent->xCond ), NULL );
+	pxEvent->xSignalled = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventDelete( Event_t *pxEvent )
+{
+	( void ) pthread_cond_destroy( &( pxEvent->xCond ) );
+	( void ) pthread_mutex_destroy( &( pxEvent->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventSignal( Event_t *pxEvent )
+{
+	( void ) pthread_mutex_lock( &( pxEvent->xMutex ) );
+	{
+		pxEvent->xSignalled = pdTRUE;
+		( void ) pthread_cond_signal( &( pxEvent->xCond ) );
+	}
+	( void ) pthread_mutex_unlock( &( pxEvent->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventUnlockOnCancel( void *pvMutex )
+{
+	( void ) pthread_mutex_unlock( ( pthread_mutex_t * ) pvMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventWait( Event_t *pxEvent )
+{
+	( void ) pthread_mutex_lock( &( pxEvent->xMutex ) );
+
+	/* pthread_cond_wait() is a cancellation point, so make sure the mutex is
+	released if the thread is cancelled while it is parked. */
+	pthread_cleanup_push( prvEventUnlockOnCancel, &( pxEvent->xMutex ) );
+	{
+		while( pxEvent->xSignalled == pdFALSE )
+		{
+			( void ) pthread_cond_wait( &( pxEvent->xCond ), &( pxEvent->xMutex ) );
+		}
+
+		pxEvent->xSignalled = pdFALSE;
+	}
+	pthread_cleanup_pop( 1 );
+}
+/*-----------------------------------------------------------*/
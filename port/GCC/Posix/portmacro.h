@@ -0,0 +1,285 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-----------------------------------------------------------
+ * Port specific definitions.
+ *
+ * The settings in this file configure FreeRTOS correctly for the
+ * given hardware and compiler.
+ *
+ * These settings should not be altered.
+ *-----------------------------------------------------------
+ */
+
+/* Type definitions.  The simulator runs on 32-bit and 64-bit hosts, so the
+stack and base types follow the native word size of the host. */
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		short
+#define portSTACK_TYPE	unsigned long
+#define portBASE_TYPE	long
+#define portPOINTER_SIZE_TYPE	size_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#if( configUSE_16_BIT_TICKS == 1 )
+	typedef uint16_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffff
+#else
+	typedef uint32_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+
+	/* 32-bit tick type on a 32-bit or 64-bit host, so reads of the tick count
+	do not need to be guarded with a critical section. */
+	#define portTICK_TYPE_IS_ATOMIC 1
+#endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+#define portSTACK_GROWTH			( -1 )
+#define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portTICK_PERIOD_US			( 1000000UL / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT			8
+
+/* Each task runs on its own pthread, so the FreeRTOS stack only has to hold
+the port's per-thread bookkeeping.  The real execution stack of each task is
+allocated by the host C library with the size set here. */
+#ifndef portPOSIX_THREAD_STACK_SIZE
+	#define portPOSIX_THREAD_STACK_SIZE	( 64UL * 1024UL )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Scheduler utilities. */
+extern void vPortYield( void );
+
+#define portYIELD()									vPortYield()
+#define portEND_SWITCHING_ISR( xSwitchRequired )	if( ( xSwitchRequired ) != pdFALSE ) vPortYield()
+#define portYIELD_FROM_ISR( x )						portEND_SWITCHING_ISR( x )
+/*-----------------------------------------------------------*/
+
+/* Critical section management.  Interrupts are simulated with host signals,
+so disabling interrupts blocks those signals in the calling thread. */
+extern void vPortDisableInterrupts( void );
+extern void vPortEnableInterrupts( void );
+extern UBaseType_t uxPortSetInterruptMask( void );
+extern void vPortClearInterruptMask( UBaseType_t uxMask );
+
+#define portDISABLE_INTERRUPTS()				vPortDisableInterrupts()
+#define portENABLE_INTERRUPTS()					vPortEnableInterrupts()
+
+#if( configNUMBER_OF_CORES == 1 )
+
+	extern void vPortEnterCritical( void );
+	extern void vPortExitCritical( void );
+
+	#define portENTER_CRITICAL()					vPortEnterCritical()
+	#define portEXIT_CRITICAL()						vPortExitCritical()
+	#define portSET_INTERRUPT_MASK_FROM_ISR()		uxPortSetInterruptMask()
+	#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortClearInterruptMask( x )
+
+#else
+
+	/* In SMP builds the critical sections are implemented by the kernel, as
+	they must also take the kernel spinlocks.  The nesting count is held in the
+	TCB of the task that entered the critical section. */
+	extern void vTaskEnterCritical( void );
+	extern void vTaskExitCritical( void );
+	extern UBaseType_t uxTaskEnterCriticalFromISR( void );
+	extern void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus );
+
+	#define portCRITICAL_NESTING_IN_TCB				1
+	#define portENTER_CRITICAL()					vTaskEnterCritical()
+	#define portEXIT_CRITICAL()						vTaskExitCritical()
+	#define portSET_INTERRUPT_MASK_FROM_ISR()		uxTaskEnterCriticalFromISR()
+	#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vTaskExitCriticalFromISR( x )
+
+	/* Masking only, used by the kernel to implement the above. */
+	#define portSET_INTERRUPT_MASK()				uxPortSetInterruptMask()
+	#define portCLEAR_INTERRUPT_MASK(x)				vPortClearInterruptMask( x )
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	/* Multi core support.  Every simulated core is the thread of the task
+	that is running on it, so up to configNUMBER_OF_CORES task threads execute
+	concurrently.  A core is interrupted by another core by sending the yield
+	signal to the thread of the task running on it. */
+	extern BaseType_t xPortGetCoreID( void );
+	extern void vPortYieldCore( BaseType_t xCoreID );
+	extern void vPortGetLock( BaseType_t xLock );
+	extern void vPortReleaseLock( BaseType_t xLock );
+
+	extern void vPortWaitForInterrupt( void );
+
+	#define portGET_CORE_ID()						xPortGetCoreID()
+	#define portYIELD_CORE( xCoreID )				vPortYieldCore( xCoreID )
+	#define portWAIT_FOR_INTERRUPT()				vPortWaitForInterrupt()
+
+	/* The two kernel spinlocks. */
+	#define portTASK_LOCK							( ( BaseType_t ) 0 )
+	#define portISR_LOCK							( ( BaseType_t ) 1 )
+
+	#define portGET_TASK_LOCK()						vPortGetLock( portTASK_LOCK )
+	#define portRELEASE_TASK_LOCK()					vPortReleaseLock( portTASK_LOCK )
+	#define portGET_ISR_LOCK()						vPortGetLock( portISR_LOCK )
+	#define portRELEASE_ISR_LOCK()					vPortReleaseLock( portISR_LOCK )
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+/* Task deletion.  A thread that deletes itself cannot free its own pthread, so
+it is marked as dying and exits at the next context switch.  Its resources are
+reclaimed when the idle task (or the deleting task) frees the TCB. */
+extern void vPortThreadDying( void *pvTaskToDelete, volatile BaseType_t *pxPendYield );
+extern void vPortCancelThread( void *pvTaskToDelete );
+
+#define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxPendYield )	vPortThreadDying( ( pvTaskToDelete ), ( pxPendYield ) )
+#define portCLEAN_UP_TCB( pxTCB )								vPortCancelThread( pxTCB )
+/*-----------------------------------------------------------*/
+
+/* Run time stats and instrumentation time base.  Returns the number of
+microseconds that have elapsed since the scheduler was started. */
+extern uint32_t ulPortGetRunTimeCounterValue( void );
+/*-----------------------------------------------------------*/
+
+/* Port specific optimisations. */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+	#if( configNUMBER_OF_CORES == 1 )
+		#define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
+	#else
+		/* The SMP scheduler walks the ready lists itself. */
+		#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+	#endif
+#endif
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+	/* Check the configuration. */
+	#if( configMAX_PRIORITIES > 32 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+	#endif
+
+	/* Store/clear the ready priorities in a bit map. */
+	#define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+	#define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+	/*-----------------------------------------------------------*/
+
+	#define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) uxTopPriority = ( 31UL - ( uint32_t ) __builtin_clz( ( uint32_t ) ( uxReadyPriorities ) ) )
+
+#endif /* taskRECORD_READY_PRIORITY */
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site.  These are
+not necessary for to use this port.  They are defined so the common demo files
+(which build with all the ports) will build. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+/*-----------------------------------------------------------*/
+
+/* portNOP() is not required by this port. */
+#define portNOP()
+
+/* Tasks run on separate host threads, so lock free structures (such as stream
+buffers) need a full barrier between writing data and publishing an index. */
+#define portMEMORY_BARRIER() __sync_synchronize()
+
+/* Atomically write ulExchange to *pulDestination if *pulDestination equals
+ulComparand, returning pdTRUE if the write was made.  Used by lock free code
+that must also be safe on other cores. */
+#define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand ) ( __sync_bool_compare_and_swap( ( pulDestination ), ( ulComparand ), ( ulExchange ) ) ? pdTRUE : pdFALSE )
+
+/* As portATOMIC_COMPARE_AND_SWAP_U32(), but for portPOINTER_SIZE_TYPE values,
+which are 64 bits on a 64 bit host. */
+#define portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE( puxDestination, uxExchange, uxComparand ) ( __sync_bool_compare_and_swap( ( puxDestination ), ( uxComparand ), ( uxExchange ) ) ? pdTRUE : pdFALSE )
+
+#define portINLINE __inline
+
+#ifndef portFORCE_INLINE
+	#define portFORCE_INLINE inline __attribute__( ( always_inline ) )
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTMACRO_H */
@@ -0,0 +1,761 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that uses the
+ * Two-Level Segregated Fit (TLSF) algorithm.  Free blocks are held in an
+ * array of segregated lists - a first level indexed by the power of two size
+ * class, and a second level that splits each class linearly - and a bitmap
+ * records which of those lists are not empty.  A free block of adequate size
+ * is therefore found with a couple of bit scans rather than a walk of the free
+ * list, so the time taken by pvPortMalloc() and vPortFree() is bounded and
+ * does not grow as the heap becomes fragmented.  Every block records the block
+ * that precedes it in memory, so a block being freed is combined with free
+ * neighbouring blocks immediately.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ *
+ * Usage notes:
+ *
+ * As with heap_5.c the heap can be spread across multiple non-contiguous
+ * blocks of memory, which are passed in using vPortDefineHeapRegions().
+ * vPortDefineHeapRegions() ***must*** be called before pvPortMalloc().
+ * pvPortMalloc() will be called if any task objects (tasks, queues, event
+ * groups, etc.) are created, therefore vPortDefineHeapRegions() ***must*** be
+ * called before any other objects are defined.
+ *
+ * vPortDefineHeapRegions() takes a single parameter.  The parameter is an array
+ * of HeapRegion_t structures, terminated using a NULL zero sized region
+ * definition.  See heap_5.c for an example.  Unlike heap_5.c the regions do not
+ * need to appear in address order.
+ *
+ * Two optional constants can be defined in FreeRTOSConfig.h:
+ *
+ * configHEAP_TLSF_SL_INDEX_COUNT_LOG2 sets the number of second level lists per
+ * size class (2 to the power of the value, 1 to 5).  More lists waste less
+ * memory per allocation, but use more RAM for the list heads.  Defaults to 4.
+ *
+ * configHEAP_TLSF_FL_INDEX_MAX sets the limit on the size of a block (blocks
+ * are smaller than 2 to the power of the value).  Regions larger than this are
+ * used as several independent blocks.  Defaults to 24 (16MB).
+ *
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configHEAP_TLSF_SL_INDEX_COUNT_LOG2
+	#define configHEAP_TLSF_SL_INDEX_COUNT_LOG2	4
+#endif
+
+#ifndef configHEAP_TLSF_FL_INDEX_MAX
+	#define configHEAP_TLSF_FL_INDEX_MAX		24
+#endif
+
+#if( ( configHEAP_TLSF_SL_INDEX_COUNT_LOG2 < 1 ) || ( configHEAP_TLSF_SL_INDEX_COUNT_LOG2 > 5 ) )
+	#error configHEAP_TLSF_SL_INDEX_COUNT_LOG2 must be between 1 and 5
+#endif
+
+#if( configHEAP_TLSF_FL_INDEX_MAX > 31 )
+	#error configHEAP_TLSF_FL_INDEX_MAX must not be greater than 31
+#endif
+
+#if portBYTE_ALIGNMENT == 32
+	#define heapBYTE_ALIGNMENT_LOG2		( 5 )
+#endif
+
+#if portBYTE_ALIGNMENT == 16
+	#define heapBYTE_ALIGNMENT_LOG2		( 4 )
+#endif
+
+#if portBYTE_ALIGNMENT == 8
+	#define heapBYTE_ALIGNMENT_LOG2		( 3 )
+#endif
+
+#if portBYTE_ALIGNMENT == 4
+	#define heapBYTE_ALIGNMENT_LOG2		( 2 )
+#endif
+
+#if portBYTE_ALIGNMENT == 2
+	#define heapBYTE_ALIGNMENT_LOG2		( 1 )
+#endif
+
+#if portBYTE_ALIGNMENT == 1
+	#define heapBYTE_ALIGNMENT_LOG2		( 0 )
+#endif
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE are spread linearly over the
+second level lists of the first size class, one list per portBYTE_ALIGNMENT
+bytes.  Larger blocks use one size class per power of two. */
+#define heapSL_INDEX_COUNT_LOG2	( configHEAP_TLSF_SL_INDEX_COUNT_LOG2 )
+#define heapSL_INDEX_COUNT		( ( UBaseType_t ) 1 << heapSL_INDEX_COUNT_LOG2 )
+#define heapFL_INDEX_SHIFT		( heapSL_INDEX_COUNT_LOG2 + heapBYTE_ALIGNMENT_LOG2 )
+#define heapFL_INDEX_COUNT		( configHEAP_TLSF_FL_INDEX_MAX - heapFL_INDEX_SHIFT + 1 )
+#define heapSMALL_BLOCK_SIZE	( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+#if( heapFL_INDEX_COUNT < 1 )
+	#error configHEAP_TLSF_FL_INDEX_MAX is too small for the configured alignment and second level list count
+#endif
+
+/* The largest block, including its header, that can be managed. */
+#define heapMAX_BLOCK_SIZE		( ( ( size_t ) 1 << configHEAP_TLSF_FL_INDEX_MAX ) - ( size_t ) portBYTE_ALIGNMENT )
+
+/* Block sizes must not get too small - a free block has to be able to hold the
+free list links as well as the block header. */
+#define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE		( ( size_t ) 8 )
+
+/* The block that follows pxBlock in memory. */
+#define heapNEXT_PHYSICAL_BLOCK( pxBlock ) ( ( BlockLink_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + ( ( pxBlock )->xBlockSize & ~xBlockAllocatedBit ) ) )
+
+/* Define the structure placed at the start of each block.  Only the first two
+members are kept while a block is allocated, the free list links occupy the
+start of the memory returned to the application. */
+typedef struct A_BLOCK_LINK
+{
+	struct A_BLOCK_LINK *pxPrevPhysicalBlock;	/*<< The block before this one in memory, or NULL if this is the first block of a region. */
+	size_t xBlockSize;							/*<< The size of the block including this header. */
+	struct A_BLOCK_LINK *pxNextFreeBlock;		/*<< The next block in the same free list.  Only valid while the block is free. */
+	struct A_BLOCK_LINK *pxPrevFreeBlock;		/*<< The previous block in the same free list.  Only valid while the block is free. */
+} BlockLink_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the index of the most significant set bit in ulValue, which must not
+ * be zero.  A fixed number of steps is used whatever the value.
+ */
+static UBaseType_t prvFindLastSet( uint32_t ulValue );
+
+/*
+ * Return the first and second level list indexes for a free block of xSize
+ * bytes.
+ */
+static void prvMappingInsert( size_t xSize, UBaseType_t *puxFLIndex, UBaseType_t *puxSLIndex );
+
+/*
+ * Return the first and second level list indexes of the smallest list in
+ * which every block is at least xSize bytes.
+ */
+static void prvMappingSearch( size_t xSize, UBaseType_t *puxFLIndex, UBaseType_t *puxSLIndex );
+
+/*
+ * Return a free block from the list selected by prvMappingSearch(), or from
+ * the next larger list that is not empty.  The indexes are updated to those of
+ * the list the block was found in.  Returns NULL if there is no such block.
+ */
+static BlockLink_t *prvFindSuitableBlock( UBaseType_t *puxFLIndex, UBaseType_t *puxSLIndex );
+
+/*
+ * Add a block to, or remove a block from, the free list for its size.
+ */
+static void prvInsertFreeBlock( BlockLink_t *pxBlock );
+static void prvRemoveFreeBlock( BlockLink_t *pxBlock );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the part of the structure kept at the beginning of each
+allocated memory block must by correctly byte aligned. */
+static const size_t xHeapStructSize	= ( ( ( size_t ) &( ( ( BlockLink_t * ) 0 )->pxNextFreeBlock ) ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The segregated free lists, and the bitmaps that record which of them contain
+at least one block. */
+static BlockLink_t *pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+static uint32_t ulFLBitmap = 0U;
+static uint32_t ulSLBitmap[ heapFL_INDEX_COUNT ];
+
+/* Keeps track of the number of free bytes remaining, but says nothing about
+fragmentation. */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+
+/* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
+member of an BlockLink_t structure is set then the block belongs to the
+application.  When the bit is free the block is still part of the free heap
+space. */
+static size_t xBlockAllocatedBit = 0;
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+BlockLink_t *pxBlock = NULL, *pxNewBlockLink;
+UBaseType_t uxFLIndex, uxSLIndex;
+void *pvReturn = NULL;
+
+	/* The heap must be initialised before the first call to
+	prvPortMalloc(). */
+	configASSERT( xBlockAllocatedBit );
+
+	vTaskSuspendAll();
+	{
+		/* Check the requested block size is not so large that the top bit is
+		set.  The top bit of the block size member of the BlockLink_t structure
+		is used to determine who owns the block - the application or the
+		kernel, so it must be free. */
+		if( ( xWantedSize & xBlockAllocatedBit ) == 0 )
+		{
+			/* The wanted size is increased so it can contain the block header
+			in addition to the requested amount of bytes. */
+			if( xWantedSize > 0 )
+			{
+				xWantedSize += xHeapStructSize;
+
+				/* Ensure that blocks are always aligned to the required number
+				of bytes. */
+				if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+				{
+					/* Byte alignment required. */
+					xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The block must be able to hold the free list links once it
+				is freed again. */
+				if( xWantedSize < heapMINIMUM_BLOCK_SIZE )
+				{
+					xWantedSize = heapMINIMUM_BLOCK_SIZE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( ( xWantedSize > 0 ) && ( xWantedSize <= heapMAX_BLOCK_SIZE ) && ( xWantedSize <= xFreeBytesRemaining ) )
+			{
+				/* Find a list in which every block is large enough, so the
+				first block in the list can be used without checking its
+				size. */
+				prvMappingSearch( xWantedSize, &uxFLIndex, &uxSLIndex );
+
+				if( uxFLIndex < ( UBaseType_t ) heapFL_INDEX_COUNT )
+				{
+					pxBlock = prvFindSuitableBlock( &uxFLIndex, &uxSLIndex );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( pxBlock != NULL )
+				{
+					/* This block is being returned for use so must be taken out
+					of the list of free blocks. */
+					prvRemoveFreeBlock( pxBlock );
+
+					/* If the block is larger than required it can be split into
+					two. */
+					if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+					{
+						/* This block is to be split into two.  Create a new
+						block following the number of bytes requested. The void
+						cast is used to prevent byte alignment warnings from the
+						compiler. */
+						pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+
+						/* Calculate the sizes of two blocks split from the
+						single block, and link the new block in between the
+						block and the block that follows it in memory. */
+						pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+						pxNewBlockLink->pxPrevPhysicalBlock = pxBlock;
+						heapNEXT_PHYSICAL_BLOCK( pxNewBlockLink )->pxPrevPhysicalBlock = pxNewBlockLink;
+						pxBlock->xBlockSize = xWantedSize;
+
+						/* Insert the new block into the list of free blocks. */
+						prvInsertFreeBlock( pxNewBlockLink );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+					if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+					{
+						xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* The block is being returned - it is allocated and owned
+					by the application. */
+					pxBlock->xBlockSize |= xBlockAllocatedBit;
+
+					/* Return the memory space pointed to - jumping over the
+					block header at its start. */
+					pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockLink_t *pxLink, *pxNeighbour;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have a block header immediately before
+		it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+
+		if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 )
+		{
+			/* The block is being returned to the heap - it is no longer
+			allocated. */
+			pxLink->xBlockSize &= ~xBlockAllocatedBit;
+
+			vTaskSuspendAll();
+			{
+				xFreeBytesRemaining += pxLink->xBlockSize;
+				traceFREE( pv, pxLink->xBlockSize );
+
+				/* Combine the block with the block that follows it in memory
+				if that block is also free.  The end of each region is marked
+				by a zero sized block that is always allocated. */
+				pxNeighbour = heapNEXT_PHYSICAL_BLOCK( pxLink );
+				if( ( pxNeighbour->xBlockSize & xBlockAllocatedBit ) == 0 )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxLink->xBlockSize += pxNeighbour->xBlockSize;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Likewise with the block that precedes it in memory. */
+				pxNeighbour = pxLink->pxPrevPhysicalBlock;
+				if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & xBlockAllocatedBit ) == 0 ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xBlockSize += pxLink->xBlockSize;
+					pxLink = pxNeighbour;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				heapNEXT_PHYSICAL_BLOCK( pxLink )->pxPrevPhysicalBlock = pxLink;
+
+				/* Add this block to the list of free blocks. */
+				prvInsertFreeBlock( pxLink );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindLastSet( uint32_t ulValue )
+{
+UBaseType_t uxBit = 0;
+
+	if( ( ulValue & 0xffff0000UL ) != 0UL )
+	{
+		ulValue >>= 16;
+		uxBit += 16;
+	}
+
+	if( ( ulValue & 0xff00UL ) != 0UL )
+	{
+		ulValue >>= 8;
+		uxBit += 8;
+	}
+
+	if( ( ulValue & 0xf0UL ) != 0UL )
+	{
+		ulValue >>= 4;
+		uxBit += 4;
+	}
+
+	if( ( ulValue & 0x0cUL ) != 0UL )
+	{
+		ulValue >>= 2;
+		uxBit += 2;
+	}
+
+	if( ( ulValue & 0x02UL ) != 0UL )
+	{
+		uxBit += 1;
+	}
+
+	return uxBit;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xSize, UBaseType_t *puxFLIndex, UBaseType_t *puxSLIndex )
+{
+UBaseType_t uxFLIndex;
+
+	if( xSize < heapSMALL_BLOCK_SIZE )
+	{
+		/* Small blocks are spread linearly over the first size class. */
+		*puxFLIndex = 0;
+		*puxSLIndex = ( UBaseType_t ) ( xSize >> heapBYTE_ALIGNMENT_LOG2 );
+	}
+	else
+	{
+		/* The first level index is the power of two below the size, and the
+		second level index is taken from the bits that follow the most
+		significant set bit. */
+		uxFLIndex = prvFindLastSet( ( uint32_t ) xSize );
+		*puxSLIndex = ( UBaseType_t ) ( xSize >> ( uxFLIndex - heapSL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT;
+		*puxFLIndex = uxFLIndex - ( heapFL_INDEX_SHIFT - 1 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingSearch( size_t xSize, UBaseType_t *puxFLIndex, UBaseType_t *puxSLIndex )
+{
+	/* Round the size up to the start of the next second level list so any
+	block in the selected list is large enough. */
+	if( xSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xSize += ( ( size_t ) 1 << ( prvFindLastSet( ( uint32_t ) xSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMappingInsert( xSize, puxFLIndex, puxSLIndex );
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t *prvFindSuitableBlock( UBaseType_t *puxFLIndex, UBaseType_t *puxSLIndex )
+{
+UBaseType_t uxFLIndex = *puxFLIndex;
+uint32_t ulMap;
+
+	/* First look for a list that is not empty in the same size class. */
+	ulMap = ulSLBitmap[ uxFLIndex ] & ( ~( ( uint32_t ) 0U ) << *puxSLIndex );
+
+	if( ulMap == 0U )
+	{
+		/* There is no such list, so take the first list that is not empty
+		in the next larger size class that contains any free blocks. */
+		if( ( uxFLIndex + 1U ) < ( UBaseType_t ) heapFL_INDEX_COUNT )
+		{
+			ulMap = ulFLBitmap & ( ~( ( uint32_t ) 0U ) << ( uxFLIndex + 1U ) );
+		}
+
+		if( ulMap == 0U )
+		{
+			/* No free block is large enough. */
+			return NULL;
+		}
+
+		uxFLIndex = prvFindLastSet( ulMap & ( ~ulMap + 1U ) );
+		ulMap = ulSLBitmap[ uxFLIndex ];
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	*puxFLIndex = uxFLIndex;
+	*puxSLIndex = prvFindLastSet( ulMap & ( ~ulMap + 1U ) );
+
+	return pxFreeLists[ uxFLIndex ][ *puxSLIndex ];
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( BlockLink_t *pxBlock )
+{
+UBaseType_t uxFLIndex, uxSLIndex;
+BlockLink_t *pxHead;
+
+	prvMappingInsert( pxBlock->xBlockSize, &uxFLIndex, &uxSLIndex );
+	pxHead = pxFreeLists[ uxFLIndex ][ uxSLIndex ];
+
+	pxBlock->pxNextFreeBlock = pxHead;
+	pxBlock->pxPrevFreeBlock = NULL;
+
+	if( pxHead != NULL )
+	{
+		pxHead->pxPrevFreeBlock = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxFreeLists[ uxFLIndex ][ uxSLIndex ] = pxBlock;
+	ulFLBitmap |= ( ( uint32_t ) 1U << uxFLIndex );
+	ulSLBitmap[ uxFLIndex ] |= ( ( uint32_t ) 1U << uxSLIndex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( BlockLink_t *pxBlock )
+{
+UBaseType_t uxFLIndex, uxSLIndex;
+
+	prvMappingInsert( pxBlock->xBlockSize, &uxFLIndex, &uxSLIndex );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPrevFreeBlock != NULL )
+	{
+		pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was at the head of its list. */
+		pxFreeLists[ uxFLIndex ][ uxSLIndex ] = pxBlock->pxNextFreeBlock;
+
+		if( pxBlock->pxNextFreeBlock == NULL )
+		{
+			/* The list is now empty. */
+			ulSLBitmap[ uxFLIndex ] &= ~( ( uint32_t ) 1U << uxSLIndex );
+
+			if( ulSLBitmap[ uxFLIndex ] == 0U )
+			{
+				ulFLBitmap &= ~( ( uint32_t ) 1U << uxFLIndex );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+BlockLink_t *pxFirstFreeBlockInRegion, *pxEnd;
+size_t xTotalRegionSize, xTotalHeapSize = 0, xBlockSize;
+BaseType_t xDefinedRegions = 0;
+size_t xAddress;
+const HeapRegion_t *pxHeapRegion;
+
+	/* Can only call once! */
+	configASSERT( xBlockAllocatedBit == 0 );
+
+	/* Work out the position of the top bit in a size_t variable.  This is
+	also used as the marker that the heap has been defined. */
+	xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+
+	pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+
+	while( pxHeapRegion->xSizeInBytes > 0 )
+	{
+		xTotalRegionSize = pxHeapRegion->xSizeInBytes;
+
+		/* Ensure the heap region starts on a correctly aligned boundary. */
+		xAddress = ( size_t ) pxHeapRegion->pucStartAddress;
+		if( ( xAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+		{
+			xAddress += ( portBYTE_ALIGNMENT - 1 );
+			xAddress &= ~portBYTE_ALIGNMENT_MASK;
+
+			/* Adjust the size for the bytes lost to alignment. */
+			xTotalRegionSize -= xAddress - ( size_t ) pxHeapRegion->pucStartAddress;
+		}
+
+		/* The region is used as one free block followed by a zero sized block
+		that is always marked as allocated, so a block being freed is never
+		combined with memory outside of the region.  A region larger than the
+		largest block that can be managed is used as several such pairs. */
+		while( xTotalRegionSize >= ( heapMINIMUM_BLOCK_SIZE + xHeapStructSize ) )
+		{
+			xBlockSize = ( xTotalRegionSize - xHeapStructSize ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+			if( xBlockSize > heapMAX_BLOCK_SIZE )
+			{
+				xBlockSize = heapMAX_BLOCK_SIZE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxFirstFreeBlockInRegion = ( BlockLink_t * ) xAddress;
+			pxFirstFreeBlockInRegion->pxPrevPhysicalBlock = NULL;
+			pxFirstFreeBlockInRegion->xBlockSize = xBlockSize;
+
+			pxEnd = heapNEXT_PHYSICAL_BLOCK( pxFirstFreeBlockInRegion );
+			pxEnd->pxPrevPhysicalBlock = pxFirstFreeBlockInRegion;
+			pxEnd->xBlockSize = xBlockAllocatedBit;
+
+			prvInsertFreeBlock( pxFirstFreeBlockInRegion );
+			xTotalHeapSize += xBlockSize;
+
+			xAddress += xBlockSize + xHeapStructSize;
+			xTotalRegionSize -= xBlockSize + xHeapStructSize;
+		}
+
+		/* Move onto the next HeapRegion_t structure. */
+		xDefinedRegions++;
+		pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+	}
+
+	xMinimumEverFreeBytesRemaining = xTotalHeapSize;
+	xFreeBytesRemaining = xTotalHeapSize;
+
+	/* Check something was actually defined before it is accessed. */
+	configASSERT( xTotalHeapSize );
+}
+
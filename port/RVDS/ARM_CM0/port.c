@@ -324,12 +324,26 @@ uint32_t ulPreviousMask;
 
 	ulPreviousMask = portSET_INTERRUPT_MASK_FROM_ISR();
 	{
+		#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+		{
+			/* Do not bill the time spent in the tick interrupt to the task
+			that was interrupted. */
+			vTaskISREnter();
+		}
+		#endif
+
 		/* Increment the RTOS tick. */
 		if( xTaskIncrementTick() != pdFALSE )
 		{
 			/* Pend a context switch. */
 			*(portNVIC_INT_CTRL) = portNVIC_PENDSVSET;
 		}
+
+		#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+		{
+			vTaskISRExit();
+		}
+		#endif
 	}
 	portCLEAR_INTERRUPT_MASK_FROM_ISR( ulPreviousMask );
 }
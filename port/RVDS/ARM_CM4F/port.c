@@ -525,6 +525,14 @@ void xPortSysTickHandler( void )
 	in place of portSET_INTERRUPT_MASK_FROM_ISR(). */
 	vPortRaiseBASEPRI();
 	{
+		#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+		{
+			/* Do not bill the time spent in the tick interrupt to the task
+			that was interrupted. */
+			vTaskISREnter();
+		}
+		#endif
+
 		/* Increment the RTOS tick. */
 		if( xTaskIncrementTick() != pdFALSE )
 		{
@@ -532,6 +540,12 @@ void xPortSysTickHandler( void )
 			the PendSV interrupt.  Pend the PendSV interrupt. */
 			portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
 		}
+
+		#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+		{
+			vTaskISRExit();
+		}
+		#endif
 	}
 	vPortClearBASEPRIFromISR();
 }
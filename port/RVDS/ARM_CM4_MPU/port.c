@@ -527,12 +527,26 @@ uint32_t ulDummy;
 
 	ulDummy = portSET_INTERRUPT_MASK_FROM_ISR();
 	{
+		#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+		{
+			/* Do not bill the time spent in the tick interrupt to the task
+			that was interrupted. */
+			vTaskISREnter();
+		}
+		#endif
+
 		/* Increment the RTOS tick. */
 		if( xTaskIncrementTick() != pdFALSE )
 		{
 			/* Pend a context switch. */
 			portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
 		}
+
+		#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+		{
+			vTaskISRExit();
+		}
+		#endif
 	}
 	portCLEAR_INTERRUPT_MASK_FROM_ISR( ulDummy );
 }
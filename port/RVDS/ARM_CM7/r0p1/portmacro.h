@@ -288,6 +288,31 @@ BaseType_t xReturn;
 
 	return xReturn;
 }
+/*-----------------------------------------------------------*/
+
+static portFORCE_INLINE BaseType_t xPortCompareAndSwapU32( volatile uint32_t *pulDestination, uint32_t ulExchange, uint32_t ulComparand )
+{
+BaseType_t xReturn = pdFALSE;
+
+	/* A single exclusive load/store attempt.  The store is not made, and
+	pdFALSE is returned, if the exclusive monitor was cleared in between - as
+	it is on every exception entry and return - so callers must retry. */
+	if( __ldrex( pulDestination ) == ulComparand )
+	{
+		if( __strex( ulExchange, pulDestination ) == 0U )
+		{
+			xReturn = pdTRUE;
+		}
+	}
+	else
+	{
+		__clrex();
+	}
+
+	return xReturn;
+}
+
+#define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand ) xPortCompareAndSwapU32( ( pulDestination ), ( ulExchange ), ( ulComparand ) )
 
 
 #ifdef __cplusplus
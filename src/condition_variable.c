@@ -0,0 +1,429 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "condition_variable.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include condition variable functionality.  This #if is closed at the very
+bottom of this file.  If you want to include condition variables then ensure
+configUSE_CONDITION_VARIABLES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_CONDITION_VARIABLES == 1 )
+
+#if( configUSE_PREEMPTION == 0 )
+	/* If the cooperative scheduler is being used then a yield should not be
+	performed just because a higher priority task has been woken. */
+	#define cvYIELD_IF_USING_PREEMPTION()
+#else
+	#define cvYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
+#endif
+
+/* Bits stored in the ucFlags field of the condition variable. */
+#define cvFLAGS_IS_STATICALLY_ALLOCATED	( ( uint8_t ) 1 ) /* Set if the condition variable was created using statically allocated memory. */
+
+/*-----------------------------------------------------------*/
+
+/* Structure that holds the state of a condition variable. */
+typedef struct xCONDITION_VARIABLE /*lint !e9058 Style convention uses tag. */
+{
+	List_t xTasksWaiting;		/*< List of tasks that are blocked on the condition variable.  Stored in priority order. */
+	SemaphoreHandle_t xMutex;	/*< The mutex given back by the tasks in xTasksWaiting.  Only valid while xTasksWaiting is not empty. */
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucFlags;
+	#endif
+} CondVar_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by xCondVarCreate() and xCondVarCreateStatic() to initialise the
+ * members of a newly created condition variable.
+ */
+static void prvInitialiseNewCondVar( CondVar_t * const pxCondVar ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from a critical section to release the highest priority task waiting
+ * on the condition variable, which must have a task waiting.  The task is moved
+ * onto the list of tasks waiting for the mutex if the mutex is held, otherwise
+ * it is unblocked.  Returns pdTRUE if a task that has a priority above that of
+ * the calling task was unblocked.
+ */
+static BaseType_t prvReleaseWaitingTask( CondVar_t * const pxCondVar ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	CondVarHandle_t xCondVarCreate( void )
+	{
+	CondVar_t *pxCondVar;
+
+		pxCondVar = ( CondVar_t * ) pvPortMalloc( sizeof( CondVar_t ) );
+
+		if( pxCondVar != NULL )
+		{
+			prvInitialiseNewCondVar( pxCondVar );
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				pxCondVar->ucFlags = ( uint8_t ) 0;
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( CondVarHandle_t ) pxCondVar;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	CondVarHandle_t xCondVarCreateStatic( StaticCondVar_t *pxCondVarBuffer )
+	{
+	CondVar_t * const pxCondVar = ( CondVar_t * ) pxCondVarBuffer; /*lint !e740 !e9087 CondVar_t and StaticCondVar_t are guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+
+		configASSERT( pxCondVarBuffer );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticCondVar_t equals the size of the real
+			condition variable structure. */
+			volatile size_t xSize = sizeof( StaticCondVar_t );
+			configASSERT( xSize == sizeof( CondVar_t ) );
+		}
+		#endif /* configASSERT_DEFINED */
+
+		if( pxCondVar != NULL )
+		{
+			prvInitialiseNewCondVar( pxCondVar );
+
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* Remember the condition variable was statically allocated in
+				case it is later deleted. */
+				pxCondVar->ucFlags = cvFLAGS_IS_STATICALLY_ALLOCATED;
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( CondVarHandle_t ) pxCondVar;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+BaseType_t xCondVarWait( CondVarHandle_t xCondVar, SemaphoreHandle_t xMutex, TickType_t xTicksToWait )
+{
+CondVar_t * const pxCondVar = ( CondVar_t * ) xCondVar;
+TimeOut_t xTimeOut;
+BaseType_t xReturn = pdPASS;
+
+	configASSERT( pxCondVar );
+	configASSERT( xMutex );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	if( xTicksToWait == ( TickType_t ) 0 )
+	{
+		/* The condition variable cannot be signalled without the calling task
+		blocking, so the mutex is not given back. */
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		/* The scheduler is suspended while the mutex is given back and the
+		calling task is placed on the list of waiting tasks, so the calling task
+		cannot be switched out between the two.  Giving the mutex back may
+		unblock a higher priority task waiting for it, but that task cannot run,
+		take the mutex and signal the condition variable until the calling task
+		is on the list.  The yield it requests is held pending until the
+		scheduler is resumed.  Giving the mutex back also drops any priority the
+		calling task inherited. */
+		vTaskSuspendAll();
+		{
+			configASSERT( ( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaiting ) ) != pdFALSE ) || ( pxCondVar->xMutex == xMutex ) );
+
+			if( xSemaphoreGive( xMutex ) != pdFALSE )
+			{
+				pxCondVar->xMutex = xMutex;
+				vTaskSetTimeOutState( &xTimeOut );
+
+				/* The condition variable is only accessed from tasks, and
+				tasks cannot run while the scheduler is suspended, so the list
+				of waiting tasks does not need any other protection. */
+				vTaskPlaceOnEventList( &( pxCondVar->xTasksWaiting ), xTicksToWait );
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+		}
+		if( xTaskResumeAll() == pdFALSE )
+		{
+			if( xReturn != pdFAIL )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( xReturn != pdFAIL )
+	{
+		/* The task was either signalled or timed out.  A task moved onto the
+		list of tasks waiting for the mutex does not run again until the mutex
+		has been given back. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+		{
+			xReturn = pdFAIL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The mutex is always taken back, whether or not the wait timed
+		out. */
+		while( xSemaphoreTake( xMutex, portMAX_DELAY ) == pdFALSE )
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vCondVarSignal( CondVarHandle_t xCondVar )
+{
+CondVar_t * const pxCondVar = ( CondVar_t * ) xCondVar;
+
+	configASSERT( pxCondVar );
+
+	taskENTER_CRITICAL();
+	{
+		if( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaiting ) ) == pdFALSE )
+		{
+			if( prvReleaseWaitingTask( pxCondVar ) != pdFALSE )
+			{
+				/* Yes it is ok to do this from within the critical section -
+				the kernel takes care of that. */
+				cvYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vCondVarBroadcast( CondVarHandle_t xCondVar )
+{
+CondVar_t * const pxCondVar = ( CondVar_t * ) xCondVar;
+BaseType_t xYieldRequired = pdFALSE;
+
+	configASSERT( pxCondVar );
+
+	taskENTER_CRITICAL();
+	{
+		while( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaiting ) ) == pdFALSE )
+		{
+			if( prvReleaseWaitingTask( pxCondVar ) != pdFALSE )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( xYieldRequired != pdFALSE )
+		{
+			cvYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vCondVarDelete( CondVarHandle_t xCondVar )
+{
+CondVar_t * const pxCondVar = ( CondVar_t * ) xCondVar;
+
+	configASSERT( pxCondVar );
+	configASSERT( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaiting ) ) != pdFALSE );
+
+	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	{
+		/* The condition variable can only have been allocated dynamically -
+		free it again. */
+		vPortFree( pxCondVar );
+	}
+	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	{
+		/* The condition variable could have been allocated statically or
+		dynamically, so check before attempting to free the memory. */
+		if( ( pxCondVar->ucFlags & cvFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+		{
+			vPortFree( pxCondVar );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewCondVar( CondVar_t * const pxCondVar )
+{
+	vListInitialise( &( pxCondVar->xTasksWaiting ) );
+	pxCondVar->xMutex = NULL;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvReleaseWaitingTask( CondVar_t * const pxCondVar )
+{
+BaseType_t xReturn;
+
+	/* A task unblocked while the mutex is held - normally by the signalling
+	task - would only block again as soon as it tried to take the mutex back,
+	costing two context switches for nothing. */
+	if( xQueueMoveWaitingTaskToMutex( pxCondVar->xMutex, &( pxCondVar->xTasksWaiting ) ) != pdFALSE )
+	{
+		xReturn = pdFALSE;
+	}
+	else
+	{
+		xReturn = xTaskRemoveFromEventList( &( pxCondVar->xTasksWaiting ) );
+	}
+
+	return xReturn;
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include condition variable functionality.  If you want to include condition
+variables then ensure configUSE_CONDITION_VARIABLES is set to 1 in
+FreeRTOSConfig.h. */
+#endif /* configUSE_CONDITION_VARIABLES == 1 */
@@ -95,11 +95,13 @@ taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
 	#define eventUNBLOCKED_DUE_TO_BIT_SET	0x0200U
 	#define eventWAIT_FOR_ALL_BITS			0x0400U
 	#define eventEVENT_BITS_CONTROL_BYTES	0xff00U
+	#define eventNUM_INDEXED_BITS			8U
 #else
 	#define eventCLEAR_EVENTS_ON_EXIT_BIT	0x01000000UL
 	#define eventUNBLOCKED_DUE_TO_BIT_SET	0x02000000UL
 	#define eventWAIT_FOR_ALL_BITS			0x04000000UL
 	#define eventEVENT_BITS_CONTROL_BYTES	0xff000000UL
+	#define eventNUM_INDEXED_BITS			24U
 #endif
 
 typedef struct xEventGroupDefinition
@@ -107,6 +109,16 @@ typedef struct xEventGroupDefinition
 	EventBits_t uxEventBits;
 	List_t xTasksWaitingForBits;		/*< List of tasks waiting for a bit to be set. */
 
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+		List_t xTasksWaitingForBit[ eventNUM_INDEXED_BITS ];	/*< xTasksWaitingForBit[ n ] holds the tasks that cannot be unblocked until bit n is set.  xTasksWaitingForBits then only holds tasks waiting for any one of several bits. */
+		EventBits_t uxBitsIndexed;			/*< Bit n is set if xTasksWaitingForBit[ n ] might not be empty.  A set bit can be stale as tasks time out, a clear bit is never wrong. */
+		EventBits_t uxBitsWaitedForByAny;	/*< The bits waited for by the tasks in xTasksWaitingForBits.  Can also be stale in the same way. */
+	#endif
+
+	#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+		List_t xTasksWaitingForMultiple;	/*< Wait records of the tasks waiting for the event group as one of several objects.  Only accessed from critical sections. */
+	#endif
+
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxEventGroupNumber;
 	#endif
@@ -128,6 +140,59 @@ typedef struct xEventGroupDefinition
  */
 static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	/*
+	 * Initialise the per bit lists of an event group that is being created.
+	 */
+	static void prvInitialiseBitIndex( EventGroup_t *pxEventBits ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns the list a task waiting for uxBitsToWaitFor should be placed in.
+	 * A task that cannot be unblocked until one particular bit is set - because
+	 * it is waiting for all of its bits, or only waits for a single bit - is
+	 * placed in the list of that bit, so xEventGroupSetBits() only looks at it
+	 * when that bit is set.  Tasks waiting for any one of several bits are
+	 * placed in xTasksWaitingForBits.
+	 */
+	static List_t *prvGetWaitingList( EventGroup_t *pxEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Move a waiting task's event list item into pxUnblockList, which is kept in
+	 * the order in which the tasks started to wait.  Tasks found in different
+	 * lists are then unblocked in the same order as if there was only one list.
+	 */
+	static void prvAddToUnblockList( List_t *pxUnblockList, ListItem_t *pxListItem ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Test the tasks in pxList against the event group's current bits.  Tasks
+	 * whose wait condition is met are moved to pxUnblockList, tasks indexed by a
+	 * bit that is now set but still waiting for other bits are moved to the list
+	 * of one of those bits.  Returns the bits to clear on behalf of the tasks
+	 * that are to be unblocked.
+	 */
+	static EventBits_t prvTestWaitingList( EventGroup_t *pxEventBits, List_t *pxList, List_t *pxUnblockList ) PRIVILEGED_FUNCTION;
+
+	#define eventWAITING_LIST( pxEventBits, uxBitsToWaitFor, xWaitForAllBits ) prvGetWaitingList( ( pxEventBits ), ( uxBitsToWaitFor ), ( xWaitForAllBits ) )
+
+#else
+
+	#define eventWAITING_LIST( pxEventBits, uxBitsToWaitFor, xWaitForAllBits ) ( &( ( pxEventBits )->xTasksWaitingForBits ) )
+
+#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+	/*
+	 * Called from a critical section to unblock the tasks waiting for the event
+	 * group as one of several objects whose wait condition is met by the event
+	 * group's current bits.  Such tasks do not clear any bits.  If xUnblockAll
+	 * is pdTRUE then every waiting task is unblocked, whatever its condition.
+	 */
+	static void prvUnblockMultipleObjectWaits( EventGroup_t *pxEventBits, const BaseType_t xUnblockAll ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -147,6 +212,18 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 			pxEventBits->uxEventBits = 0;
 			vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+			#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+			{
+				prvInitialiseBitIndex( pxEventBits );
+			}
+			#endif
+
+			#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+			{
+				vListInitialise( &( pxEventBits->xTasksWaitingForMultiple ) );
+			}
+			#endif
+
 			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 			{
 				/* Both static and dynamic allocation can be used, so note that
@@ -183,6 +260,18 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 			pxEventBits->uxEventBits = 0;
 			vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+			#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+			{
+				prvInitialiseBitIndex( pxEventBits );
+			}
+			#endif
+
+			#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+			{
+				vListInitialise( &( pxEventBits->xTasksWaitingForMultiple ) );
+			}
+			#endif
+
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
 				/* Both static and dynamic allocation can be used, so note this
@@ -246,7 +335,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 				/* Store the bits that the calling task is waiting for in the
 				task's event list item so the kernel knows when a match is
 				found.  Then enter the blocked state. */
-				vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+				vTaskPlaceOnUnorderedEventList( eventWAITING_LIST( pxEventBits, uxBitsToWaitFor, pdTRUE ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
 
 				/* This assignment is obsolete as uxReturn will get set after
 				the task unblocks, but some compilers mistakenly generate a
@@ -396,7 +485,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			/* Store the bits that the calling task is waiting for in the
 			task's event list item so the kernel knows when a match is
 			found.  Then enter the blocked state. */
-			vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+			vTaskPlaceOnUnorderedEventList( eventWAITING_LIST( pxEventBits, uxBitsToWaitFor, xWaitForAllBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
 
 			/* This is obsolete as it will get set after the task unblocks, but
 			some compilers mistakenly generate a warning about the variable
@@ -529,91 +618,175 @@ EventBits_t uxReturn;
 
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet )
 {
-ListItem_t *pxListItem, *pxNext;
-ListItem_t const *pxListEnd;
-List_t *pxList;
-EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+EventBits_t uxBitsToClear = 0;
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-BaseType_t xMatchFound = pdFALSE;
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+	List_t xUnblockList;
+	EventBits_t uxBitsToTest;
+	UBaseType_t uxBit;
+#else
+	ListItem_t *pxListItem, *pxNext;
+	ListItem_t const *pxListEnd;
+	List_t *pxList;
+	EventBits_t uxBitsWaitedFor, uxControlBits;
+	BaseType_t xMatchFound = pdFALSE;
+#endif
 
 	/* Check the user is not attempting to set the bits used by the kernel
 	itself. */
 	configASSERT( xEventGroup );
 	configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-	pxList = &( pxEventBits->xTasksWaitingForBits );
-	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+	{
+		vListInitialise( &xUnblockList );
+	}
+	#else
+	{
+		pxList = &( pxEventBits->xTasksWaitingForBits );
+		pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+	}
+	#endif
+
 	vTaskSuspendAll();
 	{
 		traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-		pxListItem = listGET_HEAD_ENTRY( pxList );
-
 		/* Set the bits. */
 		pxEventBits->uxEventBits |= uxBitsToSet;
 
-		/* See if the new bit value should unblock any tasks. */
-		while( pxListItem != pxListEnd )
+		#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
 		{
-			pxNext = listGET_NEXT( pxListItem );
-			uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-			xMatchFound = pdFALSE;
+			/* Only the tasks indexed by a bit that has just been set, and the
+			tasks waiting for any of several bits if one of their bits has just
+			been set, can have had their wait condition met. */
+			uxBitsToTest = uxBitsToSet & pxEventBits->uxBitsIndexed;
 
-			/* Split the bits waited for from the control bits. */
-			uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-			uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
-
-			if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+			for( uxBit = ( UBaseType_t ) 0U; uxBitsToTest != ( EventBits_t ) 0; uxBit++ )
 			{
-				/* Just looking for single bit being set. */
-				if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+				if( ( uxBitsToTest & ( ( EventBits_t ) 1 << uxBit ) ) != ( EventBits_t ) 0 )
 				{
-					xMatchFound = pdTRUE;
+					uxBitsToTest &= ~( ( EventBits_t ) 1 << uxBit );
+					uxBitsToClear |= prvTestWaitingList( pxEventBits, &( pxEventBits->xTasksWaitingForBit[ uxBit ] ), &xUnblockList );
+
+					/* Every task in the list was either unblocked or moved to
+					the list of a bit that is not set, so the list is now
+					empty. */
+					pxEventBits->uxBitsIndexed &= ~( ( EventBits_t ) 1 << uxBit );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+
+			if( ( uxBitsToSet & pxEventBits->uxBitsWaitedForByAny ) != ( EventBits_t ) 0 )
 			{
-				/* All bits are set. */
-				xMatchFound = pdTRUE;
+				uxBitsToClear |= prvTestWaitingList( pxEventBits, &( pxEventBits->xTasksWaitingForBits ), &xUnblockList );
 			}
 			else
 			{
-				/* Need all bits to be set, but not all the bits were set. */
+				mtCOVERAGE_TEST_MARKER();
 			}
 
-			if( xMatchFound != pdFALSE )
+			/* Store the actual event flag value in each task's event list item
+			as the task is removed from the list, exactly as when there is only
+			one list. */
+			while( listLIST_IS_EMPTY( &xUnblockList ) == pdFALSE )
 			{
-				/* The bits match.  Should the bits be cleared on exit? */
-				if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+				( void ) xTaskRemoveFromUnorderedEventList( listGET_HEAD_ENTRY( &xUnblockList ), pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+			}
+		}
+		#else
+		{
+			pxListItem = listGET_HEAD_ENTRY( pxList );
+
+			/* See if the new bit value should unblock any tasks. */
+			while( pxListItem != pxListEnd )
+			{
+				pxNext = listGET_NEXT( pxListItem );
+				uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+				xMatchFound = pdFALSE;
+
+				/* Split the bits waited for from the control bits. */
+				uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+				uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+				if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
 				{
-					uxBitsToClear |= uxBitsWaitedFor;
+					/* Just looking for single bit being set. */
+					if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+					{
+						xMatchFound = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+				{
+					/* All bits are set. */
+					xMatchFound = pdTRUE;
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* Need all bits to be set, but not all the bits were set. */
 				}
 
-				/* Store the actual event flag value in the task's event list
-				item before removing the task from the event list.  The
-				eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-				that is was unblocked due to its required bits matching, rather
-				than because it timed out. */
-				( void ) xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
-			}
+				if( xMatchFound != pdFALSE )
+				{
+					/* The bits match.  Should the bits be cleared on exit? */
+					if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+					{
+						uxBitsToClear |= uxBitsWaitedFor;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 
-			/* Move onto the next list item.  Note pxListItem->pxNext is not
-			used here as the list item may have been removed from the event list
-			and inserted into the ready/pending reading list. */
-			pxListItem = pxNext;
+					/* Store the actual event flag value in the task's event list
+					item before removing the task from the event list.  The
+					eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+					that is was unblocked due to its required bits matching, rather
+					than because it timed out. */
+					( void ) xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+				}
+
+				/* Move onto the next list item.  Note pxListItem->pxNext is not
+				used here as the list item may have been removed from the event list
+				and inserted into the ready/pending reading list. */
+				pxListItem = pxNext;
+			}
 		}
+		#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
 
 		/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
 		bit was set in the control word. */
 		pxEventBits->uxEventBits &= ~uxBitsToClear;
+
+		#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+		{
+			/* The list is only changed from critical sections, which cannot be
+			entered by other tasks while the scheduler is suspended, so does not
+			need to be protected to see if it is empty.  Tasks waiting for
+			several objects do not clear bits, so are tested against the bits
+			left after the tasks above have cleared theirs. */
+			if( listLIST_IS_EMPTY( &( pxEventBits->xTasksWaitingForMultiple ) ) == pdFALSE )
+			{
+				taskENTER_CRITICAL();
+				{
+					prvUnblockMultipleObjectWaits( pxEventBits, pdFALSE );
+				}
+				taskEXIT_CRITICAL();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
 	}
 	( void ) xTaskResumeAll();
 
@@ -625,11 +798,38 @@ void vEventGroupDelete( EventGroupHandle_t xEventGroup )
 {
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
 const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+	List_t xUnblockList;
+	UBaseType_t uxBit;
+#endif
 
 	vTaskSuspendAll();
 	{
 		traceEVENT_GROUP_DELETE( xEventGroup );
 
+		#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+		{
+			/* Gather the waiting tasks from every list so they are unblocked in
+			the order in which they started to wait. */
+			vListInitialise( &xUnblockList );
+
+			for( uxBit = ( UBaseType_t ) 0U; uxBit < eventNUM_INDEXED_BITS; uxBit++ )
+			{
+				while( listLIST_IS_EMPTY( &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) ) == pdFALSE )
+				{
+					prvAddToUnblockList( &xUnblockList, listGET_HEAD_ENTRY( &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) ) );
+				}
+			}
+
+			while( listLIST_IS_EMPTY( &( pxEventBits->xTasksWaitingForBits ) ) == pdFALSE )
+			{
+				prvAddToUnblockList( &xUnblockList, listGET_HEAD_ENTRY( &( pxEventBits->xTasksWaitingForBits ) ) );
+			}
+
+			pxTasksWaitingForBits = &xUnblockList;
+		}
+		#endif
+
 		while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
 		{
 			/* Unblock the task, returning 0 as the event list is being deleted
@@ -638,6 +838,18 @@ const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
 			( void ) xTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
 		}
 
+		#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+		{
+			/* Tasks waiting for several objects are also unblocked, and find
+			the event group's bits are not set. */
+			taskENTER_CRITICAL();
+			{
+				prvUnblockMultipleObjectWaits( pxEventBits, pdTRUE );
+			}
+			taskEXIT_CRITICAL();
+		}
+		#endif
+
 		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
 		{
 			/* The event group can only have been allocated dynamically - free
@@ -714,6 +926,173 @@ BaseType_t xWaitConditionMet = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	static void prvInitialiseBitIndex( EventGroup_t *pxEventBits )
+	{
+	UBaseType_t uxBit;
+
+		for( uxBit = ( UBaseType_t ) 0U; uxBit < eventNUM_INDEXED_BITS; uxBit++ )
+		{
+			vListInitialise( &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) );
+		}
+
+		pxEventBits->uxBitsIndexed = 0;
+		pxEventBits->uxBitsWaitedForByAny = 0;
+	}
+
+#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	static List_t *prvGetWaitingList( EventGroup_t *pxEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits )
+	{
+	EventBits_t uxIndexBits;
+	UBaseType_t uxBit;
+	List_t *pxList;
+
+		if( xWaitForAllBits != pdFALSE )
+		{
+			/* The task cannot be unblocked before any of the bits it is still
+			missing is set, so it can be indexed by any one of them. */
+			uxIndexBits = uxBitsToWaitFor & ~( pxEventBits->uxEventBits );
+		}
+		else if( ( uxBitsToWaitFor & ( uxBitsToWaitFor - ( EventBits_t ) 1 ) ) == ( EventBits_t ) 0 )
+		{
+			/* Waiting for a single bit. */
+			uxIndexBits = uxBitsToWaitFor;
+		}
+		else
+		{
+			/* Waiting for any one of several bits. */
+			uxIndexBits = 0;
+		}
+
+		if( uxIndexBits != ( EventBits_t ) 0 )
+		{
+			for( uxBit = ( UBaseType_t ) 0U; ( uxIndexBits & ( ( EventBits_t ) 1 << uxBit ) ) == ( EventBits_t ) 0; uxBit++ )
+			{
+				/* Find the lowest bit. */
+			}
+
+			configASSERT( uxBit < eventNUM_INDEXED_BITS );
+			pxEventBits->uxBitsIndexed |= ( ( EventBits_t ) 1 << uxBit );
+			pxList = &( pxEventBits->xTasksWaitingForBit[ uxBit ] );
+		}
+		else
+		{
+			pxEventBits->uxBitsWaitedForByAny |= uxBitsToWaitFor;
+			pxList = &( pxEventBits->xTasksWaitingForBits );
+		}
+
+		return pxList;
+	}
+
+#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	static void prvAddToUnblockList( List_t *pxUnblockList, ListItem_t *pxListItem )
+	{
+	TickType_t xOrder;
+
+		/* The item value is overwritten by xTaskRemoveFromUnorderedEventList()
+		when the task is unblocked, so can hold the order until then. */
+		xOrder = xTaskGetEventListItemOrder( pxListItem );
+		( void ) uxListRemove( pxListItem );
+		listSET_LIST_ITEM_VALUE( pxListItem, xOrder );
+
+		/* Tasks from the same list usually arrive in order, so check the end of
+		the list before searching it. */
+		if( ( listLIST_IS_EMPTY( pxUnblockList ) != pdFALSE ) || ( listGET_LIST_ITEM_VALUE( pxUnblockList->xListEnd.pxPrevious ) <= xOrder ) )
+		{
+			vListInsertEnd( pxUnblockList, pxListItem );
+		}
+		else
+		{
+			vListInsert( pxUnblockList, pxListItem );
+		}
+	}
+
+#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	static EventBits_t prvTestWaitingList( EventGroup_t *pxEventBits, List_t *pxList, List_t *pxUnblockList )
+	{
+	ListItem_t *pxListItem, *pxNext;
+	ListItem_t const *pxListEnd;
+	EventBits_t uxBitsToClear = 0, uxBitsStillWaitedFor = 0, uxBitsWaitedFor, uxControlBits;
+	BaseType_t xWaitForAllBits;
+
+		pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+		pxListItem = listGET_HEAD_ENTRY( pxList );
+
+		while( pxListItem != pxListEnd )
+		{
+			pxNext = listGET_NEXT( pxListItem );
+			uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+
+			/* Split the bits waited for from the control bits. */
+			uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+			uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+			if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 )
+			{
+				xWaitForAllBits = pdTRUE;
+			}
+			else
+			{
+				xWaitForAllBits = pdFALSE;
+			}
+
+			if( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, xWaitForAllBits ) != pdFALSE )
+			{
+				/* The bits match.  Should the bits be cleared on exit? */
+				if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+				{
+					uxBitsToClear |= uxBitsWaitedFor;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvAddToUnblockList( pxUnblockList, pxListItem );
+			}
+			else if( pxList != &( pxEventBits->xTasksWaitingForBits ) )
+			{
+				/* The task was indexed by a bit that is now set, but is still
+				waiting for other bits. */
+				( void ) uxListRemove( pxListItem );
+				vListInsertEnd( prvGetWaitingList( pxEventBits, uxBitsWaitedFor, xWaitForAllBits ), pxListItem );
+			}
+			else
+			{
+				uxBitsStillWaitedFor |= uxBitsWaitedFor;
+			}
+
+			pxListItem = pxNext;
+		}
+
+		if( pxList == &( pxEventBits->xTasksWaitingForBits ) )
+		{
+			pxEventBits->uxBitsWaitedForByAny = uxBitsStillWaitedFor;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxBitsToClear;
+	}
+
+#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
@@ -729,6 +1108,94 @@ BaseType_t xWaitConditionMet = pdFALSE;
 #endif
 /*-----------------------------------------------------------*/
 
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+	BaseType_t xEventGroupAddMultipleObjectWait( EventGroupHandle_t xEventGroup, ListItem_t * const pxWaitListItem, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits )
+	{
+	EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+	BaseType_t xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION. */
+		configASSERT( xEventGroup );
+		configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+		configASSERT( uxBitsToWaitFor != 0 );
+
+		if( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsToWaitFor, xWaitForAllBits ) != pdFALSE )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			/* The wait condition is stored in the record in the same way as
+			in the event list item of a task waiting on the event group
+			directly.  The owner and priority of the record are not used by
+			the event group. */
+			if( xWaitForAllBits != pdFALSE )
+			{
+				listSET_LIST_ITEM_VALUE( pxWaitListItem, uxBitsToWaitFor | eventWAIT_FOR_ALL_BITS );
+			}
+			else
+			{
+				listSET_LIST_ITEM_VALUE( pxWaitListItem, uxBitsToWaitFor );
+			}
+
+			vListInsertEnd( &( pxEventBits->xTasksWaitingForMultiple ), pxWaitListItem );
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+	static void prvUnblockMultipleObjectWaits( EventGroup_t *pxEventBits, const BaseType_t xUnblockAll )
+	{
+	ListItem_t *pxListItem, *pxNext;
+	ListItem_t const *pxListEnd;
+	EventBits_t uxBitsWaitedFor;
+	BaseType_t xWaitForAllBits;
+
+		pxListEnd = listGET_END_MARKER( &( pxEventBits->xTasksWaitingForMultiple ) ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+		pxListItem = listGET_HEAD_ENTRY( &( pxEventBits->xTasksWaitingForMultiple ) );
+
+		while( pxListItem != pxListEnd )
+		{
+			pxNext = listGET_NEXT( pxListItem );
+			uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+
+			if( ( uxBitsWaitedFor & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 )
+			{
+				xWaitForAllBits = pdTRUE;
+			}
+			else
+			{
+				xWaitForAllBits = pdFALSE;
+			}
+
+			uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+			if( ( xUnblockAll != pdFALSE ) || ( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, xWaitForAllBits ) != pdFALSE ) )
+			{
+				/* The scheduler is suspended, so the task is held in the
+				pending ready list and the yield is performed when the scheduler
+				is resumed. */
+				( void ) xTaskRemoveMultipleObjectWaitItem( pxListItem );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxListItem = pxNext;
+		}
+	}
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+/*-----------------------------------------------------------*/
+
 #if (configUSE_TRACE_FACILITY == 1)
 
 	UBaseType_t uxEventGroupGetNumber( void* xEventGroup )
@@ -0,0 +1,645 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fast_mutex.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include fast mutex functionality.  This #if is closed at the very bottom of
+this file.  If you want to include fast mutexes then ensure
+configUSE_FAST_MUTEXES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+/* The lock word of a fast mutex holds fmUNLOCKED, or the handle of the task
+holding the mutex with fmWAITERS set while tasks are waiting for it, so a task
+that finds the mutex locked always knows which task to raise the priority of.
+Task handles are aligned, so bit 0 of a handle is always clear.  The lock word
+only ever moves out of fmUNLOCKED, or from a holder without fmWAITERS back to
+fmUNLOCKED, by a compare and swap, as those are the transitions made without a
+critical section.  On some ports a compare and swap can fail even though the
+value matched, so a failed compare and swap is always either retried or
+followed by a slower path that is correct whatever the lock word holds. */
+#define fmUNLOCKED		( ( portPOINTER_SIZE_TYPE ) 0 )
+#define fmWAITERS		( ( portPOINTER_SIZE_TYPE ) 1 )
+
+/* Used in place of a task handle by a mutex taken before any task has been
+created. */
+#define fmNO_TASK		( ( portPOINTER_SIZE_TYPE ) 2 )
+
+#ifdef portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE
+	#define fmCOMPARE_AND_SWAP( puxDestination, uxExchange, uxComparand ) portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE( ( puxDestination ), ( uxExchange ), ( uxComparand ) )
+#else
+	#define fmCOMPARE_AND_SWAP( puxDestination, uxExchange, uxComparand ) prvCompareAndSwap( ( puxDestination ), ( uxExchange ), ( uxComparand ) )
+#endif
+
+#if( configUSE_PREEMPTION == 0 )
+	/* If the cooperative scheduler is being used then a yield should not be
+	performed just because a higher priority task has been woken. */
+	#define fmYIELD_IF_USING_PREEMPTION()
+#else
+	#define fmYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
+#endif
+
+/* Bits stored in the ucFlags field of the fast mutex. */
+#define fmFLAGS_IS_STATICALLY_ALLOCATED	( ( uint8_t ) 1 ) /* Set if the fast mutex was created using statically allocated memory. */
+
+/*-----------------------------------------------------------*/
+
+/* Structure that holds the state of a fast mutex. */
+typedef struct xFAST_MUTEX /*lint !e9058 Style convention uses tag. */
+{
+	volatile portPOINTER_SIZE_TYPE uxLockWord;	/*< fmUNLOCKED, or the holder of the mutex, with fmWAITERS set if tasks are waiting. */
+	List_t xTasksWaitingToLock;					/*< List of tasks that are blocked waiting for the mutex.  Stored in priority order. */
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucFlags;
+	#endif
+} FastMutex_t;
+
+/*-----------------------------------------------------------*/
+
+#ifndef portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE
+	/*
+	 * Used in place of portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE() on ports that
+	 * do not provide it.  Only single core builds get here, so masking
+	 * interrupts is enough to make the compare and swap atomic.
+	 */
+	static BaseType_t prvCompareAndSwap( volatile portPOINTER_SIZE_TYPE *puxDestination, portPOINTER_SIZE_TYPE uxExchange, portPOINTER_SIZE_TYPE uxComparand ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Called by xFastMutexCreate() and xFastMutexCreateStatic() to initialise the
+ * members of a newly created fast mutex.
+ */
+static void prvInitialiseNewFastMutex( FastMutex_t * const pxFastMutex ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the value the calling task stores in the lock word when it takes a
+ * fast mutex.
+ */
+static portPOINTER_SIZE_TYPE prvGetLockWordOfCallingTask( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the handle of the task holding a fast mutex with the lock word
+ * uxLockWord, or NULL if the mutex is not held by a task.
+ */
+static TaskHandle_t prvGetHolder( const portPOINTER_SIZE_TYPE uxLockWord ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from a critical section when a task has timed out waiting for the
+ * mutex.  Returns the priority of the highest priority task that is still
+ * waiting, or tskIDLE_PRIORITY if no tasks are waiting.
+ */
+static UBaseType_t prvGetHighestWaitingPriority( const FastMutex_t * const pxFastMutex ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	FastMutexHandle_t xFastMutexCreate( void )
+	{
+	FastMutex_t *pxFastMutex;
+
+		pxFastMutex = ( FastMutex_t * ) pvPortMalloc( sizeof( FastMutex_t ) );
+
+		if( pxFastMutex != NULL )
+		{
+			prvInitialiseNewFastMutex( pxFastMutex );
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				pxFastMutex->ucFlags = ( uint8_t ) 0;
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( FastMutexHandle_t ) pxFastMutex;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	FastMutexHandle_t xFastMutexCreateStatic( StaticFastMutex_t *pxFastMutexBuffer )
+	{
+	FastMutex_t * const pxFastMutex = ( FastMutex_t * ) pxFastMutexBuffer; /*lint !e740 !e9087 FastMutex_t and StaticFastMutex_t are guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+
+		configASSERT( pxFastMutexBuffer );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticFastMutex_t equals the size of the real fast
+			mutex structure. */
+			volatile size_t xSize = sizeof( StaticFastMutex_t );
+			configASSERT( xSize == sizeof( FastMutex_t ) );
+		}
+		#endif /* configASSERT_DEFINED */
+
+		if( pxFastMutex != NULL )
+		{
+			prvInitialiseNewFastMutex( pxFastMutex );
+
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* Remember the mutex was statically allocated in case it is
+				later deleted. */
+				pxFastMutex->ucFlags = fmFLAGS_IS_STATICALLY_ALLOCATED;
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( FastMutexHandle_t ) pxFastMutex;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+BaseType_t xFastMutexLock( FastMutexHandle_t xFastMutex, TickType_t xTicksToWait )
+{
+FastMutex_t * const pxFastMutex = ( FastMutex_t * ) xFastMutex;
+TimeOut_t xTimeOut;
+BaseType_t xEntryTimeSet = pdFALSE, xInheritanceOccurred = pdFALSE, xBlocked;
+portPOINTER_SIZE_TYPE uxCallingTask, uxLockWord, uxLockedWord;
+
+	configASSERT( pxFastMutex );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	uxCallingTask = prvGetLockWordOfCallingTask();
+
+	/* The mutex is not held - take it with a single atomic operation, which
+	also records the calling task as the holder. */
+	if( fmCOMPARE_AND_SWAP( &( pxFastMutex->uxLockWord ), uxCallingTask, fmUNLOCKED ) != pdFALSE )
+	{
+		vTaskIncrementMutexHeldCount( prvGetHolder( uxCallingTask ) );
+		return pdPASS;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* This function relaxes the coding standard somewhat to allow return
+	statements within the function itself.  This is done in the interest
+	of execution time efficiency. */
+	for( ;; )
+	{
+		xBlocked = pdFALSE;
+
+		taskENTER_CRITICAL();
+		{
+			uxLockWord = pxFastMutex->uxLockWord;
+
+			if( uxLockWord == fmUNLOCKED )
+			{
+				/* Tasks may have been left waiting when this task was
+				unblocked, in which case the holder must wake the next of them
+				when it gives the mutex back.  The compare and swap fails if
+				another core took the mutex first, or spuriously on some ports,
+				in which case try again. */
+				if( listLIST_IS_EMPTY( &( pxFastMutex->xTasksWaitingToLock ) ) != pdFALSE )
+				{
+					uxLockedWord = uxCallingTask;
+				}
+				else
+				{
+					uxLockedWord = uxCallingTask | fmWAITERS;
+				}
+
+				if( fmCOMPARE_AND_SWAP( &( pxFastMutex->uxLockWord ), uxLockedWord, fmUNLOCKED ) != pdFALSE )
+				{
+					vTaskIncrementMutexHeldCount( prvGetHolder( uxCallingTask ) );
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else if( ( xTicksToWait == ( TickType_t ) 0 ) || ( ( xEntryTimeSet != pdFALSE ) && ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE ) ) )
+			{
+				/* This task may have been unblocked to take the mutex when it
+				was given back, only for another task to take it first.  Unless
+				the mutex is marked as having tasks waiting, which ensures its
+				holder will unblock one of them, pass the wake on to the next
+				waiting task so it can take or mark the mutex itself. */
+				if( ( ( uxLockWord & fmWAITERS ) == fmUNLOCKED ) && ( listLIST_IS_EMPTY( &( pxFastMutex->xTasksWaitingToLock ) ) == pdFALSE ) )
+				{
+					if( xTaskRemoveFromEventList( &( pxFastMutex->xTasksWaitingToLock ) ) != pdFALSE )
+					{
+						fmYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The holder must not keep a priority it inherited from this
+				task. */
+				if( xInheritanceOccurred != pdFALSE )
+				{
+					( void ) xTaskPriorityDisinheritAfterTimeout( prvGetHolder( uxLockWord ), prvGetHighestWaitingPriority( pxFastMutex ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return pdFAIL;
+			}
+			else
+			{
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Mark the mutex so the holder enters the kernel to wake this
+				task when it gives the mutex back.  The compare and swap fails
+				if the holder gave the mutex back after it was read, or
+				spuriously on some ports, in which case try again.  The lock
+				word names the holder, so its priority can be raised even if
+				it took the mutex only just before. */
+				if( ( ( uxLockWord & fmWAITERS ) != fmUNLOCKED ) || ( fmCOMPARE_AND_SWAP( &( pxFastMutex->uxLockWord ), uxLockWord | fmWAITERS, uxLockWord ) != pdFALSE ) )
+				{
+					if( xTaskPriorityInherit( prvGetHolder( uxLockWord ) ) != pdFALSE )
+					{
+						xInheritanceOccurred = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					vTaskPlaceOnEventList( &( pxFastMutex->xTasksWaitingToLock ), xTicksToWait );
+					xBlocked = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xBlocked != pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xFastMutexUnlock( FastMutexHandle_t xFastMutex )
+{
+FastMutex_t * const pxFastMutex = ( FastMutex_t * ) xFastMutex;
+portPOINTER_SIZE_TYPE uxCallingTask;
+BaseType_t xYieldRequired = pdFALSE;
+
+	configASSERT( pxFastMutex );
+
+	uxCallingTask = prvGetLockWordOfCallingTask();
+
+	/* Other tasks can only set fmWAITERS while the calling task holds the
+	mutex, so no mutual exclusion is required to test the holder. */
+	if( ( pxFastMutex->uxLockWord & ~fmWAITERS ) != uxCallingTask )
+	{
+		return pdFAIL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* No task waited for the mutex - give it back with a single atomic
+	operation. */
+	if( fmCOMPARE_AND_SWAP( &( pxFastMutex->uxLockWord ), fmUNLOCKED, uxCallingTask ) != pdFALSE )
+	{
+		if( xTaskDecrementMutexHeldCount( prvGetHolder( uxCallingTask ) ) != pdFALSE )
+		{
+			return pdPASS;
+		}
+		else
+		{
+			/* The calling task is still above its base priority as mutexes
+			were given back in a different order to that in which they were
+			taken.  Drop the priority as the last of them is given back. */
+			taskENTER_CRITICAL();
+			{
+				if( xTaskPriorityDisinherit( prvGetHolder( uxCallingTask ) ) != pdFALSE )
+				{
+					fmYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+			return pdPASS;
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Tasks are waiting for the mutex, or the compare and swap failed
+	spuriously and fmWAITERS is not set.  Either way only the holder moves the
+	lock word away from the holder, and other tasks only set fmWAITERS from
+	within a critical section, so inside one the mutex can be given back with
+	a plain write. */
+	taskENTER_CRITICAL();
+	{
+		pxFastMutex->uxLockWord = fmUNLOCKED;
+
+		/* Wake the highest priority waiting task to take the mutex.  It marks
+		the mutex again if other tasks are still waiting. */
+		if( listLIST_IS_EMPTY( &( pxFastMutex->xTasksWaitingToLock ) ) == pdFALSE )
+		{
+			if( xTaskRemoveFromEventList( &( pxFastMutex->xTasksWaitingToLock ) ) != pdFALSE )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Drop any priority inherited from the waiting tasks. */
+		if( xTaskPriorityDisinherit( prvGetHolder( uxCallingTask ) ) != pdFALSE )
+		{
+			xYieldRequired = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xYieldRequired != pdFALSE )
+		{
+			/* Yes it is ok to do this from within the critical section - the
+			kernel takes care of that. */
+			fmYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xFastMutexGetHolder( FastMutexHandle_t xFastMutex )
+{
+FastMutex_t * const pxFastMutex = ( FastMutex_t * ) xFastMutex;
+
+	configASSERT( pxFastMutex );
+	return prvGetHolder( pxFastMutex->uxLockWord );
+}
+/*-----------------------------------------------------------*/
+
+void vFastMutexDelete( FastMutexHandle_t xFastMutex )
+{
+FastMutex_t * const pxFastMutex = ( FastMutex_t * ) xFastMutex;
+
+	configASSERT( pxFastMutex );
+	configASSERT( pxFastMutex->uxLockWord == fmUNLOCKED );
+	configASSERT( listLIST_IS_EMPTY( &( pxFastMutex->xTasksWaitingToLock ) ) != pdFALSE );
+
+	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	{
+		/* The mutex can only have been allocated dynamically - free it
+		again. */
+		vPortFree( pxFastMutex );
+	}
+	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	{
+		/* The mutex could have been allocated statically or dynamically, so
+		check before attempting to free the memory. */
+		if( ( pxFastMutex->ucFlags & fmFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+		{
+			vPortFree( pxFastMutex );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+#ifndef portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE
+
+	static BaseType_t prvCompareAndSwap( volatile portPOINTER_SIZE_TYPE *puxDestination, portPOINTER_SIZE_TYPE uxExchange, portPOINTER_SIZE_TYPE uxComparand )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xReturn = pdFALSE;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( *puxDestination == uxComparand )
+			{
+				*puxDestination = uxExchange;
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* portATOMIC_COMPARE_AND_SWAP_POINTER_SIZE */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewFastMutex( FastMutex_t * const pxFastMutex )
+{
+	pxFastMutex->uxLockWord = fmUNLOCKED;
+	vListInitialise( &( pxFastMutex->xTasksWaitingToLock ) );
+}
+/*-----------------------------------------------------------*/
+
+static portPOINTER_SIZE_TYPE prvGetLockWordOfCallingTask( void )
+{
+portPOINTER_SIZE_TYPE uxCallingTask;
+
+	uxCallingTask = ( portPOINTER_SIZE_TYPE ) xTaskGetCurrentTaskHandle(); /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical. */
+
+	/* The lock word of a held mutex must not read as fmUNLOCKED. */
+	if( uxCallingTask == fmUNLOCKED )
+	{
+		uxCallingTask = fmNO_TASK;
+	}
+	else
+	{
+		configASSERT( ( uxCallingTask & fmWAITERS ) == fmUNLOCKED );
+	}
+
+	return uxCallingTask;
+}
+/*-----------------------------------------------------------*/
+
+static TaskHandle_t prvGetHolder( const portPOINTER_SIZE_TYPE uxLockWord )
+{
+portPOINTER_SIZE_TYPE uxHolder = uxLockWord & ~fmWAITERS;
+TaskHandle_t xHolder;
+
+	if( uxHolder == fmNO_TASK )
+	{
+		xHolder = NULL;
+	}
+	else
+	{
+		xHolder = ( TaskHandle_t ) uxHolder; /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical. */
+	}
+
+	return xHolder;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetHighestWaitingPriority( const FastMutex_t * const pxFastMutex )
+{
+UBaseType_t uxHighestPriorityOfWaitingTasks;
+
+	/* The tasks waiting for the mutex are held in priority order, so the first
+	one has the highest priority. */
+	if( listCURRENT_LIST_LENGTH( &( pxFastMutex->xTasksWaitingToLock ) ) > ( UBaseType_t ) 0U )
+	{
+		uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxFastMutex->xTasksWaitingToLock ) );
+	}
+	else
+	{
+		uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+	}
+
+	return uxHighestPriorityOfWaitingTasks;
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include fast mutex functionality.  If you want to include fast mutexes then
+ensure configUSE_FAST_MUTEXES is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_FAST_MUTEXES == 1 */
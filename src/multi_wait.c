@@ -0,0 +1,345 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "event_groups.h"
+#include "multi_wait.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include multiple object wait functionality.  This #if is closed at the very
+bottom of this file.  If you want to wait for multiple objects then ensure
+configUSE_MULTIPLE_OBJECT_WAITS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called from a critical section to link a wait record into each object in
+ * turn.  Stops at the first object found to be ready and returns its index, in
+ * which case the records already linked must be removed again.  Returns
+ * waitTIMED_OUT if no object is ready, in which case every object has a record.
+ */
+static BaseType_t prvAddWaitRecords( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from a critical section to remove the calling task's wait records
+ * from any objects they are still linked into.
+ */
+static void prvRemoveWaitRecords( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xWaitForMultipleObjects( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount, TickType_t xTicksToWait )
+{
+List_t xWaitList;
+TimeOut_t xTimeOut;
+UBaseType_t uxIndex;
+BaseType_t xReturn, xBlocked;
+BaseType_t xEntryTimeSet = pdFALSE;
+
+	configASSERT( pxObjects );
+	configASSERT( uxObjectCount > ( UBaseType_t ) 0 );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	/* The calling task blocks on a list of its own, which the object that
+	becomes ready first unblocks it from.  The list is only used while the task
+	is in this function. */
+	vListInitialise( &xWaitList );
+
+	for( uxIndex = ( UBaseType_t ) 0; uxIndex < uxObjectCount; uxIndex++ )
+	{
+		vListInitialiseItem( &( pxObjects[ uxIndex ].xWaitListItem ) );
+	}
+
+	do
+	{
+		taskENTER_CRITICAL();
+		{
+			/* Records left by the last time around the loop are removed, and
+			new records linked, within the same critical section, so an object
+			that becomes ready in between cannot be missed. */
+			prvRemoveWaitRecords( pxObjects, uxObjectCount );
+			xReturn = prvAddWaitRecords( pxObjects, uxObjectCount );
+			xBlocked = pdFALSE;
+
+			if( xReturn == waitTIMED_OUT )
+			{
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+				{
+					/* The kernel is told where the records are while they are
+					linked into the objects, in case the task is deleted or its
+					priority changes. */
+					vTaskSetMultipleObjectWaitObjects( pxObjects, uxObjectCount );
+					vTaskPlaceOnEventList( &xWaitList, xTicksToWait );
+					xBlocked = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xBlocked == pdFALSE )
+			{
+				prvRemoveWaitRecords( pxObjects, uxObjectCount );
+				vTaskSetMultipleObjectWaitObjects( NULL, ( UBaseType_t ) 0 );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xBlocked != pdFALSE )
+		{
+			/* The task was placed on its own list with interrupts disabled, so
+			yield now.  When the task runs again one of its objects has probably
+			become ready, but might already have been read by another task,
+			so the objects are tested again. */
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	} while( xBlocked != pdFALSE );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvAddWaitRecords( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount )
+{
+UBaseType_t uxIndex = ( UBaseType_t ) 0;
+BaseType_t xReady = pdFALSE, xReturn;
+WaitObject_t *pxObject;
+
+	while( ( xReady == pdFALSE ) && ( uxIndex < uxObjectCount ) )
+	{
+		pxObject = &( pxObjects[ uxIndex ] );
+		vTaskSetMultipleObjectWaitOwner( &( pxObject->xWaitListItem ) );
+
+		switch( pxObject->eType )
+		{
+			case eWaitForQueue :
+				xReady = xQueueAddMultipleObjectWait( ( QueueHandle_t ) pxObject->pvObject, &( pxObject->xWaitListItem ) );
+				break;
+
+			case eWaitForEventBits :
+				xReady = xEventGroupAddMultipleObjectWait( ( EventGroupHandle_t ) pxObject->pvObject, &( pxObject->xWaitListItem ), pxObject->uxBitsToWaitFor, pxObject->xWaitForAllBits );
+				break;
+
+			#if( configUSE_TASK_NOTIFICATIONS == 1 )
+				case eWaitForNotification :
+					xReady = xTaskNotifyAddMultipleObjectWait();
+					break;
+			#endif
+
+			default :
+				/* Not a valid object type. */
+				configASSERT( pdFALSE );
+				break;
+		}
+
+		if( xReady == pdFALSE )
+		{
+			uxIndex++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( xReady != pdFALSE )
+	{
+		xReturn = ( BaseType_t ) uxIndex;
+	}
+	else
+	{
+		xReturn = waitTIMED_OUT;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveWaitRecords( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount )
+{
+	vMultipleObjectWaitRemoveRecords( pxObjects, uxObjectCount );
+
+	#if( configUSE_TASK_NOTIFICATIONS == 1 )
+	{
+	UBaseType_t uxIndex;
+
+		for( uxIndex = ( UBaseType_t ) 0; uxIndex < uxObjectCount; uxIndex++ )
+		{
+			if( pxObjects[ uxIndex ].eType == eWaitForNotification )
+			{
+				vTaskNotifyRemoveMultipleObjectWait();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vMultipleObjectWaitRemoveRecords( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount )
+{
+UBaseType_t uxIndex;
+
+	for( uxIndex = ( UBaseType_t ) 0; uxIndex < uxObjectCount; uxIndex++ )
+	{
+		/* A record that was passed over by the object it is linked into has
+		already been removed. */
+		if( listLIST_ITEM_CONTAINER( &( pxObjects[ uxIndex ].xWaitListItem ) ) != NULL )
+		{
+			( void ) uxListRemove( &( pxObjects[ uxIndex ].xWaitListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vMultipleObjectWaitReorderRecords( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount, const TickType_t xItemValue )
+{
+UBaseType_t uxIndex;
+ListItem_t *pxWaitListItem;
+List_t *pxEventList;
+
+	for( uxIndex = ( UBaseType_t ) 0; uxIndex < uxObjectCount; uxIndex++ )
+	{
+		pxWaitListItem = &( pxObjects[ uxIndex ].xWaitListItem );
+		pxEventList = ( List_t * ) listLIST_ITEM_CONTAINER( pxWaitListItem );
+
+		/* Only queues hold their waiting tasks in priority order.  The value
+		of a record in an event group is the bits it waits for. */
+		if( ( pxObjects[ uxIndex ].eType == eWaitForQueue ) && ( pxEventList != NULL ) )
+		{
+			( void ) uxListRemove( pxWaitListItem );
+			listSET_LIST_ITEM_VALUE( pxWaitListItem, xItemValue );
+			vListInsert( pxEventList, pxWaitListItem );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include multiple object wait functionality.  If you want to wait for
+multiple objects then ensure configUSE_MULTIPLE_OBJECT_WAITS is set to 1 in
+FreeRTOSConfig.h. */
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS == 1 */
@@ -93,6 +93,7 @@ privileged Vs unprivileged linkage and placement. */
 /* Constants used with the cRxLock and cTxLock structure members. */
 #define queueUNLOCKED					( ( int8_t ) -1 )
 #define queueLOCKED_UNMODIFIED			( ( int8_t ) 0 )
+#define queueLOCK_COUNT_MAX				( ( int8_t ) 127 )
 
 /* When the Queue_t structure is used to represent a base queue its pcHead and
 pcTail members are used as pointers into the queue storage area.  When the
@@ -114,6 +115,50 @@ zero. */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH ( ( UBaseType_t ) 0 )
 #define queueMUTEX_GIVE_BLOCK_TIME		 ( ( TickType_t ) 0U )
 
+#if( configUSE_CEILING_MUTEXES == 1 )
+	/* A priority ceiling mutex raises its holder when it is taken, so the
+	holder never inherits the priority of a task that blocks on the mutex. */
+	#define queueUSES_PRIORITY_INHERITANCE( pxQueue ) ( ( ( pxQueue )->uxQueueType == queueQUEUE_IS_MUTEX ) && ( ( pxQueue )->uxCeilingPriority == tskIDLE_PRIORITY ) )
+#else
+	#define queueUSES_PRIORITY_INHERITANCE( pxQueue ) ( ( pxQueue )->uxQueueType == queueQUEUE_IS_MUTEX )
+#endif
+
+#if( configUSE_QUEUE_LOANS == 1 )
+	/* The number of slots that are held outside of the item count, either
+	because they are on loan to a sender (xQueueLoanSlot()) or borrowed by a
+	receiver (xQueueBorrowSlot()). */
+	#define queueSLOTS_HELD( pxQueue )															\
+		( ( ( ( pxQueue )->pcLoanedSlot != NULL ) ? ( UBaseType_t ) 1U : ( UBaseType_t ) 0U ) +	\
+		  ( ( ( pxQueue )->pcBorrowedSlot != NULL ) ? ( UBaseType_t ) 1U : ( UBaseType_t ) 0U ) )
+
+	/* Nothing else can be written to the queue while a slot is on loan, as the
+	new item would become visible ahead of the item being built in the loaned
+	slot.  While a slot is borrowed it is not free, and as it sits at the read
+	position an item cannot be sent to the front of the queue or overwritten
+	either. */
+	#define queueCAN_SEND( pxQueue, xCopyPosition )																\
+		( ( ( pxQueue )->pcLoanedSlot == NULL ) &&																\
+		  ( ( ( pxQueue )->pcBorrowedSlot == NULL ) ?															\
+			( ( ( pxQueue )->uxMessagesWaiting < ( pxQueue )->uxLength ) || ( ( xCopyPosition ) == queueOVERWRITE ) ) :	\
+			( ( ( xCopyPosition ) == queueSEND_TO_BACK ) &&														\
+			  ( ( ( pxQueue )->uxMessagesWaiting + ( UBaseType_t ) 1U ) < ( pxQueue )->uxLength ) ) ) )
+
+	/* The borrowed slot must stay at the read position until it is released,
+	otherwise the write position could wrap around onto it, so items can only
+	be peeked, not received, while a slot is borrowed. */
+	#define queueRECEIVE_HELD_OFF( pxQueue, xJustPeeking ) ( ( ( pxQueue )->pcBorrowedSlot != NULL ) && ( ( xJustPeeking ) == pdFALSE ) )
+
+	/* The number of items that can be sent to the back of the queue in one
+	go. */
+	#define queueSPACES_FOR_SEND( pxQueue )														\
+		( ( ( pxQueue )->pcLoanedSlot != NULL ) ? ( UBaseType_t ) 0U :							\
+		  ( ( pxQueue )->uxLength - ( pxQueue )->uxMessagesWaiting - queueSLOTS_HELD( pxQueue ) ) )
+#else
+	#define queueCAN_SEND( pxQueue, xCopyPosition ) ( ( ( pxQueue )->uxMessagesWaiting < ( pxQueue )->uxLength ) || ( ( xCopyPosition ) == queueOVERWRITE ) )
+	#define queueRECEIVE_HELD_OFF( pxQueue, xJustPeeking ) ( pdFALSE )
+	#define queueSPACES_FOR_SEND( pxQueue ) ( ( pxQueue )->uxLength - ( pxQueue )->uxMessagesWaiting )
+#endif
+
 #if( configUSE_PREEMPTION == 0 )
 	/* If the cooperative scheduler is being used then a yield should not be
 	performed just because a higher priority task has been woken. */
@@ -149,6 +194,20 @@ typedef struct QueueDefinition
 	volatile int8_t cRxLock;		/*< Stores the number of items received from the queue (removed from the queue) while the queue was locked.  Set to queueUNLOCKED when the queue is not locked. */
 	volatile int8_t cTxLock;		/*< Stores the number of items transmitted to the queue (added to the queue) while the queue was locked.  Set to queueUNLOCKED when the queue is not locked. */
 
+	#if( configUSE_WAKE_LATENCY_STATS == 1 )
+		volatile uint8_t ucLockedFromISR;	/*< queueTX_LOCKED_FROM_ISR and queueRX_LOCKED_FROM_ISR are set if an interrupt added to the corresponding lock count while the queue was locked. */
+	#endif
+
+	#if( configUSE_QUEUE_LOANS == 1 )
+		int8_t *pcLoanedSlot;		/*< The slot on loan to a sender that is writing an item in place, or NULL if no slot is on loan. */
+		int8_t *pcBorrowedSlot;		/*< The slot borrowed by a receiver that is reading an item in place, or NULL if no slot is borrowed. */
+	#endif
+
+	#if( configUSE_CEILING_MUTEXES == 1 )
+		UBaseType_t uxCeilingPriority;		/*< The priority the holder of a priority ceiling mutex runs at, or tskIDLE_PRIORITY if the mutex uses priority inheritance.  Only used when the structure is used as a mutex. */
+		UBaseType_t uxPriorityBeforeCeiling;/*< The priority the holder of a priority ceiling mutex had when it took the mutex. */
+	#endif
+
 	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 		uint8_t ucStaticallyAllocated;	/*< Set to pdTRUE if the memory used by the queue was statically allocated to ensure no attempt is made to free the memory. */
 	#endif
@@ -168,6 +227,58 @@ typedef struct QueueDefinition
 name below to enable the use of older kernel aware debuggers. */
 typedef xQUEUE Queue_t;
 
+#if( configUSE_QUEUE_HAND_OFF == 1 )
+
+	/* A task that blocks in xQueueGenericSend() or xQueueGenericReceive()
+	records one of these (on its own stack) against its TCB, so the task or
+	interrupt that unblocks it can complete the send or receive on its behalf.
+	The blocked task sees xComplete set when it runs again. */
+	typedef struct QUEUE_HAND_OFF
+	{
+		void *pvBuffer;					/*< The item being sent, or the buffer to receive into. */
+		BaseType_t xCopyPosition;		/*< Where the item being sent is to be placed.  Not used when receiving. */
+		volatile BaseType_t xComplete;	/*< Set to pdTRUE once the operation has been completed by another task or interrupt. */
+	} QueueHandOff_t;
+
+	/* Unblocking a task that is waiting to send can also complete its send. */
+	#define queueUNBLOCK_SENDER( pxQueue ) prvUnblockWaitingSender( pxQueue )
+#else
+	#define queueUNBLOCK_SENDER( pxQueue ) xTaskRemoveFromEventList( &( ( pxQueue )->xTasksWaitingToSend ) )
+#endif
+
+#if( configUSE_WAKE_LATENCY_STATS == 1 )
+	/* Brackets the code that unblocks tasks on behalf of an interrupt, so the
+	time at which they are unblocked is recorded. */
+	#define queueWAKING_FROM_ISR( xWaking ) vTaskSetWakingFromISR( xWaking )
+
+	/* Bits in the ucLockedFromISR structure member. */
+	#define queueTX_LOCKED_FROM_ISR		( ( uint8_t ) 0x01U )
+	#define queueRX_LOCKED_FROM_ISR		( ( uint8_t ) 0x02U )
+
+	/* Called each time a lock count is added to.  Tasks add to the Tx lock
+	count too, when they send to a member of a queue set that is locked, so
+	the count alone does not say whether the tasks unblocked when the queue is
+	unlocked are unblocked on behalf of an interrupt. */
+	#define queueRECORD_LOCK_FROM_ISR( pxQueue, ucLock )		\
+		if( xTaskGetWakingFromISR() != pdFALSE )				\
+		{														\
+			( pxQueue )->ucLockedFromISR |= ( ucLock );			\
+		}
+
+	/* Brackets the code that unblocks the tasks counted by a lock count, if
+	an interrupt added to the count. */
+	#define queueUNLOCKING_FROM_ISR( pxQueue, ucLock )							\
+		vTaskSetWakingFromISR( ( ( ( pxQueue )->ucLockedFromISR & ( ucLock ) ) != 0U ) ? pdTRUE : pdFALSE )
+	#define queueUNLOCKED_FROM_ISR( pxQueue, ucLock )		\
+		vTaskSetWakingFromISR( pdFALSE );					\
+		( pxQueue )->ucLockedFromISR &= ( uint8_t ) ~( ucLock )
+#else
+	#define queueWAKING_FROM_ISR( xWaking )
+	#define queueRECORD_LOCK_FROM_ISR( pxQueue, ucLock )
+	#define queueUNLOCKING_FROM_ISR( pxQueue, ucLock )
+	#define queueUNLOCKED_FROM_ISR( pxQueue, ucLock )
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -232,6 +343,55 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_QUEUE_BATCHES == 1 )
+	/*
+	 * Copies uxCount items to the back of a queue, or out of the front of a
+	 * queue.  The items can wrap around the end of the queue storage area, so
+	 * the copy is made with at most two calls to memcpy().
+	 */
+	static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const void *pvItems, const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+	static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, void * const pvBuffer, const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Removes up to uxCount tasks from an event list - one for each item sent
+	 * or received in a batch - in a single pass.
+	 *
+	 * @return pdTRUE if a task that has a priority above the calling task was
+	 * unblocked, otherwise pdFALSE.
+	 */
+	static BaseType_t prvUnblockWaitingTasks( List_t * const pxEventList, UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+#endif
+
+#if( configUSE_QUEUE_HAND_OFF == 1 )
+	/*
+	 * Items can only be handed directly between tasks if the queue holds data
+	 * (so is not a semaphore or mutex), is not a member of a queue set (which
+	 * must see every item pass through the queue) and does not have a slot on
+	 * loan (the loaned item must be received first).
+	 */
+	static BaseType_t prvCanHandOff( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * If the queue is empty and the task that would be unblocked next from the
+	 * list of tasks waiting to receive is blocked in xQueueGenericReceive(),
+	 * copy the item straight into that task's buffer and unblock it, completing
+	 * its receive without the item passing through the queue storage area.
+	 *
+	 * @return pdTRUE if the item was handed off, otherwise pdFALSE.
+	 */
+	static BaseType_t prvHandOffToReceiver( Queue_t * const pxQueue, const void * const pvItemToQueue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Unblocks the next task waiting to send, after an item has been removed
+	 * from the queue.  If that task is blocked in xQueueGenericSend() its item
+	 * is first placed in the space just freed, completing its send, so it does
+	 * not have to compete to send again when it runs.
+	 *
+	 * @return As xTaskRemoveFromEventList().
+	 */
+	static BaseType_t prvUnblockWaitingSender( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -255,6 +415,31 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	static void prvInitialiseMutex( Queue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+#if( configUSE_MUTEXES == 1 )
+	/*
+	 * Called from within a critical section before the calling task blocks on
+	 * pxMutex.  The holder of pxMutex inherits the priority of the calling task
+	 * and, if that holder is itself blocked on a mutex, so does the holder of
+	 * that mutex, and so on along a chain of up to
+	 * configPRIORITY_INHERITANCE_DEPTH holders.  Returns the value
+	 * xTaskPriorityInherit() returned for the holder of pxMutex.
+	 */
+	static BaseType_t prvInheritPriorityAlongChain( Queue_t *pxMutex ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called from within a critical section after the calling task timed out
+	 * waiting for pxMutex.  Lowers the priorities inherited from the calling
+	 * task along the same chain of holders.
+	 */
+	static void prvDisinheritPriorityAfterTimeout( Queue_t *pxMutex ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns the priority of the highest priority task waiting for pxMutex, or
+	 * tskIDLE_PRIORITY if no tasks are waiting.
+	 */
+	static UBaseType_t prvGetHighestWaitingPriority( const Queue_t * const pxMutex ) PRIVILEGED_FUNCTION;
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -291,6 +476,22 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		pxQueue->cRxLock = queueUNLOCKED;
 		pxQueue->cTxLock = queueUNLOCKED;
 
+		#if( configUSE_WAKE_LATENCY_STATS == 1 )
+		{
+			pxQueue->ucLockedFromISR = 0U;
+		}
+		#endif
+
+		#if( configUSE_QUEUE_LOANS == 1 )
+		{
+			/* A slot that is still on loan or borrowed would be handed out
+			again once the queue had been reset. */
+			configASSERT( ( xNewQueue != pdFALSE ) || ( ( pxQueue->pcLoanedSlot == NULL ) && ( pxQueue->pcBorrowedSlot == NULL ) ) );
+			pxQueue->pcLoanedSlot = NULL;
+			pxQueue->pcBorrowedSlot = NULL;
+		}
+		#endif
+
 		if( xNewQueue == pdFALSE )
 		{
 			/* If there are tasks blocked waiting to read from the queue, then
@@ -487,6 +688,15 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 			/* In case this is a recursive mutex. */
 			pxNewQueue->u.uxRecursiveCallCount = 0;
 
+			#if( configUSE_CEILING_MUTEXES == 1 )
+			{
+				/* Priority inheritance is used unless a ceiling is set after
+				the mutex has been initialised. */
+				pxNewQueue->uxCeilingPriority = tskIDLE_PRIORITY;
+				pxNewQueue->uxPriorityBeforeCeiling = tskIDLE_PRIORITY;
+			}
+			#endif /* configUSE_CEILING_MUTEXES */
+
 			traceCREATE_MUTEX( pxNewQueue );
 
 			/* Start with the semaphore in the expected state. */
@@ -501,6 +711,84 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if( configUSE_MUTEXES == 1 )
+
+	static BaseType_t prvInheritPriorityAlongChain( Queue_t *pxMutex )
+	{
+	void *pvHolder;
+	Queue_t *pxNextMutex;
+	UBaseType_t uxDepth;
+	BaseType_t xReturn;
+
+		pvHolder = ( void * ) pxMutex->pxMutexHolder;
+		xReturn = xTaskPriorityInherit( pvHolder );
+
+		/* Follow the chain while each holder is itself blocked on a mutex.  The
+		depth limit bounds the time spent in the critical section, and stops a
+		cycle of deadlocked mutexes being followed forever. */
+		for( uxDepth = ( UBaseType_t ) 1U; ( pvHolder != NULL ) && ( uxDepth < ( UBaseType_t ) configPRIORITY_INHERITANCE_DEPTH ); uxDepth++ )
+		{
+			pxNextMutex = ( Queue_t * ) pvTaskGetBlockingMutex( pvHolder );
+
+			if( pxNextMutex != NULL )
+			{
+				pvHolder = ( void * ) pxNextMutex->pxMutexHolder;
+				( void ) xTaskPriorityInherit( pvHolder );
+			}
+			else
+			{
+				pvHolder = NULL;
+			}
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvDisinheritPriorityAfterTimeout( Queue_t *pxMutex )
+	{
+	void *pvHolder;
+	UBaseType_t uxDepth;
+
+		for( uxDepth = ( UBaseType_t ) 0U; ( pxMutex != NULL ) && ( uxDepth < ( UBaseType_t ) configPRIORITY_INHERITANCE_DEPTH ); uxDepth++ )
+		{
+			pvHolder = ( void * ) pxMutex->pxMutexHolder;
+
+			/* If the holder keeps its priority then so does every holder
+			further along the chain, as they inherited it from this one. */
+			if( xTaskPriorityDisinheritAfterTimeout( pvHolder, prvGetHighestWaitingPriority( pxMutex ) ) != pdFALSE )
+			{
+				pxMutex = ( Queue_t * ) pvTaskGetBlockingMutex( pvHolder );
+			}
+			else
+			{
+				pxMutex = NULL;
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static UBaseType_t prvGetHighestWaitingPriority( const Queue_t * const pxMutex )
+	{
+	UBaseType_t uxHighestPriorityOfWaitingTasks;
+
+		/* The tasks waiting for a mutex are held in priority order, so the
+		first one has the highest priority. */
+		if( listCURRENT_LIST_LENGTH( &( pxMutex->xTasksWaitingToReceive ) ) > ( UBaseType_t ) 0U )
+		{
+			uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxMutex->xTasksWaitingToReceive ) );
+		}
+		else
+		{
+			uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+		}
+
+		return uxHighestPriorityOfWaitingTasks;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType )
@@ -537,6 +825,58 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCeilingMutex( const UBaseType_t uxCeilingPriority )
+	{
+	Queue_t *pxNewQueue;
+
+		configASSERT( uxCeilingPriority > tskIDLE_PRIORITY );
+		configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		pxNewQueue = ( Queue_t * ) xQueueCreateMutex( queueQUEUE_TYPE_CEILING_MUTEX );
+
+		if( pxNewQueue != NULL )
+		{
+			pxNewQueue->uxCeilingPriority = uxCeilingPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxNewQueue;
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCeilingMutexStatic( const UBaseType_t uxCeilingPriority, StaticQueue_t *pxStaticQueue )
+	{
+	Queue_t *pxNewQueue;
+
+		configASSERT( uxCeilingPriority > tskIDLE_PRIORITY );
+		configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		pxNewQueue = ( Queue_t * ) xQueueCreateMutexStatic( queueQUEUE_TYPE_CEILING_MUTEX, pxStaticQueue );
+
+		if( pxNewQueue != NULL )
+		{
+			pxNewQueue->uxCeilingPriority = uxCeilingPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxNewQueue;
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
 
 	void* xQueueGetMutexHolder( QueueHandle_t xSemaphore )
@@ -567,6 +907,76 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 #endif
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_CONDITION_VARIABLES == 1 )
+
+	BaseType_t xQueueMoveWaitingTaskToMutex( QueueHandle_t xMutex, const List_t * const pxEventList )
+	{
+	Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+	BaseType_t xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  A task only
+		manipulates the event lists of a locked queue with the scheduler
+		suspended, so the list of tasks waiting for the mutex is not being
+		accessed by another task. */
+		configASSERT( pxMutex );
+		configASSERT( pxMutex->uxQueueType == queueQUEUE_IS_MUTEX );
+
+		if( pxMutex->pxMutexHolder != NULL )
+		{
+			if( queueUSES_PRIORITY_INHERITANCE( pxMutex ) )
+			{
+				vTaskMoveToMutexEventList( pxEventList, &( pxMutex->xTasksWaitingToReceive ), ( TaskHandle_t ) pxMutex->pxMutexHolder );
+			}
+			else
+			{
+				vTaskMoveToMutexEventList( pxEventList, &( pxMutex->xTasksWaitingToReceive ), NULL );
+			}
+
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_CONDITION_VARIABLES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+	BaseType_t xQueueAddMultipleObjectWait( QueueHandle_t xQueue, ListItem_t * const pxWaitListItem )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	BaseType_t xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION, so the queue
+		cannot be locked by another task.  The record is held in priority order
+		with the tasks waiting to receive, and xTaskRemoveFromEventList()
+		recognises it when it reaches the head of the list, so nothing on the
+		send path changes.  Mutexes cannot be waited for in this way as a task
+		waiting for a mutex must be seen by the priority inheritance code. */
+		configASSERT( pxQueue );
+		configASSERT( pxQueue->uxQueueType != queueQUEUE_IS_MUTEX );
+
+		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			vListInsert( &( pxQueue->xTasksWaitingToReceive ), pxWaitListItem );
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_RECURSIVE_MUTEXES == 1 )
 
 	BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex )
@@ -725,6 +1135,9 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQ
 BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
 TimeOut_t xTimeOut;
 Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+#if( configUSE_QUEUE_HAND_OFF == 1 )
+	QueueHandOff_t xHandOff;
+#endif
 
 	configASSERT( pxQueue );
 	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
@@ -735,6 +1148,13 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	}
 	#endif
 
+	#if( configUSE_QUEUE_HAND_OFF == 1 )
+	{
+		xHandOff.pvBuffer = ( void * ) pvItemToQueue; /*lint !e9005 The item is only read. */
+		xHandOff.xCopyPosition = xCopyPosition;
+		xHandOff.xComplete = pdFALSE;
+	}
+	#endif
 
 	/* This function relaxes the coding standard somewhat to allow return
 	statements within the function itself.  This is done in the interest
@@ -743,11 +1163,43 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	{
 		taskENTER_CRITICAL();
 		{
+			#if( configUSE_QUEUE_HAND_OFF == 1 )
+			{
+				/* Was the item placed in the queue by a receiver while this
+				task was blocked? */
+				if( xHandOff.xComplete != pdFALSE )
+				{
+					traceQUEUE_SEND( pxQueue );
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+
+				/* Can the item go straight to a task that is waiting for it? */
+				xYieldRequired = pdFALSE;
+				if( prvHandOffToReceiver( pxQueue, pvItemToQueue, &xYieldRequired ) != pdFALSE )
+				{
+					traceQUEUE_SEND( pxQueue );
+
+					if( xYieldRequired != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+			}
+			#endif /* configUSE_QUEUE_HAND_OFF */
+
 			/* Is there room on the queue now?  The running task must be the
 			highest priority task wanting to access the queue.  If the head item
 			in the queue is to be overwritten then it does not matter if the
 			queue is full. */
-			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+			if( queueCAN_SEND( pxQueue, xCopyPosition ) )
 			{
 				traceQUEUE_SEND( pxQueue );
 				xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
@@ -879,7 +1331,16 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			if( prvIsQueueFull( pxQueue ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+
+				#if( configUSE_QUEUE_HAND_OFF == 1 )
+				{
+					vTaskPlaceOnEventListWithHandOff( &( pxQueue->xTasksWaitingToSend ), &xHandOff, xTicksToWait );
+				}
+				#else
+				{
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				}
+				#endif
 
 				/* Unlocking the queue means queue events can effect the
 				event list.  It is possible	that interrupts occurring now
@@ -950,8 +1411,26 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	not (i.e. has a task with a higher priority than us been woken by this
 	post). */
 	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	queueWAKING_FROM_ISR( pdTRUE );
 	{
-		if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+		#if( configUSE_QUEUE_HAND_OFF == 1 )
+		{
+			/* The event lists cannot be accessed while the queue is locked, so
+			the item can only go straight to a waiting task if it is not. */
+			if( pxQueue->cTxLock == queueUNLOCKED )
+			{
+				if( prvHandOffToReceiver( pxQueue, pvItemToQueue, pxHigherPriorityTaskWoken ) != pdFALSE )
+				{
+					traceQUEUE_SEND_FROM_ISR( pxQueue );
+					queueWAKING_FROM_ISR( pdFALSE );
+					portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+					return pdPASS;
+				}
+			}
+		}
+		#endif /* configUSE_QUEUE_HAND_OFF */
+
+		if( queueCAN_SEND( pxQueue, xCopyPosition ) )
 		{
 			const int8_t cTxLock = pxQueue->cTxLock;
 
@@ -1053,6 +1532,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				/* Increment the lock count so the task that unlocks the queue
 				knows that data was posted while it was locked. */
 				pxQueue->cTxLock = ( int8_t ) ( cTxLock + 1 );
+				queueRECORD_LOCK_FROM_ISR( pxQueue, queueTX_LOCKED_FROM_ISR );
 			}
 
 			xReturn = pdPASS;
@@ -1063,6 +1543,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			xReturn = errQUEUE_FULL;
 		}
 	}
+	queueWAKING_FROM_ISR( pdFALSE );
 	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
 	return xReturn;
@@ -1109,6 +1590,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
 	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	queueWAKING_FROM_ISR( pdTRUE );
 	{
 		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
@@ -1218,6 +1700,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				/* Increment the lock count so the task that unlocks the queue
 				knows that data was posted while it was locked. */
 				pxQueue->cTxLock = ( int8_t ) ( cTxLock + 1 );
+				queueRECORD_LOCK_FROM_ISR( pxQueue, queueTX_LOCKED_FROM_ISR );
 			}
 
 			xReturn = pdPASS;
@@ -1228,6 +1711,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			xReturn = errQUEUE_FULL;
 		}
 	}
+	queueWAKING_FROM_ISR( pdFALSE );
 	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
 	return xReturn;
@@ -1240,6 +1724,12 @@ BaseType_t xEntryTimeSet = pdFALSE;
 TimeOut_t xTimeOut;
 int8_t *pcOriginalReadPosition;
 Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+#if( configUSE_QUEUE_HAND_OFF == 1 )
+	QueueHandOff_t xHandOff;
+#endif
+#if( configUSE_MUTEXES == 1 )
+	BaseType_t xInheritanceOccurred = pdFALSE;
+#endif
 
 	configASSERT( pxQueue );
 	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
@@ -1249,6 +1739,14 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	}
 	#endif
 
+	#if( configUSE_QUEUE_HAND_OFF == 1 )
+	{
+		xHandOff.pvBuffer = pvBuffer;
+		xHandOff.xCopyPosition = queueSEND_TO_BACK;
+		xHandOff.xComplete = pdFALSE;
+	}
+	#endif
+
 	/* This function relaxes the coding standard somewhat to allow return
 	statements within the function itself.  This is done in the interest
 	of execution time efficiency. */
@@ -1259,9 +1757,22 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		{
 			const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
+			#if( configUSE_QUEUE_HAND_OFF == 1 )
+			{
+				/* Was an item copied straight into pvBuffer by a sender while
+				this task was blocked? */
+				if( xHandOff.xComplete != pdFALSE )
+				{
+					traceQUEUE_RECEIVE( pxQueue );
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+			}
+			#endif /* configUSE_QUEUE_HAND_OFF */
+
 			/* Is there data in the queue now?  To be running the calling task
 			must be the highest priority task wanting to access the queue. */
-			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			if( ( uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( queueRECEIVE_HELD_OFF( pxQueue, xJustPeeking ) == pdFALSE ) )
 			{
 				/* Remember the read position in case the queue is only being
 				peeked. */
@@ -1283,6 +1794,21 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 							/* Record the information required to implement
 							priority inheritance should it become necessary. */
 							pxQueue->pxMutexHolder = ( int8_t * ) pvTaskIncrementMutexHeldCount(); /*lint !e961 Cast is not redundant as TaskHandle_t is a typedef. */
+
+							#if ( configUSE_CEILING_MUTEXES == 1 )
+							{
+								/* The holder of a priority ceiling mutex runs
+								at the ceiling for as long as it holds it. */
+								if( pxQueue->uxCeilingPriority != tskIDLE_PRIORITY )
+								{
+									pxQueue->uxPriorityBeforeCeiling = uxTaskPriorityRaiseToCeiling( pxQueue->uxCeilingPriority );
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+							#endif /* configUSE_CEILING_MUTEXES */
 						}
 						else
 						{
@@ -1293,7 +1819,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+						if( queueUNBLOCK_SENDER( pxQueue ) != pdFALSE )
 						{
 							queueYIELD_IF_USING_PREEMPTION();
 						}
@@ -1373,17 +1899,26 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		/* Update the timeout state to see if it has expired yet. */
 		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
 		{
-			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			if( ( prvIsQueueEmpty( pxQueue ) != pdFALSE ) || ( queueRECEIVE_HELD_OFF( pxQueue, xJustPeeking ) != pdFALSE ) )
 			{
 				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
 
 				#if ( configUSE_MUTEXES == 1 )
 				{
-					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+					if( queueUSES_PRIORITY_INHERITANCE( pxQueue ) )
 					{
 						taskENTER_CRITICAL();
 						{
-							vTaskPriorityInherit( ( void * ) pxQueue->pxMutexHolder );
+							vTaskSetBlockingMutex( ( void * ) pxQueue );
+
+							if( prvInheritPriorityAlongChain( pxQueue ) != pdFALSE )
+							{
+								xInheritanceOccurred = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
 						}
 						taskEXIT_CRITICAL();
 					}
@@ -1394,8 +1929,19 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				}
 				#endif
 
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
-				prvUnlockQueue( pxQueue );
+				#if( configUSE_QUEUE_HAND_OFF == 1 )
+				{
+					/* A peek must leave the item in the queue, so only a
+					receive can be completed by the sender. */
+					vTaskPlaceOnEventListWithHandOff( &( pxQueue->xTasksWaitingToReceive ), ( xJustPeeking == pdFALSE ) ? &xHandOff : NULL, xTicksToWait );
+				}
+				#else
+				{
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				}
+				#endif
+
+				prvUnlockQueue( pxQueue );
 				if( xTaskResumeAll() == pdFALSE )
 				{
 					portYIELD_WITHIN_API();
@@ -1404,6 +1950,21 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					/* The task is running again, so is no longer waiting for
+					the mutex. */
+					if( queueUSES_PRIORITY_INHERITANCE( pxQueue ) )
+					{
+						vTaskSetBlockingMutex( NULL );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
 			}
 			else
 			{
@@ -1419,6 +1980,25 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					/* The task gave up waiting for the mutex, so the holder
+					must not keep the priority it inherited from this task. */
+					if( xInheritanceOccurred != pdFALSE )
+					{
+						taskENTER_CRITICAL();
+						{
+							prvDisinheritPriorityAfterTimeout( pxQueue );
+						}
+						taskEXIT_CRITICAL();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
 				traceQUEUE_RECEIVE_FAILED( pxQueue );
 				return errQUEUE_EMPTY;
 			}
@@ -1457,11 +2037,12 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
 	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	queueWAKING_FROM_ISR( pdTRUE );
 	{
 		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
 		/* Cannot block in an ISR, so check there is data available. */
-		if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+		if( ( uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( queueRECEIVE_HELD_OFF( pxQueue, pdFALSE ) == pdFALSE ) )
 		{
 			const int8_t cRxLock = pxQueue->cRxLock;
 
@@ -1478,7 +2059,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			{
 				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					if( queueUNBLOCK_SENDER( pxQueue ) != pdFALSE )
 					{
 						/* The task waiting has a higher priority than us so
 						force a context switch. */
@@ -1498,82 +2079,1042 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Increment the lock count so the task that unlocks the queue
+				knows that data was removed while it was locked. */
+				pxQueue->cRxLock = ( int8_t ) ( cRxLock + 1 );
+				queueRECORD_LOCK_FROM_ISR( pxQueue, queueRX_LOCKED_FROM_ISR );
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	queueWAKING_FROM_ISR( pdFALSE );
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+int8_t *pcOriginalReadPosition;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Cannot block in an ISR, so check there is data available. */
+		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+		{
+			traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+			/* Remember the read position so it can be reset as nothing is
+			actually being removed from the queue. */
+			pcOriginalReadPosition = pxQueue->u.pcReadFrom;
+			prvCopyDataFromQueue( pxQueue, pvBuffer );
+			pxQueue->u.pcReadFrom = pcOriginalReadPosition;
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_LOANS == 1 )
+
+	BaseType_t xQueueLoanSlot( QueueHandle_t xQueue, void ** const ppvSlot, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( ppvSlot );
+
+		/* Semaphores and mutexes have no storage area to loan out. */
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		/* This function follows the same structure as xQueueGenericSend(), so
+		a task waiting for a slot to loan blocks, times out and is prioritised
+		in exactly the same way as a task waiting to send. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				/* Is there a free slot at the back of the queue, and no other
+				slot already on loan? */
+				if( queueCAN_SEND( pxQueue, queueSEND_TO_BACK ) )
+				{
+					traceQUEUE_LOAN( pxQueue );
+
+					/* The slot is not added to the queue until it is committed,
+					so the write position is left where it is - nothing else can
+					be written to the queue until then. */
+					pxQueue->pcLoanedSlot = pxQueue->pcWriteTo;
+					*ppvSlot = ( void * ) pxQueue->pcLoanedSlot;
+
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+				else
+				{
+					if( xTicksToWait == ( TickType_t ) 0 )
+					{
+						/* The queue was full and no block time is specified (or
+						the block time has expired) so leave now. */
+						taskEXIT_CRITICAL();
+						traceQUEUE_LOAN_FAILED( pxQueue );
+						return errQUEUE_FULL;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						/* The queue was full and a block time was specified so
+						configure the timeout structure. */
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						/* Entry time was already set. */
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			/* Interrupts and other tasks can send to and receive from the queue
+			now the critical section has been exited. */
+
+			vTaskSuspendAll();
+			prvLockQueue( pxQueue );
+
+			/* Update the timeout state to see if it has expired yet. */
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( prvIsQueueFull( pxQueue ) != pdFALSE )
+				{
+					traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+					prvUnlockQueue( pxQueue );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxQueue );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				/* The timeout has expired. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+
+				traceQUEUE_LOAN_FAILED( pxQueue );
+				return errQUEUE_FULL;
+			}
+		}
+	}
+
+#endif /* configUSE_QUEUE_LOANS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_LOANS == 1 )
+
+	BaseType_t xQueueCommitSlot( QueueHandle_t xQueue, void * const pvSlot )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+
+		/* Only the slot that is on loan can be committed. */
+		configASSERT( ( pvSlot != NULL ) && ( pvSlot == ( void * ) pxQueue->pcLoanedSlot ) );
+		( void ) pvSlot; /* Remove compiler warnings if configASSERT() is not defined. */
+
+		taskENTER_CRITICAL();
+		{
+			traceQUEUE_COMMIT( pxQueue );
+
+			/* The item is already in place, so adding it to the queue only
+			requires the write position to be moved on, as prvCopyDataToQueue()
+			would after copying an item to the back of the queue. */
+			pxQueue->pcLoanedSlot = NULL;
+			pxQueue->pcWriteTo += pxQueue->uxItemSize;
+			if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+			{
+				pxQueue->pcWriteTo = pxQueue->pcHead;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			++( pxQueue->uxMessagesWaiting );
+
+			#if ( configUSE_QUEUE_SETS == 1 )
+			{
+				if( pxQueue->pxQueueSetContainer != NULL )
+				{
+					if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+					{
+						/* The queue is a member of a queue set, and posting to
+						the queue set caused a higher priority task to unblock.
+						A context switch is required. */
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					/* If there was a task waiting for data to arrive on the
+					queue then unblock it now. */
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#else /* configUSE_QUEUE_SETS */
+			{
+				/* If there was a task waiting for data to arrive on the queue
+				then unblock it now. */
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_QUEUE_SETS */
+
+			/* Other senders were held off while the slot was on loan, so if
+			there is still space one of them can now proceed. */
+			if( ( pxQueue->uxMessagesWaiting + queueSLOTS_HELD( pxQueue ) ) < pxQueue->uxLength )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return pdPASS;
+	}
+
+#endif /* configUSE_QUEUE_LOANS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_LOANS == 1 )
+
+	BaseType_t xQueueBorrowSlot( QueueHandle_t xQueue, void ** const ppvSlot, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( ppvSlot );
+
+		/* Semaphores and mutexes have no storage area to borrow from. */
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		/* This function follows the same structure as xQueueGenericReceive(),
+		so a task waiting for an item to borrow blocks, times out and is
+		prioritised in exactly the same way as a task waiting to receive. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				/* Is there data in the queue, and no other slot already
+				borrowed? */
+				if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( pxQueue->pcBorrowedSlot == NULL ) )
+				{
+					traceQUEUE_BORROW( pxQueue );
+
+					/* Move the read position on to the item at the head of the
+					queue, as prvCopyDataFromQueue() would, but hand the slot
+					out rather than copying from it.  The item is removed from
+					the queue, but the slot does not become free until it is
+					released, so unlike a receive no sender is unblocked. */
+					pxQueue->u.pcReadFrom += pxQueue->uxItemSize;
+					if( pxQueue->u.pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+					{
+						pxQueue->u.pcReadFrom = pxQueue->pcHead;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					pxQueue->pcBorrowedSlot = pxQueue->u.pcReadFrom;
+					--( pxQueue->uxMessagesWaiting );
+					*ppvSlot = ( void * ) pxQueue->pcBorrowedSlot;
+
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+				else
+				{
+					if( xTicksToWait == ( TickType_t ) 0 )
+					{
+						/* The queue was empty and no block time is specified (or
+						the block time has expired) so leave now. */
+						taskEXIT_CRITICAL();
+						traceQUEUE_BORROW_FAILED( pxQueue );
+						return errQUEUE_EMPTY;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						/* The queue was empty and a block time was specified so
+						configure the timeout structure. */
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						/* Entry time was already set. */
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			/* Interrupts and other tasks can send to and receive from the queue
+			now the critical section has been exited. */
+
+			vTaskSuspendAll();
+			prvLockQueue( pxQueue );
+
+			/* Update the timeout state to see if it has expired yet. */
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				/* pcBorrowedSlot is only changed by tasks, so cannot change
+				while the scheduler is suspended. */
+				if( ( prvIsQueueEmpty( pxQueue ) != pdFALSE ) || ( pxQueue->pcBorrowedSlot != NULL ) )
+				{
+					traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+					prvUnlockQueue( pxQueue );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxQueue );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				/* The timeout has expired. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+
+				traceQUEUE_BORROW_FAILED( pxQueue );
+				return errQUEUE_EMPTY;
+			}
+		}
+	}
+
+#endif /* configUSE_QUEUE_LOANS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_LOANS == 1 )
+
+	BaseType_t xQueueReleaseSlot( QueueHandle_t xQueue, void * const pvSlot )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+
+		/* Only the slot that is borrowed can be released. */
+		configASSERT( ( pvSlot != NULL ) && ( pvSlot == ( void * ) pxQueue->pcBorrowedSlot ) );
+		( void ) pvSlot; /* Remove compiler warnings if configASSERT() is not defined. */
+
+		taskENTER_CRITICAL();
+		{
+			traceQUEUE_RELEASE( pxQueue );
+
+			pxQueue->pcBorrowedSlot = NULL;
+
+			/* The slot is free again, so if there was a task waiting to post
+			to the queue it can now do so. */
+			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+			{
+				if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+				{
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Another task may have been waiting to borrow an item that was
+			already in the queue. */
+			if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return pdPASS;
+	}
+
+#endif /* configUSE_QUEUE_LOANS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_BATCHES == 1 )
+
+	size_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, size_t xItemCount, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
+	TimeOut_t xTimeOut;
+	UBaseType_t uxCount;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pvItems );
+		configASSERT( xItemCount > ( size_t ) 0 );
+
+		/* Semaphores and mutexes do not hold items to send in a batch. */
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		/* This function follows the same structure as xQueueGenericSend(), so
+		a task waiting to send a batch blocks, times out and is prioritised in
+		exactly the same way as a task waiting to send a single item. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				/* Is there room for at least one item on the queue now? */
+				uxCount = queueSPACES_FOR_SEND( pxQueue );
+
+				if( uxCount > ( UBaseType_t ) 0 )
+				{
+					if( ( size_t ) uxCount > xItemCount )
+					{
+						uxCount = ( UBaseType_t ) xItemCount;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					traceQUEUE_SEND_MULTIPLE( pxQueue, uxCount );
+					prvCopyMultipleToQueue( pxQueue, pvItems, uxCount );
+					xYieldRequired = pdFALSE;
+
+					#if ( configUSE_QUEUE_SETS == 1 )
+					{
+						if( pxQueue->pxQueueSetContainer != NULL )
+						{
+						UBaseType_t uxItem;
+
+							/* The queue set holds one entry for each item in
+							its member queues. */
+							for( uxItem = ( UBaseType_t ) 0; uxItem < uxCount; uxItem++ )
+							{
+								if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+								{
+									xYieldRequired = pdTRUE;
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+						}
+						else
+						{
+							xYieldRequired = prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxCount );
+						}
+					}
+					#else /* configUSE_QUEUE_SETS */
+					{
+						xYieldRequired = prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxCount );
+					}
+					#endif /* configUSE_QUEUE_SETS */
+
+					/* However many tasks were unblocked, yield at most once
+					for the whole batch. */
+					if( xYieldRequired != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					taskEXIT_CRITICAL();
+					return ( size_t ) uxCount;
+				}
+				else
+				{
+					if( xTicksToWait == ( TickType_t ) 0 )
+					{
+						/* The queue was full and no block time is specified (or
+						the block time has expired) so leave now. */
+						taskEXIT_CRITICAL();
+						traceQUEUE_SEND_MULTIPLE_FAILED( pxQueue );
+						return ( size_t ) 0;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						/* The queue was full and a block time was specified so
+						configure the timeout structure. */
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						/* Entry time was already set. */
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			/* Interrupts and other tasks can send to and receive from the queue
+			now the critical section has been exited. */
+
+			vTaskSuspendAll();
+			prvLockQueue( pxQueue );
+
+			/* Update the timeout state to see if it has expired yet. */
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( prvIsQueueFull( pxQueue ) != pdFALSE )
+				{
+					traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+					prvUnlockQueue( pxQueue );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxQueue );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				/* The timeout has expired. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+
+				traceQUEUE_SEND_MULTIPLE_FAILED( pxQueue );
+				return ( size_t ) 0;
+			}
+		}
+	}
+
+#endif /* configUSE_QUEUE_BATCHES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_BATCHES == 1 )
+
+	size_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItems, size_t xItemCount, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	size_t xReturn;
+	UBaseType_t uxSavedInterruptStatus, uxCount;
+	BaseType_t xYieldRequired = pdFALSE;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pvItems );
+		configASSERT( xItemCount > ( size_t ) 0 );
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+		/* RTOS ports that support interrupt nesting have the concept of a maximum
+		system call (or maximum API call) interrupt priority.  Interrupts that are
+		above the maximum system call priority are kept permanently enabled, even
+		when the RTOS kernel is in a critical section, but cannot make any calls to
+		FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+		then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+		failure if a FreeRTOS API function is called from an interrupt that has been
+		assigned a priority above the configured maximum system call priority.
+		Only FreeRTOS functions that end in FromISR can be called from interrupts
+		that have been assigned a priority at or (logically) below the maximum
+		system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+		safe API to ensure interrupt entry is as fast and as simple as possible.
+		More information (albeit Cortex-M specific) is provided on the following
+		link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		queueWAKING_FROM_ISR( pdTRUE );
+		{
+			uxCount = queueSPACES_FOR_SEND( pxQueue );
+
+			if( uxCount > ( UBaseType_t ) 0 )
+			{
+				const int8_t cTxLock = pxQueue->cTxLock;
+
+				if( ( size_t ) uxCount > xItemCount )
+				{
+					uxCount = ( UBaseType_t ) xItemCount;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceQUEUE_SEND_MULTIPLE_FROM_ISR( pxQueue, uxCount );
+				prvCopyMultipleToQueue( pxQueue, pvItems, uxCount );
+
+				/* The event list is not altered if the queue is locked.  This
+				will be done when the queue is unlocked later. */
+				if( cTxLock == queueUNLOCKED )
+				{
+					#if ( configUSE_QUEUE_SETS == 1 )
+					{
+						if( pxQueue->pxQueueSetContainer != NULL )
+						{
+						UBaseType_t uxItem;
+
+							for( uxItem = ( UBaseType_t ) 0; uxItem < uxCount; uxItem++ )
+							{
+								if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+								{
+									xYieldRequired = pdTRUE;
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+						}
+						else
+						{
+							xYieldRequired = prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxCount );
+						}
+					}
+					#else /* configUSE_QUEUE_SETS */
+					{
+						xYieldRequired = prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxCount );
+					}
+					#endif /* configUSE_QUEUE_SETS */
+
+					if( ( xYieldRequired != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Add the whole batch to the lock count so the task that
+					unlocks the queue unblocks as many tasks as it would have
+					done had the items been sent one at a time.  The count
+					saturates rather than overflows. */
+					if( uxCount > ( UBaseType_t ) ( queueLOCK_COUNT_MAX - cTxLock ) )
+					{
+						pxQueue->cTxLock = queueLOCK_COUNT_MAX;
+					}
+					else
+					{
+						pxQueue->cTxLock = ( int8_t ) ( cTxLock + ( int8_t ) uxCount );
+					}
+
+					queueRECORD_LOCK_FROM_ISR( pxQueue, queueTX_LOCKED_FROM_ISR );
+				}
+
+				xReturn = ( size_t ) uxCount;
+			}
+			else
+			{
+				traceQUEUE_SEND_MULTIPLE_FROM_ISR_FAILED( pxQueue );
+				xReturn = ( size_t ) 0;
+			}
+		}
+		queueWAKING_FROM_ISR( pdFALSE );
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_QUEUE_BATCHES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_BATCHES == 1 )
+
+	size_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, size_t xBufferItems, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	UBaseType_t uxCount;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pvBuffer );
+		configASSERT( xBufferItems > ( size_t ) 0 );
+
+		/* Semaphores and mutexes do not hold items to receive in a batch. */
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		/* This function follows the same structure as xQueueGenericReceive(),
+		so a task waiting to receive a batch blocks, times out and is
+		prioritised in exactly the same way as a task waiting to receive a
+		single item. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				uxCount = pxQueue->uxMessagesWaiting;
+
+				/* Is there data in the queue now? */
+				if( ( uxCount > ( UBaseType_t ) 0 ) && ( queueRECEIVE_HELD_OFF( pxQueue, pdFALSE ) == pdFALSE ) )
+				{
+					if( ( size_t ) uxCount > xBufferItems )
+					{
+						uxCount = ( UBaseType_t ) xBufferItems;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					traceQUEUE_RECEIVE_MULTIPLE( pxQueue, uxCount );
+					prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxCount );
+
+					/* Unblock a sender for each slot that was freed, but
+					yield at most once for the whole batch. */
+					if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), uxCount ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					taskEXIT_CRITICAL();
+					return ( size_t ) uxCount;
+				}
+				else
+				{
+					if( xTicksToWait == ( TickType_t ) 0 )
+					{
+						/* The queue was empty and no block time is specified (or
+						the block time has expired) so leave now. */
+						taskEXIT_CRITICAL();
+						traceQUEUE_RECEIVE_MULTIPLE_FAILED( pxQueue );
+						return ( size_t ) 0;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						/* The queue was empty and a block time was specified so
+						configure the timeout structure. */
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						/* Entry time was already set. */
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			/* Interrupts and other tasks can send to and receive from the queue
+			now the critical section has been exited. */
+
+			vTaskSuspendAll();
+			prvLockQueue( pxQueue );
+
+			/* Update the timeout state to see if it has expired yet. */
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( ( prvIsQueueEmpty( pxQueue ) != pdFALSE ) || ( queueRECEIVE_HELD_OFF( pxQueue, pdFALSE ) != pdFALSE ) )
+				{
+					traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+					prvUnlockQueue( pxQueue );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxQueue );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+
+				if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+				{
+					traceQUEUE_RECEIVE_MULTIPLE_FAILED( pxQueue );
+					return ( size_t ) 0;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+	}
+
+#endif /* configUSE_QUEUE_BATCHES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_BATCHES == 1 )
+
+	size_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, size_t xBufferItems, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	size_t xReturn;
+	UBaseType_t uxSavedInterruptStatus, uxCount;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pvBuffer );
+		configASSERT( xBufferItems > ( size_t ) 0 );
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+		/* RTOS ports that support interrupt nesting have the concept of a maximum
+		system call (or maximum API call) interrupt priority.  Interrupts that are
+		above the maximum system call priority are kept permanently enabled, even
+		when the RTOS kernel is in a critical section, but cannot make any calls to
+		FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+		then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+		failure if a FreeRTOS API function is called from an interrupt that has been
+		assigned a priority above the configured maximum system call priority.
+		Only FreeRTOS functions that end in FromISR can be called from interrupts
+		that have been assigned a priority at or (logically) below the maximum
+		system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+		safe API to ensure interrupt entry is as fast and as simple as possible.
+		More information (albeit Cortex-M specific) is provided on the following
+		link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		queueWAKING_FROM_ISR( pdTRUE );
+		{
+			uxCount = pxQueue->uxMessagesWaiting;
+
+			/* Cannot block in an ISR, so check there is data available. */
+			if( ( uxCount > ( UBaseType_t ) 0 ) && ( queueRECEIVE_HELD_OFF( pxQueue, pdFALSE ) == pdFALSE ) )
+			{
+				const int8_t cRxLock = pxQueue->cRxLock;
+
+				if( ( size_t ) uxCount > xBufferItems )
+				{
+					uxCount = ( UBaseType_t ) xBufferItems;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceQUEUE_RECEIVE_MULTIPLE_FROM_ISR( pxQueue, uxCount );
+				prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxCount );
+
+				/* If the queue is locked the event list will not be modified.
+				Instead update the lock count so the task that unlocks the
+				queue will know that an ISR has removed data while the queue
+				was locked. */
+				if( cRxLock == queueUNLOCKED )
+				{
+					if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), uxCount ) != pdFALSE )
+					{
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* As for xQueueSendMultipleFromISR(), the count saturates
+					rather than overflows. */
+					if( uxCount > ( UBaseType_t ) ( queueLOCK_COUNT_MAX - cRxLock ) )
+					{
+						pxQueue->cRxLock = queueLOCK_COUNT_MAX;
+					}
+					else
+					{
+						pxQueue->cRxLock = ( int8_t ) ( cRxLock + ( int8_t ) uxCount );
+					}
+
+					queueRECORD_LOCK_FROM_ISR( pxQueue, queueRX_LOCKED_FROM_ISR );
 				}
+
+				xReturn = ( size_t ) uxCount;
 			}
 			else
 			{
-				/* Increment the lock count so the task that unlocks the queue
-				knows that data was removed while it was locked. */
-				pxQueue->cRxLock = ( int8_t ) ( cRxLock + 1 );
+				traceQUEUE_RECEIVE_MULTIPLE_FROM_ISR_FAILED( pxQueue );
+				xReturn = ( size_t ) 0;
 			}
-
-			xReturn = pdPASS;
-		}
-		else
-		{
-			xReturn = pdFAIL;
-			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
 		}
-	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
-
-BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
-{
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
-int8_t *pcOriginalReadPosition;
-Queue_t * const pxQueue = ( Queue_t * ) xQueue;
-
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-	configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
-
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
-
-	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
-	{
-		/* Cannot block in an ISR, so check there is data available. */
-		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
-		{
-			traceQUEUE_PEEK_FROM_ISR( pxQueue );
-
-			/* Remember the read position so it can be reset as nothing is
-			actually being removed from the queue. */
-			pcOriginalReadPosition = pxQueue->u.pcReadFrom;
-			prvCopyDataFromQueue( pxQueue, pvBuffer );
-			pxQueue->u.pcReadFrom = pcOriginalReadPosition;
+		queueWAKING_FROM_ISR( pdFALSE );
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-			xReturn = pdPASS;
-		}
-		else
-		{
-			xReturn = pdFAIL;
-			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
-		}
+		return xReturn;
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-	return xReturn;
-}
+#endif /* configUSE_QUEUE_BATCHES */
 /*-----------------------------------------------------------*/
 
 UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
@@ -1603,6 +3144,12 @@ Queue_t *pxQueue;
 	taskENTER_CRITICAL();
 	{
 		uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+		#if( configUSE_QUEUE_LOANS == 1 )
+		{
+			uxReturn -= queueSLOTS_HELD( pxQueue );
+		}
+		#endif
 	}
 	taskEXIT_CRITICAL();
 
@@ -1710,7 +3257,22 @@ UBaseType_t uxMessagesWaiting;
 			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
 			{
 				/* The mutex is no longer being held. */
-				xReturn = xTaskPriorityDisinherit( ( void * ) pxQueue->pxMutexHolder );
+				#if ( configUSE_CEILING_MUTEXES == 1 )
+				{
+					if( pxQueue->uxCeilingPriority != tskIDLE_PRIORITY )
+					{
+						xReturn = xTaskPriorityCeilingRelease( ( void * ) pxQueue->pxMutexHolder, pxQueue->uxCeilingPriority, pxQueue->uxPriorityBeforeCeiling );
+					}
+					else
+					{
+						xReturn = xTaskPriorityDisinherit( ( void * ) pxQueue->pxMutexHolder );
+					}
+				}
+				#else
+				{
+					xReturn = xTaskPriorityDisinherit( ( void * ) pxQueue->pxMutexHolder );
+				}
+				#endif /* configUSE_CEILING_MUTEXES */
 				pxQueue->pxMutexHolder = NULL;
 			}
 			else
@@ -1791,6 +3353,262 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_QUEUE_BATCHES == 1 )
+
+	static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const void *pvItems, const UBaseType_t uxCount )
+	{
+	const size_t xBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+	size_t xFirstBytes = ( size_t ) ( pxQueue->pcTail - pxQueue->pcWriteTo );
+
+		/* This function is called from a critical section, and the caller has
+		already checked there is space for uxCount items. */
+
+		if( xFirstBytes > xBytes )
+		{
+			xFirstBytes = xBytes;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItems, xFirstBytes ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+
+		if( xBytes > xFirstBytes )
+		{
+			/* The batch wraps around the end of the storage area. */
+			( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) ( ( const int8_t * ) pvItems + xFirstBytes ), xBytes - xFirstBytes ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			pxQueue->pcWriteTo = pxQueue->pcHead + ( xBytes - xFirstBytes );
+		}
+		else
+		{
+			pxQueue->pcWriteTo += xBytes;
+			if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+			{
+				pxQueue->pcWriteTo = pxQueue->pcHead;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		pxQueue->uxMessagesWaiting += uxCount;
+	}
+
+#endif /* configUSE_QUEUE_BATCHES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_BATCHES == 1 )
+
+	static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, void * const pvBuffer, const UBaseType_t uxCount )
+	{
+	const size_t xBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+	size_t xFirstBytes;
+	int8_t *pcReadFrom;
+
+		/* This function is called from a critical section, and the caller has
+		already checked there are uxCount items in the queue.  pcReadFrom points
+		to the last item read, so the first item to copy follows it. */
+		pcReadFrom = pxQueue->u.pcReadFrom + pxQueue->uxItemSize;
+		if( pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+		{
+			pcReadFrom = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xFirstBytes = ( size_t ) ( pxQueue->pcTail - pcReadFrom );
+		if( xFirstBytes > xBytes )
+		{
+			xFirstBytes = xBytes;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		( void ) memcpy( pvBuffer, ( void * ) pcReadFrom, xFirstBytes ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+
+		if( xBytes > xFirstBytes )
+		{
+			/* The batch wraps around the end of the storage area. */
+			( void ) memcpy( ( void * ) ( ( int8_t * ) pvBuffer + xFirstBytes ), ( void * ) pxQueue->pcHead, xBytes - xFirstBytes ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			pcReadFrom = pxQueue->pcHead + ( xBytes - xFirstBytes );
+		}
+		else
+		{
+			pcReadFrom += xBytes;
+		}
+
+		/* Leave pcReadFrom pointing at the last item read, as
+		prvCopyDataFromQueue() would. */
+		pxQueue->u.pcReadFrom = pcReadFrom - pxQueue->uxItemSize;
+		pxQueue->uxMessagesWaiting -= uxCount;
+	}
+
+#endif /* configUSE_QUEUE_BATCHES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_BATCHES == 1 )
+
+	static BaseType_t prvUnblockWaitingTasks( List_t * const pxEventList, UBaseType_t uxCount )
+	{
+	BaseType_t xReturn = pdFALSE;
+
+		/* This function is called from a critical section, with the queue
+		unlocked. */
+		while( ( uxCount > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+		{
+			if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+			{
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			--uxCount;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_QUEUE_BATCHES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_HAND_OFF == 1 )
+
+	static BaseType_t prvCanHandOff( const Queue_t * const pxQueue )
+	{
+	BaseType_t xReturn;
+
+		if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
+		{
+			xReturn = pdFALSE;
+		}
+		#if( configUSE_QUEUE_SETS == 1 )
+			else if( pxQueue->pxQueueSetContainer != NULL )
+			{
+				xReturn = pdFALSE;
+			}
+		#endif
+		#if( configUSE_QUEUE_LOANS == 1 )
+			else if( pxQueue->pcLoanedSlot != NULL )
+			{
+				xReturn = pdFALSE;
+			}
+		#endif
+		else
+		{
+			xReturn = pdTRUE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_QUEUE_HAND_OFF */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_HAND_OFF == 1 )
+
+	static BaseType_t prvHandOffToReceiver( Queue_t * const pxQueue, const void * const pvItemToQueue, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	QueueHandOff_t *pxHandOff = NULL;
+	BaseType_t xReturn = pdFALSE;
+
+		/* This function is called from a critical section with the queue
+		unlocked.  Items must be received in the order in which they were sent,
+		so an item can only bypass the queue storage area if the queue is
+		empty. */
+		if( ( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 ) && ( prvCanHandOff( pxQueue ) != pdFALSE ) )
+		{
+			pxHandOff = ( QueueHandOff_t * ) pvTaskGetEventListHandOff( &( pxQueue->xTasksWaitingToReceive ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( pxHandOff != NULL )
+		{
+			( void ) memcpy( pxHandOff->pvBuffer, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+			pxHandOff->xComplete = pdTRUE;
+
+			if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+			{
+				if( pxHigherPriorityTaskWoken != NULL )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_QUEUE_HAND_OFF */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_HAND_OFF == 1 )
+
+	static BaseType_t prvUnblockWaitingSender( Queue_t * const pxQueue )
+	{
+	QueueHandOff_t *pxHandOff = NULL;
+
+		/* This function is called from a critical section with the queue
+		unlocked, and only when there is a task waiting to send. */
+		if( prvCanHandOff( pxQueue ) != pdFALSE )
+		{
+			pxHandOff = ( QueueHandOff_t * ) pvTaskGetEventListHandOff( &( pxQueue->xTasksWaitingToSend ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( pxHandOff != NULL )
+		{
+			if( queueCAN_SEND( pxQueue, pxHandOff->xCopyPosition ) )
+			{
+				/* The queue does not hold data for semaphores or mutexes, so
+				prvCopyDataToQueue() cannot disinherit a priority here. */
+				( void ) prvCopyDataToQueue( pxQueue, pxHandOff->pvBuffer, pxHandOff->xCopyPosition );
+				pxHandOff->xComplete = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) );
+	}
+
+#endif /* configUSE_QUEUE_HAND_OFF */
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
 	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -1803,6 +3621,12 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 	{
 		int8_t cTxLock = pxQueue->cTxLock;
 
+		/* The lock counts are incremented by interrupts, and the Tx lock count
+		of a queue set also by tasks that send to its members, so the tasks
+		unblocked here are only unblocked on behalf of an interrupt if an
+		interrupt incremented the count. */
+		queueUNLOCKING_FROM_ISR( pxQueue, queueTX_LOCKED_FROM_ISR );
+
 		/* See if data was added to the queue while it was locked. */
 		while( cTxLock > queueLOCKED_UNMODIFIED )
 		{
@@ -1875,6 +3699,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 			--cTxLock;
 		}
 
+		queueUNLOCKED_FROM_ISR( pxQueue, queueTX_LOCKED_FROM_ISR );
 		pxQueue->cTxLock = queueUNLOCKED;
 	}
 	taskEXIT_CRITICAL();
@@ -1884,6 +3709,8 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 	{
 		int8_t cRxLock = pxQueue->cRxLock;
 
+		queueUNLOCKING_FROM_ISR( pxQueue, queueRX_LOCKED_FROM_ISR );
+
 		while( cRxLock > queueLOCKED_UNMODIFIED )
 		{
 			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
@@ -1905,6 +3732,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 			}
 		}
 
+		queueUNLOCKED_FROM_ISR( pxQueue, queueRX_LOCKED_FROM_ISR );
 		pxQueue->cRxLock = queueUNLOCKED;
 	}
 	taskEXIT_CRITICAL();
@@ -1960,6 +3788,16 @@ BaseType_t xReturn;
 		{
 			xReturn = pdTRUE;
 		}
+		#if( configUSE_QUEUE_LOANS == 1 )
+			else if( ( pxQueue->pcLoanedSlot != NULL ) || ( pxQueue->pcBorrowedSlot != NULL ) )
+			{
+				/* Treated as full by a sender that is deciding whether to
+				block, even if a send to the back of the queue could now
+				succeed, as committing or releasing the slot will unblock it
+				again. */
+				xReturn = pdTRUE;
+			}
+		#endif
 		else
 		{
 			xReturn = pdFALSE;
@@ -1980,6 +3818,12 @@ BaseType_t xReturn;
 	{
 		xReturn = pdTRUE;
 	}
+	#if( configUSE_QUEUE_LOANS == 1 )
+		else if( ( ( ( Queue_t * ) xQueue )->uxMessagesWaiting + queueSLOTS_HELD( ( Queue_t * ) xQueue ) ) >= ( ( Queue_t * ) xQueue )->uxLength )
+		{
+			xReturn = pdTRUE;
+		}
+	#endif
 	else
 	{
 		xReturn = pdFALSE;
@@ -2541,6 +4385,7 @@ BaseType_t xReturn;
 			else
 			{
 				pxQueueSetContainer->cTxLock = ( int8_t ) ( cTxLock + 1 );
+				queueRECORD_LOCK_FROM_ISR( pxQueueSetContainer, queueTX_LOCKED_FROM_ISR );
 			}
 		}
 		else
@@ -0,0 +1,651 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rw_lock.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include reader-writer lock functionality.  This #if is closed at the very
+bottom of this file.  If you want to include reader-writer locks then ensure
+configUSE_RW_LOCKS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_RW_LOCKS == 1 )
+
+#if( configUSE_PREEMPTION == 0 )
+	/* If the cooperative scheduler is being used then a yield should not be
+	performed just because a higher priority task has been woken. */
+	#define rwlYIELD_IF_USING_PREEMPTION()
+#else
+	#define rwlYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
+#endif
+
+/* Bits stored in the ucFlags field of the reader-writer lock. */
+#define rwlFLAGS_IS_STATICALLY_ALLOCATED	( ( uint8_t ) 1 ) /* Set if the lock was created using statically allocated memory. */
+
+/*-----------------------------------------------------------*/
+
+/* Structure that holds the state of a reader-writer lock.  All members are only
+accessed from within a critical section. */
+typedef struct xRW_LOCK /*lint !e9058 Style convention uses tag. */
+{
+	volatile UBaseType_t uxReaders;			/*< The number of tasks holding the lock for reading. */
+	volatile UBaseType_t uxWritersWaiting;	/*< The number of tasks waiting to write, including any that have been unblocked but have not yet run to take the lock.  Readers are held off while this is not zero. */
+	volatile TaskHandle_t xWriter;			/*< The task holding the lock for writing, or NULL. */
+	List_t xTasksWaitingToRead;				/*< List of tasks that are blocked waiting to read.  Stored in priority order. */
+	List_t xTasksWaitingToWrite;			/*< List of tasks that are blocked waiting to write.  Stored in priority order. */
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucFlags;
+	#endif
+} RWLock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by xRWLockCreate() and xRWLockCreateStatic() to initialise the members
+ * of a newly created reader-writer lock.
+ */
+static void prvInitialiseNewRWLock( RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from a critical section whenever the lock may have become available to
+ * tasks that are waiting for it.  Unblocks the highest priority waiting writer
+ * if the lock is free, otherwise every waiting reader if no task holds or is
+ * waiting for the lock for writing.  Returns pdTRUE if a task that has a
+ * priority above that of the calling task was unblocked.
+ */
+static BaseType_t prvUnblockWaitingTasks( RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from a critical section when a task has timed out waiting for the
+ * lock.  Returns the priority of the highest priority task that is still
+ * waiting to read or write, or tskIDLE_PRIORITY if no tasks are waiting.
+ */
+static UBaseType_t prvGetHighestWaitingPriority( const RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	RWLockHandle_t xRWLockCreate( void )
+	{
+	RWLock_t *pxRWLock;
+
+		pxRWLock = ( RWLock_t * ) pvPortMalloc( sizeof( RWLock_t ) );
+
+		if( pxRWLock != NULL )
+		{
+			prvInitialiseNewRWLock( pxRWLock );
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				pxRWLock->ucFlags = ( uint8_t ) 0;
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( RWLockHandle_t ) pxRWLock;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t *pxRWLockBuffer )
+	{
+	RWLock_t * const pxRWLock = ( RWLock_t * ) pxRWLockBuffer; /*lint !e740 !e9087 RWLock_t and StaticRWLock_t are guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+
+		configASSERT( pxRWLockBuffer );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticRWLock_t equals the size of the real
+			reader-writer lock structure. */
+			volatile size_t xSize = sizeof( StaticRWLock_t );
+			configASSERT( xSize == sizeof( RWLock_t ) );
+		}
+		#endif /* configASSERT_DEFINED */
+
+		if( pxRWLock != NULL )
+		{
+			prvInitialiseNewRWLock( pxRWLock );
+
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* Remember the lock was statically allocated in case it is
+				later deleted. */
+				pxRWLock->ucFlags = rwlFLAGS_IS_STATICALLY_ALLOCATED;
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( RWLockHandle_t ) pxRWLock;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockReadLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+TimeOut_t xTimeOut;
+BaseType_t xEntryTimeSet = pdFALSE, xInheritanceOccurred = pdFALSE;
+
+	configASSERT( pxRWLock );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	/* This function relaxes the coding standard somewhat to allow return
+	statements within the function itself.  This is done in the interest
+	of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			/* Readers only need to wait for writers.  Any number of readers
+			can hold the lock at once. */
+			if( ( pxRWLock->xWriter == NULL ) && ( pxRWLock->uxWritersWaiting == ( UBaseType_t ) 0 ) )
+			{
+				( pxRWLock->uxReaders )++;
+				taskEXIT_CRITICAL();
+				return pdPASS;
+			}
+			else if( ( xTicksToWait == ( TickType_t ) 0 ) || ( ( xEntryTimeSet != pdFALSE ) && ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE ) ) )
+			{
+				/* Readers are always unblocked together, so, unlike a writer,
+				a reader that times out never has a wake to pass on.  It must
+				still stop the writer keeping a priority inherited from it. */
+				if( xInheritanceOccurred != pdFALSE )
+				{
+					( void ) xTaskPriorityDisinheritAfterTimeout( pxRWLock->xWriter, prvGetHighestWaitingPriority( pxRWLock ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return pdFAIL;
+			}
+			else
+			{
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Only a writer can be raised to the priority of this task.  If
+				the lock is held by readers and this task is waiting behind a
+				writer that is itself waiting, there is no single holder to
+				raise. */
+				if( pxRWLock->xWriter != NULL )
+				{
+					if( xTaskPriorityInherit( pxRWLock->xWriter ) != pdFALSE )
+					{
+						xInheritanceOccurred = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				vTaskPlaceOnEventList( &( pxRWLock->xTasksWaitingToRead ), xTicksToWait );
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		portYIELD_WITHIN_API();
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockReadUnlock( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+BaseType_t xReturn = pdPASS;
+
+	configASSERT( pxRWLock );
+
+	taskENTER_CRITICAL();
+	{
+		if( pxRWLock->uxReaders > ( UBaseType_t ) 0 )
+		{
+			( pxRWLock->uxReaders )--;
+
+			/* The last reader to give the lock back lets a waiting writer
+			in. */
+			if( pxRWLock->uxReaders == ( UBaseType_t ) 0 )
+			{
+				if( prvUnblockWaitingTasks( pxRWLock ) != pdFALSE )
+				{
+					/* Yes it is ok to do this from within the critical section
+					- the kernel takes care of that. */
+					rwlYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockWriteLock( RWLockHandle_t xRWLock, TickType_t xTicksToWait )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+TimeOut_t xTimeOut;
+BaseType_t xEntryTimeSet = pdFALSE, xInheritanceOccurred = pdFALSE;
+
+	configASSERT( pxRWLock );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	/* This function relaxes the coding standard somewhat to allow return
+	statements within the function itself.  This is done in the interest
+	of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( ( pxRWLock->xWriter == NULL ) && ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) )
+			{
+				/* The holder is counted as holding a mutex so it can inherit
+				priority from the tasks that wait for it. */
+				pxRWLock->xWriter = ( TaskHandle_t ) pvTaskIncrementMutexHeldCount();
+
+				/* xEntryTimeSet is only set once this task has been counted as
+				waiting. */
+				if( xEntryTimeSet != pdFALSE )
+				{
+					( pxRWLock->uxWritersWaiting )--;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return pdPASS;
+			}
+			else if( ( xTicksToWait == ( TickType_t ) 0 ) || ( ( xEntryTimeSet != pdFALSE ) && ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE ) ) )
+			{
+				if( xEntryTimeSet != pdFALSE )
+				{
+					( pxRWLock->uxWritersWaiting )--;
+
+					/* If this was the last waiting writer then readers held off
+					by it can now run.  Equally, this task may have been
+					unblocked to take the lock as it became free, in which case
+					the wake is passed on to the next waiting writer. */
+					if( prvUnblockWaitingTasks( pxRWLock ) != pdFALSE )
+					{
+						rwlYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The holder must not keep a priority it inherited from this
+				task. */
+				if( xInheritanceOccurred != pdFALSE )
+				{
+					( void ) xTaskPriorityDisinheritAfterTimeout( pxRWLock->xWriter, prvGetHighestWaitingPriority( pxRWLock ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return pdFAIL;
+			}
+			else
+			{
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+
+					/* Hold off new readers until this task has had the lock. */
+					( pxRWLock->uxWritersWaiting )++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( pxRWLock->xWriter != NULL )
+				{
+					if( xTaskPriorityInherit( pxRWLock->xWriter ) != pdFALSE )
+					{
+						xInheritanceOccurred = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				vTaskPlaceOnEventList( &( pxRWLock->xTasksWaitingToWrite ), xTicksToWait );
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		portYIELD_WITHIN_API();
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockWriteUnlock( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+BaseType_t xReturn = pdPASS, xYieldRequired = pdFALSE;
+
+	configASSERT( pxRWLock );
+
+	taskENTER_CRITICAL();
+	{
+		if( pxRWLock->xWriter == xTaskGetCurrentTaskHandle() )
+		{
+			pxRWLock->xWriter = NULL;
+
+			if( prvUnblockWaitingTasks( pxRWLock ) != pdFALSE )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Drop any priority inherited from the waiting tasks. */
+			if( xTaskPriorityDisinherit( xTaskGetCurrentTaskHandle() ) != pdFALSE )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xYieldRequired != pdFALSE )
+			{
+				/* Yes it is ok to do this from within the critical section -
+				the kernel takes care of that. */
+				rwlYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockDelete( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+
+	configASSERT( pxRWLock );
+	configASSERT( pxRWLock->uxReaders == ( UBaseType_t ) 0 );
+	configASSERT( pxRWLock->xWriter == NULL );
+	configASSERT( pxRWLock->uxWritersWaiting == ( UBaseType_t ) 0 );
+	configASSERT( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) != pdFALSE );
+
+	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	{
+		/* The lock can only have been allocated dynamically - free it
+		again. */
+		vPortFree( pxRWLock );
+	}
+	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	{
+		/* The lock could have been allocated statically or dynamically, so
+		check before attempting to free the memory. */
+		if( ( pxRWLock->ucFlags & rwlFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+		{
+			vPortFree( pxRWLock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewRWLock( RWLock_t * const pxRWLock )
+{
+	pxRWLock->uxReaders = ( UBaseType_t ) 0;
+	pxRWLock->uxWritersWaiting = ( UBaseType_t ) 0;
+	pxRWLock->xWriter = NULL;
+	vListInitialise( &( pxRWLock->xTasksWaitingToRead ) );
+	vListInitialise( &( pxRWLock->xTasksWaitingToWrite ) );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockWaitingTasks( RWLock_t * const pxRWLock )
+{
+BaseType_t xYieldRequired = pdFALSE;
+
+	if( pxRWLock->xWriter == NULL )
+	{
+		if( ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) == pdFALSE ) )
+		{
+			/* Writers are preferred.  The highest priority writer is
+			unblocked, and stays counted as waiting until it takes the lock,
+			so readers cannot take the lock before it runs. */
+			xYieldRequired = xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToWrite ) );
+		}
+		else if( pxRWLock->uxWritersWaiting == ( UBaseType_t ) 0 )
+		{
+			/* No writer holds or wants the lock, so every waiting reader can
+			take it.  They are unblocked in priority order. */
+			while( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) == pdFALSE )
+			{
+				if( xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToRead ) ) != pdFALSE )
+				{
+					xYieldRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		else
+		{
+			/* A writer that has been unblocked has not yet run to take the
+			lock, or readers still hold it. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xYieldRequired;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetHighestWaitingPriority( const RWLock_t * const pxRWLock )
+{
+UBaseType_t uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY, uxPriority;
+
+	/* The tasks waiting on each list are held in priority order, so the first
+	one on each list has the highest priority on that list. */
+	if( listCURRENT_LIST_LENGTH( &( pxRWLock->xTasksWaitingToRead ) ) > ( UBaseType_t ) 0U )
+	{
+		uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToRead ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( listCURRENT_LIST_LENGTH( &( pxRWLock->xTasksWaitingToWrite ) ) > ( UBaseType_t ) 0U )
+	{
+		uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToWrite ) );
+
+		if( uxPriority > uxHighestPriorityOfWaitingTasks )
+		{
+			uxHighestPriorityOfWaitingTasks = uxPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return uxHighestPriorityOfWaitingTasks;
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include reader-writer lock functionality.  If you want to include
+reader-writer locks then ensure configUSE_RW_LOCKS is set to 1 in
+FreeRTOSConfig.h. */
+#endif /* configUSE_RW_LOCKS == 1 */
@@ -82,6 +82,10 @@ task.h is included from an application file. */
 #include "timers.h"
 #include "StackMacros.h"
 
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+	#include "multi_wait.h"
+#endif
+
 /* Lint e961 and e750 are suppressed as a MISRA exception justified because the
 MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
 header files above, but not in this file, in order to generate the correct
@@ -106,10 +110,92 @@ functions but without including stdio.h here. */
 	#define taskYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
 #endif
 
+#if( configNUMBER_OF_CORES > 1 )
+
+	/* Values that can be assigned to the xTaskRunState member of the TCB.  A
+	task that is running holds the ID of the core it is running on. */
+	#define taskTASK_NOT_RUNNING		( ( BaseType_t ) -1 )
+	#define taskTASK_IS_RUNNING( pxTCB )	( ( pxTCB )->xTaskRunState != taskTASK_NOT_RUNNING )
+
+	/* Value held in xTaskLockOwner and xISRLockOwner when no core holds the
+	lock. */
+	#define taskNO_CORE					( ( BaseType_t ) -1 )
+
+	#define taskCORE_BIT( xCoreID )		( ( UBaseType_t ) 1U << ( UBaseType_t ) ( xCoreID ) )
+
+	/* The spinlocks provided by the port are not recursive, so the kernel
+	records which core holds each lock and how many times it has been taken.
+	The owner is only ever compared against the ID of the calling core, and the
+	calling core is the only core that can write its own ID, so reading the
+	owner outside of the lock is safe.  Must be called with interrupts masked on
+	the calling core. */
+	#define taskGET_TASK_LOCK( xCoreID )												\
+	{																					\
+		if( xTaskLockOwner != ( xCoreID ) )												\
+		{																				\
+			portGET_TASK_LOCK();														\
+			xTaskLockOwner = ( xCoreID );												\
+		}																				\
+		uxTaskLockNesting++;															\
+	}
+
+	#define taskRELEASE_TASK_LOCK( xCoreID )											\
+	{																					\
+		configASSERT( xTaskLockOwner == ( xCoreID ) );									\
+		( void ) ( xCoreID ); /* Only used by the assert. */							\
+		uxTaskLockNesting--;															\
+		if( uxTaskLockNesting == ( UBaseType_t ) 0U )									\
+		{																				\
+			xTaskLockOwner = taskNO_CORE;												\
+			portRELEASE_TASK_LOCK();													\
+		}																				\
+	}
+
+	#define taskGET_ISR_LOCK( xCoreID )													\
+	{																					\
+		if( xISRLockOwner != ( xCoreID ) )												\
+		{																				\
+			portGET_ISR_LOCK();															\
+			xISRLockOwner = ( xCoreID );												\
+		}																				\
+		uxISRLockNesting++;																\
+	}
+
+	#define taskRELEASE_ISR_LOCK( xCoreID )												\
+	{																					\
+		configASSERT( xISRLockOwner == ( xCoreID ) );									\
+		( void ) ( xCoreID ); /* Only used by the assert. */							\
+		uxISRLockNesting--;																\
+		if( uxISRLockNesting == ( UBaseType_t ) 0U )									\
+		{																				\
+			xISRLockOwner = taskNO_CORE;												\
+			portRELEASE_ISR_LOCK();														\
+		}																				\
+	}
+
+#endif /* configNUMBER_OF_CORES */
+
+/* Tests whether the calling task has the scheduler suspended. */
+#if( configNUMBER_OF_CORES == 1 )
+	#define taskSCHEDULER_SUSPENDED_BY_CALLER()	( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+#else
+	#define taskSCHEDULER_SUSPENDED_BY_CALLER()	prvSchedulerSuspendedByCallingCore()
+#endif
+
 /* Values that can be assigned to the ucNotifyState member of the TCB. */
 #define taskNOT_WAITING_NOTIFICATION	( ( uint8_t ) 0 )
 #define taskWAITING_NOTIFICATION		( ( uint8_t ) 1 )
 #define taskNOTIFICATION_RECEIVED		( ( uint8_t ) 2 )
+#define taskWAITING_MULTIPLE_OBJECTS	( ( uint8_t ) 3 )	/* Waiting for a notification as one of several objects. */
+
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+	/* A task in xWaitForMultipleObjects() is blocked on an event list of its
+	own, and has wait records in the event lists of the objects it waits for.
+	Once the task has been unblocked its event list item is either in the
+	pending ready list or not in a list, so records it has not yet removed can
+	be recognised as stale. */
+	#define taskIS_WAITING_FOR_MULTIPLE_OBJECTS( pxTCB ) ( ( listLIST_ITEM_CONTAINER( &( ( pxTCB )->xEventListItem ) ) != NULL ) && ( listLIST_ITEM_CONTAINER( &( ( pxTCB )->xEventListItem ) ) != ( void * ) &xPendingReadyList ) )
+#endif
 
 /*
  * The value used to fill the stack of a task when the task is created.  This
@@ -145,6 +231,15 @@ a statically allocated stack and a dynamically allocated TCB. */
 #define tskDELETED_CHAR		( 'D' )
 #define tskSUSPENDED_CHAR	( 'S' )
 
+/*
+ * The stages of writing a binary stats record stream, as recorded in the xStage
+ * member of a TaskStatsCursor_t.
+ */
+#define taskSTATS_STAGE_HEADER		( ( BaseType_t ) 0 )
+#define taskSTATS_STAGE_TASKS		( ( BaseType_t ) 1 )
+#define taskSTATS_STAGE_END			( ( BaseType_t ) 2 )
+#define taskSTATS_STAGE_DONE		( ( BaseType_t ) 3 )
+
 /*
  * Some kernel aware debuggers require the data the debugger needs access to be
  * global, rather than file scope.
@@ -153,6 +248,65 @@ a statically allocated stack and a dynamically allocated TCB. */
 	#define static
 #endif
 
+/* Is tick time xA before tick time xB?  The times are compared by their
+distance apart so the comparison remains correct when the tick count overflows,
+provided the two are less than half the tick range apart. */
+#define taskTICK_SIGN_BIT					( ( TickType_t ) ~( portMAX_DELAY >> 1 ) )
+#define taskTIME_IS_BEFORE( xA, xB )		( ( ( TickType_t ) ( ( xA ) - ( xB ) ) & taskTICK_SIGN_BIT ) != ( TickType_t ) 0U )
+
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	/* The ready list of configEDF_PRIORITY is kept in the order in which its
+	tasks must run - tasks without a deadline first, then tasks with a deadline
+	by earliest absolute deadline - so the task to run at that priority is
+	always the one at the head of the list.  Tasks of every other priority
+	share the processor in turn. */
+	#define taskIS_EDF_PRIORITY( uxPriority )	( ( uxPriority ) == ( UBaseType_t ) configEDF_PRIORITY )
+
+	#define taskSELECT_FROM_READY_LIST( pxTCB, uxPriority )													\
+	{																										\
+		if( taskIS_EDF_PRIORITY( uxPriority ) )																\
+		{																									\
+			( pxTCB ) = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyTasksLists[ ( uxPriority ) ] ) );	\
+		}																									\
+		else																								\
+		{																									\
+			listGET_OWNER_OF_NEXT_ENTRY( ( pxTCB ), &( pxReadyTasksLists[ ( uxPriority ) ] ) );				\
+		}																									\
+	}
+
+	#define taskINSERT_INTO_READY_LIST( pxTCB )																\
+	{																										\
+		if( taskIS_EDF_PRIORITY( ( pxTCB )->uxPriority ) )													\
+		{																									\
+			prvAddTaskToDeadlineOrderedList( ( pxTCB ) );													\
+		}																									\
+		else																								\
+		{																									\
+			vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) );	\
+		}																									\
+	}
+
+	/* Does the task that has just been made ready need to preempt the running
+	task?  Within the EDF priority the task must also come before the running
+	task in deadline order. */
+	#define taskPREEMPTS_CURRENT_TASK( pxTCB )																\
+		( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) ||											\
+		  ( ( ( pxTCB )->uxPriority == pxCurrentTCB->uxPriority ) && taskIS_EDF_PRIORITY( ( pxTCB )->uxPriority ) && ( prvTaskRunsBefore( ( pxTCB ), pxCurrentTCB ) != pdFALSE ) ) )
+
+#else
+
+	#define taskIS_EDF_PRIORITY( uxPriority )	( pdFALSE )
+	#define taskSELECT_FROM_READY_LIST( pxTCB, uxPriority )	listGET_OWNER_OF_NEXT_ENTRY( ( pxTCB ), &( pxReadyTasksLists[ ( uxPriority ) ] ) )
+	#define taskINSERT_INTO_READY_LIST( pxTCB )	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) )
+	#define taskPREEMPTS_CURRENT_TASK( pxTCB )	( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority )
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 	/* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -184,7 +338,7 @@ a statically allocated stack and a dynamically allocated TCB. */
 																										\
 		/* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of						\
 		the	same priority get an equal share of the processor time. */									\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );			\
+		taskSELECT_FROM_READY_LIST( pxCurrentTCB, uxTopPriority );										\
 		uxTopReadyPriority = uxTopPriority;																\
 	} /* taskSELECT_HIGHEST_PRIORITY_TASK */
 
@@ -214,7 +368,7 @@ a statically allocated stack and a dynamically allocated TCB. */
 		/* Find the highest priority list that contains ready tasks. */								\
 		portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );								\
 		configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );		\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );		\
+		taskSELECT_FROM_READY_LIST( pxCurrentTCB, uxTopPriority );									\
 	} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
 
 	/*-----------------------------------------------------------*/
@@ -234,6 +388,8 @@ a statically allocated stack and a dynamically allocated TCB. */
 
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMING_WHEEL_DELAYS == 0 )
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
 count overflows. */
 #define taskSWITCH_DELAYED_LISTS()																	\
@@ -250,16 +406,47 @@ count overflows. */
 	prvResetNextTaskUnblockTime();																	\
 }
 
+/* Is pxList one of the lists used to hold Blocked tasks? */
+#define taskLIST_IS_DELAYED_LIST( pxList ) ( ( ( pxList ) == pxDelayedTaskList ) || ( ( pxList ) == pxOverflowDelayedTaskList ) )
+
+#else /* configUSE_TIMING_WHEEL_DELAYS */
+
+	/* The delayed tasks are held in a hierarchical timing wheel.  Each level of
+	the wheel has taskWHEEL_SLOTS slots.  A slot in level 0 covers a single tick,
+	a slot in level 1 covers taskWHEEL_SLOTS ticks, and so on, with enough levels
+	to cover the full range of TickType_t.  A task is placed in the level that
+	matches how far in the future its wake time is, in the slot selected by the
+	wake time itself, so insertion does not depend on the number of tasks that
+	are already blocked.  When the tick count crosses a slot boundary of a level
+	above 0 the tasks in that slot are moved down the wheel, so every task
+	referenced from a level 0 slot is due at exactly the tick that slot
+	represents. */
+	#if( configUSE_16_BIT_TICKS == 1 )
+		#define taskWHEEL_TICK_BITS		( 16U )
+	#else
+		#define taskWHEEL_TICK_BITS		( 32U )
+	#endif
+
+	#define taskWHEEL_SLOTS				( ( UBaseType_t ) 1U << configTIMING_WHEEL_SLOT_BITS )
+	#define taskWHEEL_SLOT_MASK			( ( TickType_t ) taskWHEEL_SLOTS - ( TickType_t ) 1U )
+	#define taskWHEEL_LEVELS			( ( taskWHEEL_TICK_BITS + configTIMING_WHEEL_SLOT_BITS - 1U ) / configTIMING_WHEEL_SLOT_BITS )
+
+	/* Is pxList one of the lists used to hold Blocked tasks? */
+	#define taskLIST_IS_DELAYED_LIST( pxList ) ( ( ( pxList ) >= &( xDelayWheel[ 0 ] ) ) && ( ( pxList ) <= &( xDelayWheel[ ( taskWHEEL_LEVELS * taskWHEEL_SLOTS ) - 1U ] ) ) )
+
+#endif /* configUSE_TIMING_WHEEL_DELAYS */
+
 /*-----------------------------------------------------------*/
 
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
- * the task.  It is inserted at the end of the list.
+ * the task.  It is inserted at the end of the list, or in deadline order if
+ * the list is that of the EDF priority.
  */
 #define prvAddTaskToReadyList( pxTCB )																\
 	traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
 	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
-	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+	taskINSERT_INTO_READY_LIST( pxTCB );															\
 	tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 /*-----------------------------------------------------------*/
 
@@ -320,6 +507,7 @@ typedef struct tskTaskControlBlock
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t		uxBasePriority;		/*< The priority last assigned to the task - used by the priority inheritance mechanism. */
 		UBaseType_t		uxMutexesHeld;
+		void			*pvBlockingMutex;	/*< The mutex the task is blocked waiting for, or NULL.  Only valid while the task is in an event list. */
 	#endif
 
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
@@ -331,7 +519,7 @@ typedef struct tskTaskControlBlock
 	#endif
 
 	#if( configGENERATE_RUN_TIME_STATS == 1 )
-		uint32_t		ulRunTimeCounter;	/*< Stores the amount of time the task has spent in the Running state. */
+		RunTimeCounter_t	ulRunTimeCounter;	/*< Stores the amount of time the task has spent in the Running state. */
 	#endif
 
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
@@ -350,6 +538,58 @@ typedef struct tskTaskControlBlock
 		volatile uint8_t ucNotifyState;
 	#endif
 
+	#if( configUSE_QUEUE_HAND_OFF == 1 )
+		void			*pvHandOff;			/*< Describes the queue send or receive the task is blocked on, so it can be completed on the task's behalf, or NULL if it cannot.  Only valid while the task is in a queue event list. */
+	#endif
+
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+		TickType_t		xEventWaitOrder;	/*< Records when the task was placed on an unordered event list, relative to other tasks placed on unordered event lists. */
+	#endif
+
+	#if( configUSE_EDF_SCHEDULING == 1 )
+		TickType_t		xRelativeDeadline;	/*< The deadline of each job of the task relative to its release, or 0 if the task has no deadline. */
+		TickType_t		xPeriod;			/*< The period the task was created with. */
+		TickType_t		xAbsoluteDeadline;	/*< The tick count by which the current job of the task must complete. */
+		BaseType_t		xDeadlineOverflowCount;	/*< The value of xNumOfOverflows while the tick count is in the range that holds xAbsoluteDeadline, so a deadline that passed however long ago is recognised as passed. */
+		UBaseType_t		uxDeadlineMisses;	/*< The number of jobs of the task that have missed their deadline. */
+		uint8_t			ucDeadlineMissed;	/*< Set to pdTRUE once a miss of xAbsoluteDeadline has been counted. */
+	#endif
+
+	#if( configUSE_TASK_BUDGETS == 1 )
+		TickType_t		xBudget;			/*< The ticks the task may run for in each budget period, or 0 if its execution is not limited. */
+		TickType_t		xBudgetPeriod;		/*< The period at which the budget is replenished. */
+		TickType_t		xBudgetRemaining;	/*< The ticks left in the current budget period. */
+		TickType_t		xBudgetReplenishTime;	/*< The tick count at which the budget is next replenished. */
+		UBaseType_t		uxBudgetOverruns;	/*< The number of times the task has been throttled. */
+	#endif
+
+	#if( configUSE_WAKE_LATENCY_STATS == 1 )
+		uint32_t		ulWakeTimestamp;	/*< configWAKE_LATENCY_TIMESTAMP() when an interrupt last moved the task to the Ready state.  Only valid if xWakeTimestampValid is pdTRUE. */
+		BaseType_t		xWakeTimestampValid;	/*< Set to pdTRUE when ulWakeTimestamp is recorded, and back to pdFALSE when the task next runs. */
+		WakeLatencyStats_t	xWakeLatency;		/*< The histogram of the time from ulWakeTimestamp to the task running. */
+	#endif
+
+	#if( configUSE_CRITICAL_PROFILER == 1 )
+		UBaseType_t		uxProfiledCriticalNesting;	/*< The depth of taskENTER_CRITICAL() calls the task is within, as counted by the critical section profiler. */
+		UBaseType_t		uxCriticalEnterLine;	/*< The line of the outermost taskENTER_CRITICAL() call.  Only valid while uxProfiledCriticalNesting is not 0. */
+		uint32_t		ulCriticalEnterTime;	/*< configCRITICAL_PROFILER_TIMESTAMP() when the critical section was entered, or when the task was last switched back in within it. */
+		const char		*pcCriticalEnterFile;	/*< The source file of the outermost taskENTER_CRITICAL() call. */
+	#endif
+
+	#if( configUSE_TASK_SNAPSHOTS == 1 )
+		ListItem_t		xAllTasksListItem;	/*< Used to reference the task from xAllTasksList. */
+	#endif
+
+	#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+		void			*pvWaitObjects;		/*< The WaitObject_t array passed to xWaitForMultipleObjects() while the task is blocked in that function, or NULL. */
+		UBaseType_t		uxWaitObjectCount;	/*< The number of structures in pvWaitObjects. */
+	#endif
+
+	#if( configNUMBER_OF_CORES > 1 )
+		volatile BaseType_t	xTaskRunState;		/*< The ID of the core the task is running on, or taskTASK_NOT_RUNNING. */
+		UBaseType_t		uxCoreAffinityMask;	/*< Bit n set if the task is allowed to run on core n. */
+	#endif
+
 	/* See the comments above the definition of
 	tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE. */
 	#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
@@ -369,16 +609,47 @@ typedef tskTCB TCB_t;
 /*lint -e956 A manual analysis and inspection has been used to determine which
 static variables must be declared volatile. */
 
-PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#if( configNUMBER_OF_CORES == 1 )
+
+	PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+
+#else
+
+	PRIVILEGED_DATA TCB_t * volatile pxCurrentTCBs[ configNUMBER_OF_CORES ] = { NULL };	/*< The task running on each core. */
+
+	/* A task can be moved to another core between reading the core ID and
+	indexing pxCurrentTCBs[], so the current TCB is read with interrupts masked.
+	Code that already knows it cannot migrate indexes pxCurrentTCBs[]
+	directly. */
+	#define pxCurrentTCB	prvGetCurrentTCB()
+
+#endif
 
 /* Lists for ready and blocked tasks. --------------------*/
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#if( configUSE_TIMING_WHEEL_DELAYS == 0 )
+
+	PRIVILEGED_DATA static List_t xDelayedTaskList1;					/*< Delayed tasks. */
+	PRIVILEGED_DATA static List_t xDelayedTaskList2;					/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+	PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;			/*< Points to the delayed task list currently being used. */
+	PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;	/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#else
+
+	PRIVILEGED_DATA static List_t xDelayWheel[ taskWHEEL_LEVELS * taskWHEEL_SLOTS ];	/*< Delayed tasks, one list per slot, level 0 first. */
+	PRIVILEGED_DATA static uint32_t ulDelayWheelMap[ taskWHEEL_LEVELS ];				/*< One bit per slot that may reference a task.  A set bit can be stale, a clear bit is never wrong. */
+
+#endif
+
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	PRIVILEGED_DATA static TickType_t xNextEventWaitOrder = ( TickType_t ) 0U;	/*< The value given to the next task placed on an unordered event list. */
+
+#endif
+
 #if( INCLUDE_vTaskDelete == 1 )
 
 	PRIVILEGED_DATA static List_t xTasksWaitingTermination;				/*< Tasks that have been deleted - but their memory not yet freed. */
@@ -392,17 +663,33 @@ PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been r
 
 #endif
 
+#if( configUSE_TASK_BUDGETS == 1 )
+
+	PRIVILEGED_DATA static List_t xThrottledTaskList;					/*< Tasks that have used up their execution budget and are waiting for it to be replenished. */
+
+#endif
+
+#if( configUSE_TASK_SNAPSHOTS == 1 )
+
+	PRIVILEGED_DATA static List_t xAllTasksList;						/*< Every task that has been created and not deleted, in the order the tasks were created. */
+
+#endif
+
 /* Other file private variables. --------------------------------*/
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks 	= ( UBaseType_t ) 0U;
-PRIVILEGED_DATA static volatile TickType_t xTickCount 				= ( TickType_t ) 0U;
+PRIVILEGED_DATA static volatile TickType_t xTickCount 				= ( TickType_t ) configINITIAL_TICK_COUNT;
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority 		= tskIDLE_PRIORITY;
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning 		= pdFALSE;
 PRIVILEGED_DATA static volatile UBaseType_t uxPendedTicks 			= ( UBaseType_t ) 0U;
+#if( configNUMBER_OF_CORES == 1 )
 PRIVILEGED_DATA static volatile BaseType_t xYieldPending 			= pdFALSE;
+#endif
 PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows 			= ( BaseType_t ) 0;
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber 					= ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime		= ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
+#if( configNUMBER_OF_CORES == 1 )
 PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle					= NULL;			/*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
+#endif
 
 /* Context switches are held pending while the scheduler is suspended.  Also,
 interrupts must not manipulate the xStateListItem of a TCB, or any of the
@@ -414,10 +701,83 @@ when the scheduler is unsuspended.  The pending ready list itself can only be
 accessed from a critical section. */
 PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t ) pdFALSE;
 
+#if( configNUMBER_OF_CORES > 1 )
+
+	/* Each core has its own yield pending flag.  The flag of the calling core
+	is only accessed from a critical section, with the scheduler suspended, or
+	from an interrupt, none of which allow the calling task to change core, so
+	the code shared with the single core build can keep using xYieldPending. */
+	PRIVILEGED_DATA static volatile BaseType_t xYieldPendings[ configNUMBER_OF_CORES ] = { pdFALSE };
+	#define xYieldPending	xYieldPendings[ portGET_CORE_ID() ]
+
+	/* One idle task is created for, and bound to, each core. */
+	PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandles[ configNUMBER_OF_CORES ] = { NULL };
+	#define xIdleTaskHandle	xIdleTaskHandles[ 0 ]
+
+	/* The kernel task lock is held by a task level critical section and while
+	the scheduler is suspended, so only one core at a time can have the
+	scheduler suspended.  The kernel ISR lock is held by all critical sections,
+	including those entered from interrupts.  The task lock is always taken
+	before the ISR lock. */
+	PRIVILEGED_DATA static volatile BaseType_t xTaskLockOwner			= taskNO_CORE;
+	PRIVILEGED_DATA static volatile UBaseType_t uxTaskLockNesting		= ( UBaseType_t ) 0U;
+	PRIVILEGED_DATA static volatile BaseType_t xISRLockOwner			= taskNO_CORE;
+	PRIVILEGED_DATA static volatile UBaseType_t uxISRLockNesting		= ( UBaseType_t ) 0U;
+
+#endif
+
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
-	PRIVILEGED_DATA static uint32_t ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
-	PRIVILEGED_DATA static uint32_t ulTotalRunTime = 0UL;		/*< Holds the total amount of execution time as defined by the run time counter clock. */
+	PRIVILEGED_DATA static RunTimeCounter_t ulTaskSwitchedInTimes[ configNUMBER_OF_CORES ] = { 0UL };	/*< Holds the value of ulTotalRunTime the last time the time used on each core was accounted. */
+	PRIVILEGED_DATA static RunTimeCounter_t ulTotalRunTime = 0UL;		/*< Holds the total amount of execution time as defined by the run time counter clock. */
+	PRIVILEGED_DATA static uint32_t ulLastRunTimeCounterValue = 0UL;	/*< The value of the port run time counter when it was last read. */
+
+	#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+		PRIVILEGED_DATA static RunTimeCounter_t ulISRRunTime = 0UL;		/*< Holds the amount of execution time spent between vTaskISREnter() and vTaskISRExit() calls. */
+		PRIVILEGED_DATA static UBaseType_t uxISRNesting[ configNUMBER_OF_CORES ] = { 0U };	/*< The interrupt nesting depth on each core, as reported by vTaskISREnter() and vTaskISRExit(). */
+	#endif
+
+	/* The task the time used on core xCoreID is charged to when it is not in an
+	interrupt. */
+	#if( configNUMBER_OF_CORES == 1 )
+		#define taskRUN_TIME_TCB( xCoreID )		pxCurrentTCB
+	#else
+		#define taskRUN_TIME_TCB( xCoreID )		pxCurrentTCBs[ ( xCoreID ) ]
+	#endif
+
+#endif
+
+#if( configUSE_WAKE_LATENCY_STATS == 1 )
+
+	PRIVILEGED_DATA static volatile BaseType_t xWakingFromISR[ configNUMBER_OF_CORES ] = { pdFALSE };	/*< Set, by vTaskSetWakingFromISR(), while a queue FromISR function on each core may unblock tasks. */
+
+	#if( configNUMBER_OF_CORES == 1 )
+		#define taskWAKING_FROM_ISR()	xWakingFromISR[ 0 ]
+	#else
+		#define taskWAKING_FROM_ISR()	xWakingFromISR[ portGET_CORE_ID() ]
+	#endif
+
+	/* Record the time at which an interrupt moved pxTCB to the Ready state.
+	Must be called with interrupts masked. */
+	#define taskSTAMP_WAKE_FROM_ISR( pxTCB )												\
+	{																						\
+		( pxTCB )->ulWakeTimestamp = ( uint32_t ) configWAKE_LATENCY_TIMESTAMP();		\
+		( pxTCB )->xWakeTimestampValid = pdTRUE;										\
+	}
+
+#else
+
+	#define taskSTAMP_WAKE_FROM_ISR( pxTCB )
+
+#endif
+
+#if( configUSE_CRITICAL_PROFILER == 1 )
+
+	PRIVILEGED_DATA static CriticalProfileSite_t xCriticalProfileSites[ configCRITICAL_PROFILER_SITES ];	/*< The call sites seen by the profiler, hashed by line number.  Entries with a NULL pcFile are free. */
+	PRIVILEGED_DATA static uint32_t ulCriticalProfileUnrecorded = 0UL;	/*< The number of durations not recorded because xCriticalProfileSites was full. */
+	PRIVILEGED_DATA static const char *pcSuspendAllFile = NULL;		/*< The source file of the vTaskSuspendAll() call that suspended the scheduler, or NULL if the suspension is not being timed. */
+	PRIVILEGED_DATA static UBaseType_t uxSuspendAllLine = 0U;		/*< The line of that vTaskSuspendAll() call. */
+	PRIVILEGED_DATA static uint32_t ulSuspendAllTime = 0UL;			/*< configCRITICAL_PROFILER_TIMESTAMP() when the scheduler was suspended. */
 
 #endif
 
@@ -434,8 +794,18 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 	extern void vApplicationTickHook( void );
 #endif
 
+#if( ( configUSE_EDF_SCHEDULING == 1 ) && ( configUSE_DEADLINE_MISS_HOOK == 1 ) )
+	extern void vApplicationDeadlineMissHook( TaskHandle_t xTask );
+#endif
+
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
 	extern void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize );
+
+	#if( configNUMBER_OF_CORES > 1 )
+		/* Provides the memory for the idle tasks of cores 1 and above.  The idle
+		task of core 0 still uses vApplicationGetIdleTaskMemory(). */
+		extern void vApplicationGetIdleTaskMemoryForCore( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize, BaseType_t xCoreID );
+	#endif
 #endif
 
 /* File private functions. --------------------------------*/
@@ -550,6 +920,49 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 static void prvResetNextTaskUnblockTime( void );
 
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+	/*
+	 * Called by xTaskRemoveFromEventList() to find the task to unblock from
+	 * pxEventList.  Wait records at the head of the list are removed as they
+	 * are passed.  The task that owns a record is returned if it is still
+	 * waiting, and stale records are discarded.  Returns NULL if the list only
+	 * held stale records.
+	 */
+	static TCB_t *prvGetEventListTaskToUnblock( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called from a critical section when the value of the event list item of
+	 * pxTCB has been changed for a new priority.  If the task is blocked in
+	 * xWaitForMultipleObjects() its wait records are moved to the position for
+	 * the new priority, as the task's own event list item would be.
+	 */
+	static void prvReorderMultipleObjectWaitRecords( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if( configUSE_TIMING_WHEEL_DELAYS == 1 )
+
+	/*
+	 * Place pxListItem in the delay wheel slot that will next be reached at or
+	 * before the wake time held in its item value, as seen from xTimeNow.
+	 */
+	static void prvWheelInsert( ListItem_t * const pxListItem, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called when xTimeNow is a multiple of taskWHEEL_SLOTS to move the tasks
+	 * held in the slots whose boundary has just been reached down the wheel.
+	 */
+	static void prvWheelCascade( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Wheel equivalent of inserting the calling task into the current or the
+	 * overflow delayed task list.
+	 */
+	static void prvAddCurrentTaskToDelayWheel( TickType_t xTimeToWake, const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	/*
@@ -560,6 +973,28 @@ static void prvResetNextTaskUnblockTime( void );
 
 #endif
 
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+	/*
+	 * Helper function used by vTaskGetRunTimeStats() to write a run time, and
+	 * the percentage of the total run time it represents, to pcBuffer.
+	 */
+	static char *prvWriteRunTimeToBuffer( char *pcBuffer, const RunTimeCounter_t ulRunTime, const RunTimeCounter_t ulTotalTimeDiv100 ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if( configUSE_BINARY_TASK_STATS == 1 )
+
+	/*
+	 * Helpers used by xTaskGetStatsRecords() to write values to a record in
+	 * little endian byte order, whatever the byte order of the target.  Each
+	 * returns the position after the value written.
+	 */
+	static uint8_t *prvPackStatsValue( uint8_t *pucRecord, uint32_t ulValue, size_t xBytes ) PRIVILEGED_FUNCTION;
+	static uint8_t *prvPackStatsRunTime( uint8_t *pucRecord, const RunTimeCounter_t ulRunTime ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Called after a Task_t structure has been allocated either statically or
  * dynamically to fill in the structure's members.
@@ -579,6 +1014,176 @@ static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
  */
 static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	/*
+	 * Returns pdTRUE if pxTCB must run before pxOtherTCB when both are in the
+	 * ready list of configEDF_PRIORITY.  Tasks without a deadline (such as a
+	 * task that has inherited configEDF_PRIORITY from a mutex) run before tasks
+	 * with a deadline, and tasks with a deadline run in deadline order.  Equal
+	 * tasks run in the order in which they became ready.
+	 */
+	static BaseType_t prvTaskRunsBefore( const TCB_t * const pxTCB, const TCB_t * const pxOtherTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Inserts pxTCB into the ready list of configEDF_PRIORITY, in front of the
+	 * first task it must run before.  A deadline task whose deadline has passed
+	 * by the time it is made ready starts a new job first.
+	 */
+	static void prvAddTaskToDeadlineOrderedList( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Releases a new job of the deadline task pxTCB at xReleaseTime, moving the
+	 * task within the ready list if it is in it.  Must be called with the
+	 * scheduler suspended or from within a critical section.
+	 */
+	static void prvSetJobRelease( TCB_t * const pxTCB, const TickType_t xReleaseTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns pdTRUE if the absolute deadline of the current job of the
+	 * deadline task pxTCB has been reached, however long ago that was.
+	 */
+	static BaseType_t prvJobDeadlineHasPassed( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called from the tick interrupt to count, and report, the deadline tasks
+	 * that are in the Ready state after their deadline has passed.
+	 */
+	static void prvCheckForDeadlineMisses( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Gives the newly created task xTask the deadline parameters passed to
+	 * xTaskCreateWithDeadline() or xTaskCreateStaticWithDeadline().
+	 */
+	static void prvSetTaskDeadline( TaskHandle_t xTask, TickType_t xRelativeDeadline, const TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+#if( configUSE_TASK_BUDGETS == 1 )
+
+	/*
+	 * Called from the tick interrupt to charge the tick to pxTCB, the task that
+	 * was running when the tick occurred.  Returns pdTRUE if the task has used
+	 * up its budget and has been moved from its ready list to the throttled
+	 * list, in which case the core running it must switch context.
+	 */
+	static BaseType_t prvChargeBudget( TCB_t * const pxTCB, const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called from the tick interrupt to return the throttled tasks whose budget
+	 * is due to be replenished to the Ready state.  Returns pdTRUE if a context
+	 * switch is required.
+	 */
+	static BaseType_t prvReplenishThrottledTasks( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Refills the budget of pxTCB and moves its replenish time on to the next
+	 * period boundary after xConstTickCount.
+	 */
+	static void prvReplenishBudget( TCB_t * const pxTCB, const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_BUDGETS */
+
+#if( configUSE_WAKE_LATENCY_STATS == 1 )
+
+	/*
+	 * Called as pxTCB is switched in.  If an interrupt moved the task to the
+	 * Ready state since it last ran then the time taken for it to run is added
+	 * to its wake latency histogram.
+	 */
+	static void prvRecordWakeLatency( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_WAKE_LATENCY_STATS */
+
+#if( ( configUSE_WAKE_LATENCY_STATS == 1 ) || ( configUSE_CRITICAL_PROFILER == 1 ) )
+
+	/*
+	 * Returns the bucket of a log scale histogram of uxBuckets buckets that
+	 * ulValue is counted in.
+	 */
+	static UBaseType_t prvGetHistogramBucket( const uint32_t ulValue, const UBaseType_t uxBuckets ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if( configUSE_CRITICAL_PROFILER == 1 )
+
+	/*
+	 * Adds ulDuration to the histogram of the critical section or scheduler
+	 * suspension entered at line uxLine of pcFile.  Must be called from within
+	 * a critical section.
+	 */
+	static void prvProfileRegion( const char * const pcFile, const UBaseType_t uxLine, const eProfiledRegion eRegion, const uint32_t ulDuration ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_CRITICAL_PROFILER */
+
+#if( configUSE_MUTEXES == 1 )
+
+	/*
+	 * Changes the priority pxTCB is using to uxNewPriority, without changing
+	 * its base priority, moving the task to the ready list for its new priority
+	 * or to its new position in the event list it is waiting on.  Must be called
+	 * from within a critical section.
+	 */
+	static void prvSetInheritedPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MUTEXES */
+
+#if( configGENERATE_RUN_TIME_STATS == 1 )
+
+	/*
+	 * Reads the port run time counter and adds the time that has passed since
+	 * it was last read to ulTotalRunTime, which is returned.  Must be called
+	 * with the scheduler data protected from interrupts (and, in SMP builds,
+	 * with the kernel ISR lock held).
+	 */
+	static RunTimeCounter_t prvGetTotalRunTime( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Charges the time used on core xCoreID since it was last accounted to
+	 * either the interrupt run time or the task running on the core.
+	 */
+	static void prvUpdateRunTimeCounters( const BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	/*
+	 * Returns the TCB of the task running on the calling core.
+	 */
+	static TCB_t *prvGetCurrentTCB( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns pdTRUE if the scheduler was suspended by the calling core.
+	 * uxSchedulerSuspended is shared by all the cores, so on its own it also
+	 * reports a suspension made by another core.
+	 */
+	static BaseType_t prvSchedulerSuspendedByCallingCore( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Selects the task to run on core xCoreID - the highest priority ready
+	 * task that is allowed to run on the core and is not already running on
+	 * another core.  Called with both kernel locks held.
+	 */
+	static void prvSelectHighestPriorityTask( const BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Makes core xCoreID reschedule.  If xCoreID is the calling core the
+	 * yield is held pending in xYieldPendings[], otherwise the port is asked to
+	 * interrupt the other core.
+	 */
+	static void prvYieldCore( const BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called when pxTCB has become ready to run.  If a core that pxTCB is
+	 * allowed to run on is running a lower priority task then the core running
+	 * the lowest priority task is made to reschedule.  Called from a critical
+	 * section or with the scheduler suspended.
+	 */
+	static void prvYieldForTask( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configNUMBER_OF_CORES */
+
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -764,882 +1369,883 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
-static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
-									const char * const pcName,
-									const uint32_t ulStackDepth,
-									void * const pvParameters,
-									UBaseType_t uxPriority,
-									TaskHandle_t * const pxCreatedTask,
-									TCB_t *pxNewTCB,
-									const MemoryRegion_t * const xRegions ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-StackType_t *pxTopOfStack;
-UBaseType_t x;
+#if( ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-	#if( portUSING_MPU_WRAPPERS == 1 )
-		/* Should the task be created in privileged mode? */
-		BaseType_t xRunPrivileged;
-		if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
-		{
-			xRunPrivileged = pdTRUE;
-		}
-		else
+	BaseType_t xTaskCreateWithDeadline(	TaskFunction_t pxTaskCode,
+										const char * const pcName,
+										const uint16_t usStackDepth,
+										void * const pvParameters,
+										const TickType_t xRelativeDeadline,
+										const TickType_t xPeriod,
+										TaskHandle_t * const pxCreatedTask ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	TaskHandle_t xCreatedTask;
+	BaseType_t xReturn;
+
+		/* The scheduler is suspended so the task cannot be selected before it
+		has been given its deadline. */
+		vTaskSuspendAll();
 		{
-			xRunPrivileged = pdFALSE;
-		}
-		uxPriority &= ~portPRIVILEGE_BIT;
-	#endif /* portUSING_MPU_WRAPPERS == 1 */
+			xReturn = xTaskCreate( pxTaskCode, pcName, usStackDepth, pvParameters, ( UBaseType_t ) configEDF_PRIORITY, &xCreatedTask );
 
-	/* Avoid dependency on memset() if it is not required. */
-	#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
-	{
-		/* Fill the stack with a known value to assist debugging. */
-		( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
-	}
-	#endif /* ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) ) */
+			if( xReturn == pdPASS )
+			{
+				prvSetTaskDeadline( xCreatedTask, xRelativeDeadline, xPeriod );
 
-	/* Calculate the top of stack address.  This depends on whether the stack
-	grows from high memory to low (as per the 80x86) or vice versa.
-	portSTACK_GROWTH is used to make the result positive or negative as required
-	by the port. */
-	#if( portSTACK_GROWTH < 0 )
-	{
-		pxTopOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
-		pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
+				if( pxCreatedTask != NULL )
+				{
+					*pxCreatedTask = xCreatedTask;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
 
-		/* Check the alignment of the calculated top of stack is correct. */
-		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+		return xReturn;
 	}
-	#else /* portSTACK_GROWTH */
-	{
-		pxTopOfStack = pxNewTCB->pxStack;
 
-		/* Check the alignment of the stack buffer is correct. */
-		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+#endif /* ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
 
-		/* The other extreme of the stack space is required if stack checking is
-		performed. */
-		pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
-	}
-	#endif /* portSTACK_GROWTH */
+#if( ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
-	/* Store the task name in the TCB. */
-	for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+	TaskHandle_t xTaskCreateStaticWithDeadline(	TaskFunction_t pxTaskCode,
+												const char * const pcName,
+												const uint32_t ulStackDepth,
+												void * const pvParameters,
+												const TickType_t xRelativeDeadline,
+												const TickType_t xPeriod,
+												StackType_t * const puxStackBuffer,
+												StaticTask_t * const pxTaskBuffer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-		pxNewTCB->pcTaskName[ x ] = pcName[ x ];
+	TaskHandle_t xReturn;
 
-		/* Don't copy all configMAX_TASK_NAME_LEN if the string is shorter than
-		configMAX_TASK_NAME_LEN characters just in case the memory after the
-		string is not accessible (extremely unlikely). */
-		if( pcName[ x ] == 0x00 )
-		{
-			break;
-		}
-		else
+		vTaskSuspendAll();
 		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-	}
-
-	/* Ensure the name string is terminated in the case that the string length
-	was greater or equal to configMAX_TASK_NAME_LEN. */
-	pxNewTCB->pcTaskName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
-
-	/* This is used as an array index so must ensure it's not too large.  First
-	remove the privilege bit if one is present. */
-	if( uxPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
-	{
-		uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-
-	pxNewTCB->uxPriority = uxPriority;
-	#if ( configUSE_MUTEXES == 1 )
-	{
-		pxNewTCB->uxBasePriority = uxPriority;
-		pxNewTCB->uxMutexesHeld = 0;
-	}
-	#endif /* configUSE_MUTEXES */
-
-	vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
-	vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
-
-	/* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
-	back to	the containing TCB from a generic item in a list. */
-	listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
+			xReturn = xTaskCreateStatic( pxTaskCode, pcName, ulStackDepth, pvParameters, ( UBaseType_t ) configEDF_PRIORITY, puxStackBuffer, pxTaskBuffer );
 
-	/* Event lists are always in priority order. */
-	listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-	listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
+			if( xReturn != NULL )
+			{
+				prvSetTaskDeadline( xReturn, xRelativeDeadline, xPeriod );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
 
-	#if ( portCRITICAL_NESTING_IN_TCB == 1 )
-	{
-		pxNewTCB->uxCriticalNesting = ( UBaseType_t ) 0U;
+		return xReturn;
 	}
-	#endif /* portCRITICAL_NESTING_IN_TCB */
 
-	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
-	{
-		pxNewTCB->pxTaskTag = NULL;
-	}
-	#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
 
-	#if ( configGENERATE_RUN_TIME_STATS == 1 )
-	{
-		pxNewTCB->ulRunTimeCounter = 0UL;
-	}
-	#endif /* configGENERATE_RUN_TIME_STATS */
+#if( configUSE_EDF_SCHEDULING == 1 )
 
-	#if ( portUSING_MPU_WRAPPERS == 1 )
-	{
-		vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, ulStackDepth );
-	}
-	#else
+	UBaseType_t uxTaskGetDeadlineMisses( TaskHandle_t xTask )
 	{
-		/* Avoid compiler warning about unreferenced parameter. */
-		( void ) xRegions;
-	}
-	#endif
+	TCB_t *pxTCB;
+	UBaseType_t uxReturn;
 
-	#if( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
-	{
-		for( x = 0; x < ( UBaseType_t ) configNUM_THREAD_LOCAL_STORAGE_POINTERS; x++ )
+		taskENTER_CRITICAL();
 		{
-			pxNewTCB->pvThreadLocalStoragePointers[ x ] = NULL;
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = pxTCB->uxDeadlineMisses;
 		}
-	}
-	#endif
+		taskEXIT_CRITICAL();
 
-	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-	{
-		pxNewTCB->ulNotifiedValue = 0;
-		pxNewTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+		return uxReturn;
 	}
-	#endif
 
-	#if ( configUSE_NEWLIB_REENTRANT == 1 )
-	{
-		/* Initialise this task's Newlib reent structure. */
-		_REENT_INIT_PTR( ( &( pxNewTCB->xNewLib_reent ) ) );
-	}
-	#endif
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
 
-	#if( INCLUDE_xTaskAbortDelay == 1 )
-	{
-		pxNewTCB->ucDelayAborted = pdFALSE;
-	}
-	#endif
+#if( configUSE_TASK_BUDGETS == 1 )
 
-	/* Initialize the TCB stack to look as if the task was already running,
-	but had been interrupted by the scheduler.  The return address is set
-	to the start of the task function. Once the stack has been initialised
-	the	top of stack variable is updated. */
-	#if( portUSING_MPU_WRAPPERS == 1 )
-	{
-		pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
-	}
-	#else /* portUSING_MPU_WRAPPERS */
+	void vTaskSetBudget( TaskHandle_t xTask, const TickType_t xBudget, const TickType_t xPeriod )
 	{
-		pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
-	}
-	#endif /* portUSING_MPU_WRAPPERS */
+	TCB_t *pxTCB;
 
-	if( ( void * ) pxCreatedTask != NULL )
-	{
-		/* Pass the handle out in an anonymous way.  The handle can be used to
-		change the created task's priority, delete the created task, etc.*/
-		*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-}
-/*-----------------------------------------------------------*/
+		configASSERT( ( xBudget == ( TickType_t ) 0U ) || ( ( xPeriod >= xBudget ) && ( ( xPeriod & taskTICK_SIGN_BIT ) == ( TickType_t ) 0U ) ) );
 
-static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
-{
-	/* Ensure interrupts don't access the task lists while the lists are being
-	updated. */
-	taskENTER_CRITICAL();
-	{
-		uxCurrentNumberOfTasks++;
-		if( pxCurrentTCB == NULL )
+		taskENTER_CRITICAL();
 		{
-			/* There are no other tasks, or all the other tasks are in
-			the suspended state - make this the current task. */
-			pxCurrentTCB = pxNewTCB;
+			pxTCB = prvGetTCBFromHandle( xTask );
 
-			if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
-			{
-				/* This is the first task to be created so do the preliminary
-				initialisation required.  We will not recover if this call
-				fails, but we will report the failure. */
-				prvInitialiseTaskLists();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-		}
-		else
-		{
-			/* If the scheduler is not already running, make this task the
-			current task if it is the highest priority task to be created
-			so far. */
-			if( xSchedulerRunning == pdFALSE )
+			pxTCB->xBudget = xBudget;
+			pxTCB->xBudgetPeriod = xPeriod;
+			pxTCB->xBudgetRemaining = xBudget;
+			pxTCB->xBudgetReplenishTime = xTickCount + xPeriod;
+
+			/* The new budget is available immediately, so a task that was
+			throttled can run again. */
+			if( listIS_CONTAINED_WITHIN( &xThrottledTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
 			{
-				if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+				prvAddTaskToReadyList( pxTCB );
+
+				#if( configNUMBER_OF_CORES == 1 )
 				{
-					pxCurrentTCB = pxNewTCB;
+					if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
+					{
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
-				else
+				#else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					prvYieldForTask( pxTCB );
 				}
+				#endif /* configNUMBER_OF_CORES */
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
 
-		uxTaskNumber++;
+	UBaseType_t uxTaskGetBudgetOverruns( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxReturn;
 
-		#if ( configUSE_TRACE_FACILITY == 1 )
+		taskENTER_CRITICAL();
 		{
-			/* Add a counter into the TCB for tracing only. */
-			pxNewTCB->uxTCBNumber = uxTaskNumber;
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = pxTCB->uxBudgetOverruns;
 		}
-		#endif /* configUSE_TRACE_FACILITY */
-		traceTASK_CREATE( pxNewTCB );
-
-		prvAddTaskToReadyList( pxNewTCB );
+		taskEXIT_CRITICAL();
 
-		portSETUP_TCB( pxNewTCB );
+		return uxReturn;
 	}
-	taskEXIT_CRITICAL();
 
-	if( xSchedulerRunning != pdFALSE )
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_WAKE_LATENCY_STATS == 1 )
+
+	static void prvRecordWakeLatency( TCB_t * const pxTCB )
 	{
-		/* If the created task is of a higher priority than the current task
-		then it should run now. */
-		if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+	uint32_t ulLatency;
+
+		if( pxTCB->xWakeTimestampValid != pdFALSE )
 		{
-			taskYIELD_IF_USING_PREEMPTION();
+			pxTCB->xWakeTimestampValid = pdFALSE;
+			ulLatency = ( uint32_t ) configWAKE_LATENCY_TIMESTAMP() - pxTCB->ulWakeTimestamp;
+
+			( pxTCB->xWakeLatency.ulBuckets[ prvGetHistogramBucket( ulLatency, ( UBaseType_t ) configWAKE_LATENCY_BUCKETS ) ] )++;
+			( pxTCB->xWakeLatency.ulWakes )++;
+
+			if( ulLatency > pxTCB->xWakeLatency.ulMaxLatency )
+			{
+				pxTCB->xWakeLatency.ulMaxLatency = ulLatency;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
-	else
+	/*-----------------------------------------------------------*/
+
+	void vTaskSetWakingFromISR( BaseType_t xWaking )
 	{
-		mtCOVERAGE_TEST_MARKER();
+		/* Called with interrupts masked, so the calling code cannot move to
+		another core. */
+		taskWAKING_FROM_ISR() = xWaking;
 	}
-}
-/*-----------------------------------------------------------*/
+	/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
+	BaseType_t xTaskGetWakingFromISR( void )
+	{
+		return taskWAKING_FROM_ISR();
+	}
+	/*-----------------------------------------------------------*/
 
-	void vTaskDelete( TaskHandle_t xTaskToDelete )
+	void vTaskGetWakeLatencyStats( TaskHandle_t xTask, WakeLatencyStats_t *pxStats )
 	{
 	TCB_t *pxTCB;
 
+		configASSERT( pxStats );
+
 		taskENTER_CRITICAL();
 		{
-			/* If null is passed in here then it is the calling task that is
-			being deleted. */
-			pxTCB = prvGetTCBFromHandle( xTaskToDelete );
+			pxTCB = prvGetTCBFromHandle( xTask );
+			*pxStats = pxTCB->xWakeLatency;
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
 
-			/* Remove task from the ready list. */
-			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-			{
-				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+	void vTaskResetWakeLatencyStats( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
 
-			/* Is the task waiting on an event also? */
-			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-			{
-				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( xTask );
+			( void ) memset( ( void * ) &( pxTCB->xWakeLatency ), 0x00, sizeof( WakeLatencyStats_t ) );
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
 
-			/* Increment the uxTaskNumber also so kernel aware debuggers can
-			detect that the task lists need re-generating.  This is done before
-			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
-			not return. */
-			uxTaskNumber++;
+	uint32_t ulTaskGetWakeLatencyPercentile( const WakeLatencyStats_t * const pxStats, const uint32_t ulPartsPerMillion )
+	{
+	uint64_t ullRank, ullCount = 0ULL;
+	UBaseType_t uxBucket;
+	uint32_t ulReturn = 0UL;
 
-			if( pxTCB == pxCurrentTCB )
-			{
-				/* A task is deleting itself.  This cannot complete within the
-				task itself, as a context switch to another task is required.
-				Place the task in the termination list.  The idle task will
-				check the termination list and free up any memory allocated by
-				the scheduler for the TCB and stack of the deleted task. */
-				vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
+		configASSERT( pxStats );
+		configASSERT( ulPartsPerMillion <= 1000000UL );
 
-				/* Increment the ucTasksDeleted variable so the idle task knows
-				there is a task that has been deleted and that it should therefore
-				check the xTasksWaitingTermination list. */
-				++uxDeletedTasksWaitingCleanUp;
+		if( pxStats->ulWakes != 0UL )
+		{
+			/* The rank of the latency being looked for, rounded up. */
+			ullRank = ( ( ( uint64_t ) pxStats->ulWakes * ( uint64_t ) ulPartsPerMillion ) + 999999ULL ) / 1000000ULL;
 
-				/* The pre-delete hook is primarily for the Windows simulator,
-				in which Windows specific clean up operations are performed,
-				after which it is not possible to yield away from this task -
-				hence xYieldPending is used to latch that a context switch is
-				required. */
-				portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
-			}
-			else
+			for( uxBucket = ( UBaseType_t ) 0U; uxBucket < ( UBaseType_t ) configWAKE_LATENCY_BUCKETS; uxBucket++ )
 			{
-				--uxCurrentNumberOfTasks;
-				prvDeleteTCB( pxTCB );
+				ullCount += ( uint64_t ) pxStats->ulBuckets[ uxBucket ];
 
-				/* Reset the next expected unblock time in case it referred to
-				the task that has just been deleted. */
-				prvResetNextTaskUnblockTime();
-			}
+				if( ( ullCount >= ullRank ) && ( ullCount != 0ULL ) )
+				{
+					/* Return the upper limit of the bucket, or the longest
+					latency recorded if that is lower.  The last bucket has no
+					upper limit. */
+					ulReturn = pxStats->ulMaxLatency;
 
-			traceTASK_DELETE( pxTCB );
+					if( uxBucket < ( UBaseType_t ) ( configWAKE_LATENCY_BUCKETS - 1 ) )
+					{
+						if( ( ( ( uint32_t ) 1UL << uxBucket ) - 1UL ) < ulReturn )
+						{
+							ulReturn = ( ( uint32_t ) 1UL << uxBucket ) - 1UL;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					break;
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		taskEXIT_CRITICAL();
 
-		/* Force a reschedule if it is the currently running task that has just
-		been deleted. */
-		if( xSchedulerRunning != pdFALSE )
+		return ulReturn;
+	}
+
+#endif /* configUSE_WAKE_LATENCY_STATS */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_WAKE_LATENCY_STATS == 1 ) || ( configUSE_CRITICAL_PROFILER == 1 ) )
+
+	static UBaseType_t prvGetHistogramBucket( const uint32_t ulValue, const UBaseType_t uxBuckets )
+	{
+	UBaseType_t uxBucket;
+
+		/* Bucket n holds values that need n bits, so bucket 0 holds a value of
+		0 and bucket n > 0 values from 2^(n-1) to 2^n - 1.  The last bucket
+		also holds all the larger values. */
+		for( uxBucket = ( UBaseType_t ) 0U; uxBucket < ( uxBuckets - ( UBaseType_t ) 1U ); uxBucket++ )
 		{
-			if( pxTCB == pxCurrentTCB )
-			{
-				configASSERT( uxSchedulerSuspended == 0 );
-				portYIELD_WITHIN_API();
-			}
-			else
+			if( ( ulValue >> uxBucket ) == 0UL )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				break;
 			}
 		}
+
+		return uxBucket;
 	}
 
-#endif /* INCLUDE_vTaskDelete */
+#endif
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelayUntil == 1 )
+#if( configUSE_CRITICAL_PROFILER == 1 )
 
-	void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement )
+	static void prvProfileRegion( const char * const pcFile, const UBaseType_t uxLine, const eProfiledRegion eRegion, const uint32_t ulDuration )
 	{
-	TickType_t xTimeToWake;
-	BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
+	CriticalProfileSite_t *pxEntry, *pxSite = NULL;
+	UBaseType_t uxIndex, uxProbes;
 
-		configASSERT( pxPreviousWakeTime );
-		configASSERT( ( xTimeIncrement > 0U ) );
-		configASSERT( uxSchedulerSuspended == 0 );
+		/* Search from the entry the line hashes to.  Entries are only freed all
+		at once, by vTaskResetCriticalProfile(), so a site that has been seen
+		is always found before the first free entry.  Sites are compared by
+		the address of their file name, which is cheaper than comparing the
+		strings and, as __FILE__ is used, the same for every call site in a
+		source file. */
+		uxIndex = ( uxLine + ( UBaseType_t ) eRegion ) & ( UBaseType_t ) ( configCRITICAL_PROFILER_SITES - 1 );
 
-		vTaskSuspendAll();
+		for( uxProbes = ( UBaseType_t ) 0U; uxProbes < ( UBaseType_t ) configCRITICAL_PROFILER_SITES; uxProbes++ )
 		{
-			/* Minor optimisation.  The tick count cannot change in this
-			block. */
-			const TickType_t xConstTickCount = xTickCount;
-
-			/* Generate the tick time at which the task wants to wake. */
-			xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+			pxEntry = &( xCriticalProfileSites[ uxIndex ] );
 
-			if( xConstTickCount < *pxPreviousWakeTime )
+			if( pxEntry->pcFile == NULL )
 			{
-				/* The tick count has overflowed since this function was
-				lasted called.  In this case the only time we should ever
-				actually delay is if the wake time has also	overflowed,
-				and the wake time is greater than the tick time.  When this
-				is the case it is as if neither time had overflowed. */
-				if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
-				{
-					xShouldDelay = pdTRUE;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				/* The first time the site has been seen. */
+				pxEntry->pcFile = pcFile;
+				pxEntry->uxLine = uxLine;
+				pxEntry->eRegion = eRegion;
+				pxSite = pxEntry;
+				break;
+			}
+			else if( ( pxEntry->uxLine == uxLine ) && ( pxEntry->pcFile == pcFile ) && ( pxEntry->eRegion == eRegion ) )
+			{
+				pxSite = pxEntry;
+				break;
 			}
 			else
 			{
-				/* The tick time has not overflowed.  In this case we will
-				delay if either the wake time has overflowed, and/or the
-				tick time is less than the wake time. */
-				if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
-				{
-					xShouldDelay = pdTRUE;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				uxIndex = ( uxIndex + ( UBaseType_t ) 1U ) & ( UBaseType_t ) ( configCRITICAL_PROFILER_SITES - 1 );
 			}
+		}
 
-			/* Update the wake time ready for the next call. */
-			*pxPreviousWakeTime = xTimeToWake;
+		if( pxSite != NULL )
+		{
+			( pxSite->ulBuckets[ prvGetHistogramBucket( ulDuration, ( UBaseType_t ) configCRITICAL_PROFILER_BUCKETS ) ] )++;
+			( pxSite->ulCount )++;
 
-			if( xShouldDelay != pdFALSE )
+			if( ulDuration > pxSite->ulMaxDuration )
 			{
-				traceTASK_DELAY_UNTIL( xTimeToWake );
-
-				/* prvAddCurrentTaskToDelayedList() needs the block time, not
-				the time to wake, so subtract the current tick count. */
-				prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
+				pxSite->ulMaxDuration = ulDuration;
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		xAlreadyYielded = xTaskResumeAll();
-
-		/* Force a reschedule if xTaskResumeAll has not already done so, we may
-		have put ourselves to sleep. */
-		if( xAlreadyYielded == pdFALSE )
-		{
-			portYIELD_WITHIN_API();
-		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			/* The table is full. */
+			ulCriticalProfileUnrecorded++;
 		}
 	}
+	/*-----------------------------------------------------------*/
 
-#endif /* INCLUDE_vTaskDelayUntil */
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_vTaskDelay == 1 )
-
-	void vTaskDelay( const TickType_t xTicksToDelay )
+	void vTaskProfileEnterCritical( const char * const pcFile, const UBaseType_t uxLine )
 	{
-	BaseType_t xAlreadyYielded = pdFALSE;
+	TCB_t *pxTCB;
 
-		/* A delay time of zero just forces a reschedule. */
-		if( xTicksToDelay > ( TickType_t ) 0U )
+		/* Called from within the critical section, so the calling task cannot
+		be switched out, or move to another core, before the count is
+		updated. */
+		if( xSchedulerRunning != pdFALSE )
 		{
-			configASSERT( uxSchedulerSuspended == 0 );
-			vTaskSuspendAll();
-			{
-				traceTASK_DELAY();
-
-				/* A task that is removed from the event list while the
-				scheduler is suspended will not get placed in the ready
-				list or removed from the blocked list until the scheduler
-				is resumed.
+			pxTCB = pxCurrentTCB;
 
-				This task cannot be in an event list as it is the currently
-				executing task. */
-				prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
+			if( pxTCB->uxProfiledCriticalNesting == ( UBaseType_t ) 0U )
+			{
+				pxTCB->pcCriticalEnterFile = pcFile;
+				pxTCB->uxCriticalEnterLine = uxLine;
+				pxTCB->ulCriticalEnterTime = ( uint32_t ) configCRITICAL_PROFILER_TIMESTAMP();
 			}
-			xAlreadyYielded = xTaskResumeAll();
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			( pxTCB->uxProfiledCriticalNesting )++;
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+	}
+	/*-----------------------------------------------------------*/
 
-		/* Force a reschedule if xTaskResumeAll has not already done so, we may
-		have put ourselves to sleep. */
-		if( xAlreadyYielded == pdFALSE )
+	void vTaskProfileExitCritical( void )
+	{
+	TCB_t *pxTCB;
+
+		if( xSchedulerRunning != pdFALSE )
 		{
-			portYIELD_WITHIN_API();
+			pxTCB = pxCurrentTCB;
+
+			/* The count is zero if the critical section was entered before the
+			scheduler was started. */
+			if( pxTCB->uxProfiledCriticalNesting > ( UBaseType_t ) 0U )
+			{
+				( pxTCB->uxProfiledCriticalNesting )--;
+
+				if( pxTCB->uxProfiledCriticalNesting == ( UBaseType_t ) 0U )
+				{
+					prvProfileRegion( pxTCB->pcCriticalEnterFile, pxTCB->uxCriticalEnterLine, eProfiledCriticalSection, ( uint32_t ) configCRITICAL_PROFILER_TIMESTAMP() - pxTCB->ulCriticalEnterTime );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
+	/*-----------------------------------------------------------*/
 
-#endif /* INCLUDE_vTaskDelay */
-/*-----------------------------------------------------------*/
-
-#if( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) )
-
-	eTaskState eTaskGetState( TaskHandle_t xTask )
+	UBaseType_t uxTaskGetCriticalProfile( CriticalProfileSite_t * const pxSiteArray, const UBaseType_t uxArraySize, uint32_t * const pulUnrecorded )
 	{
-	eTaskState eReturn;
-	List_t *pxStateList;
-	const TCB_t * const pxTCB = ( TCB_t * ) xTask;
+	UBaseType_t uxIndex, uxCopied = ( UBaseType_t ) 0U;
 
-		configASSERT( pxTCB );
+		configASSERT( ( pxSiteArray != NULL ) || ( uxArraySize == ( UBaseType_t ) 0U ) );
 
-		if( pxTCB == pxCurrentTCB )
-		{
-			/* The task calling this function is querying its own state. */
-			eReturn = eRunning;
-		}
-		else
+		/* Each entry is copied in its own critical section, so reading the
+		profile does not itself mask interrupts for long. */
+		for( uxIndex = ( UBaseType_t ) 0U; ( uxIndex < ( UBaseType_t ) configCRITICAL_PROFILER_SITES ) && ( uxCopied < uxArraySize ); uxIndex++ )
 		{
 			taskENTER_CRITICAL();
 			{
-				pxStateList = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
+				if( xCriticalProfileSites[ uxIndex ].pcFile != NULL )
+				{
+					pxSiteArray[ uxCopied ] = xCriticalProfileSites[ uxIndex ];
+					uxCopied++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 			taskEXIT_CRITICAL();
+		}
 
-			if( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) )
-			{
-				/* The task being queried is referenced from one of the Blocked
-				lists. */
-				eReturn = eBlocked;
-			}
-
-			#if ( INCLUDE_vTaskSuspend == 1 )
-				else if( pxStateList == &xSuspendedTaskList )
-				{
-					/* The task being queried is referenced from the suspended
-					list.  Is it genuinely suspended or is it block
-					indefinitely? */
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
-					{
-						eReturn = eSuspended;
-					}
-					else
-					{
-						eReturn = eBlocked;
-					}
-				}
-			#endif
-
-			#if ( INCLUDE_vTaskDelete == 1 )
-				else if( ( pxStateList == &xTasksWaitingTermination ) || ( pxStateList == NULL ) )
-				{
-					/* The task being queried is referenced from the deleted
-					tasks list, or it is not referenced from any lists at
-					all. */
-					eReturn = eDeleted;
-				}
-			#endif
-
-			else /*lint !e525 Negative indentation is intended to make use of pre-processor clearer. */
-			{
-				/* If the task is not in any other state, it must be in the
-				Ready (including pending ready) state. */
-				eReturn = eReady;
-			}
+		if( pulUnrecorded != NULL )
+		{
+			*pulUnrecorded = ulCriticalProfileUnrecorded;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
 
-		return eReturn;
-	} /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
-
-#endif /* INCLUDE_eTaskGetState */
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_uxTaskPriorityGet == 1 )
+		return uxCopied;
+	}
+	/*-----------------------------------------------------------*/
 
-	UBaseType_t uxTaskPriorityGet( TaskHandle_t xTask )
+	void vTaskResetCriticalProfile( void )
 	{
-	TCB_t *pxTCB;
-	UBaseType_t uxReturn;
-
 		taskENTER_CRITICAL();
 		{
-			/* If null is passed in here then it is the priority of the that
-			called uxTaskPriorityGet() that is being queried. */
-			pxTCB = prvGetTCBFromHandle( xTask );
-			uxReturn = pxTCB->uxPriority;
+			( void ) memset( ( void * ) xCriticalProfileSites, 0x00, sizeof( xCriticalProfileSites ) );
+			ulCriticalProfileUnrecorded = 0UL;
 		}
 		taskEXIT_CRITICAL();
-
-		return uxReturn;
 	}
 
-#endif /* INCLUDE_uxTaskPriorityGet */
+#endif /* configUSE_CRITICAL_PROFILER */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskPriorityGet == 1 )
-
-	UBaseType_t uxTaskPriorityGetFromISR( TaskHandle_t xTask )
-	{
-	TCB_t *pxTCB;
-	UBaseType_t uxReturn, uxSavedInterruptState;
-
-		/* RTOS ports that support interrupt nesting have the concept of a
-		maximum	system call (or maximum API call) interrupt priority.
-		Interrupts that are	above the maximum system call priority are keep
-		permanently enabled, even when the RTOS kernel is in a critical section,
-		but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-		is defined in FreeRTOSConfig.h then
-		portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-		failure if a FreeRTOS API function is called from an interrupt that has
-		been assigned a priority above the configured maximum system call
-		priority.  Only FreeRTOS functions that end in FromISR can be called
-		from interrupts	that have been assigned a priority at or (logically)
-		below the maximum system call interrupt priority.  FreeRTOS maintains a
-		separate interrupt safe API to ensure interrupt entry is as fast and as
-		simple as possible.  More information (albeit Cortex-M specific) is
-		provided on the following link:
-		http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
+									const char * const pcName,
+									const uint32_t ulStackDepth,
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask,
+									TCB_t *pxNewTCB,
+									const MemoryRegion_t * const xRegions ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+StackType_t *pxTopOfStack;
+UBaseType_t x;
 
-		uxSavedInterruptState = portSET_INTERRUPT_MASK_FROM_ISR();
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		/* Should the task be created in privileged mode? */
+		BaseType_t xRunPrivileged;
+		if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
 		{
-			/* If null is passed in here then it is the priority of the calling
-			task that is being queried. */
-			pxTCB = prvGetTCBFromHandle( xTask );
-			uxReturn = pxTCB->uxPriority;
+			xRunPrivileged = pdTRUE;
 		}
-		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptState );
+		else
+		{
+			xRunPrivileged = pdFALSE;
+		}
+		uxPriority &= ~portPRIVILEGE_BIT;
+	#endif /* portUSING_MPU_WRAPPERS == 1 */
 
-		return uxReturn;
+	/* Avoid dependency on memset() if it is not required. */
+	#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
+	{
+		/* Fill the stack with a known value to assist debugging. */
+		( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
 	}
+	#endif /* ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) ) */
 
-#endif /* INCLUDE_uxTaskPriorityGet */
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_vTaskPrioritySet == 1 )
+	/* Calculate the top of stack address.  This depends on whether the stack
+	grows from high memory to low (as per the 80x86) or vice versa.
+	portSTACK_GROWTH is used to make the result positive or negative as required
+	by the port. */
+	#if( portSTACK_GROWTH < 0 )
+	{
+		pxTopOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
+		pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
 
-	void vTaskPrioritySet( TaskHandle_t xTask, UBaseType_t uxNewPriority )
+		/* Check the alignment of the calculated top of stack is correct. */
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+	}
+	#else /* portSTACK_GROWTH */
 	{
-	TCB_t *pxTCB;
-	UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
-	BaseType_t xYieldRequired = pdFALSE;
+		pxTopOfStack = pxNewTCB->pxStack;
 
-		configASSERT( ( uxNewPriority < configMAX_PRIORITIES ) );
+		/* Check the alignment of the stack buffer is correct. */
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
 
-		/* Ensure the new priority is valid. */
-		if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+		/* The other extreme of the stack space is required if stack checking is
+		performed. */
+		pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
+	}
+	#endif /* portSTACK_GROWTH */
+
+	/* Store the task name in the TCB. */
+	for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+	{
+		pxNewTCB->pcTaskName[ x ] = pcName[ x ];
+
+		/* Don't copy all configMAX_TASK_NAME_LEN if the string is shorter than
+		configMAX_TASK_NAME_LEN characters just in case the memory after the
+		string is not accessible (extremely unlikely). */
+		if( pcName[ x ] == 0x00 )
 		{
-			uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+			break;
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+	}
 
-		taskENTER_CRITICAL();
-		{
-			/* If null is passed in here then it is the priority of the calling
-			task that is being changed. */
-			pxTCB = prvGetTCBFromHandle( xTask );
+	/* Ensure the name string is terminated in the case that the string length
+	was greater or equal to configMAX_TASK_NAME_LEN. */
+	pxNewTCB->pcTaskName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
 
-			traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+	/* This is used as an array index so must ensure it's not too large.  First
+	remove the privilege bit if one is present. */
+	if( uxPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+	{
+		uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
-			#if ( configUSE_MUTEXES == 1 )
-			{
-				uxCurrentBasePriority = pxTCB->uxBasePriority;
-			}
-			#else
-			{
-				uxCurrentBasePriority = pxTCB->uxPriority;
-			}
-			#endif
+	pxNewTCB->uxPriority = uxPriority;
+	#if ( configUSE_MUTEXES == 1 )
+	{
+		pxNewTCB->uxBasePriority = uxPriority;
+		pxNewTCB->uxMutexesHeld = 0;
+		pxNewTCB->pvBlockingMutex = NULL;
+	}
+	#endif /* configUSE_MUTEXES */
 
-			if( uxCurrentBasePriority != uxNewPriority )
-			{
-				/* The priority change may have readied a task of higher
-				priority than the calling task. */
-				if( uxNewPriority > uxCurrentBasePriority )
-				{
-					if( pxTCB != pxCurrentTCB )
-					{
-						/* The priority of a task other than the currently
-						running task is being raised.  Is the priority being
-						raised above that of the running task? */
-						if( uxNewPriority >= pxCurrentTCB->uxPriority )
-						{
-							xYieldRequired = pdTRUE;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					else
-					{
-						/* The priority of the running task is being raised,
-						but the running task must already be the highest
-						priority task able to run so no yield is required. */
-					}
-				}
-				else if( pxTCB == pxCurrentTCB )
-				{
-					/* Setting the priority of the running task down means
-					there may now be another task of higher priority that
-					is ready to execute. */
-					xYieldRequired = pdTRUE;
-				}
-				else
-				{
-					/* Setting the priority of any other task down does not
-					require a yield as the running task must be above the
-					new priority of the task being modified. */
-				}
+	vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
+	vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
-				/* Remember the ready list the task might be referenced from
-				before its uxPriority member is changed so the
-				taskRESET_READY_PRIORITY() macro can function correctly. */
-				uxPriorityUsedOnEntry = pxTCB->uxPriority;
+	/* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
+	back to	the containing TCB from a generic item in a list. */
+	listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
 
-				#if ( configUSE_MUTEXES == 1 )
-				{
-					/* Only change the priority being used if the task is not
-					currently using an inherited priority. */
-					if( pxTCB->uxBasePriority == pxTCB->uxPriority )
-					{
-						pxTCB->uxPriority = uxNewPriority;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+	/* Event lists are always in priority order. */
+	listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+	listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
 
-					/* The base priority gets set whatever. */
-					pxTCB->uxBasePriority = uxNewPriority;
-				}
-				#else
-				{
-					pxTCB->uxPriority = uxNewPriority;
-				}
-				#endif
+	#if( configUSE_TASK_SNAPSHOTS == 1 )
+	{
+		vListInitialiseItem( &( pxNewTCB->xAllTasksListItem ) );
+		listSET_LIST_ITEM_OWNER( &( pxNewTCB->xAllTasksListItem ), pxNewTCB );
+	}
+	#endif /* configUSE_TASK_SNAPSHOTS */
 
-				/* Only reset the event list item value if the value is not
-				being used for anything else. */
-				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-				{
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+	#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+	{
+		pxNewTCB->pvWaitObjects = NULL;
+		pxNewTCB->uxWaitObjectCount = ( UBaseType_t ) 0U;
+	}
+	#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
 
-				/* If the task is in the blocked or suspended list we need do
-				nothing more than change it's priority variable. However, if
-				the task is in a ready list it needs to be removed and placed
-				in the list appropriate to its new priority. */
-				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+	#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+	{
+		pxNewTCB->uxCriticalNesting = ( UBaseType_t ) 0U;
+	}
+	#endif /* portCRITICAL_NESTING_IN_TCB */
+
+	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+	{
+		pxNewTCB->pxTaskTag = NULL;
+	}
+	#endif /* configUSE_APPLICATION_TASK_TAG */
+
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	{
+		pxNewTCB->ulRunTimeCounter = 0UL;
+	}
+	#endif /* configGENERATE_RUN_TIME_STATS */
+
+	#if ( portUSING_MPU_WRAPPERS == 1 )
+	{
+		vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, ulStackDepth );
+	}
+	#else
+	{
+		/* Avoid compiler warning about unreferenced parameter. */
+		( void ) xRegions;
+	}
+	#endif
+
+	#if( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+	{
+		for( x = 0; x < ( UBaseType_t ) configNUM_THREAD_LOCAL_STORAGE_POINTERS; x++ )
+		{
+			pxNewTCB->pvThreadLocalStoragePointers[ x ] = NULL;
+		}
+	}
+	#endif
+
+	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+	{
+		pxNewTCB->ulNotifiedValue = 0;
+		pxNewTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+	}
+	#endif
+
+	#if( configUSE_QUEUE_HAND_OFF == 1 )
+	{
+		/* The task is not blocked on a queue yet. */
+		pxNewTCB->pvHandOff = NULL;
+	}
+	#endif
+
+	#if ( configUSE_NEWLIB_REENTRANT == 1 )
+	{
+		/* Initialise this task's Newlib reent structure. */
+		_REENT_INIT_PTR( ( &( pxNewTCB->xNewLib_reent ) ) );
+	}
+	#endif
+
+	#if( INCLUDE_xTaskAbortDelay == 1 )
+	{
+		pxNewTCB->ucDelayAborted = pdFALSE;
+	}
+	#endif
+
+	#if( configNUMBER_OF_CORES > 1 )
+	{
+		pxNewTCB->xTaskRunState = taskTASK_NOT_RUNNING;
+		pxNewTCB->uxCoreAffinityMask = tskNO_AFFINITY;
+	}
+	#endif
+
+	#if( configUSE_EDF_SCHEDULING == 1 )
+	{
+		/* The task is given a deadline by xTaskCreateWithDeadline() after it
+		has been initialised. */
+		pxNewTCB->xRelativeDeadline = ( TickType_t ) 0U;
+		pxNewTCB->xPeriod = ( TickType_t ) 0U;
+		pxNewTCB->xAbsoluteDeadline = ( TickType_t ) 0U;
+		pxNewTCB->xDeadlineOverflowCount = ( BaseType_t ) 0;
+		pxNewTCB->uxDeadlineMisses = ( UBaseType_t ) 0U;
+		pxNewTCB->ucDeadlineMissed = pdFALSE;
+	}
+	#endif
+
+	#if( configUSE_TASK_BUDGETS == 1 )
+	{
+		/* The execution of a task is not limited until vTaskSetBudget() is
+		called. */
+		pxNewTCB->xBudget = ( TickType_t ) 0U;
+		pxNewTCB->xBudgetPeriod = ( TickType_t ) 0U;
+		pxNewTCB->xBudgetRemaining = ( TickType_t ) 0U;
+		pxNewTCB->xBudgetReplenishTime = ( TickType_t ) 0U;
+		pxNewTCB->uxBudgetOverruns = ( UBaseType_t ) 0U;
+	}
+	#endif
+
+	#if( configUSE_WAKE_LATENCY_STATS == 1 )
+	{
+		pxNewTCB->xWakeTimestampValid = pdFALSE;
+		( void ) memset( ( void * ) &( pxNewTCB->xWakeLatency ), 0x00, sizeof( WakeLatencyStats_t ) );
+	}
+	#endif
+
+	#if( configUSE_CRITICAL_PROFILER == 1 )
+	{
+		pxNewTCB->uxProfiledCriticalNesting = ( UBaseType_t ) 0U;
+		pxNewTCB->pcCriticalEnterFile = NULL;
+	}
+	#endif
+
+	/* Initialize the TCB stack to look as if the task was already running,
+	but had been interrupted by the scheduler.  The return address is set
+	to the start of the task function. Once the stack has been initialised
+	the	top of stack variable is updated. */
+	#if( portUSING_MPU_WRAPPERS == 1 )
+	{
+		pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+	}
+	#else /* portUSING_MPU_WRAPPERS */
+	{
+		pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+	}
+	#endif /* portUSING_MPU_WRAPPERS */
+
+	if( ( void * ) pxCreatedTask != NULL )
+	{
+		/* Pass the handle out in an anonymous way.  The handle can be used to
+		change the created task's priority, delete the created task, etc.*/
+		*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
+{
+	/* Ensure interrupts don't access the task lists while the lists are being
+	updated. */
+	taskENTER_CRITICAL();
+	{
+		uxCurrentNumberOfTasks++;
+		#if( configNUMBER_OF_CORES == 1 )
+		{
+			if( pxCurrentTCB == NULL )
+			{
+				/* There are no other tasks, or all the other tasks are in
+				the suspended state - make this the current task. */
+				pxCurrentTCB = pxNewTCB;
+
+				if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
 				{
-					/* The task is currently in its ready list - remove before adding
-					it to it's new ready list.  As we are in a critical section we
-					can do this even if the scheduler is suspended. */
-					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-					{
-						/* It is known that the task is in its ready list so
-						there is no need to check again and the port level
-						reset macro can be called directly. */
-						portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-					prvAddTaskToReadyList( pxTCB );
+					/* This is the first task to be created so do the preliminary
+					initialisation required.  We will not recover if this call
+					fails, but we will report the failure. */
+					prvInitialiseTaskLists();
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
-
-				if( xYieldRequired != pdFALSE )
+			}
+			else
+			{
+				/* If the scheduler is not already running, make this task the
+				current task if it is the highest priority task to be created
+				so far. */
+				if( xSchedulerRunning == pdFALSE )
 				{
-					taskYIELD_IF_USING_PREEMPTION();
+					if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
+					{
+						pxCurrentTCB = pxNewTCB;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
-
-				/* Remove compiler warning about unused variables when the port
-				optimised task selection is not being used. */
-				( void ) uxPriorityUsedOnEntry;
 			}
 		}
-		taskEXIT_CRITICAL();
-	}
-
-#endif /* INCLUDE_vTaskPrioritySet */
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_vTaskSuspend == 1 )
-
-	void vTaskSuspend( TaskHandle_t xTaskToSuspend )
-	{
-	TCB_t *pxTCB;
-
-		taskENTER_CRITICAL();
+		#else
 		{
-			/* If null is passed in here then it is the running task that is
-			being suspended. */
-			pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
-
-			traceTASK_SUSPEND( pxTCB );
-
-			/* Remove task from the ready/delayed list and place in the
-			suspended list. */
-			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+			/* The task that runs on each core is not selected until the
+			scheduler is started. */
+			if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
 			{
-				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+				prvInitialiseTaskLists();
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+		}
+		#endif /* configNUMBER_OF_CORES */
 
-			/* Is the task waiting on an event also? */
-			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+		uxTaskNumber++;
+
+		#if ( configUSE_TRACE_FACILITY == 1 )
+		{
+			/* Add a counter into the TCB for tracing only. */
+			pxNewTCB->uxTCBNumber = uxTaskNumber;
+		}
+		#endif /* configUSE_TRACE_FACILITY */
+
+		#if( configUSE_TASK_SNAPSHOTS == 1 )
+		{
+			/* xAllTasksList is only ever appended to, so it stays in creation
+			order. */
+			vListInsertEnd( &xAllTasksList, &( pxNewTCB->xAllTasksListItem ) );
+		}
+		#endif /* configUSE_TASK_SNAPSHOTS */
+		traceTASK_CREATE( pxNewTCB );
+
+		prvAddTaskToReadyList( pxNewTCB );
+
+		portSETUP_TCB( pxNewTCB );
+
+		#if( configNUMBER_OF_CORES > 1 )
+		{
+			/* If the created task is of a higher priority than the task
+			running on any core it is allowed to run on then it should run
+			now. */
+			if( xSchedulerRunning != pdFALSE )
 			{
-				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				prvYieldForTask( pxNewTCB );
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-
-			vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
 		}
-		taskEXIT_CRITICAL();
+		#endif /* configNUMBER_OF_CORES */
+	}
+	taskEXIT_CRITICAL();
 
+	#if( configNUMBER_OF_CORES == 1 )
+	{
 		if( xSchedulerRunning != pdFALSE )
 		{
-			/* Reset the next expected unblock time in case it referred to the
-			task that is now in the Suspended state. */
-			taskENTER_CRITICAL();
-			{
-				prvResetNextTaskUnblockTime();
-			}
-			taskEXIT_CRITICAL();
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-
-		if( pxTCB == pxCurrentTCB )
-		{
-			if( xSchedulerRunning != pdFALSE )
+			/* If the created task is of a higher priority than the current task
+			then it should run now. */
+			if( taskPREEMPTS_CURRENT_TASK( pxNewTCB ) )
 			{
-				/* The current task has just been suspended. */
-				configASSERT( uxSchedulerSuspended == 0 );
-				portYIELD_WITHIN_API();
+				taskYIELD_IF_USING_PREEMPTION();
 			}
 			else
 			{
-				/* The scheduler is not running, but the task that was pointed
-				to by pxCurrentTCB has just been suspended and pxCurrentTCB
-				must be adjusted to point to a different task. */
-				if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks )
-				{
-					/* No other tasks are ready, so set pxCurrentTCB back to
-					NULL so when the next task is created pxCurrentTCB will
-					be set to point to it no matter what its relative priority
-					is. */
-					pxCurrentTCB = NULL;
-				}
-				else
-				{
-					vTaskSwitchContext();
-				}
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
 		else
@@ -1647,1456 +2253,4484 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
-
-#endif /* INCLUDE_vTaskSuspend */
+	#endif /* configNUMBER_OF_CORES */
+}
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if( configUSE_EDF_SCHEDULING == 1 )
 
-	static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask )
+	static BaseType_t prvTaskRunsBefore( const TCB_t * const pxTCB, const TCB_t * const pxOtherTCB )
 	{
-	BaseType_t xReturn = pdFALSE;
-	const TCB_t * const pxTCB = ( TCB_t * ) xTask;
-
-		/* Accesses xPendingReadyList so must be called from a critical
-		section. */
-
-		/* It does not make sense to check if the calling task is suspended. */
-		configASSERT( xTask );
+	BaseType_t xReturn;
 
-		/* Is the task being resumed actually in the suspended list? */
-		if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
+		if( pxOtherTCB->xRelativeDeadline == ( TickType_t ) 0U )
 		{
-			/* Has the task already been resumed from within an ISR? */
-			if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
-			{
-				/* Is it in the suspended list because it is in the	Suspended
-				state, or because is is blocked with no timeout? */
-				if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE )
-				{
-					xReturn = pdTRUE;
-				}
-				else
+			xReturn = pdFALSE;
+		}
+		else if( pxTCB->xRelativeDeadline == ( TickType_t ) 0U )
+		{
+			xReturn = pdTRUE;
+		}
+		else if( taskTIME_IS_BEFORE( pxTCB->xAbsoluteDeadline, pxOtherTCB->xAbsoluteDeadline ) )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvAddTaskToDeadlineOrderedList( TCB_t * const pxTCB )
+	{
+	List_t * const pxList = &( pxReadyTasksLists[ configEDF_PRIORITY ] );
+	ListItem_t * const pxSavedIndex = pxList->pxIndex;
+	ListItem_t *pxIterator;
+
+		/* A task that blocks on anything other than vTaskDelayUntil() does not
+		release a new job when it blocks.  If the deadline of its job passed
+		while it was not ready then the job is over, and the task is starting a
+		new one, so it is released now.  Otherwise the old deadline would put
+		it in front of every task whose deadline is still to come, and would
+		be counted as a miss. */
+		if( ( pxTCB->xRelativeDeadline != ( TickType_t ) 0U ) && ( prvJobDeadlineHasPassed( pxTCB ) != pdFALSE ) )
+		{
+			prvSetJobRelease( pxTCB, xTickCount );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != ( ListItem_t * ) listGET_END_MARKER( pxList ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+		{
+			if( prvTaskRunsBefore( pxTCB, ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator ) ) != pdFALSE )
+			{
+				break;
+			}
+		}
+
+		/* vListInsertEnd() inserts an item in front of the list's index, so
+		pointing the index at the item found places pxTCB in front of that
+		task, or at the end of the list if no task was found.  The index is not
+		used to select tasks at this priority, but is put back as the functions
+		that walk the lists move it. */
+		pxList->pxIndex = pxIterator;
+		vListInsertEnd( pxList, &( pxTCB->xStateListItem ) );
+		pxList->pxIndex = pxSavedIndex;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvSetJobRelease( TCB_t * const pxTCB, const TickType_t xReleaseTime )
+	{
+	const TickType_t xDeadline = xReleaseTime + pxTCB->xRelativeDeadline;
+
+		pxTCB->xAbsoluteDeadline = xDeadline;
+		pxTCB->ucDeadlineMissed = pdFALSE;
+
+		/* The deadline is less than half the tick range from the current tick
+		count.  Note whether the tick count overflows before it is reached, or
+		overflowed after it was reached, in the same way as a TimeOut_t. */
+		if( taskTIME_IS_BEFORE( xTickCount, xDeadline ) )
+		{
+			pxTCB->xDeadlineOverflowCount = xNumOfOverflows + ( ( xDeadline < xTickCount ) ? ( BaseType_t ) 1 : ( BaseType_t ) 0 );
+		}
+		else
+		{
+			pxTCB->xDeadlineOverflowCount = xNumOfOverflows - ( ( xDeadline > xTickCount ) ? ( BaseType_t ) 1 : ( BaseType_t ) 0 );
+		}
+
+		/* The task's position in the deadline ordered list depends on its
+		deadline. */
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configEDF_PRIORITY ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+		{
+			( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+			prvAddTaskToDeadlineOrderedList( pxTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvCheckForDeadlineMisses( const TickType_t xConstTickCount )
+	{
+	List_t * const pxList = &( pxReadyTasksLists[ configEDF_PRIORITY ] );
+	ListItem_t *pxIterator;
+	TCB_t *pxTCB;
+
+		/* Tasks with a deadline are held in deadline order behind any tasks
+		without one, so the search ends at the first deadline that has not yet
+		been reached.  Only a task that is in the Ready state at its deadline
+		misses it - a task that is not starts a new job when it is next made
+		ready. */
+		for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != ( ListItem_t * ) listGET_END_MARKER( pxList ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+		{
+			pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator );
+
+			if( pxTCB->xRelativeDeadline == ( TickType_t ) 0U )
+			{
+				continue;
+			}
+
+			if( taskTIME_IS_BEFORE( xConstTickCount, pxTCB->xAbsoluteDeadline ) )
+			{
+				break;
+			}
+
+			/* Each job is only counted once, however long it overruns. */
+			if( pxTCB->ucDeadlineMissed == pdFALSE )
+			{
+				pxTCB->ucDeadlineMissed = pdTRUE;
+				( pxTCB->uxDeadlineMisses )++;
+				traceTASK_DEADLINE_MISSED( pxTCB );
+
+				#if( configUSE_DEADLINE_MISS_HOOK == 1 )
 				{
-					mtCOVERAGE_TEST_MARKER();
+					vApplicationDeadlineMissHook( ( TaskHandle_t ) pxTCB );
 				}
+				#endif /* configUSE_DEADLINE_MISS_HOOK */
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvJobDeadlineHasPassed( const TCB_t * const pxTCB )
+	{
+	BaseType_t xReturn;
+
+		if( pxTCB->xDeadlineOverflowCount == xNumOfOverflows )
+		{
+			/* The tick count is in the range that holds the deadline. */
+			xReturn = ( xTickCount >= pxTCB->xAbsoluteDeadline ) ? pdTRUE : pdFALSE;
+		}
+		else if( pxTCB->xDeadlineOverflowCount == ( xNumOfOverflows + ( BaseType_t ) 1 ) )
+		{
+			/* The deadline is after the tick count next overflows. */
+			xReturn = pdFALSE;
+		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			/* The tick count has overflowed since the deadline's range. */
+			xReturn = pdTRUE;
 		}
 
 		return xReturn;
-	} /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+	}
+	/*-----------------------------------------------------------*/
 
-#endif /* INCLUDE_vTaskSuspend */
+	static void prvSetTaskDeadline( TaskHandle_t xTask, TickType_t xRelativeDeadline, const TickType_t xPeriod )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) xTask;
+
+		configASSERT( xPeriod > ( TickType_t ) 0U );
+
+		/* A deadline of 0 means the deadline equals the period. */
+		if( xRelativeDeadline == ( TickType_t ) 0U )
+		{
+			xRelativeDeadline = xPeriod;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Deadlines are compared across tick count overflows, which only works
+		if they are less than half the tick range away. */
+		configASSERT( ( xRelativeDeadline & taskTICK_SIGN_BIT ) == ( TickType_t ) 0U );
+
+		pxTCB->xRelativeDeadline = xRelativeDeadline;
+		pxTCB->xPeriod = xPeriod;
+
+		/* The first job is released when the task is created. */
+		prvSetJobRelease( pxTCB, xTickCount );
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if( configUSE_TASK_BUDGETS == 1 )
 
-	void vTaskResume( TaskHandle_t xTaskToResume )
+	static void prvReplenishBudget( TCB_t * const pxTCB, const TickType_t xConstTickCount )
 	{
-	TCB_t * const pxTCB = ( TCB_t * ) xTaskToResume;
+		pxTCB->xBudgetRemaining = pxTCB->xBudget;
 
-		/* It does not make sense to resume the calling task. */
-		configASSERT( xTaskToResume );
+		/* Replenishment stays aligned to the budget period.  Periods in which
+		the task did not run are skipped. */
+		pxTCB->xBudgetReplenishTime += ( ( ( TickType_t ) ( xConstTickCount - pxTCB->xBudgetReplenishTime ) / pxTCB->xBudgetPeriod ) + ( TickType_t ) 1U ) * pxTCB->xBudgetPeriod;
+		traceTASK_BUDGET_REPLENISHED( pxTCB );
+	}
+	/*-----------------------------------------------------------*/
 
-		/* The parameter cannot be NULL as it is impossible to resume the
-		currently executing task. */
-		if( ( pxTCB != NULL ) && ( pxTCB != pxCurrentTCB ) )
+	static BaseType_t prvChargeBudget( TCB_t * const pxTCB, const TickType_t xConstTickCount )
+	{
+	BaseType_t xThrottled = pdFALSE, xMayThrottle;
+
+		if( pxTCB->xBudget != ( TickType_t ) 0U )
 		{
-			taskENTER_CRITICAL();
+			/* The budget of a task that is not throttled is only replenished
+			when the task next runs. */
+			if( taskTIME_IS_BEFORE( xConstTickCount, pxTCB->xBudgetReplenishTime ) == pdFALSE )
 			{
-				if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
-				{
-					traceTASK_RESUME( pxTCB );
+				prvReplenishBudget( pxTCB, xConstTickCount );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-					/* As we are in a critical section we can access the ready
-					lists even if the scheduler is suspended. */
-					( void ) uxListRemove(  &( pxTCB->xStateListItem ) );
-					prvAddTaskToReadyList( pxTCB );
+			if( pxTCB->xBudgetRemaining > ( TickType_t ) 0U )
+			{
+				( pxTCB->xBudgetRemaining )--;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-					/* We may have just resumed a higher priority task. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-					{
-						/* This yield may not cause the task just resumed to run,
-						but will leave the lists in the correct state for the
-						next yield. */
-						taskYIELD_IF_USING_PREEMPTION();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+			/* The task might not be in its ready list if it blocked while the
+			scheduler was suspended and the tick is being processed as the
+			scheduler is resumed. */
+			xMayThrottle = listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) );
+
+			#if( configUSE_MUTEXES == 1 )
+			{
+				/* A task that holds a mutex is allowed to overrun its budget
+				until it has released the mutex, so it cannot block higher
+				priority tasks for the rest of the period. */
+				if( pxTCB->uxMutexesHeld != ( UBaseType_t ) 0U )
+				{
+					xMayThrottle = pdFALSE;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			taskEXIT_CRITICAL();
+			#endif /* configUSE_MUTEXES */
+
+			if( ( pxTCB->xBudgetRemaining == ( TickType_t ) 0U ) && ( xMayThrottle != pdFALSE ) )
+			{
+				if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				vListInsertEnd( &xThrottledTaskList, &( pxTCB->xStateListItem ) );
+				( pxTCB->uxBudgetOverruns )++;
+				traceTASK_BUDGET_EXHAUSTED( pxTCB );
+				xThrottled = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
-	}
-
-#endif /* INCLUDE_vTaskSuspend */
-
-/*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
+		return xThrottled;
+	}
+	/*-----------------------------------------------------------*/
 
-	BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume )
+	static BaseType_t prvReplenishThrottledTasks( const TickType_t xConstTickCount )
 	{
-	BaseType_t xYieldRequired = pdFALSE;
-	TCB_t * const pxTCB = ( TCB_t * ) xTaskToResume;
-	UBaseType_t uxSavedInterruptStatus;
-
-		configASSERT( xTaskToResume );
+	ListItem_t *pxIterator;
+	TCB_t *pxTCB;
+	BaseType_t xSwitchRequired = pdFALSE;
 
-		/* RTOS ports that support interrupt nesting have the concept of a
-		maximum	system call (or maximum API call) interrupt priority.
-		Interrupts that are	above the maximum system call priority are keep
-		permanently enabled, even when the RTOS kernel is in a critical section,
-		but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-		is defined in FreeRTOSConfig.h then
-		portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-		failure if a FreeRTOS API function is called from an interrupt that has
-		been assigned a priority above the configured maximum system call
-		priority.  Only FreeRTOS functions that end in FromISR can be called
-		from interrupts	that have been assigned a priority at or (logically)
-		below the maximum system call interrupt priority.  FreeRTOS maintains a
-		separate interrupt safe API to ensure interrupt entry is as fast and as
-		simple as possible.  More information (albeit Cortex-M specific) is
-		provided on the following link:
-		http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+		pxIterator = listGET_HEAD_ENTRY( &xThrottledTaskList );
 
-		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		while( pxIterator != ( ListItem_t * ) listGET_END_MARKER( &xThrottledTaskList ) ) /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
 		{
-			if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
+			pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator );
+			pxIterator = listGET_NEXT( pxIterator );
+
+			if( taskTIME_IS_BEFORE( xConstTickCount, pxTCB->xBudgetReplenishTime ) == pdFALSE )
 			{
-				traceTASK_RESUME_FROM_ISR( pxTCB );
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+				prvReplenishBudget( pxTCB, xConstTickCount );
+				prvAddTaskToReadyList( pxTCB );
 
-				/* Check the ready lists can be accessed. */
-				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				#if( configNUMBER_OF_CORES == 1 )
 				{
-					/* Ready lists can be accessed so move the task from the
-					suspended list to the ready list directly. */
 					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
 					{
-						xYieldRequired = pdTRUE;
+						xSwitchRequired = pdTRUE;
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
-
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-					prvAddTaskToReadyList( pxTCB );
 				}
-				else
+				#else
 				{
-					/* The delayed or ready lists cannot be accessed so the task
-					is held in the pending ready list until the scheduler is
-					unsuspended. */
-					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+					prvYieldForTask( pxTCB );
 				}
+				#endif /* configNUMBER_OF_CORES */
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-		return xYieldRequired;
+		return xSwitchRequired;
 	}
 
-#endif /* ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
+#endif /* configUSE_TASK_BUDGETS */
 /*-----------------------------------------------------------*/
 
-void vTaskStartScheduler( void )
-{
-BaseType_t xReturn;
+#if( configGENERATE_RUN_TIME_STATS == 1 )
 
-	/* Add the idle task at the lowest priority. */
-	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	static RunTimeCounter_t prvGetTotalRunTime( void )
 	{
-		StaticTask_t *pxIdleTaskTCBBuffer = NULL;
-		StackType_t *pxIdleTaskStackBuffer = NULL;
-		uint32_t ulIdleTaskStackSize;
+	uint32_t ulCounterValue;
 
-		/* The Idle task is created using user provided RAM - obtain the
-		address of the RAM then create the idle task. */
-		vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
-		xIdleTaskHandle = xTaskCreateStatic(	prvIdleTask,
-												"IDLE",
-												ulIdleTaskStackSize,
-												( void * ) NULL,
-												( tskIDLE_PRIORITY | portPRIVILEGE_BIT ),
-												pxIdleTaskStackBuffer,
-												pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+			portALT_GET_RUN_TIME_COUNTER_VALUE( ulCounterValue );
+		#else
+			ulCounterValue = ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE();
+		#endif
 
-		if( xIdleTaskHandle != NULL )
-		{
-			xReturn = pdPASS;
-		}
-		else
-		{
-			xReturn = pdFAIL;
-		}
-	}
-	#else
-	{
-		/* The Idle task is being created using dynamically allocated RAM. */
-		xReturn = xTaskCreate(	prvIdleTask,
-								"IDLE", configMINIMAL_STACK_SIZE,
-								( void * ) NULL,
-								( tskIDLE_PRIORITY | portPRIVILEGE_BIT ),
-								&xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		/* The port counter is normally a free running 32-bit timer.  It is
+		extended to the width of RunTimeCounter_t by accumulating the difference
+		between successive readings, which unsigned arithmetic keeps correct
+		when the timer wraps.  The counter is read at least once a tick, so the
+		timer must not wrap more than once within a tick period. */
+		ulTotalRunTime += ( RunTimeCounter_t ) ( uint32_t ) ( ulCounterValue - ulLastRunTimeCounterValue );
+		ulLastRunTimeCounterValue = ulCounterValue;
+
+		return ulTotalRunTime;
 	}
-	#endif /* configSUPPORT_STATIC_ALLOCATION */
+	/*-----------------------------------------------------------*/
 
-	#if ( configUSE_TIMERS == 1 )
+	static void prvUpdateRunTimeCounters( const BaseType_t xCoreID )
 	{
-		if( xReturn == pdPASS )
+	RunTimeCounter_t ulNow, ulElapsed;
+
+		ulNow = prvGetTotalRunTime();
+		ulElapsed = ulNow - ulTaskSwitchedInTimes[ xCoreID ];
+		ulTaskSwitchedInTimes[ xCoreID ] = ulNow;
+
+		#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
 		{
-			xReturn = xTimerCreateTimerTask();
+			if( uxISRNesting[ xCoreID ] != ( UBaseType_t ) 0U )
+			{
+				/* Time spent in an interrupt is not billed to the task the
+				interrupt preempted. */
+				ulISRRunTime += ulElapsed;
+			}
+			else
+			{
+				taskRUN_TIME_TCB( xCoreID )->ulRunTimeCounter += ulElapsed;
+			}
 		}
-		else
+		#else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			taskRUN_TIME_TCB( xCoreID )->ulRunTimeCounter += ulElapsed;
 		}
+		#endif /* configGENERATE_ISR_RUN_TIME_STATS */
 	}
-	#endif /* configUSE_TIMERS */
 
-	if( xReturn == pdPASS )
-	{
-		/* Interrupts are turned off here, to ensure a tick does not occur
-		before or during the call to xPortStartScheduler().  The stacks of
-		the created tasks contain a status word with interrupts switched on
-		so interrupts will automatically get re-enabled when the first task
-		starts to run. */
-		portDISABLE_INTERRUPTS();
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
 
-		#if ( configUSE_NEWLIB_REENTRANT == 1 )
-		{
-			/* Switch Newlib's _impure_ptr variable to point to the _reent
-			structure specific to the task that will run first. */
-			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
-		}
-		#endif /* configUSE_NEWLIB_REENTRANT */
-
-		xNextTaskUnblockTime = portMAX_DELAY;
-		xSchedulerRunning = pdTRUE;
-		xTickCount = ( TickType_t ) 0U;
-
-		/* If configGENERATE_RUN_TIME_STATS is defined then the following
-		macro must be defined to configure the timer/counter used to generate
-		the run time counter time base. */
-		portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
+#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
 
-		/* Setting up the timer tick is hardware specific and thus in the
-		portable interface. */
-		if( xPortStartScheduler() != pdFALSE )
-		{
-			/* Should not reach here as if the scheduler is running the
-			function will not return. */
-		}
-		else
-		{
-			/* Should only reach here if a task calls xTaskEndScheduler(). */
-		}
-	}
-	else
+	void vTaskISREnter( void )
 	{
-		/* This line will only be reached if the kernel could not be started,
-		because there was not enough FreeRTOS heap to create the idle task
-		or the timer task. */
-		configASSERT( xReturn != errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY );
-	}
-
-	/* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
-	meaning xIdleTaskHandle is not used anywhere else. */
-	( void ) xIdleTaskHandle;
-}
-/*-----------------------------------------------------------*/
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xCoreID;
 
-void vTaskEndScheduler( void )
-{
-	/* Stop the scheduler interrupts and call the portable scheduler end
-	routine so the original ISRs can be restored if necessary.  The port
-	layer must ensure interrupts enable	bit is left in the correct state. */
-	portDISABLE_INTERRUPTS();
-	xSchedulerRunning = pdFALSE;
-	vPortEndScheduler();
-}
-/*----------------------------------------------------------*/
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+		{
+			#if( configNUMBER_OF_CORES == 1 )
+			{
+				xCoreID = 0;
+			}
+			#else
+			{
+				xCoreID = portGET_CORE_ID();
+			}
+			#endif
 
-void vTaskSuspendAll( void )
-{
-	/* A critical section is not required as the variable is of type
-	BaseType_t.  Please read Richard Barry's reply in the following link to a
-	post in the FreeRTOS support forum before reporting this as a bug! -
-	http://goo.gl/wu4acr */
-	++uxSchedulerSuspended;
-}
-/*----------------------------------------------------------*/
+			if( ( uxISRNesting[ xCoreID ] == ( UBaseType_t ) 0U ) && ( xSchedulerRunning != pdFALSE ) )
+			{
+				/* Charge the time used up to the interrupt to the task that
+				was interrupted. */
+				prvUpdateRunTimeCounters( xCoreID );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-#if ( configUSE_TICKLESS_IDLE != 0 )
+			( uxISRNesting[ xCoreID ] )++;
+		}
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+	}
+	/*-----------------------------------------------------------*/
 
-	static TickType_t prvGetExpectedIdleTime( void )
+	void vTaskISRExit( void )
 	{
-	TickType_t xReturn;
-	UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xCoreID;
 
-		/* uxHigherPriorityReadyTasks takes care of the case where
-		configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
-		task that are in the Ready state, even though the idle task is
-		running. */
-		#if( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
 		{
-			if( uxTopReadyPriority > tskIDLE_PRIORITY )
+			#if( configNUMBER_OF_CORES == 1 )
 			{
-				uxHigherPriorityReadyTasks = pdTRUE;
+				xCoreID = 0;
 			}
-		}
-		#else
-		{
-			const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
+			#else
+			{
+				xCoreID = portGET_CORE_ID();
+			}
+			#endif
 
-			/* When port optimised task selection is used the uxTopReadyPriority
-			variable is used as a bit map.  If bits other than the least
-			significant bit are set then there are tasks that have a priority
-			above the idle priority that are in the Ready state.  This takes
-			care of the case where the co-operative scheduler is in use. */
-			if( uxTopReadyPriority > uxLeastSignificantBit )
+			configASSERT( uxISRNesting[ xCoreID ] > ( UBaseType_t ) 0U );
+
+			if( ( uxISRNesting[ xCoreID ] == ( UBaseType_t ) 1U ) && ( xSchedulerRunning != pdFALSE ) )
 			{
-				uxHigherPriorityReadyTasks = pdTRUE;
+				/* Leaving the outermost interrupt, so charge the time used
+				since it was entered to the interrupt run time. */
+				prvUpdateRunTimeCounters( xCoreID );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
 			}
-		}
-		#endif
 
-		if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
-		{
-			xReturn = 0;
-		}
-		else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
-		{
-			/* There are other idle priority tasks in the ready state.  If
-			time slicing is used then the very next tick interrupt must be
-			processed. */
-			xReturn = 0;
-		}
-		else if( uxHigherPriorityReadyTasks != pdFALSE )
-		{
-			/* There are tasks in the Ready state that have a priority above the
-			idle priority.  This path can only be reached if
-			configUSE_PREEMPTION is 0. */
-			xReturn = 0;
+			( uxISRNesting[ xCoreID ] )--;
 		}
-		else
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+	}
+	/*-----------------------------------------------------------*/
+
+	RunTimeCounter_t ulTaskGetISRRunTimeCounter( void )
+	{
+	RunTimeCounter_t ulReturn;
+
+		/* The counter can be wider than the native word size, so it is read
+		inside a critical section. */
+		taskENTER_CRITICAL();
 		{
-			xReturn = xNextTaskUnblockTime - xTickCount;
+			ulReturn = ulISRRunTime;
 		}
+		taskEXIT_CRITICAL();
 
-		return xReturn;
+		return ulReturn;
 	}
 
-#endif /* configUSE_TICKLESS_IDLE */
-/*----------------------------------------------------------*/
-
-BaseType_t xTaskResumeAll( void )
-{
-TCB_t *pxTCB = NULL;
-BaseType_t xAlreadyYielded = pdFALSE;
+#endif /* configGENERATE_ISR_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
 
-	/* If uxSchedulerSuspended is zero then this function does not match a
-	previous call to vTaskSuspendAll(). */
-	configASSERT( uxSchedulerSuspended );
+#if ( INCLUDE_vTaskDelete == 1 )
 
-	/* It is possible that an ISR caused a task to be removed from an event
-	list while the scheduler was suspended.  If this was the case then the
-	removed task will have been added to the xPendingReadyList.  Once the
-	scheduler has been resumed it is safe to move all the pending ready
-	tasks from this list into their appropriate ready list. */
-	taskENTER_CRITICAL();
+	void vTaskDelete( TaskHandle_t xTaskToDelete )
 	{
-		--uxSchedulerSuspended;
+	TCB_t *pxTCB;
 
-		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+		taskENTER_CRITICAL();
 		{
-			if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
-			{
-				/* Move any readied tasks from the pending list into the
-				appropriate ready list. */
-				while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
-				{
-					pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) );
-					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-					prvAddTaskToReadyList( pxTCB );
-
-					/* If the moved task has a priority higher than the current
-					task then a yield must be performed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-					{
-						xYieldPending = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-
-				if( pxTCB != NULL )
-				{
-					/* A task was unblocked while the scheduler was suspended,
-					which may have prevented the next unblock time from being
-					re-calculated, in which case re-calculate it now.  Mainly
-					important for low power tickless implementations, where
-					this can prevent an unnecessary exit from low power
-					state. */
-					prvResetNextTaskUnblockTime();
-				}
-
-				/* If any ticks occurred while the scheduler was suspended then
-				they should be processed now.  This ensures the tick count does
-				not	slip, and that any delayed tasks are resumed at the correct
-				time. */
-				{
-					UBaseType_t uxPendedCounts = uxPendedTicks; /* Non-volatile copy. */
+			/* If null is passed in here then it is the calling task that is
+			being deleted. */
+			pxTCB = prvGetTCBFromHandle( xTaskToDelete );
 
-					if( uxPendedCounts > ( UBaseType_t ) 0U )
-					{
-						do
-						{
-							if( xTaskIncrementTick() != pdFALSE )
-							{
-								xYieldPending = pdTRUE;
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-							--uxPendedCounts;
-						} while( uxPendedCounts > ( UBaseType_t ) 0U );
+			/* Remove task from the ready list. */
+			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-						uxPendedTicks = 0;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
+			/* Is the task waiting on an event also? */
+			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+			{
+				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-				if( xYieldPending != pdFALSE )
+			#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+			{
+				/* A task deleted while blocked in xWaitForMultipleObjects()
+				has wait records in the event lists of the objects it was
+				waiting for.  The records are on the task's stack, so must be
+				removed before the stack is freed. */
+				if( pxTCB->pvWaitObjects != NULL )
 				{
-					#if( configUSE_PREEMPTION != 0 )
-					{
-						xAlreadyYielded = pdTRUE;
-					}
-					#endif
-					taskYIELD_IF_USING_PREEMPTION();
+					vMultipleObjectWaitRemoveRecords( ( WaitObject_t * ) pxTCB->pvWaitObjects, pxTCB->uxWaitObjectCount );
+					pxTCB->pvWaitObjects = NULL;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-	}
-	taskEXIT_CRITICAL();
-
-	return xAlreadyYielded;
-}
-/*-----------------------------------------------------------*/
+			#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
 
-TickType_t xTaskGetTickCount( void )
-{
-TickType_t xTicks;
-
-	/* Critical section required if running on a 16 bit processor. */
-	portTICK_TYPE_ENTER_CRITICAL();
-	{
-		xTicks = xTickCount;
-	}
-	portTICK_TYPE_EXIT_CRITICAL();
-
-	return xTicks;
-}
-/*-----------------------------------------------------------*/
-
-TickType_t xTaskGetTickCountFromISR( void )
-{
-TickType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
-
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
-
-	uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
-	{
-		xReturn = xTickCount;
-	}
-	portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
-
-UBaseType_t uxTaskGetNumberOfTasks( void )
-{
-	/* A critical section is not required because the variables are of type
-	BaseType_t. */
-	return uxCurrentNumberOfTasks;
-}
-/*-----------------------------------------------------------*/
-
-char *pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-TCB_t *pxTCB;
-
-	/* If null is passed in here then the name of the calling task is being
-	queried. */
-	pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-	configASSERT( pxTCB );
-	return &( pxTCB->pcTaskName[ 0 ] );
-}
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_xTaskGetHandle == 1 )
-
-	static TCB_t *prvSearchForNameWithinSingleList( List_t *pxList, const char pcNameToQuery[] )
-	{
-	TCB_t *pxNextTCB, *pxFirstTCB, *pxReturn = NULL;
-	UBaseType_t x;
-	char cNextChar;
-
-		/* This function is called with the scheduler suspended. */
+			/* Increment the uxTaskNumber also so kernel aware debuggers can
+			detect that the task lists need re-generating.  This is done before
+			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
+			not return. */
+			uxTaskNumber++;
 
-		if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
-		{
-			listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList );
+			#if( configUSE_TASK_SNAPSHOTS == 1 )
+			{
+				( void ) uxListRemove( &( pxTCB->xAllTasksListItem ) );
+			}
+			#endif /* configUSE_TASK_SNAPSHOTS */
 
-			do
+			#if( configNUMBER_OF_CORES == 1 )
+			if( pxTCB == pxCurrentTCB )
+			#else
+			if( taskTASK_IS_RUNNING( pxTCB ) )
+			#endif
 			{
-				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList );
+				/* A task is deleting itself.  This cannot complete within the
+				task itself, as a context switch to another task is required.
+				Place the task in the termination list.  The idle task will
+				check the termination list and free up any memory allocated by
+				the scheduler for the TCB and stack of the deleted task. */
+				vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
 
-				/* Check each character in the name looking for a match or
-				mismatch. */
-				for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
-				{
-					cNextChar = pxNextTCB->pcTaskName[ x ];
+				/* Increment the ucTasksDeleted variable so the idle task knows
+				there is a task that has been deleted and that it should therefore
+				check the xTasksWaitingTermination list. */
+				++uxDeletedTasksWaitingCleanUp;
 
-					if( cNextChar != pcNameToQuery[ x ] )
-					{
-						/* Characters didn't match. */
-						break;
-					}
-					else if( cNextChar == 0x00 )
+				/* The pre-delete hook is primarily for the Windows simulator,
+				in which Windows specific clean up operations are performed,
+				after which it is not possible to yield away from this task -
+				hence xYieldPending is used to latch that a context switch is
+				required. */
+				#if( configNUMBER_OF_CORES == 1 )
+				{
+					portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+				}
+				#else
+				{
+					/* A task running on another core is switched out by that
+					core.  The idle task does not free the TCB until the task
+					is no longer running. */
+					if( pxTCB->xTaskRunState == portGET_CORE_ID() )
 					{
-						/* Both strings terminated, a match must have been
-						found. */
-						pxReturn = pxNextTCB;
-						break;
+						portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
 					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
+						prvYieldCore( pxTCB->xTaskRunState );
 					}
 				}
+				#endif /* configNUMBER_OF_CORES */
+			}
+			else
+			{
+				--uxCurrentNumberOfTasks;
+				prvDeleteTCB( pxTCB );
 
-				if( pxReturn != NULL )
-				{
-					/* The handle has been found. */
-					break;
-				}
+				/* Reset the next expected unblock time in case it referred to
+				the task that has just been deleted. */
+				prvResetNextTaskUnblockTime();
+			}
 
-			} while( pxNextTCB != pxFirstTCB );
+			traceTASK_DELETE( pxTCB );
 		}
-		else
+		taskEXIT_CRITICAL();
+
+		/* Force a reschedule if it is the currently running task that has just
+		been deleted. */
+		if( xSchedulerRunning != pdFALSE )
 		{
-			mtCOVERAGE_TEST_MARKER();
+			if( pxTCB == pxCurrentTCB )
+			{
+				configASSERT( taskSCHEDULER_SUSPENDED_BY_CALLER() == pdFALSE );
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-
-		return pxReturn;
 	}
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( INCLUDE_vTaskDelayUntil == 1 )
 
-	TaskHandle_t xTaskGetHandle( const char *pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement )
 	{
-	UBaseType_t uxQueue = configMAX_PRIORITIES;
-	TCB_t* pxTCB;
+	TickType_t xTimeToWake;
+	BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
 
-		/* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
-		configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+		configASSERT( pxPreviousWakeTime );
+		configASSERT( ( xTimeIncrement > 0U ) );
+		configASSERT( taskSCHEDULER_SUSPENDED_BY_CALLER() == pdFALSE );
 
 		vTaskSuspendAll();
 		{
-			/* Search the ready lists. */
-			do
-			{
-				uxQueue--;
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+			/* Minor optimisation.  The tick count cannot change in this
+			block. */
+			const TickType_t xConstTickCount = xTickCount;
 
-				if( pxTCB != NULL )
+			/* Generate the tick time at which the task wants to wake. */
+			xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+
+			if( xConstTickCount < *pxPreviousWakeTime )
+			{
+				/* The tick count has overflowed since this function was
+				lasted called.  In this case the only time we should ever
+				actually delay is if the wake time has also	overflowed,
+				and the wake time is greater than the tick time.  When this
+				is the case it is as if neither time had overflowed. */
+				if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
 				{
-					/* Found the handle. */
-					break;
+					xShouldDelay = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* The tick time has not overflowed.  In this case we will
+				delay if either the wake time has overflowed, and/or the
+				tick time is less than the wake time. */
+				if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+				{
+					xShouldDelay = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
 				}
+			}
 
-			} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			/* Update the wake time ready for the next call. */
+			*pxPreviousWakeTime = xTimeToWake;
 
-			/* Search the delayed lists. */
-			if( pxTCB == NULL )
+			if( xShouldDelay != pdFALSE )
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-			}
+				traceTASK_DELAY_UNTIL( xTimeToWake );
 
-			if( pxTCB == NULL )
+				/* prvAddCurrentTaskToDelayedList() needs the block time, not
+				the time to wake, so subtract the current tick count. */
+				prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
+			}
+			else
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				mtCOVERAGE_TEST_MARKER();
 			}
 
-			#if ( INCLUDE_vTaskSuspend == 1 )
+			#if( configUSE_EDF_SCHEDULING == 1 )
 			{
-				if( pxTCB == NULL )
+				/* The next job of a deadline task is released at the wake
+				time, so its deadline moves on by one period.  If the task did
+				not block it is moved to its new place in the ready list. */
+				if( pxCurrentTCB->xRelativeDeadline != ( TickType_t ) 0U )
 				{
-					/* Search the suspended list. */
-					pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+					prvSetJobRelease( pxCurrentTCB, xTimeToWake );
 				}
-			}
-			#endif
-
-			#if( INCLUDE_vTaskDelete == 1 )
-			{
-				if( pxTCB == NULL )
+				else
 				{
-					/* Search the deleted list. */
-					pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			#endif
+			#endif /* configUSE_EDF_SCHEDULING */
 		}
-		( void ) xTaskResumeAll();
+		xAlreadyYielded = xTaskResumeAll();
 
-		return ( TaskHandle_t ) pxTCB;
+		/* Force a reschedule if xTaskResumeAll has not already done so, we may
+		have put ourselves to sleep. */
+		if( xAlreadyYielded == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* INCLUDE_vTaskDelayUntil */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( INCLUDE_vTaskDelay == 1 )
 
-	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
+	void vTaskDelay( const TickType_t xTicksToDelay )
 	{
-	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+	BaseType_t xAlreadyYielded = pdFALSE;
 
-		vTaskSuspendAll();
+		/* A delay time of zero just forces a reschedule. */
+		if( xTicksToDelay > ( TickType_t ) 0U )
 		{
-			/* Is there a space in the array for each task in the system? */
-			if( uxArraySize >= uxCurrentNumberOfTasks )
+			configASSERT( taskSCHEDULER_SUSPENDED_BY_CALLER() == pdFALSE );
+			vTaskSuspendAll();
 			{
-				/* Fill in an TaskStatus_t structure with information on each
-				task in the Ready state. */
-				do
-				{
-					uxQueue--;
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
-
-				} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-
-				/* Fill in an TaskStatus_t structure with information on each
-				task in the Blocked state. */
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
-
-				#if( INCLUDE_vTaskDelete == 1 )
-				{
-					/* Fill in an TaskStatus_t structure with information on
-					each task that has been deleted but not yet cleaned up. */
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
-				}
-				#endif
+				traceTASK_DELAY();
 
-				#if ( INCLUDE_vTaskSuspend == 1 )
-				{
-					/* Fill in an TaskStatus_t structure with information on
-					each task in the Suspended state. */
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
-				}
-				#endif
+				/* A task that is removed from the event list while the
+				scheduler is suspended will not get placed in the ready
+				list or removed from the blocked list until the scheduler
+				is resumed.
 
-				#if ( configGENERATE_RUN_TIME_STATS == 1)
-				{
-					if( pulTotalRunTime != NULL )
-					{
-						#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-							portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
-						#else
-							*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-						#endif
-					}
-				}
-				#else
-				{
-					if( pulTotalRunTime != NULL )
-					{
-						*pulTotalRunTime = 0;
-					}
-				}
-				#endif
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
+				This task cannot be in an event list as it is the currently
+				executing task. */
+				prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
 			}
+			xAlreadyYielded = xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		( void ) xTaskResumeAll();
-
-		return uxTask;
-	}
-
-#endif /* configUSE_TRACE_FACILITY */
-/*----------------------------------------------------------*/
-
-#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
-
-	TaskHandle_t xTaskGetIdleTaskHandle( void )
-	{
-		/* If xTaskGetIdleTaskHandle() is called before the scheduler has been
-		started, then xIdleTaskHandle will be NULL. */
-		configASSERT( ( xIdleTaskHandle != NULL ) );
-		return xIdleTaskHandle;
-	}
-
-#endif /* INCLUDE_xTaskGetIdleTaskHandle */
-/*----------------------------------------------------------*/
-
-/* This conditional compilation should use inequality to 0, not equality to 1.
-This is to ensure vTaskStepTick() is available when user defined low power mode
-implementations require configUSE_TICKLESS_IDLE to be set to a value other than
-1. */
-#if ( configUSE_TICKLESS_IDLE != 0 )
 
-	void vTaskStepTick( const TickType_t xTicksToJump )
-	{
-		/* Correct the tick count value after a period during which the tick
-		was suppressed.  Note this does *not* call the tick hook function for
-		each stepped tick. */
-		configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
-		xTickCount += xTicksToJump;
-		traceINCREASE_TICK_COUNT( xTicksToJump );
+		/* Force a reschedule if xTaskResumeAll has not already done so, we may
+		have put ourselves to sleep. */
+		if( xAlreadyYielded == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
 
-#endif /* configUSE_TICKLESS_IDLE */
-/*----------------------------------------------------------*/
+#endif /* INCLUDE_vTaskDelay */
+/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskAbortDelay == 1 )
+#if( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) )
 
-	BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+	eTaskState eTaskGetState( TaskHandle_t xTask )
 	{
-	TCB_t *pxTCB = ( TCB_t * ) xTask;
-	BaseType_t xReturn = pdFALSE;
+	eTaskState eReturn;
+	List_t *pxStateList;
+	const TCB_t * const pxTCB = ( TCB_t * ) xTask;
 
 		configASSERT( pxTCB );
 
-		vTaskSuspendAll();
+		#if( configNUMBER_OF_CORES == 1 )
+		if( pxTCB == pxCurrentTCB )
+		#else
+		if( taskTASK_IS_RUNNING( pxTCB ) )
+		#endif
 		{
-			/* A task can only be prematurely removed from the Blocked state if
-			it is actually in the Blocked state. */
-			if( eTaskGetState( xTask ) == eBlocked )
+			/* The task calling this function is querying its own state, or the
+			task is running on another core. */
+			eReturn = eRunning;
+		}
+		else
+		{
+			taskENTER_CRITICAL();
 			{
-				/* Remove the reference to the task from the blocked list.  An
-				interrupt won't touch the xStateListItem because the
-				scheduler is suspended. */
-				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+				pxStateList = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
+			}
+			taskEXIT_CRITICAL();
 
-				/* Is the task waiting on an event also?  If so remove it from
-				the event list too.  Interrupts can touch the event list item,
-				even though the scheduler is suspended, so a critical section
-				is used. */
-				taskENTER_CRITICAL();
+			if( taskLIST_IS_DELAYED_LIST( pxStateList ) )
+			{
+				/* The task being queried is referenced from one of the Blocked
+				lists. */
+				eReturn = eBlocked;
+			}
+
+			#if ( INCLUDE_vTaskSuspend == 1 )
+				else if( pxStateList == &xSuspendedTaskList )
 				{
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+					/* The task being queried is referenced from the suspended
+					list.  Is it genuinely suspended or is it block
+					indefinitely? */
+					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
 					{
-						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-						pxTCB->ucDelayAborted = pdTRUE;
+						eReturn = eSuspended;
 					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
+						eReturn = eBlocked;
 					}
 				}
-				taskEXIT_CRITICAL();
+			#endif
 
-				/* Place the unblocked task into the appropriate ready list. */
-				prvAddTaskToReadyList( pxTCB );
+			#if( configUSE_TASK_BUDGETS == 1 )
+				else if( pxStateList == &xThrottledTaskList )
+				{
+					/* The task is waiting for its budget to be replenished. */
+					eReturn = eBlocked;
+				}
+			#endif
 
-				/* A task being unblocked cannot cause an immediate context
-				switch if preemption is turned off. */
-				#if (  configUSE_PREEMPTION == 1 )
+			#if ( INCLUDE_vTaskDelete == 1 )
+				else if( ( pxStateList == &xTasksWaitingTermination ) || ( pxStateList == NULL ) )
 				{
-					/* Preemption is on, but a context switch should only be
-					performed if the unblocked task has a priority that is
-					equal to or higher than the currently executing task. */
-					if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-					{
-						/* Pend the yield to be performed when the scheduler
-						is unsuspended. */
-						xYieldPending = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					/* The task being queried is referenced from the deleted
+					tasks list, or it is not referenced from any lists at
+					all. */
+					eReturn = eDeleted;
 				}
-				#endif /* configUSE_PREEMPTION */
-			}
-			else
+			#endif
+
+			else /*lint !e525 Negative indentation is intended to make use of pre-processor clearer. */
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* If the task is not in any other state, it must be in the
+				Ready (including pending ready) state. */
+				eReturn = eReady;
 			}
 		}
-		xTaskResumeAll();
 
-		return xReturn;
-	}
+		return eReturn;
+	} /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
 
-#endif /* INCLUDE_xTaskAbortDelay */
-/*----------------------------------------------------------*/
+#endif /* INCLUDE_eTaskGetState */
+/*-----------------------------------------------------------*/
 
-BaseType_t xTaskIncrementTick( void )
-{
-TCB_t * pxTCB;
-TickType_t xItemValue;
-BaseType_t xSwitchRequired = pdFALSE;
+#if ( INCLUDE_uxTaskPriorityGet == 1 )
 
-	/* Called by the portable layer each time a tick interrupt occurs.
-	Increments the tick then checks to see if the new tick value will cause any
-	tasks to be unblocked. */
-	traceTASK_INCREMENT_TICK( xTickCount );
-	if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+	UBaseType_t uxTaskPriorityGet( TaskHandle_t xTask )
 	{
-		/* Minor optimisation.  The tick count cannot change in this
-		block. */
-		const TickType_t xConstTickCount = xTickCount + 1;
-
-		/* Increment the RTOS tick, switching the delayed and overflowed
-		delayed lists if it wraps to 0. */
-		xTickCount = xConstTickCount;
+	TCB_t *pxTCB;
+	UBaseType_t uxReturn;
 
-		if( xConstTickCount == ( TickType_t ) 0U )
-		{
-			taskSWITCH_DELAYED_LISTS();
-		}
-		else
+		taskENTER_CRITICAL();
 		{
-			mtCOVERAGE_TEST_MARKER();
+			/* If null is passed in here then it is the priority of the that
+			called uxTaskPriorityGet() that is being queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = pxTCB->uxPriority;
 		}
+		taskEXIT_CRITICAL();
 
-		/* See if this tick has made a timeout expire.  Tasks are stored in
-		the	queue in the order of their wake time - meaning once one task
-		has been found whose block time has not expired there is no need to
-		look any further down the list. */
-		if( xConstTickCount >= xNextTaskUnblockTime )
-		{
-			for( ;; )
-			{
-				if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-				{
-					/* The delayed list is empty.  Set xNextTaskUnblockTime
-					to the maximum possible value so it is extremely
-					unlikely that the
-					if( xTickCount >= xNextTaskUnblockTime ) test will pass
-					next time through. */
-					xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					break;
-				}
-				else
-				{
-					/* The delayed list is not empty, get the value of the
-					item at the head of the delayed list.  This is the time
-					at which the task at the head of the delayed list must
-					be removed from the Blocked state. */
-					pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
-					xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+		return uxReturn;
+	}
 
-					if( xConstTickCount < xItemValue )
-					{
-						/* It is not time to unblock this item yet, but the
-						item value is the time at which the task at the head
-						of the blocked list must be removed from the Blocked
-						state -	so record the item value in
-						xNextTaskUnblockTime. */
-						xNextTaskUnblockTime = xItemValue;
-						break;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+#endif /* INCLUDE_uxTaskPriorityGet */
+/*-----------------------------------------------------------*/
 
-					/* It is time to remove the item from the Blocked state. */
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+#if ( INCLUDE_uxTaskPriorityGet == 1 )
 
-					/* Is the task waiting on an event also?  If so remove
-					it from the event list. */
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+	UBaseType_t uxTaskPriorityGetFromISR( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxReturn, uxSavedInterruptState;
+
+		/* RTOS ports that support interrupt nesting have the concept of a
+		maximum	system call (or maximum API call) interrupt priority.
+		Interrupts that are	above the maximum system call priority are keep
+		permanently enabled, even when the RTOS kernel is in a critical section,
+		but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+		is defined in FreeRTOSConfig.h then
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+		failure if a FreeRTOS API function is called from an interrupt that has
+		been assigned a priority above the configured maximum system call
+		priority.  Only FreeRTOS functions that end in FromISR can be called
+		from interrupts	that have been assigned a priority at or (logically)
+		below the maximum system call interrupt priority.  FreeRTOS maintains a
+		separate interrupt safe API to ensure interrupt entry is as fast and as
+		simple as possible.  More information (albeit Cortex-M specific) is
+		provided on the following link:
+		http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptState = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			/* If null is passed in here then it is the priority of the calling
+			task that is being queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = pxTCB->uxPriority;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptState );
+
+		return uxReturn;
+	}
+
+#endif /* INCLUDE_uxTaskPriorityGet */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskPrioritySet == 1 )
+
+	void vTaskPrioritySet( TaskHandle_t xTask, UBaseType_t uxNewPriority )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
+	BaseType_t xYieldRequired = pdFALSE;
+
+		configASSERT( ( uxNewPriority < configMAX_PRIORITIES ) );
+
+		/* Ensure the new priority is valid. */
+		if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+		{
+			uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the priority of the calling
+			task that is being changed. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+
+			#if ( configUSE_MUTEXES == 1 )
+			{
+				uxCurrentBasePriority = pxTCB->uxBasePriority;
+			}
+			#else
+			{
+				uxCurrentBasePriority = pxTCB->uxPriority;
+			}
+			#endif
+
+			if( uxCurrentBasePriority != uxNewPriority )
+			{
+				#if( configNUMBER_OF_CORES == 1 )
+				{
+					/* The priority change may have readied a task of higher
+					priority than the calling task. */
+					if( uxNewPriority > uxCurrentBasePriority )
 					{
-						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+						if( pxTCB != pxCurrentTCB )
+						{
+							/* The priority of a task other than the currently
+							running task is being raised.  Is the priority being
+							raised above that of the running task? */
+							if( uxNewPriority >= pxCurrentTCB->uxPriority )
+							{
+								xYieldRequired = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							/* The priority of the running task is being raised,
+							but the running task must already be the highest
+							priority task able to run so no yield is required. */
+						}
+					}
+					else if( pxTCB == pxCurrentTCB )
+					{
+						/* Setting the priority of the running task down means
+						there may now be another task of higher priority that
+						is ready to execute. */
+						xYieldRequired = pdTRUE;
+					}
+					else
+					{
+						/* Setting the priority of any other task down does not
+						require a yield as the running task must be above the
+						new priority of the task being modified. */
+					}
+				}
+				#else
+				{
+					/* Setting the priority of a running task down means there
+					may now be a task of higher priority that is able to run on
+					its core.  Raising the priority of a task that is not running
+					is handled once the task is in its new ready list. */
+					if( ( uxNewPriority < uxCurrentBasePriority ) && ( taskTASK_IS_RUNNING( pxTCB ) ) )
+					{
+						xYieldRequired = pdTRUE;
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
+				}
+				#endif /* configNUMBER_OF_CORES */
 
-					/* Place the unblocked task into the appropriate ready
-					list. */
+				/* Remember the ready list the task might be referenced from
+				before its uxPriority member is changed so the
+				taskRESET_READY_PRIORITY() macro can function correctly. */
+				uxPriorityUsedOnEntry = pxTCB->uxPriority;
+
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					/* Only change the priority being used if the task is not
+					currently using an inherited priority. */
+					if( pxTCB->uxBasePriority == pxTCB->uxPriority )
+					{
+						pxTCB->uxPriority = uxNewPriority;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* The base priority gets set whatever. */
+					pxTCB->uxBasePriority = uxNewPriority;
+				}
+				#else
+				{
+					pxTCB->uxPriority = uxNewPriority;
+				}
+				#endif
+
+				/* Only reset the event list item value if the value is not
+				being used for anything else. */
+				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+				{
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+					#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+					{
+						prvReorderMultipleObjectWaitRecords( pxTCB );
+					}
+					#endif
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* If the task is in the blocked or suspended list we need do
+				nothing more than change it's priority variable. However, if
+				the task is in a ready list it needs to be removed and placed
+				in the list appropriate to its new priority. */
+				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+				{
+					/* The task is currently in its ready list - remove before adding
+					it to it's new ready list.  As we are in a critical section we
+					can do this even if the scheduler is suspended. */
+					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+					{
+						/* It is known that the task is in its ready list so
+						there is no need to check again and the port level
+						reset macro can be called directly. */
+						portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-					/* A task being unblocked cannot cause an immediate
-					context switch if preemption is turned off. */
-					#if (  configUSE_PREEMPTION == 1 )
+				#if( configNUMBER_OF_CORES == 1 )
+				{
+					if( xYieldRequired != pdFALSE )
 					{
-						/* Preemption is on, but a context switch should
-						only be performed if the unblocked task has a
-						priority that is equal to or higher than the
-						currently executing task. */
-						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-						{
-							xSwitchRequired = pdTRUE;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#elif( configUSE_PREEMPTION == 1 )
+				{
+					if( xYieldRequired != pdFALSE )
+					{
+						prvYieldCore( pxTCB->xTaskRunState );
+					}
+					else if( ( uxNewPriority > uxCurrentBasePriority ) && ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+					{
+						prvYieldForTask( pxTCB );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
 					}
-					#endif /* configUSE_PREEMPTION */
 				}
+				#endif /* configNUMBER_OF_CORES */
+
+				/* Remove compiler warning about unused variables when the port
+				optimised task selection is not being used, or when the SMP
+				scheduler is cooperative. */
+				( void ) uxPriorityUsedOnEntry;
+				( void ) xYieldRequired;
 			}
 		}
+		taskEXIT_CRITICAL();
+	}
 
-		/* Tasks of equal priority to the currently running task will share
-		processing time (time slice) if preemption is on, and the application
-		writer has not explicitly turned time slicing off. */
-		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+#endif /* INCLUDE_vTaskPrioritySet */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+	void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+	{
+	TCB_t *pxTCB;
+
+		taskENTER_CRITICAL();
 		{
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+			/* If null is passed in here then it is the running task that is
+			being suspended. */
+			pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+
+			traceTASK_SUSPEND( pxTCB );
+
+			/* Remove task from the ready/delayed list and place in the
+			suspended list. */
+			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
 			{
-				xSwitchRequired = pdTRUE;
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-		}
-		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
-		#if ( configUSE_TICK_HOOK == 1 )
-		{
-			/* Guard against the tick hook being called when the pended tick
-			count is being unwound (when the scheduler is being unlocked). */
-			if( uxPendedTicks == ( UBaseType_t ) 0U )
+			/* Is the task waiting on an event also? */
+			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
 			{
-				vApplicationTickHook();
+				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+
+			vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+
+			#if( configUSE_WAKE_LATENCY_STATS == 1 )
+			{
+				/* The time the task spends suspended is not wake latency. */
+				pxTCB->xWakeTimestampValid = pdFALSE;
+			}
+			#endif
+
+			#if( configNUMBER_OF_CORES > 1 )
+			{
+				/* A task that is suspended while it is running on another core
+				must be switched out by that core. */
+				if( ( xSchedulerRunning != pdFALSE ) && ( taskTASK_IS_RUNNING( pxTCB ) ) && ( pxTCB->xTaskRunState != portGET_CORE_ID() ) )
+				{
+					prvYieldCore( pxTCB->xTaskRunState );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configNUMBER_OF_CORES */
 		}
-		#endif /* configUSE_TICK_HOOK */
+		taskEXIT_CRITICAL();
+
+		if( xSchedulerRunning != pdFALSE )
+		{
+			/* Reset the next expected unblock time in case it referred to the
+			task that is now in the Suspended state. */
+			taskENTER_CRITICAL();
+			{
+				prvResetNextTaskUnblockTime();
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( pxTCB == pxCurrentTCB )
+		{
+			if( xSchedulerRunning != pdFALSE )
+			{
+				/* The current task has just been suspended. */
+				configASSERT( taskSCHEDULER_SUSPENDED_BY_CALLER() == pdFALSE );
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				#if( configNUMBER_OF_CORES == 1 )
+				{
+					/* The scheduler is not running, but the task that was pointed
+					to by pxCurrentTCB has just been suspended and pxCurrentTCB
+					must be adjusted to point to a different task. */
+					if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks )
+					{
+						/* No other tasks are ready, so set pxCurrentTCB back to
+						NULL so when the next task is created pxCurrentTCB will
+						be set to point to it no matter what its relative priority
+						is. */
+						pxCurrentTCB = NULL;
+					}
+					else
+					{
+						vTaskSwitchContext();
+					}
+				}
+				#else
+				{
+					/* No task is current on any core before the scheduler is
+					started, so this path is not reachable. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+				#endif /* configNUMBER_OF_CORES */
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* INCLUDE_vTaskSuspend */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+	static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask )
+	{
+	BaseType_t xReturn = pdFALSE;
+	const TCB_t * const pxTCB = ( TCB_t * ) xTask;
+
+		/* Accesses xPendingReadyList so must be called from a critical
+		section. */
+
+		/* It does not make sense to check if the calling task is suspended. */
+		configASSERT( xTask );
+
+		/* Is the task being resumed actually in the suspended list? */
+		if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
+		{
+			/* Has the task already been resumed from within an ISR? */
+			if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
+			{
+				/* Is it in the suspended list because it is in the	Suspended
+				state, or because is is blocked with no timeout? */
+				if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	} /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+
+#endif /* INCLUDE_vTaskSuspend */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+	void vTaskResume( TaskHandle_t xTaskToResume )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) xTaskToResume;
+
+		/* It does not make sense to resume the calling task. */
+		configASSERT( xTaskToResume );
+
+		/* The parameter cannot be NULL as it is impossible to resume the
+		currently executing task. */
+		if( ( pxTCB != NULL ) && ( pxTCB != pxCurrentTCB ) )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
+				{
+					traceTASK_RESUME( pxTCB );
+
+					/* As we are in a critical section we can access the ready
+					lists even if the scheduler is suspended. */
+					( void ) uxListRemove(  &( pxTCB->xStateListItem ) );
+					prvAddTaskToReadyList( pxTCB );
+
+					/* We may have just resumed a higher priority task. */
+					#if( configNUMBER_OF_CORES == 1 )
+					{
+						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+						{
+							/* This yield may not cause the task just resumed to run,
+							but will leave the lists in the correct state for the
+							next yield. */
+							taskYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#else
+					{
+						prvYieldForTask( pxTCB );
+					}
+					#endif /* configNUMBER_OF_CORES */
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* INCLUDE_vTaskSuspend */
+
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
+
+	BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume )
+	{
+	BaseType_t xYieldRequired = pdFALSE;
+	TCB_t * const pxTCB = ( TCB_t * ) xTaskToResume;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( xTaskToResume );
+
+		/* RTOS ports that support interrupt nesting have the concept of a
+		maximum	system call (or maximum API call) interrupt priority.
+		Interrupts that are	above the maximum system call priority are keep
+		permanently enabled, even when the RTOS kernel is in a critical section,
+		but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+		is defined in FreeRTOSConfig.h then
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+		failure if a FreeRTOS API function is called from an interrupt that has
+		been assigned a priority above the configured maximum system call
+		priority.  Only FreeRTOS functions that end in FromISR can be called
+		from interrupts	that have been assigned a priority at or (logically)
+		below the maximum system call interrupt priority.  FreeRTOS maintains a
+		separate interrupt safe API to ensure interrupt entry is as fast and as
+		simple as possible.  More information (albeit Cortex-M specific) is
+		provided on the following link:
+		http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
+			{
+				traceTASK_RESUME_FROM_ISR( pxTCB );
+				taskSTAMP_WAKE_FROM_ISR( pxTCB );
+
+				/* Check the ready lists can be accessed. */
+				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				{
+					/* Ready lists can be accessed so move the task from the
+					suspended list to the ready list directly. */
+					#if( configNUMBER_OF_CORES == 1 )
+					{
+						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+						{
+							xYieldRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configNUMBER_OF_CORES */
+
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					prvAddTaskToReadyList( pxTCB );
+
+					#if( configNUMBER_OF_CORES > 1 )
+					{
+						/* Only a yield of the interrupted core is returned,
+						other cores are interrupted directly. */
+						prvYieldForTask( pxTCB );
+						xYieldRequired = xYieldPending;
+					}
+					#endif /* configNUMBER_OF_CORES */
+				}
+				else
+				{
+					/* The delayed or ready lists cannot be accessed so the task
+					is held in the pending ready list until the scheduler is
+					unsuspended. */
+					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xYieldRequired;
+	}
+
+#endif /* ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+void vTaskStartScheduler( void )
+{
+BaseType_t xReturn;
+#if( configNUMBER_OF_CORES > 1 )
+	BaseType_t xCoreID;
+#endif
+
+	/* Add the idle task at the lowest priority. */
+	#if( configNUMBER_OF_CORES == 1 )
+	{
+		#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		{
+			StaticTask_t *pxIdleTaskTCBBuffer = NULL;
+			StackType_t *pxIdleTaskStackBuffer = NULL;
+			uint32_t ulIdleTaskStackSize;
+
+			/* The Idle task is created using user provided RAM - obtain the
+			address of the RAM then create the idle task. */
+			vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+			xIdleTaskHandle = xTaskCreateStatic(	prvIdleTask,
+													"IDLE",
+													ulIdleTaskStackSize,
+													( void * ) NULL,
+													( tskIDLE_PRIORITY | portPRIVILEGE_BIT ),
+													pxIdleTaskStackBuffer,
+													pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+			if( xIdleTaskHandle != NULL )
+			{
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+		}
+		#else
+		{
+			/* The Idle task is being created using dynamically allocated RAM. */
+			xReturn = xTaskCreate(	prvIdleTask,
+									"IDLE", configMINIMAL_STACK_SIZE,
+									( void * ) NULL,
+									( tskIDLE_PRIORITY | portPRIVILEGE_BIT ),
+									&xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		}
+		#endif /* configSUPPORT_STATIC_ALLOCATION */
+	}
+	#else
+	{
+	char cIdleName[ 8 ] = "IDLE";
+
+		/* An idle task is created for each core and bound to that core, so
+		every core always has a task it is able to run.  The idle tasks are
+		named IDLE0, IDLE1, etc. */
+		xReturn = pdPASS;
+
+		for( xCoreID = 0; ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) && ( xReturn == pdPASS ); xCoreID++ )
+		{
+			if( xCoreID < 10 )
+			{
+				cIdleName[ 4 ] = ( char ) ( '0' + xCoreID );
+				cIdleName[ 5 ] = ( char ) 0x00;
+			}
+			else
+			{
+				cIdleName[ 4 ] = ( char ) ( '0' + ( xCoreID / 10 ) );
+				cIdleName[ 5 ] = ( char ) ( '0' + ( xCoreID % 10 ) );
+				cIdleName[ 6 ] = ( char ) 0x00;
+			}
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				StaticTask_t *pxIdleTaskTCBBuffer = NULL;
+				StackType_t *pxIdleTaskStackBuffer = NULL;
+				uint32_t ulIdleTaskStackSize;
+
+				if( xCoreID == 0 )
+				{
+					vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+				}
+				else
+				{
+					vApplicationGetIdleTaskMemoryForCore( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize, xCoreID );
+				}
+
+				xIdleTaskHandles[ xCoreID ] = xTaskCreateStatic(	prvIdleTask,
+																	cIdleName,
+																	ulIdleTaskStackSize,
+																	( void * ) NULL,
+																	( tskIDLE_PRIORITY | portPRIVILEGE_BIT ),
+																	pxIdleTaskStackBuffer,
+																	pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+				if( xIdleTaskHandles[ xCoreID ] != NULL )
+				{
+					xReturn = pdPASS;
+				}
+				else
+				{
+					xReturn = pdFAIL;
+				}
+			}
+			#else
+			{
+				xReturn = xTaskCreate(	prvIdleTask,
+										cIdleName, configMINIMAL_STACK_SIZE,
+										( void * ) NULL,
+										( tskIDLE_PRIORITY | portPRIVILEGE_BIT ),
+										&( xIdleTaskHandles[ xCoreID ] ) ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+			if( xReturn == pdPASS )
+			{
+				( ( TCB_t * ) xIdleTaskHandles[ xCoreID ] )->uxCoreAffinityMask = taskCORE_BIT( xCoreID );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	#endif /* configNUMBER_OF_CORES */
+
+	#if ( configUSE_TIMERS == 1 )
+	{
+		if( xReturn == pdPASS )
+		{
+			xReturn = xTimerCreateTimerTask();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_TIMERS */
+
+	if( xReturn == pdPASS )
+	{
+		/* Interrupts are turned off here, to ensure a tick does not occur
+		before or during the call to xPortStartScheduler().  The stacks of
+		the created tasks contain a status word with interrupts switched on
+		so interrupts will automatically get re-enabled when the first task
+		starts to run. */
+		portDISABLE_INTERRUPTS();
+
+		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		{
+			/* Switch Newlib's _impure_ptr variable to point to the _reent
+			structure specific to the task that will run first. */
+			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+		}
+		#endif /* configUSE_NEWLIB_REENTRANT */
+
+		#if( configNUMBER_OF_CORES > 1 )
+		{
+			/* Select the task each core runs first.  The scheduler is not
+			running yet so the kernel locks are not needed. */
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+			{
+				prvSelectHighestPriorityTask( xCoreID );
+			}
+		}
+		#endif /* configNUMBER_OF_CORES */
+
+		xNextTaskUnblockTime = portMAX_DELAY;
+		xSchedulerRunning = pdTRUE;
+		xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+
+		/* If configGENERATE_RUN_TIME_STATS is defined then the following
+		macro must be defined to configure the timer/counter used to generate
+		the run time counter time base. */
+		portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
+
+		/* Setting up the timer tick is hardware specific and thus in the
+		portable interface. */
+		if( xPortStartScheduler() != pdFALSE )
+		{
+			/* Should not reach here as if the scheduler is running the
+			function will not return. */
+		}
+		else
+		{
+			/* Should only reach here if a task calls xTaskEndScheduler(). */
+		}
+	}
+	else
+	{
+		/* This line will only be reached if the kernel could not be started,
+		because there was not enough FreeRTOS heap to create the idle task
+		or the timer task. */
+		configASSERT( xReturn != errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY );
+	}
+
+	/* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
+	meaning xIdleTaskHandle is not used anywhere else. */
+	( void ) xIdleTaskHandle;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskEndScheduler( void )
+{
+	/* Stop the scheduler interrupts and call the portable scheduler end
+	routine so the original ISRs can be restored if necessary.  The port
+	layer must ensure interrupts enable	bit is left in the correct state. */
+	portDISABLE_INTERRUPTS();
+	xSchedulerRunning = pdFALSE;
+	vPortEndScheduler();
+}
+/*----------------------------------------------------------*/
+
+#if( configUSE_CRITICAL_PROFILER == 1 )
+	/* task.h maps vTaskSuspendAll() onto this function to pass in the call
+	site. */
+	void vTaskSuspendAllFromSite( const char * const pcFile, const UBaseType_t uxLine )
+#else
+	void vTaskSuspendAll( void )
+#endif
+{
+	#if( configNUMBER_OF_CORES == 1 )
+	{
+		/* A critical section is not required as the variable is of type
+		BaseType_t.  Please read Richard Barry's reply in the following link to a
+		post in the FreeRTOS support forum before reporting this as a bug! -
+		http://goo.gl/wu4acr */
+		++uxSchedulerSuspended;
+	}
+	#else
+	{
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xCoreID;
+
+		if( xSchedulerRunning != pdFALSE )
+		{
+			/* The task lock is held until xTaskResumeAll(), which stops the
+			other cores suspending the scheduler or entering a critical section
+			in the meantime.  The ISR lock is only held while the count is
+			updated so interrupts on other cores see a consistent value. */
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+			{
+				xCoreID = portGET_CORE_ID();
+				taskGET_TASK_LOCK( xCoreID );
+				taskGET_ISR_LOCK( xCoreID );
+				++uxSchedulerSuspended;
+				taskRELEASE_ISR_LOCK( xCoreID );
+			}
+			portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+		}
+		else
+		{
+			++uxSchedulerSuspended;
+		}
+	}
+	#endif /* configNUMBER_OF_CORES */
+
+	#if( configUSE_CRITICAL_PROFILER == 1 )
+	{
+		/* Only the outermost call is timed.  Now the scheduler is suspended no
+		other task can suspend it, so the site can be recorded without a
+		critical section. */
+		if( ( uxSchedulerSuspended == ( UBaseType_t ) 1U ) && ( xSchedulerRunning != pdFALSE ) )
+		{
+			pcSuspendAllFile = pcFile;
+			uxSuspendAllLine = uxLine;
+			ulSuspendAllTime = ( uint32_t ) configCRITICAL_PROFILER_TIMESTAMP();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_CRITICAL_PROFILER */
+}
+/*----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+	static TickType_t prvGetExpectedIdleTime( void )
+	{
+	TickType_t xReturn;
+	UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
+
+		/* uxHigherPriorityReadyTasks takes care of the case where
+		configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
+		task that are in the Ready state, even though the idle task is
+		running. */
+		#if( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+		{
+			if( uxTopReadyPriority > tskIDLE_PRIORITY )
+			{
+				uxHigherPriorityReadyTasks = pdTRUE;
+			}
+		}
+		#else
+		{
+			const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
+
+			/* When port optimised task selection is used the uxTopReadyPriority
+			variable is used as a bit map.  If bits other than the least
+			significant bit are set then there are tasks that have a priority
+			above the idle priority that are in the Ready state.  This takes
+			care of the case where the co-operative scheduler is in use. */
+			if( uxTopReadyPriority > uxLeastSignificantBit )
+			{
+				uxHigherPriorityReadyTasks = pdTRUE;
+			}
+		}
+		#endif
+
+		if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
+		{
+			xReturn = 0;
+		}
+		else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
+		{
+			/* There are other idle priority tasks in the ready state.  If
+			time slicing is used then the very next tick interrupt must be
+			processed. */
+			xReturn = 0;
+		}
+		else if( uxHigherPriorityReadyTasks != pdFALSE )
+		{
+			/* There are tasks in the Ready state that have a priority above the
+			idle priority.  This path can only be reached if
+			configUSE_PREEMPTION is 0. */
+			xReturn = 0;
+		}
+		#if( configUSE_TASK_BUDGETS == 1 )
+			else if( listLIST_IS_EMPTY( &xThrottledTaskList ) == pdFALSE )
+			{
+				/* Throttled tasks are returned to the Ready state by the tick
+				interrupt. */
+				xReturn = 0;
+			}
+		#endif
+		else
+		{
+			xReturn = xNextTaskUnblockTime - xTickCount;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskResumeAll( void )
+{
+TCB_t *pxTCB = NULL;
+BaseType_t xAlreadyYielded = pdFALSE;
+
+	/* If uxSchedulerSuspended is zero then this function does not match a
+	previous call to vTaskSuspendAll(). */
+	configASSERT( uxSchedulerSuspended );
+
+	/* It is possible that an ISR caused a task to be removed from an event
+	list while the scheduler was suspended.  If this was the case then the
+	removed task will have been added to the xPendingReadyList.  Once the
+	scheduler has been resumed it is safe to move all the pending ready
+	tasks from this list into their appropriate ready list. */
+	taskENTER_CRITICAL();
+	{
+		--uxSchedulerSuspended;
+
+		#if( configUSE_CRITICAL_PROFILER == 1 )
+		{
+			if( ( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE ) && ( pcSuspendAllFile != NULL ) )
+			{
+				prvProfileRegion( pcSuspendAllFile, uxSuspendAllLine, eProfiledSchedulerSuspension, ( uint32_t ) configCRITICAL_PROFILER_TIMESTAMP() - ulSuspendAllTime );
+				pcSuspendAllFile = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_CRITICAL_PROFILER */
+
+		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+		{
+			if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
+			{
+				/* Move any readied tasks from the pending list into the
+				appropriate ready list. */
+				while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
+				{
+					pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) );
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					prvAddTaskToReadyList( pxTCB );
+
+					/* If the moved task has a priority higher than the current
+					task then a yield must be performed. */
+					#if( configNUMBER_OF_CORES == 1 )
+					{
+						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+						{
+							xYieldPending = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#else
+					{
+						prvYieldForTask( pxTCB );
+					}
+					#endif /* configNUMBER_OF_CORES */
+				}
+
+				if( pxTCB != NULL )
+				{
+					/* A task was unblocked while the scheduler was suspended,
+					which may have prevented the next unblock time from being
+					re-calculated, in which case re-calculate it now.  Mainly
+					important for low power tickless implementations, where
+					this can prevent an unnecessary exit from low power
+					state. */
+					prvResetNextTaskUnblockTime();
+				}
+
+				/* If any ticks occurred while the scheduler was suspended then
+				they should be processed now.  This ensures the tick count does
+				not	slip, and that any delayed tasks are resumed at the correct
+				time. */
+				{
+					UBaseType_t uxPendedCounts = uxPendedTicks; /* Non-volatile copy. */
+
+					if( uxPendedCounts > ( UBaseType_t ) 0U )
+					{
+						do
+						{
+							if( xTaskIncrementTick() != pdFALSE )
+							{
+								xYieldPending = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+							--uxPendedCounts;
+						} while( uxPendedCounts > ( UBaseType_t ) 0U );
+
+						uxPendedTicks = 0;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+
+				if( xYieldPending != pdFALSE )
+				{
+					#if( configUSE_PREEMPTION != 0 )
+					{
+						xAlreadyYielded = pdTRUE;
+					}
+					#endif
+					taskYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		#if( configNUMBER_OF_CORES > 1 )
+		{
+			/* Release the task lock taken by vTaskSuspendAll().  The lock is
+			still held by this critical section, and any yield requested above
+			is performed when the critical section is exited. */
+			if( xSchedulerRunning != pdFALSE )
+			{
+				taskRELEASE_TASK_LOCK( portGET_CORE_ID() );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configNUMBER_OF_CORES */
+	}
+	taskEXIT_CRITICAL();
+
+	return xAlreadyYielded;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCount( void )
+{
+TickType_t xTicks;
+
+	/* Critical section required if running on a 16 bit processor. */
+	portTICK_TYPE_ENTER_CRITICAL();
+	{
+		xTicks = xTickCount;
+	}
+	portTICK_TYPE_EXIT_CRITICAL();
+
+	return xTicks;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCountFromISR( void )
+{
+TickType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+	{
+		xReturn = xTickCount;
+	}
+	portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTaskGetNumberOfTasks( void )
+{
+	/* A critical section is not required because the variables are of type
+	BaseType_t. */
+	return uxCurrentNumberOfTasks;
+}
+/*-----------------------------------------------------------*/
+
+char *pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+TCB_t *pxTCB;
+
+	/* If null is passed in here then the name of the calling task is being
+	queried. */
+	pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+	configASSERT( pxTCB );
+	return &( pxTCB->pcTaskName[ 0 ] );
+}
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+	static TCB_t *prvSearchForNameWithinSingleList( List_t *pxList, const char pcNameToQuery[] )
+	{
+	TCB_t *pxNextTCB, *pxFirstTCB, *pxReturn = NULL;
+	UBaseType_t x;
+	char cNextChar;
+
+		/* This function is called with the scheduler suspended. */
+
+		if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+		{
+			listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList );
+
+			do
+			{
+				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList );
+
+				/* Check each character in the name looking for a match or
+				mismatch. */
+				for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+				{
+					cNextChar = pxNextTCB->pcTaskName[ x ];
+
+					if( cNextChar != pcNameToQuery[ x ] )
+					{
+						/* Characters didn't match. */
+						break;
+					}
+					else if( cNextChar == 0x00 )
+					{
+						/* Both strings terminated, a match must have been
+						found. */
+						pxReturn = pxNextTCB;
+						break;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+
+				if( pxReturn != NULL )
+				{
+					/* The handle has been found. */
+					break;
+				}
+
+			} while( pxNextTCB != pxFirstTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxReturn;
+	}
+
+#endif /* INCLUDE_xTaskGetHandle */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+	TaskHandle_t xTaskGetHandle( const char *pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	UBaseType_t uxQueue = configMAX_PRIORITIES;
+	TCB_t* pxTCB;
+
+		/* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
+		configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+
+		vTaskSuspendAll();
+		{
+			/* Search the ready lists. */
+			do
+			{
+				uxQueue--;
+				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+
+				if( pxTCB != NULL )
+				{
+					/* Found the handle. */
+					break;
+				}
+
+			} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+			/* Search the delayed lists. */
+			#if( configUSE_TIMING_WHEEL_DELAYS == 0 )
+			{
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+				}
+
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				}
+			}
+			#else
+			{
+				for( uxQueue = ( UBaseType_t ) 0U; ( pxTCB == NULL ) && ( uxQueue < ( taskWHEEL_LEVELS * taskWHEEL_SLOTS ) ); uxQueue++ )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( &( xDelayWheel[ uxQueue ] ), pcNameToQuery );
+				}
+			}
+			#endif
+
+			#if ( INCLUDE_vTaskSuspend == 1 )
+			{
+				if( pxTCB == NULL )
+				{
+					/* Search the suspended list. */
+					pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+				}
+			}
+			#endif
+
+			#if( configUSE_TASK_BUDGETS == 1 )
+			{
+				if( pxTCB == NULL )
+				{
+					/* Search the throttled list. */
+					pxTCB = prvSearchForNameWithinSingleList( &xThrottledTaskList, pcNameToQuery );
+				}
+			}
+			#endif
+
+			#if( INCLUDE_vTaskDelete == 1 )
+			{
+				if( pxTCB == NULL )
+				{
+					/* Search the deleted list. */
+					pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+				}
+			}
+			#endif
+		}
+		( void ) xTaskResumeAll();
+
+		return ( TaskHandle_t ) pxTCB;
+	}
+
+#endif /* INCLUDE_xTaskGetHandle */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, RunTimeCounter_t * const pulTotalRunTime )
+	{
+	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		RunTimeCounter_t ulTotalTime;
+		BaseType_t xCoreID;
+	#endif
+
+		vTaskSuspendAll();
+		{
+			/* Is there a space in the array for each task in the system? */
+			if( uxArraySize >= uxCurrentNumberOfTasks )
+			{
+				#if ( configGENERATE_RUN_TIME_STATS == 1 )
+				{
+					/* Charge the time used since the last switch to the tasks
+					that are running now, so their run time is consistent with
+					the total run time returned. */
+					taskENTER_CRITICAL();
+					{
+						for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+						{
+							prvUpdateRunTimeCounters( xCoreID );
+						}
+						ulTotalTime = ulTotalRunTime;
+					}
+					taskEXIT_CRITICAL();
+				}
+				#endif
+
+				/* Fill in an TaskStatus_t structure with information on each
+				task in the Ready state. */
+				do
+				{
+					uxQueue--;
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+
+				} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+				/* Fill in an TaskStatus_t structure with information on each
+				task in the Blocked state. */
+				#if( configUSE_TIMING_WHEEL_DELAYS == 0 )
+				{
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				}
+				#else
+				{
+					for( uxQueue = ( UBaseType_t ) 0U; uxQueue < ( taskWHEEL_LEVELS * taskWHEEL_SLOTS ); uxQueue++ )
+					{
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayWheel[ uxQueue ] ), eBlocked );
+					}
+				}
+				#endif
+
+				#if( configUSE_TASK_BUDGETS == 1 )
+				{
+					/* Tasks waiting for their budget to be replenished are
+					reported as Blocked. */
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xThrottledTaskList, eBlocked );
+				}
+				#endif
+
+				#if( INCLUDE_vTaskDelete == 1 )
+				{
+					/* Fill in an TaskStatus_t structure with information on
+					each task that has been deleted but not yet cleaned up. */
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
+				}
+				#endif
+
+				#if ( INCLUDE_vTaskSuspend == 1 )
+				{
+					/* Fill in an TaskStatus_t structure with information on
+					each task in the Suspended state. */
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
+				}
+				#endif
+
+				#if ( configGENERATE_RUN_TIME_STATS == 1)
+				{
+					if( pulTotalRunTime != NULL )
+					{
+						*pulTotalRunTime = ulTotalTime;
+					}
+				}
+				#else
+				{
+					if( pulTotalRunTime != NULL )
+					{
+						*pulTotalRunTime = 0;
+					}
+				}
+				#endif
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		return uxTask;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*----------------------------------------------------------*/
+
+#if( configUSE_TASK_SNAPSHOTS == 1 )
+
+	void vTaskSnapshotBegin( TaskSnapshot_t * const pxSnapshot )
+	{
+		configASSERT( pxSnapshot );
+
+		taskENTER_CRITICAL();
+		{
+			/* uxTaskNumber is incremented each time a task is created or
+			deleted, so it is used as the generation of xAllTasksList. */
+			pxSnapshot->uxGeneration = uxTaskNumber;
+			pxSnapshot->pvNextItem = ( void * ) listGET_HEAD_ENTRY( &xAllTasksList );
+			pxSnapshot->ulTotalRunTime = 0;
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	UBaseType_t uxTaskSnapshotRead( TaskSnapshot_t * const pxSnapshot, TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, const BaseType_t xGetFreeStackSpace )
+	{
+	UBaseType_t uxTask = 0;
+	BaseType_t xMoreTasks = pdTRUE;
+	ListItem_t *pxItem;
+	TCB_t *pxTCB = NULL;
+	TaskStatus_t *pxTaskStatus;
+	uint8_t *pucStackToCheck;
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		BaseType_t xCoreID;
+	#endif
+
+		configASSERT( pxSnapshot );
+
+		while( ( uxTask < uxArraySize ) && ( xMoreTasks != pdFALSE ) )
+		{
+			pxTaskStatus = &( pxTaskStatusArray[ uxTask ] );
+			pucStackToCheck = NULL;
+
+			/* Checking the stack takes time so is done outside of the
+			critical section, but the task must not be deleted, and its stack
+			freed, before the check completes.  Tasks are only deleted by
+			other tasks, so the scheduler is kept suspended from the time the
+			task is read until its stack has been checked. */
+			if( xGetFreeStackSpace != pdFALSE )
+			{
+				vTaskSuspendAll();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Only one task is read in each critical section, so the time
+			interrupts are disabled for does not depend on the number of
+			tasks. */
+			taskENTER_CRITICAL();
+			{
+				pxItem = ( ListItem_t * ) pxSnapshot->pvNextItem;
+
+				if( pxSnapshot->uxGeneration != uxTaskNumber )
+				{
+					/* A task has been created or deleted since the snapshot
+					was started, so pvNextItem might reference a TCB that has
+					been freed.  The snapshot cannot be continued. */
+					xMoreTasks = pdFALSE;
+				}
+				else if( pxItem == ( ListItem_t * ) listGET_END_MARKER( &xAllTasksList ) )
+				{
+					/* Every task has been read.  Record the total run time
+					the task run times can be compared against. */
+					#if ( configGENERATE_RUN_TIME_STATS == 1 )
+					{
+						for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+						{
+							prvUpdateRunTimeCounters( xCoreID );
+						}
+						pxSnapshot->ulTotalRunTime = ulTotalRunTime;
+					}
+					#endif
+					xMoreTasks = pdFALSE;
+				}
+				else
+				{
+					pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem );
+					pxSnapshot->pvNextItem = ( void * ) listGET_NEXT( pxItem );
+
+					pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
+					pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
+					pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+					pxTaskStatus->eCurrentState = eTaskGetState( ( TaskHandle_t ) pxTCB );
+					pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
+					pxTaskStatus->pxStackBase = pxTCB->pxStack;
+					pxTaskStatus->usStackHighWaterMark = 0;
+
+					#if ( configUSE_MUTEXES == 1 )
+					{
+						pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
+					}
+					#else
+					{
+						pxTaskStatus->uxBasePriority = 0;
+					}
+					#endif
+
+					#if ( configGENERATE_RUN_TIME_STATS == 1 )
+					{
+						pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+					}
+					#else
+					{
+						pxTaskStatus->ulRunTimeCounter = 0;
+					}
+					#endif
+
+					/* Take the stack bound while the TCB is known to be
+					valid. */
+					if( xGetFreeStackSpace != pdFALSE )
+					{
+						#if ( portSTACK_GROWTH > 0 )
+						{
+							pucStackToCheck = ( uint8_t * ) pxTCB->pxEndOfStack;
+						}
+						#else
+						{
+							pucStackToCheck = ( uint8_t * ) pxTCB->pxStack;
+						}
+						#endif
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( pucStackToCheck != NULL )
+			{
+				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( pucStackToCheck );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xGetFreeStackSpace != pdFALSE )
+			{
+				( void ) xTaskResumeAll();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xMoreTasks != pdFALSE )
+			{
+				uxTask++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( xTaskSnapshotIsValid( pxSnapshot ) == pdFALSE )
+		{
+			/* Entries read while tasks were being created or deleted are not
+			returned. */
+			uxTask = 0;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxTask;
+	}
+	/*-----------------------------------------------------------*/
+
+	BaseType_t xTaskSnapshotIsValid( const TaskSnapshot_t * const pxSnapshot )
+	{
+	BaseType_t xReturn;
+
+		configASSERT( pxSnapshot );
+
+		taskENTER_CRITICAL();
+		{
+			xReturn = ( pxSnapshot->uxGeneration == uxTaskNumber ) ? pdTRUE : pdFALSE;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_SNAPSHOTS */
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+
+	TaskHandle_t xTaskGetIdleTaskHandle( void )
+	{
+		/* If xTaskGetIdleTaskHandle() is called before the scheduler has been
+		started, then xIdleTaskHandle will be NULL. */
+		configASSERT( ( xIdleTaskHandle != NULL ) );
+		return xIdleTaskHandle;
+	}
+
+#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+/*----------------------------------------------------------*/
+
+/* This conditional compilation should use inequality to 0, not equality to 1.
+This is to ensure vTaskStepTick() is available when user defined low power mode
+implementations require configUSE_TICKLESS_IDLE to be set to a value other than
+1. */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+	void vTaskStepTick( const TickType_t xTicksToJump )
+	{
+		/* Correct the tick count value after a period during which the tick
+		was suppressed.  Note this does *not* call the tick hook function for
+		each stepped tick. */
+		configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+
+		#if( configUSE_TIMING_WHEEL_DELAYS == 1 )
+		{
+		TickType_t xTimeNow = xTickCount;
+		const TickType_t xTimeAfterJump = xTickCount + xTicksToJump;
+		List_t * const pxSlot = &( xDelayWheel[ xTimeAfterJump & taskWHEEL_SLOT_MASK ] );
+		ListItem_t *pxListItem;
+
+			/* The slot boundaries crossed while the tick was suppressed must
+			still be cascaded, otherwise tasks held in the higher levels of the
+			wheel would be missed. */
+			while( ( xTimeAfterJump - xTimeNow ) >= ( ( TickType_t ) taskWHEEL_SLOTS - ( xTimeNow & taskWHEEL_SLOT_MASK ) ) )
+			{
+				xTimeNow += ( TickType_t ) taskWHEEL_SLOTS - ( xTimeNow & taskWHEEL_SLOT_MASK );
+				prvWheelCascade( xTimeNow );
+			}
+
+			/* If the jump ends exactly on a wake time the level 0 slot for
+			that time will not be visited by the tick interrupt, so move its
+			tasks to the next tick - which is when the sorted delayed list
+			would also have unblocked them. */
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxListItem = listGET_HEAD_ENTRY( pxSlot );
+				( void ) uxListRemove( pxListItem );
+				listSET_LIST_ITEM_VALUE( pxListItem, xTimeAfterJump + ( TickType_t ) 1U );
+				prvWheelInsert( pxListItem, xTimeAfterJump );
+			}
+		}
+		#endif /* configUSE_TIMING_WHEEL_DELAYS */
+
+		xTickCount += xTicksToJump;
+		traceINCREASE_TICK_COUNT( xTicksToJump );
+
+		#if( configUSE_TIMING_WHEEL_DELAYS == 1 )
+		{
+			prvResetNextTaskUnblockTime();
+		}
+		#endif
+	}
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskAbortDelay == 1 )
+
+	BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB = ( TCB_t * ) xTask;
+	BaseType_t xReturn = pdFALSE;
+
+		configASSERT( pxTCB );
+
+		vTaskSuspendAll();
+		{
+			/* A task can only be prematurely removed from the Blocked state if
+			it is actually in the Blocked state.  A task that is waiting for its
+			execution budget cannot be released early. */
+			#if( configUSE_TASK_BUDGETS == 1 )
+				if( ( eTaskGetState( xTask ) == eBlocked ) && ( listIS_CONTAINED_WITHIN( &xThrottledTaskList, &( pxTCB->xStateListItem ) ) == pdFALSE ) )
+			#else
+				if( eTaskGetState( xTask ) == eBlocked )
+			#endif
+			{
+				/* Remove the reference to the task from the blocked list.  An
+				interrupt won't touch the xStateListItem because the
+				scheduler is suspended. */
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+				/* Is the task waiting on an event also?  If so remove it from
+				the event list too.  Interrupts can touch the event list item,
+				even though the scheduler is suspended, so a critical section
+				is used. */
+				taskENTER_CRITICAL();
+				{
+					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+					{
+						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+						pxTCB->ucDelayAborted = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				taskEXIT_CRITICAL();
+
+				/* Place the unblocked task into the appropriate ready list. */
+				prvAddTaskToReadyList( pxTCB );
+
+				/* A task being unblocked cannot cause an immediate context
+				switch if preemption is turned off. */
+				#if (  configUSE_PREEMPTION == 1 )
+				{
+					#if( configNUMBER_OF_CORES == 1 )
+					{
+						/* Preemption is on, but a context switch should only be
+						performed if the unblocked task has a priority that is
+						equal to or higher than the currently executing task. */
+						if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
+						{
+							/* Pend the yield to be performed when the scheduler
+							is unsuspended. */
+							xYieldPending = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#else
+					{
+						/* Yields of this core are pended until the scheduler is
+						unsuspended. */
+						prvYieldForTask( pxTCB );
+					}
+					#endif /* configNUMBER_OF_CORES */
+				}
+				#endif /* configUSE_PREEMPTION */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		xTaskResumeAll();
+
+		return xReturn;
+	}
+
+#endif /* INCLUDE_xTaskAbortDelay */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskIncrementTick( void )
+{
+TCB_t * pxTCB;
+BaseType_t xSwitchRequired = pdFALSE;
+#if( configNUMBER_OF_CORES > 1 )
+	UBaseType_t uxSavedInterruptStatus;
+
+	/* The tick interrupt may be taken on any core, so the ISR lock is held
+	while the delayed and ready lists are updated. */
+	uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+#endif
+
+	/* Called by the portable layer each time a tick interrupt occurs.
+	Increments the tick then checks to see if the new tick value will cause any
+	tasks to be unblocked. */
+	traceTASK_INCREMENT_TICK( xTickCount );
+
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	{
+		/* Reading the run time counter every tick keeps its extension to
+		RunTimeCounter_t correct, and keeps the run time of a task that is
+		never switched out up to date. */
+		#if( configNUMBER_OF_CORES == 1 )
+		{
+			prvUpdateRunTimeCounters( 0 );
+		}
+		#else
+		{
+			prvUpdateRunTimeCounters( portGET_CORE_ID() );
+		}
+		#endif
+	}
+	#endif /* configGENERATE_RUN_TIME_STATS */
+
+	if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+	{
+		/* Minor optimisation.  The tick count cannot change in this
+		block. */
+		const TickType_t xConstTickCount = xTickCount + 1;
+
+		/* Increment the RTOS tick, switching the delayed and overflowed
+		delayed lists if it wraps to 0. */
+		xTickCount = xConstTickCount;
+
+		#if( configUSE_TIMING_WHEEL_DELAYS == 0 )
+		{
+		TickType_t xItemValue;
+
+			if( xConstTickCount == ( TickType_t ) 0U )
+			{
+				taskSWITCH_DELAYED_LISTS();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* See if this tick has made a timeout expire.  Tasks are stored in
+			the	queue in the order of their wake time - meaning once one task
+			has been found whose block time has not expired there is no need to
+			look any further down the list. */
+			if( xConstTickCount >= xNextTaskUnblockTime )
+			{
+				for( ;; )
+				{
+					if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+					{
+						/* The delayed list is empty.  Set xNextTaskUnblockTime
+						to the maximum possible value so it is extremely
+						unlikely that the
+						if( xTickCount >= xNextTaskUnblockTime ) test will pass
+						next time through. */
+						xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+						break;
+					}
+					else
+					{
+						/* The delayed list is not empty, get the value of the
+						item at the head of the delayed list.  This is the time
+						at which the task at the head of the delayed list must
+						be removed from the Blocked state. */
+						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+						xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+						if( xConstTickCount < xItemValue )
+						{
+							/* It is not time to unblock this item yet, but the
+							item value is the time at which the task at the head
+							of the blocked list must be removed from the Blocked
+							state -	so record the item value in
+							xNextTaskUnblockTime. */
+							xNextTaskUnblockTime = xItemValue;
+							break;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						/* It is time to remove the item from the Blocked state. */
+						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+						/* Is the task waiting on an event also?  If so remove
+						it from the event list. */
+						if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+						{
+							( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						/* Place the unblocked task into the appropriate ready
+						list. */
+						prvAddTaskToReadyList( pxTCB );
+
+						/* A task being unblocked cannot cause an immediate
+						context switch if preemption is turned off. */
+						#if (  configUSE_PREEMPTION == 1 )
+						{
+							/* Preemption is on, but a context switch should
+							only be performed if the unblocked task has a
+							priority that is equal to or higher than the
+							currently executing task. */
+							#if( configNUMBER_OF_CORES == 1 )
+							{
+								if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+								{
+									xSwitchRequired = pdTRUE;
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+							#else
+							{
+								prvYieldForTask( pxTCB );
+							}
+							#endif /* configNUMBER_OF_CORES */
+						}
+						#endif /* configUSE_PREEMPTION */
+					}
+				}
+			}
+		}
+		#else /* configUSE_TIMING_WHEEL_DELAYS */
+		{
+		List_t * const pxSlot = &( xDelayWheel[ xConstTickCount & taskWHEEL_SLOT_MASK ] );
+
+			if( xConstTickCount == ( TickType_t ) 0U )
+			{
+				xNumOfOverflows++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Move tasks down the wheel if the tick count has just reached
+			the boundary of a slot above level 0. */
+			if( ( xConstTickCount & taskWHEEL_SLOT_MASK ) == ( TickType_t ) 0U )
+			{
+				prvWheelCascade( xConstTickCount );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Every task referenced from the level 0 slot for this tick is
+			due now, and no other slot can hold a task that is due now, so
+			the slot is emptied without looking at any wake times. */
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+
+				/* It is time to remove the item from the Blocked state. */
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+				/* Is the task waiting on an event also?  If so remove it from
+				the event list. */
+				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Place the unblocked task into the appropriate ready list. */
+				prvAddTaskToReadyList( pxTCB );
+
+				/* A task being unblocked cannot cause an immediate context
+				switch if preemption is turned off. */
+				#if (  configUSE_PREEMPTION == 1 )
+				{
+					/* Preemption is on, but a context switch should only be
+					performed if the unblocked task has a priority that is
+					equal to or higher than the currently executing task. */
+					#if( configNUMBER_OF_CORES == 1 )
+					{
+						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#else
+					{
+						prvYieldForTask( pxTCB );
+					}
+					#endif /* configNUMBER_OF_CORES */
+				}
+				#endif /* configUSE_PREEMPTION */
+			}
+
+			/* xNextTaskUnblockTime is only needed to decide how long the tick
+			can be suppressed for, so it is only recalculated once the time it
+			holds has been reached, or when the tick count wraps and wake times
+			that had overflowed become visible. */
+			if( ( xConstTickCount >= xNextTaskUnblockTime ) || ( xConstTickCount == ( TickType_t ) 0U ) )
+			{
+				prvResetNextTaskUnblockTime();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TIMING_WHEEL_DELAYS */
+
+		#if( configUSE_TASK_BUDGETS == 1 )
+		{
+			if( prvReplenishThrottledTasks( xConstTickCount ) != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The tick is charged to the task that was running when it
+			occurred. */
+			#if( configNUMBER_OF_CORES == 1 )
+			{
+				if( prvChargeBudget( pxCurrentTCB, xConstTickCount ) != pdFALSE )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#else
+			{
+			BaseType_t xCoreID;
+
+				for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+				{
+					if( prvChargeBudget( pxCurrentTCBs[ xCoreID ], xConstTickCount ) != pdFALSE )
+					{
+						prvYieldCore( xCoreID );
+
+						if( xCoreID == portGET_CORE_ID() )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			#endif /* configNUMBER_OF_CORES */
+		}
+		#endif /* configUSE_TASK_BUDGETS */
+
+		#if( configUSE_EDF_SCHEDULING == 1 )
+		{
+			prvCheckForDeadlineMisses( xConstTickCount );
+		}
+		#endif /* configUSE_EDF_SCHEDULING */
+
+		/* Tasks of equal priority to the currently running task will share
+		processing time (time slice) if preemption is on, and the application
+		writer has not explicitly turned time slicing off.  Tasks of the EDF
+		priority run in deadline order instead. */
+		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+		{
+			if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 ) && ( taskIS_EDF_PRIORITY( pxCurrentTCB->uxPriority ) == pdFALSE ) )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#elif ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+		{
+		BaseType_t xCoreID, xOtherCoreID, xWaiting;
+		UBaseType_t uxPriority;
+
+			/* A core is time sliced if its ready list holds a task that is
+			neither running on another core nor the idle task of another core,
+			as the idle tasks can only run on their own core. */
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+			{
+				uxPriority = pxCurrentTCBs[ xCoreID ]->uxPriority;
+				xWaiting = ( BaseType_t ) listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxPriority ] ) );
+
+				for( xOtherCoreID = 0; xOtherCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xOtherCoreID++ )
+				{
+					if( pxCurrentTCBs[ xOtherCoreID ]->uxPriority == uxPriority )
+					{
+						xWaiting--;
+					}
+
+					if( ( uxPriority == tskIDLE_PRIORITY ) && ( xOtherCoreID != xCoreID ) && ( pxCurrentTCBs[ xOtherCoreID ] != xIdleTaskHandles[ xOtherCoreID ] ) )
+					{
+						xWaiting--;
+					}
+				}
+
+				if( xWaiting > 0 )
+				{
+					prvYieldCore( xCoreID );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+
+		#if ( configUSE_TICK_HOOK == 1 )
+		{
+			/* Guard against the tick hook being called when the pended tick
+			count is being unwound (when the scheduler is being unlocked). */
+			if( uxPendedTicks == ( UBaseType_t ) 0U )
+			{
+				vApplicationTickHook();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TICK_HOOK */
+	}
+	else
+	{
+		++uxPendedTicks;
+
+		/* The tick hook gets called at regular intervals, even if the
+		scheduler is locked. */
+		#if ( configUSE_TICK_HOOK == 1 )
+		{
+			vApplicationTickHook();
+		}
+		#endif
+	}
+
+	#if ( configUSE_PREEMPTION == 1 )
+	{
+		if( xYieldPending != pdFALSE )
+		{
+			xSwitchRequired = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_PREEMPTION */
+
+	#if( configNUMBER_OF_CORES > 1 )
+	{
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+	}
+	#endif /* configNUMBER_OF_CORES */
+
+	return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+	void vTaskSetApplicationTaskTag( TaskHandle_t xTask, TaskHookFunction_t pxHookFunction )
+	{
+	TCB_t *xTCB;
+
+		/* If xTask is NULL then it is the task hook of the calling task that is
+		getting set. */
+		if( xTask == NULL )
+		{
+			xTCB = ( TCB_t * ) pxCurrentTCB;
+		}
+		else
+		{
+			xTCB = ( TCB_t * ) xTask;
+		}
+
+		/* Save the hook function in the TCB.  A critical section is required as
+		the value can be accessed from an interrupt. */
+		taskENTER_CRITICAL();
+			xTCB->pxTaskTag = pxHookFunction;
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+	TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+	{
+	TCB_t *xTCB;
+	TaskHookFunction_t xReturn;
+
+		/* If xTask is NULL then we are setting our own task hook. */
+		if( xTask == NULL )
+		{
+			xTCB = ( TCB_t * ) pxCurrentTCB;
+		}
+		else
+		{
+			xTCB = ( TCB_t * ) xTask;
+		}
+
+		/* Save the hook function in the TCB.  A critical section is required as
+		the value can be accessed from an interrupt. */
+		taskENTER_CRITICAL();
+		{
+			xReturn = xTCB->pxTaskTag;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+	BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask, void *pvParameter )
+	{
+	TCB_t *xTCB;
+	BaseType_t xReturn;
+
+		/* If xTask is NULL then we are calling our own task hook. */
+		if( xTask == NULL )
+		{
+			xTCB = ( TCB_t * ) pxCurrentTCB;
+		}
+		else
+		{
+			xTCB = ( TCB_t * ) xTask;
+		}
+
+		if( xTCB->pxTaskTag != NULL )
+		{
+			xReturn = xTCB->pxTaskTag( pvParameter );
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES == 1 )
+
+void vTaskSwitchContext( void )
+{
+	if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+	{
+		/* The scheduler is currently suspended - do not allow a context
+		switch. */
+		xYieldPending = pdTRUE;
+	}
+	else
+	{
+		xYieldPending = pdFALSE;
+		traceTASK_SWITCHED_OUT();
+
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			/* Add the amount of time the task has been running to the
+			accumulated time so far. */
+			prvUpdateRunTimeCounters( 0 );
+		}
+		#endif /* configGENERATE_RUN_TIME_STATS */
+
+		/* Check for stack overflow, if configured. */
+		taskCHECK_FOR_STACK_OVERFLOW();
+
+		#if( configUSE_CRITICAL_PROFILER == 1 )
+		{
+			/* Ports that switch context as soon as a task yields from within a
+			critical section leave interrupts enabled while the task is
+			switched out, so the critical section is timed in two parts. */
+			if( pxCurrentTCB->uxProfiledCriticalNesting != ( UBaseType_t ) 0U )
+			{
+				prvProfileRegion( pxCurrentTCB->pcCriticalEnterFile, pxCurrentTCB->uxCriticalEnterLine, eProfiledCriticalSection, ( uint32_t ) configCRITICAL_PROFILER_TIMESTAMP() - pxCurrentTCB->ulCriticalEnterTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_CRITICAL_PROFILER */
+
+		/* Select a new task to run using either the generic C or port
+		optimised asm code. */
+		taskSELECT_HIGHEST_PRIORITY_TASK();
+		traceTASK_SWITCHED_IN();
+
+		#if( configUSE_CRITICAL_PROFILER == 1 )
+		{
+			if( pxCurrentTCB->uxProfiledCriticalNesting != ( UBaseType_t ) 0U )
+			{
+				pxCurrentTCB->ulCriticalEnterTime = ( uint32_t ) configCRITICAL_PROFILER_TIMESTAMP();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_CRITICAL_PROFILER */
+
+		#if( configUSE_WAKE_LATENCY_STATS == 1 )
+		{
+			prvRecordWakeLatency( pxCurrentTCB );
+		}
+		#endif /* configUSE_WAKE_LATENCY_STATS */
+
+		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		{
+			/* Switch Newlib's _impure_ptr variable to point to the _reent
+			structure specific to this task. */
+			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+		}
+		#endif /* configUSE_NEWLIB_REENTRANT */
+	}
+}
+/*-----------------------------------------------------------*/
+
+#else /* configNUMBER_OF_CORES */
+
+void vTaskSwitchContext( BaseType_t xCoreID )
+{
+	/* Both kernel locks are held so no other core can change the ready lists,
+	or select a task, while this core is selecting a task. */
+	taskGET_TASK_LOCK( xCoreID );
+	taskGET_ISR_LOCK( xCoreID );
+	{
+		/* A task must not be switched out from inside a critical section, as
+		the kernel locks it holds are recorded against the core. */
+		configASSERT( pxCurrentTCBs[ xCoreID ]->uxCriticalNesting == ( UBaseType_t ) 0U );
+
+		if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+		{
+			/* The scheduler is currently suspended - do not allow a context
+			switch. */
+			xYieldPendings[ xCoreID ] = pdTRUE;
+		}
+		else
+		{
+			xYieldPendings[ xCoreID ] = pdFALSE;
+			traceTASK_SWITCHED_OUT();
+
+			#if ( configGENERATE_RUN_TIME_STATS == 1 )
+			{
+				/* Add the amount of time the task has been running on this
+				core to the accumulated time so far. */
+				prvUpdateRunTimeCounters( xCoreID );
+			}
+			#endif /* configGENERATE_RUN_TIME_STATS */
+
+			/* Check for stack overflow, if configured. */
+			taskCHECK_FOR_STACK_OVERFLOW();
+
+			prvSelectHighestPriorityTask( xCoreID );
+			traceTASK_SWITCHED_IN();
+
+			#if( configUSE_WAKE_LATENCY_STATS == 1 )
+			{
+				prvRecordWakeLatency( pxCurrentTCBs[ xCoreID ] );
+			}
+			#endif /* configUSE_WAKE_LATENCY_STATS */
+		}
+	}
+	taskRELEASE_ISR_LOCK( xCoreID );
+	taskRELEASE_TASK_LOCK( xCoreID );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSelectHighestPriorityTask( const BaseType_t xCoreID )
+{
+UBaseType_t uxPriority, uxCandidates;
+TCB_t *pxTCB = NULL, *pxCandidate;
+TCB_t * const pxPreviousTCB = pxCurrentTCBs[ xCoreID ];
+List_t *pxReadyList;
+
+	/* Find the highest priority queue that contains ready tasks. */
+	while( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopReadyPriority ] ) ) )
+	{
+		configASSERT( uxTopReadyPriority );
+		--uxTopReadyPriority;
+	}
+
+	/* Tasks that are running on another core, or that are not allowed to run
+	on this core, are skipped.  listGET_OWNER_OF_NEXT_ENTRY indexes through the
+	list, so the tasks of the same priority still get an equal share of the
+	processor time. */
+	uxPriority = uxTopReadyPriority;
+
+	for( ;; )
+	{
+		pxReadyList = &( pxReadyTasksLists[ uxPriority ] );
+
+		for( uxCandidates = listCURRENT_LIST_LENGTH( pxReadyList ); uxCandidates > ( UBaseType_t ) 0U; uxCandidates-- )
+		{
+			listGET_OWNER_OF_NEXT_ENTRY( pxCandidate, pxReadyList );
+
+			if( ( ( pxCandidate->xTaskRunState == taskTASK_NOT_RUNNING ) || ( pxCandidate->xTaskRunState == xCoreID ) ) &&
+				( ( pxCandidate->uxCoreAffinityMask & taskCORE_BIT( xCoreID ) ) != ( UBaseType_t ) 0U ) )
+			{
+				pxTCB = pxCandidate;
+				break;
+			}
+		}
+
+		if( pxTCB != NULL )
+		{
+			break;
+		}
+
+		/* The idle task of this core can always run on this core. */
+		configASSERT( uxPriority > tskIDLE_PRIORITY );
+		uxPriority--;
+	}
+
+	if( pxTCB != pxPreviousTCB )
+	{
+		if( pxPreviousTCB != NULL )
+		{
+			pxPreviousTCB->xTaskRunState = taskTASK_NOT_RUNNING;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxTCB->xTaskRunState = xCoreID;
+		pxCurrentTCBs[ xCoreID ] = pxTCB;
+
+		/* The task that has just been switched out may be of higher priority
+		than the task running on another core. */
+		if( ( pxPreviousTCB != NULL ) && ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxPreviousTCB->uxPriority ] ), &( pxPreviousTCB->xStateListItem ) ) != pdFALSE ) )
+		{
+			prvYieldForTask( pxPreviousTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldCore( const BaseType_t xCoreID )
+{
+	/* The flag is cleared when the core next switches context. */
+	xYieldPendings[ xCoreID ] = pdTRUE;
+
+	if( xCoreID != portGET_CORE_ID() )
+	{
+		portYIELD_CORE( xCoreID );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldForTask( const TCB_t * const pxTCB )
+{
+	#if( configUSE_PREEMPTION == 1 )
+	{
+	BaseType_t xCoreID, xLowestCoreID = taskNO_CORE;
+	UBaseType_t uxLowestPriority = pxTCB->uxPriority;
+	const BaseType_t xCallingCoreID = portGET_CORE_ID();
+
+		if( ( xSchedulerRunning != pdFALSE ) && ( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING ) )
+		{
+			/* Find the core running the lowest priority task that is below
+			the priority of pxTCB.  Cores that already have a yield pending are
+			skipped so tasks readied together are spread over different cores.
+			Where several cores qualify the calling core is preferred as it
+			does not need to be interrupted. */
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+			{
+				if( ( ( pxTCB->uxCoreAffinityMask & taskCORE_BIT( xCoreID ) ) != ( UBaseType_t ) 0U ) && ( xYieldPendings[ xCoreID ] == pdFALSE ) )
+				{
+					if( ( pxCurrentTCBs[ xCoreID ]->uxPriority < uxLowestPriority ) ||
+						( ( pxCurrentTCBs[ xCoreID ]->uxPriority == uxLowestPriority ) && ( xLowestCoreID != taskNO_CORE ) && ( xCoreID == xCallingCoreID ) ) )
+					{
+						uxLowestPriority = pxCurrentTCBs[ xCoreID ]->uxPriority;
+						xLowestCoreID = xCoreID;
+					}
+				}
+			}
+
+			if( xLowestCoreID != taskNO_CORE )
+			{
+				prvYieldCore( xLowestCoreID );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		( void ) pxTCB;
+	}
+	#endif /* configUSE_PREEMPTION */
+}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksToWait )
+{
+	configASSERT( pxEventList );
+
+	/* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
+	SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+
+	/* Place the event list item of the TCB in the appropriate event list.
+	This is placed in the list in priority order so the highest priority task
+	is the first to be woken by the event.  The queue that contains the event
+	list is locked, preventing simultaneous access from interrupts. */
+	vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+	#if( configUSE_QUEUE_HAND_OFF == 1 )
+	{
+		pxCurrentTCB->pvHandOff = NULL;
+	}
+	#endif
+
+	prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_HAND_OFF == 1 )
+
+	void vTaskPlaceOnEventListWithHandOff( List_t * const pxEventList, void * const pvHandOff, const TickType_t xTicksToWait )
+	{
+		/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED AND THE
+		QUEUE BEING ACCESSED LOCKED, so nothing can look at the hand-off
+		until it has been recorded. */
+		vTaskPlaceOnEventList( pxEventList, xTicksToWait );
+		pxCurrentTCB->pvHandOff = pvHandOff;
+	}
+
+#endif /* configUSE_QUEUE_HAND_OFF */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_HAND_OFF == 1 )
+
+	void *pvTaskGetEventListHandOff( const List_t * const pxEventList )
+	{
+	void *pvReturn;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  The task at
+		the head of the list is the one xTaskRemoveFromEventList() would
+		unblock. */
+		if( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
+		{
+			pvReturn = ( ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList ) )->pvHandOff; /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		}
+		else
+		{
+			pvReturn = NULL;
+		}
+
+		return pvReturn;
+	}
+
+#endif /* configUSE_QUEUE_HAND_OFF */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_CONDITION_VARIABLES == 1 )
+
+	void vTaskMoveToMutexEventList( const List_t * const pxEventList, List_t * const pxMutexEventList, TaskHandle_t const pxMutexHolder )
+	{
+	TCB_t *pxMovedTCB;
+	TCB_t * const pxHolderTCB = ( TCB_t * ) pxMutexHolder;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  The task stays
+		in the Blocked state, and on the delayed list, so keeps its timeout.
+		Both lists are held in priority order, so the event list item value
+		does not change. */
+		pxMovedTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e961 !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		configASSERT( pxMovedTCB );
+		( void ) uxListRemove( &( pxMovedTCB->xEventListItem ) );
+		vListInsert( pxMutexEventList, &( pxMovedTCB->xEventListItem ) );
+
+		/* The holder inherits the priority of the moved task as it would had
+		the task blocked on the mutex itself. */
+		if( ( pxHolderTCB != NULL ) && ( pxHolderTCB->uxPriority < pxMovedTCB->uxPriority ) )
+		{
+			prvSetInheritedPriority( pxHolderTCB, pxMovedTCB->uxPriority );
+			traceTASK_PRIORITY_INHERIT( pxHolderTCB, pxMovedTCB->uxPriority );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_CONDITION_VARIABLES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+	void vTaskSetMultipleObjectWaitOwner( ListItem_t * const pxWaitListItem )
+	{
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  The record is
+		given the same value as the calling task's own event list item, so it
+		is held in the same position in an event list sorted by priority. */
+		listSET_LIST_ITEM_OWNER( pxWaitListItem, pxCurrentTCB );
+		listSET_LIST_ITEM_VALUE( pxWaitListItem, ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+	}
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+	void vTaskSetMultipleObjectWaitObjects( void *pvWaitObjects, const UBaseType_t uxWaitObjectCount )
+	{
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION. */
+		pxCurrentTCB->pvWaitObjects = pvWaitObjects;
+		pxCurrentTCB->uxWaitObjectCount = uxWaitObjectCount;
+	}
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+	static void prvReorderMultipleObjectWaitRecords( TCB_t * const pxTCB )
+	{
+		if( pxTCB->pvWaitObjects != NULL )
+		{
+			vMultipleObjectWaitReorderRecords( ( WaitObject_t * ) pxTCB->pvWaitObjects, pxTCB->uxWaitObjectCount, listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+	BaseType_t xTaskRemoveMultipleObjectWaitItem( ListItem_t * const pxWaitListItem )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxWaitListItem );
+	BaseType_t xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION. */
+		( void ) uxListRemove( pxWaitListItem );
+
+		if( taskIS_WAITING_FOR_MULTIPLE_OBJECTS( pxTCB ) )
+		{
+			xReturn = xTaskRemoveFromEventList( ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) );
+		}
+		else
+		{
+			/* The task has already been unblocked. */
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_MULTIPLE_OBJECT_WAITS == 1 ) && ( configUSE_TASK_NOTIFICATIONS == 1 ) )
+
+	BaseType_t xTaskNotifyAddMultipleObjectWait( void )
+	{
+	BaseType_t xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  The
+		notification is not consumed, so the notification state is only marked
+		to show the task is waiting for it. */
+		if( pxCurrentTCB->ucNotifyState == taskNOTIFICATION_RECEIVED )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			pxCurrentTCB->ucNotifyState = taskWAITING_MULTIPLE_OBJECTS;
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_MULTIPLE_OBJECT_WAITS == 1 ) && ( configUSE_TASK_NOTIFICATIONS == 1 ) )
+
+	void vTaskNotifyRemoveMultipleObjectWait( void )
+	{
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  A notification
+		that arrived while the task was waiting is left pending. */
+		if( pxCurrentTCB->ucNotifyState == taskWAITING_MULTIPLE_OBJECTS )
+		{
+			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+
+	static TCB_t *prvGetEventListTaskToUnblock( const List_t * const pxEventList )
+	{
+	ListItem_t *pxListItem;
+	TCB_t *pxTCB = NULL;
+
+		while( ( pxTCB == NULL ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+		{
+			pxListItem = listGET_HEAD_ENTRY( pxEventList );
+			pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxListItem );
+
+			if( pxListItem != &( pxTCB->xEventListItem ) )
+			{
+				/* pxListItem is a wait record.  The task it belongs to is
+				unblocked by removing its own event list item from the list it
+				is blocked on. */
+				( void ) uxListRemove( pxListItem );
+
+				if( taskIS_WAITING_FOR_MULTIPLE_OBJECTS( pxTCB ) )
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+				else
+				{
+					/* The record is stale, try the next item. */
+					pxTCB = NULL;
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return pxTCB;
+	}
+
+#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+/*-----------------------------------------------------------*/
+
+void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xItemValue, const TickType_t xTicksToWait )
+{
+	configASSERT( pxEventList );
+
+	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+	the event groups implementation. */
+	configASSERT( uxSchedulerSuspended != 0 );
+
+	/* Store the item value in the event list item.  It is safe to access the
+	event list item here as interrupts won't access the event list item of a
+	task that is not in the Blocked state. */
+	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+	/* Place the event list item of the TCB at the end of the appropriate event
+	list.  It is safe to access the event list here because it is part of an
+	event group implementation - and interrupts don't access event groups
+	directly (instead they access them indirectly by pending function calls to
+	the task level). */
+	vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+	{
+		/* The event groups implementation can spread its waiting tasks over
+		several lists, so remember the order in which the tasks started to
+		wait. */
+		pxCurrentTCB->xEventWaitOrder = xNextEventWaitOrder;
+		xNextEventWaitOrder++;
+	}
+	#endif
+
+	prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	TickType_t xTaskGetEventListItemOrder( const ListItem_t * const pxEventListItem )
+	{
+	const TCB_t *pxTCB;
+
+		/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
+		configASSERT( uxSchedulerSuspended != 0 );
+
+		pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxEventListItem );
+		configASSERT( pxTCB );
+
+		/* Measured back from the next value to be given out so the result is
+		not affected by xNextEventWaitOrder overflowing - the task that has
+		been waiting the longest returns the lowest value. */
+		return ( TickType_t ) ( pxTCB->xEventWaitOrder - xNextEventWaitOrder );
+	}
+
+#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMERS == 1 )
+
+	void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
+	{
+		configASSERT( pxEventList );
+
+		/* This function should not be called by application code hence the
+		'Restricted' in its name.  It is not part of the public API.  It is
+		designed for use by kernel code, and has special calling requirements -
+		it should be called with the scheduler suspended. */
+
+
+		/* Place the event list item of the TCB in the appropriate event list.
+		In this case it is assume that this is the only task that is going to
+		be waiting on this event list, so the faster vListInsertEnd() function
+		can be used in place of vListInsert. */
+		vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+		#if( configUSE_QUEUE_HAND_OFF == 1 )
+		{
+			pxCurrentTCB->pvHandOff = NULL;
+		}
+		#endif
+
+		/* If the task should block indefinitely then set the block time to a
+		value that will be recognised as an indefinite delay inside the
+		prvAddCurrentTaskToDelayedList() function. */
+		if( xWaitIndefinitely != pdFALSE )
+		{
+			xTicksToWait = portMAX_DELAY;
+		}
+
+		traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
+		prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+	}
+
+#endif /* configUSE_TIMERS */
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+{
+TCB_t *pxUnblockedTCB;
+BaseType_t xReturn;
+
+	/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+	called from a critical section within an ISR. */
+
+	/* The event list is sorted in priority order, so the first in the list can
+	be removed as it is known to be the highest priority.  Remove the TCB from
+	the delayed list, and add it to the ready list.
+
+	If an event is for a queue that is locked then this function will never
+	get called - the lock count on the queue will get modified instead.  This
+	means exclusive access to the event list is guaranteed here.
+
+	This function assumes that a check has already been made to ensure that
+	pxEventList is not empty. */
+	#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+	{
+		pxUnblockedTCB = prvGetEventListTaskToUnblock( pxEventList );
+
+		if( pxUnblockedTCB == NULL )
+		{
+			/* Every task that had a record in the list had already been
+			unblocked by another object. */
+			return pdFALSE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		pxUnblockedTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+	}
+	#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
+	configASSERT( pxUnblockedTCB );
+	( void ) uxListRemove( &( pxUnblockedTCB->xEventListItem ) );
+
+	#if( configUSE_WAKE_LATENCY_STATS == 1 )
+	{
+		if( taskWAKING_FROM_ISR() != pdFALSE )
+		{
+			taskSTAMP_WAKE_FROM_ISR( pxUnblockedTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_WAKE_LATENCY_STATS */
+
+	if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+	{
+		( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+		prvAddTaskToReadyList( pxUnblockedTCB );
 	}
 	else
 	{
-		++uxPendedTicks;
+		/* The delayed and ready lists cannot be accessed, so hold this task
+		pending until the scheduler is resumed. */
+		vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+	}
+
+	#if( configNUMBER_OF_CORES == 1 )
+	{
+		if( taskPREEMPTS_CURRENT_TASK( pxUnblockedTCB ) )
+		{
+			/* Return true if the task removed from the event list has a higher
+			priority than the calling task.  This allows the calling task to know if
+			it should force a context switch now. */
+			xReturn = pdTRUE;
+
+			/* Mark that a yield is pending in case the user is not using the
+			"xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
+			xYieldPending = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+	}
+	#else
+	{
+		/* Only a yield of the calling core is returned, other cores are
+		interrupted directly.  A task held in the pending ready list is
+		considered when the scheduler is resumed. */
+		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+		{
+			prvYieldForTask( pxUnblockedTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xReturn = xYieldPending;
+	}
+	#endif /* configNUMBER_OF_CORES */
+
+	#if( configUSE_TICKLESS_IDLE != 0 )
+	{
+		/* If a task is blocked on a kernel object then xNextTaskUnblockTime
+		might be set to the blocked task's time out time.  If the task is
+		unblocked for a reason other than a timeout xNextTaskUnblockTime is
+		normally left unchanged, because it is automatically reset to a new
+		value when the tick count equals xNextTaskUnblockTime.  However if
+		tickless idling is used it might be more important to enter sleep mode
+		at the earliest possible time - so reset xNextTaskUnblockTime here to
+		ensure it is updated at the earliest possible time. */
+		prvResetNextTaskUnblockTime();
+	}
+	#endif
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, const TickType_t xItemValue )
+{
+TCB_t *pxUnblockedTCB;
+BaseType_t xReturn;
+
+	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+	the event flags implementation. */
+	configASSERT( uxSchedulerSuspended != pdFALSE );
+
+	/* Store the new item value in the event list. */
+	listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+	/* Remove the event list form the event flag.  Interrupts do not access
+	event flags. */
+	pxUnblockedTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxEventListItem );
+	configASSERT( pxUnblockedTCB );
+	( void ) uxListRemove( pxEventListItem );
+
+	/* Remove the task from the delayed list and add it to the ready list.  The
+	scheduler is suspended so interrupts will not be accessing the ready
+	lists. */
+	( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+	prvAddTaskToReadyList( pxUnblockedTCB );
+
+	#if( configNUMBER_OF_CORES == 1 )
+	{
+		if( taskPREEMPTS_CURRENT_TASK( pxUnblockedTCB ) )
+		{
+			/* Return true if the task removed from the event list has
+			a higher priority than the calling task.  This allows
+			the calling task to know if it should force a context
+			switch now. */
+			xReturn = pdTRUE;
+
+			/* Mark that a yield is pending in case the user is not using the
+			"xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
+			xYieldPending = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+	}
+	#else
+	{
+		/* Only a yield of the calling core is returned, other cores are
+		interrupted directly. */
+		prvYieldForTask( pxUnblockedTCB );
+		xReturn = xYieldPending;
+	}
+	#endif /* configNUMBER_OF_CORES */
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
+{
+	configASSERT( pxTimeOut );
+	pxTimeOut->xOverflowCount = xNumOfOverflows;
+	pxTimeOut->xTimeOnEntering = xTickCount;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait )
+{
+BaseType_t xReturn;
+
+	configASSERT( pxTimeOut );
+	configASSERT( pxTicksToWait );
+
+	taskENTER_CRITICAL();
+	{
+		/* Minor optimisation.  The tick count cannot change in this block. */
+		const TickType_t xConstTickCount = xTickCount;
+
+		#if( INCLUDE_xTaskAbortDelay == 1 )
+			if( pxCurrentTCB->ucDelayAborted != pdFALSE )
+			{
+				/* The delay was aborted, which is not the same as a time out,
+				but has the same result. */
+				pxCurrentTCB->ucDelayAborted = pdFALSE;
+				xReturn = pdTRUE;
+			}
+			else
+		#endif
+
+		#if ( INCLUDE_vTaskSuspend == 1 )
+			if( *pxTicksToWait == portMAX_DELAY )
+			{
+				/* If INCLUDE_vTaskSuspend is set to 1 and the block time
+				specified is the maximum block time then the task should block
+				indefinitely, and therefore never time out. */
+				xReturn = pdFALSE;
+			}
+			else
+		#endif
 
-		/* The tick hook gets called at regular intervals, even if the
-		scheduler is locked. */
-		#if ( configUSE_TICK_HOOK == 1 )
+		if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
 		{
-			vApplicationTickHook();
+			/* The tick count is greater than the time at which
+			vTaskSetTimeout() was called, but has also overflowed since
+			vTaskSetTimeOut() was called.  It must have wrapped all the way
+			around and gone past again. This passed since vTaskSetTimeout()
+			was called. */
+			xReturn = pdTRUE;
 		}
-		#endif
-	}
-
-	#if ( configUSE_PREEMPTION == 1 )
-	{
-		if( xYieldPending != pdFALSE )
+		else if( ( ( TickType_t ) ( xConstTickCount - pxTimeOut->xTimeOnEntering ) ) < *pxTicksToWait ) /*lint !e961 Explicit casting is only redundant with some compilers, whereas others require it to prevent integer conversion errors. */
 		{
-			xSwitchRequired = pdTRUE;
+			/* Not a genuine timeout. Adjust parameters for time remaining. */
+			*pxTicksToWait -= ( xConstTickCount - pxTimeOut->xTimeOnEntering );
+			vTaskSetTimeOutState( pxTimeOut );
+			xReturn = pdFALSE;
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			xReturn = pdTRUE;
 		}
 	}
-	#endif /* configUSE_PREEMPTION */
+	taskEXIT_CRITICAL();
 
-	return xSwitchRequired;
+	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+void vTaskMissedYield( void )
+{
+	xYieldPending = pdTRUE;
+}
+/*-----------------------------------------------------------*/
 
-	void vTaskSetApplicationTaskTag( TaskHandle_t xTask, TaskHookFunction_t pxHookFunction )
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
 	{
-	TCB_t *xTCB;
+	UBaseType_t uxReturn;
+	TCB_t *pxTCB;
 
-		/* If xTask is NULL then it is the task hook of the calling task that is
-		getting set. */
-		if( xTask == NULL )
+		if( xTask != NULL )
 		{
-			xTCB = ( TCB_t * ) pxCurrentTCB;
+			pxTCB = ( TCB_t * ) xTask;
+			uxReturn = pxTCB->uxTaskNumber;
 		}
 		else
 		{
-			xTCB = ( TCB_t * ) xTask;
+			uxReturn = 0U;
 		}
 
-		/* Save the hook function in the TCB.  A critical section is required as
-		the value can be accessed from an interrupt. */
-		taskENTER_CRITICAL();
-			xTCB->pxTaskTag = pxHookFunction;
-		taskEXIT_CRITICAL();
+		return uxReturn;
 	}
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( configUSE_TRACE_FACILITY == 1 )
 
-	TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+	void vTaskSetTaskNumber( TaskHandle_t xTask, const UBaseType_t uxHandle )
 	{
-	TCB_t *xTCB;
-	TaskHookFunction_t xReturn;
-
-		/* If xTask is NULL then we are setting our own task hook. */
-		if( xTask == NULL )
-		{
-			xTCB = ( TCB_t * ) pxCurrentTCB;
-		}
-		else
-		{
-			xTCB = ( TCB_t * ) xTask;
-		}
+	TCB_t *pxTCB;
 
-		/* Save the hook function in the TCB.  A critical section is required as
-		the value can be accessed from an interrupt. */
-		taskENTER_CRITICAL();
+		if( xTask != NULL )
 		{
-			xReturn = xTCB->pxTaskTag;
+			pxTCB = ( TCB_t * ) xTask;
+			pxTCB->uxTaskNumber = uxHandle;
 		}
-		taskEXIT_CRITICAL();
-
-		return xReturn;
 	}
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
+#endif /* configUSE_TRACE_FACILITY */
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+/*
+ * -----------------------------------------------------------
+ * The Idle task.
+ * ----------------------------------------------------------
+ *
+ * The portTASK_FUNCTION() macro is used to allow port/compiler specific
+ * language extensions.  The equivalent prototype for this function is:
+ *
+ * void prvIdleTask( void *pvParameters );
+ *
+ */
+static portTASK_FUNCTION( prvIdleTask, pvParameters )
+{
+	/* Stop warnings. */
+	( void ) pvParameters;
 
-	BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask, void *pvParameter )
+	/** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
+	SCHEDULER IS STARTED. **/
+
+	for( ;; )
 	{
-	TCB_t *xTCB;
-	BaseType_t xReturn;
+		/* See if any tasks have deleted themselves - if so then the idle task
+		is responsible for freeing the deleted task's TCB and stack. */
+		prvCheckTasksWaitingTermination();
 
-		/* If xTask is NULL then we are calling our own task hook. */
-		if( xTask == NULL )
+		#if ( configUSE_PREEMPTION == 0 )
 		{
-			xTCB = ( TCB_t * ) pxCurrentTCB;
+			/* If we are not using preemption we keep forcing a task switch to
+			see if any other task has become available.  If we are using
+			preemption we don't need to do this as any task becoming available
+			will automatically get the processor anyway. */
+			taskYIELD();
 		}
-		else
+		#endif /* configUSE_PREEMPTION */
+
+		#if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
 		{
-			xTCB = ( TCB_t * ) xTask;
+			/* When using preemption tasks of equal priority will be
+			timesliced.  If a task that is sharing the idle priority is ready
+			to run then the idle task should yield before the end of the
+			timeslice.
+
+			A critical region is not required here as we are just reading from
+			the list, and an occasional incorrect value will not matter.  If
+			the ready list at the idle priority contains more than one task
+			per core then a task other than an idle task is ready to
+			execute. */
+			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUMBER_OF_CORES )
+			{
+				taskYIELD();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
 
-		if( xTCB->pxTaskTag != NULL )
+		#if ( configUSE_IDLE_HOOK == 1 )
 		{
-			xReturn = xTCB->pxTaskTag( pvParameter );
+			extern void vApplicationIdleHook( void );
+
+			/* Call the user defined function from within the idle task.  This
+			allows the application designer to add background functionality
+			without the overhead of a separate task.
+			NOTE: vApplicationIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
+			CALL A FUNCTION THAT MIGHT BLOCK. */
+			vApplicationIdleHook();
 		}
-		else
+		#endif /* configUSE_IDLE_HOOK */
+
+		#if ( configNUMBER_OF_CORES > 1 )
 		{
-			xReturn = pdFAIL;
+			/* A task made ready for this core interrupts it (see
+			prvYieldForTask()), so unless a task that shares the idle priority
+			is ready the core can wait for its next interrupt instead of
+			spinning here.  A spinning core would otherwise compete for the
+			memory bus, or on the simulator for a host CPU, with the cores that
+			have work to do. */
+			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) <= ( UBaseType_t ) configNUMBER_OF_CORES )
+			{
+				portWAIT_FOR_INTERRUPT();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		#endif /* configNUMBER_OF_CORES */
 
-		return xReturn;
-	}
+		/* This conditional compilation should use inequality to 0, not equality
+		to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
+		user defined low power mode	implementations require
+		configUSE_TICKLESS_IDLE to be set to a value other than 1. */
+		#if ( configUSE_TICKLESS_IDLE != 0 )
+		{
+		TickType_t xExpectedIdleTime;
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
+			/* It is not desirable to suspend then resume the scheduler on
+			each iteration of the idle task.  Therefore, a preliminary
+			test of the expected idle time is performed without the
+			scheduler suspended.  The result here is not necessarily
+			valid. */
+			xExpectedIdleTime = prvGetExpectedIdleTime();
 
-void vTaskSwitchContext( void )
-{
-	if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
-	{
-		/* The scheduler is currently suspended - do not allow a context
-		switch. */
-		xYieldPending = pdTRUE;
+			if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+			{
+				vTaskSuspendAll();
+				{
+					/* Now the scheduler is suspended, the expected idle
+					time can be sampled again, and this time its value can
+					be used. */
+					configASSERT( xNextTaskUnblockTime >= xTickCount );
+					xExpectedIdleTime = prvGetExpectedIdleTime();
+
+					if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+					{
+						traceLOW_POWER_IDLE_BEGIN();
+						portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
+						traceLOW_POWER_IDLE_END();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				( void ) xTaskResumeAll();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TICKLESS_IDLE */
 	}
-	else
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TICKLESS_IDLE != 0 )
+
+	eSleepModeStatus eTaskConfirmSleepModeStatus( void )
 	{
-		xYieldPending = pdFALSE;
-		traceTASK_SWITCHED_OUT();
+	/* The idle task exists in addition to the application tasks. */
+	const UBaseType_t uxNonApplicationTasks = 1;
+	eSleepModeStatus eReturn = eStandardSleep;
+
+		if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
+		{
+			/* A task was made ready while the scheduler was suspended. */
+			eReturn = eAbortSleep;
+		}
+		else if( xYieldPending != pdFALSE )
+		{
+			/* A yield was pended while the scheduler was suspended. */
+			eReturn = eAbortSleep;
+		}
+		else
+		{
+			/* If all the tasks are in the suspended list (which might mean they
+			have an infinite block time rather than actually being suspended)
+			then it is safe to turn all clocks off and just wait for external
+			interrupts. */
+			if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+			{
+				eReturn = eNoTasksWaitingTimeout;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
 
-		#if ( configGENERATE_RUN_TIME_STATS == 1 )
-		{
-				#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-					portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
-				#else
-					ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-				#endif
+		return eReturn;
+	}
 
-				/* Add the amount of time the task has been running to the
-				accumulated time so far.  The time the task started running was
-				stored in ulTaskSwitchedInTime.  Note that there is no overflow
-				protection here so count values are only valid until the timer
-				overflows.  The guard against negative values is to protect
-				against suspect run time stat counter implementations - which
-				are provided by the application, not the kernel. */
-				if( ulTotalRunTime > ulTaskSwitchedInTime )
-				{
-					pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-				ulTaskSwitchedInTime = ulTotalRunTime;
-		}
-		#endif /* configGENERATE_RUN_TIME_STATS */
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
 
-		/* Check for stack overflow, if configured. */
-		taskCHECK_FOR_STACK_OVERFLOW();
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
 
-		/* Select a new task to run using either the generic C or port
-		optimised asm code. */
-		taskSELECT_HIGHEST_PRIORITY_TASK();
-		traceTASK_SWITCHED_IN();
+	void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet, BaseType_t xIndex, void *pvValue )
+	{
+	TCB_t *pxTCB;
 
-		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
 		{
-			/* Switch Newlib's _impure_ptr variable to point to the _reent
-			structure specific to this task. */
-			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+			pxTCB = prvGetTCBFromHandle( xTaskToSet );
+			pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
 		}
-		#endif /* configUSE_NEWLIB_REENTRANT */
 	}
-}
-/*-----------------------------------------------------------*/
-
-void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksToWait )
-{
-	configASSERT( pxEventList );
-
-	/* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
-	SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
-
-	/* Place the event list item of the TCB in the appropriate event list.
-	This is placed in the list in priority order so the highest priority task
-	is the first to be woken by the event.  The queue that contains the event
-	list is locked, preventing simultaneous access from interrupts. */
-	vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
 
-	prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-}
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
 /*-----------------------------------------------------------*/
 
-void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xItemValue, const TickType_t xTicksToWait )
-{
-	configASSERT( pxEventList );
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
 
-	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-	the event groups implementation. */
-	configASSERT( uxSchedulerSuspended != 0 );
+	void *pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery, BaseType_t xIndex )
+	{
+	void *pvReturn = NULL;
+	TCB_t *pxTCB;
 
-	/* Store the item value in the event list item.  It is safe to access the
-	event list item here as interrupts won't access the event list item of a
-	task that is not in the Blocked state. */
-	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+		if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+		{
+			pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+			pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+		}
+		else
+		{
+			pvReturn = NULL;
+		}
 
-	/* Place the event list item of the TCB at the end of the appropriate event
-	list.  It is safe to access the event list here because it is part of an
-	event group implementation - and interrupts don't access event groups
-	directly (instead they access them indirectly by pending function calls to
-	the task level). */
-	vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+		return pvReturn;
+	}
 
-	prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-}
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
 /*-----------------------------------------------------------*/
 
-#if( configUSE_TIMERS == 1 )
+#if ( portUSING_MPU_WRAPPERS == 1 )
 
-	void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
+	void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify, const MemoryRegion_t * const xRegions )
 	{
-		configASSERT( pxEventList );
-
-		/* This function should not be called by application code hence the
-		'Restricted' in its name.  It is not part of the public API.  It is
-		designed for use by kernel code, and has special calling requirements -
-		it should be called with the scheduler suspended. */
-
-
-		/* Place the event list item of the TCB in the appropriate event list.
-		In this case it is assume that this is the only task that is going to
-		be waiting on this event list, so the faster vListInsertEnd() function
-		can be used in place of vListInsert. */
-		vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+	TCB_t *pxTCB;
 
-		/* If the task should block indefinitely then set the block time to a
-		value that will be recognised as an indefinite delay inside the
-		prvAddCurrentTaskToDelayedList() function. */
-		if( xWaitIndefinitely != pdFALSE )
-		{
-			xTicksToWait = portMAX_DELAY;
-		}
+		/* If null is passed in here then we are modifying the MPU settings of
+		the calling task. */
+		pxTCB = prvGetTCBFromHandle( xTaskToModify );
 
-		traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
-		prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+		vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
 	}
 
-#endif /* configUSE_TIMERS */
+#endif /* portUSING_MPU_WRAPPERS */
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+static void prvInitialiseTaskLists( void )
 {
-TCB_t *pxUnblockedTCB;
-BaseType_t xReturn;
-
-	/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
-	called from a critical section within an ISR. */
+UBaseType_t uxPriority;
 
-	/* The event list is sorted in priority order, so the first in the list can
-	be removed as it is known to be the highest priority.  Remove the TCB from
-	the delayed list, and add it to the ready list.
+	for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+	{
+		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+	}
 
-	If an event is for a queue that is locked then this function will never
-	get called - the lock count on the queue will get modified instead.  This
-	means exclusive access to the event list is guaranteed here.
+	#if( configUSE_TIMING_WHEEL_DELAYS == 0 )
+	{
+		vListInitialise( &xDelayedTaskList1 );
+		vListInitialise( &xDelayedTaskList2 );
+	}
+	#else
+	{
+		for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( taskWHEEL_LEVELS * taskWHEEL_SLOTS ); uxPriority++ )
+		{
+			vListInitialise( &( xDelayWheel[ uxPriority ] ) );
+		}
+	}
+	#endif
 
-	This function assumes that a check has already been made to ensure that
-	pxEventList is not empty. */
-	pxUnblockedTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
-	configASSERT( pxUnblockedTCB );
-	( void ) uxListRemove( &( pxUnblockedTCB->xEventListItem ) );
+	vListInitialise( &xPendingReadyList );
 
-	if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+	#if ( INCLUDE_vTaskDelete == 1 )
 	{
-		( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
-		prvAddTaskToReadyList( pxUnblockedTCB );
+		vListInitialise( &xTasksWaitingTermination );
 	}
-	else
+	#endif /* INCLUDE_vTaskDelete */
+
+	#if ( INCLUDE_vTaskSuspend == 1 )
 	{
-		/* The delayed and ready lists cannot be accessed, so hold this task
-		pending until the scheduler is resumed. */
-		vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+		vListInitialise( &xSuspendedTaskList );
 	}
+	#endif /* INCLUDE_vTaskSuspend */
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+	#if( configUSE_TASK_BUDGETS == 1 )
 	{
-		/* Return true if the task removed from the event list has a higher
-		priority than the calling task.  This allows the calling task to know if
-		it should force a context switch now. */
-		xReturn = pdTRUE;
-
-		/* Mark that a yield is pending in case the user is not using the
-		"xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
-		xYieldPending = pdTRUE;
+		vListInitialise( &xThrottledTaskList );
 	}
-	else
+	#endif /* configUSE_TASK_BUDGETS */
+
+	#if( configUSE_TASK_SNAPSHOTS == 1 )
 	{
-		xReturn = pdFALSE;
+		vListInitialise( &xAllTasksList );
 	}
+	#endif /* configUSE_TASK_SNAPSHOTS */
 
-	#if( configUSE_TICKLESS_IDLE != 0 )
+	#if( configUSE_TIMING_WHEEL_DELAYS == 0 )
 	{
-		/* If a task is blocked on a kernel object then xNextTaskUnblockTime
-		might be set to the blocked task's time out time.  If the task is
-		unblocked for a reason other than a timeout xNextTaskUnblockTime is
-		normally left unchanged, because it is automatically reset to a new
-		value when the tick count equals xNextTaskUnblockTime.  However if
-		tickless idling is used it might be more important to enter sleep mode
-		at the earliest possible time - so reset xNextTaskUnblockTime here to
-		ensure it is updated at the earliest possible time. */
-		prvResetNextTaskUnblockTime();
+		/* Start with pxDelayedTaskList using list1 and the
+		pxOverflowDelayedTaskList using list2. */
+		pxDelayedTaskList = &xDelayedTaskList1;
+		pxOverflowDelayedTaskList = &xDelayedTaskList2;
 	}
 	#endif
-
-	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, const TickType_t xItemValue )
+static void prvCheckTasksWaitingTermination( void )
 {
-TCB_t *pxUnblockedTCB;
-BaseType_t xReturn;
 
-	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-	the event flags implementation. */
-	configASSERT( uxSchedulerSuspended != pdFALSE );
+	/** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
 
-	/* Store the new item value in the event list. */
-	listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+	#if ( INCLUDE_vTaskDelete == 1 )
+	{
+		#if( configNUMBER_OF_CORES == 1 )
+		{
+			BaseType_t xListIsEmpty;
 
-	/* Remove the event list form the event flag.  Interrupts do not access
-	event flags. */
-	pxUnblockedTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxEventListItem );
-	configASSERT( pxUnblockedTCB );
-	( void ) uxListRemove( pxEventListItem );
+			/* ucTasksDeleted is used to prevent vTaskSuspendAll() being called
+			too often in the idle task. */
+			while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+			{
+				vTaskSuspendAll();
+				{
+					xListIsEmpty = listLIST_IS_EMPTY( &xTasksWaitingTermination );
+				}
+				( void ) xTaskResumeAll();
 
-	/* Remove the task from the delayed list and add it to the ready list.  The
-	scheduler is suspended so interrupts will not be accessing the ready
-	lists. */
-	( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
-	prvAddTaskToReadyList( pxUnblockedTCB );
+				if( xListIsEmpty == pdFALSE )
+				{
+					TCB_t *pxTCB;
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
-	{
-		/* Return true if the task removed from the event list has
-		a higher priority than the calling task.  This allows
-		the calling task to know if it should force a context
-		switch now. */
-		xReturn = pdTRUE;
+					taskENTER_CRITICAL();
+					{
+						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
+						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+						--uxCurrentNumberOfTasks;
+						--uxDeletedTasksWaitingCleanUp;
+					}
+					taskEXIT_CRITICAL();
 
-		/* Mark that a yield is pending in case the user is not using the
-		"xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
-		xYieldPending = pdTRUE;
-	}
-	else
-	{
-		xReturn = pdFALSE;
-	}
+					prvDeleteTCB( pxTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		#else
+		{
+		TCB_t *pxTCB;
 
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
+			while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+			{
+				pxTCB = NULL;
 
-void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
-{
-	configASSERT( pxTimeOut );
-	pxTimeOut->xOverflowCount = xNumOfOverflows;
-	pxTimeOut->xTimeOnEntering = xTickCount;
+				taskENTER_CRITICAL();
+				{
+					/* The idle task of another core may have freed the task
+					while this one was waiting for the critical section. */
+					if( listLIST_IS_EMPTY( &xTasksWaitingTermination ) == pdFALSE )
+					{
+						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
+
+						/* A task deleted while it was running cannot be freed
+						until its core has switched it out. */
+						if( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING )
+						{
+							( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+							--uxCurrentNumberOfTasks;
+							--uxDeletedTasksWaitingCleanUp;
+						}
+						else
+						{
+							pxTCB = NULL;
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				taskEXIT_CRITICAL();
+
+				if( pxTCB != NULL )
+				{
+					prvDeleteTCB( pxTCB );
+				}
+				else
+				{
+					/* Try again the next time the idle task runs. */
+					break;
+				}
+			}
+		}
+		#endif /* configNUMBER_OF_CORES */
+	}
+	#endif /* INCLUDE_vTaskDelete */
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait )
-{
-BaseType_t xReturn;
-
-	configASSERT( pxTimeOut );
-	configASSERT( pxTicksToWait );
+#if( configUSE_TRACE_FACILITY == 1 )
 
-	taskENTER_CRITICAL();
+	void vTaskGetInfo( TaskHandle_t xTask, TaskStatus_t *pxTaskStatus, BaseType_t xGetFreeStackSpace, eTaskState eState )
 	{
-		/* Minor optimisation.  The tick count cannot change in this block. */
-		const TickType_t xConstTickCount = xTickCount;
+	TCB_t *pxTCB;
 
-		#if( INCLUDE_xTaskAbortDelay == 1 )
-			if( pxCurrentTCB->ucDelayAborted != pdFALSE )
-			{
-				/* The delay was aborted, which is not the same as a time out,
-				but has the same result. */
-				pxCurrentTCB->ucDelayAborted = pdFALSE;
-				xReturn = pdTRUE;
-			}
-			else
-		#endif
+		/* xTask is NULL then get the state of the calling task. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
+		pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName [ 0 ] );
+		pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
+		pxTaskStatus->pxStackBase = pxTCB->pxStack;
+		pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
 
 		#if ( INCLUDE_vTaskSuspend == 1 )
-			if( *pxTicksToWait == portMAX_DELAY )
+		{
+			/* If the task is in the suspended list then there is a chance it is
+			actually just blocked indefinitely - so really it should be reported as
+			being in the Blocked state. */
+			if( pxTaskStatus->eCurrentState == eSuspended )
 			{
-				/* If INCLUDE_vTaskSuspend is set to 1 and the block time
-				specified is the maximum block time then the task should block
-				indefinitely, and therefore never time out. */
-				xReturn = pdFALSE;
+				vTaskSuspendAll();
+				{
+					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+					{
+						pxTaskStatus->eCurrentState = eBlocked;
+					}
+				}
+				xTaskResumeAll();
 			}
-			else
+		}
+		#endif /* INCLUDE_vTaskSuspend */
+
+		#if ( configUSE_MUTEXES == 1 )
+		{
+			pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
+		}
+		#else
+		{
+			pxTaskStatus->uxBasePriority = 0;
+		}
 		#endif
 
-		if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
 		{
-			/* The tick count is greater than the time at which
-			vTaskSetTimeout() was called, but has also overflowed since
-			vTaskSetTimeOut() was called.  It must have wrapped all the way
-			around and gone past again. This passed since vTaskSetTimeout()
-			was called. */
-			xReturn = pdTRUE;
+			pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
 		}
-		else if( ( ( TickType_t ) ( xConstTickCount - pxTimeOut->xTimeOnEntering ) ) < *pxTicksToWait ) /*lint !e961 Explicit casting is only redundant with some compilers, whereas others require it to prevent integer conversion errors. */
+		#else
 		{
-			/* Not a genuine timeout. Adjust parameters for time remaining. */
-			*pxTicksToWait -= ( xConstTickCount - pxTimeOut->xTimeOnEntering );
-			vTaskSetTimeOutState( pxTimeOut );
-			xReturn = pdFALSE;
+			pxTaskStatus->ulRunTimeCounter = 0;
+		}
+		#endif
+
+		/* Obtaining the task state is a little fiddly, so is only done if the value
+		of eState passed into this function is eInvalid - otherwise the state is
+		just set to whatever is passed in. */
+		if( eState != eInvalid )
+		{
+			pxTaskStatus->eCurrentState = eState;
 		}
 		else
 		{
-			xReturn = pdTRUE;
+			pxTaskStatus->eCurrentState = eTaskGetState( xTask );
 		}
-	}
-	taskEXIT_CRITICAL();
-
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
-
-void vTaskMissedYield( void )
-{
-	xYieldPending = pdTRUE;
-}
-/*-----------------------------------------------------------*/
-
-#if ( configUSE_TRACE_FACILITY == 1 )
-
-	UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
-	{
-	UBaseType_t uxReturn;
-	TCB_t *pxTCB;
 
-		if( xTask != NULL )
+		/* Obtaining the stack space takes some time, so the xGetFreeStackSpace
+		parameter is provided to allow it to be skipped. */
+		if( xGetFreeStackSpace != pdFALSE )
 		{
-			pxTCB = ( TCB_t * ) xTask;
-			uxReturn = pxTCB->uxTaskNumber;
+			#if ( portSTACK_GROWTH > 0 )
+			{
+				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+			}
+			#else
+			{
+				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+			}
+			#endif
 		}
 		else
 		{
-			uxReturn = 0U;
+			pxTaskStatus->usStackHighWaterMark = 0;
 		}
-
-		return uxReturn;
 	}
 
 #endif /* configUSE_TRACE_FACILITY */
@@ -3104,654 +6738,758 @@ void vTaskMissedYield( void )
 
 #if ( configUSE_TRACE_FACILITY == 1 )
 
-	void vTaskSetTaskNumber( TaskHandle_t xTask, const UBaseType_t uxHandle )
+	static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t *pxTaskStatusArray, List_t *pxList, eTaskState eState )
 	{
-	TCB_t *pxTCB;
+	volatile TCB_t *pxNextTCB, *pxFirstTCB;
+	UBaseType_t uxTask = 0;
 
-		if( xTask != NULL )
+		if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
 		{
-			pxTCB = ( TCB_t * ) xTask;
-			pxTCB->uxTaskNumber = uxHandle;
+			listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList );
+
+			/* Populate an TaskStatus_t structure within the
+			pxTaskStatusArray array for each task that is referenced from
+			pxList.  See the definition of TaskStatus_t in task.h for the
+			meaning of each TaskStatus_t structure member. */
+			do
+			{
+				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList );
+				vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
+				uxTask++;
+			} while( pxNextTCB != pxFirstTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return uxTask;
 	}
 
 #endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
 
-/*
- * -----------------------------------------------------------
- * The Idle task.
- * ----------------------------------------------------------
- *
- * The portTASK_FUNCTION() macro is used to allow port/compiler specific
- * language extensions.  The equivalent prototype for this function is:
- *
- * void prvIdleTask( void *pvParameters );
- *
- */
-static portTASK_FUNCTION( prvIdleTask, pvParameters )
-{
-	/* Stop warnings. */
-	( void ) pvParameters;
-
-	/** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
-	SCHEDULER IS STARTED. **/
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
 
-	for( ;; )
+	static uint16_t prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
 	{
-		/* See if any tasks have deleted themselves - if so then the idle task
-		is responsible for freeing the deleted task's TCB and stack. */
-		prvCheckTasksWaitingTermination();
-
-		#if ( configUSE_PREEMPTION == 0 )
-		{
-			/* If we are not using preemption we keep forcing a task switch to
-			see if any other task has become available.  If we are using
-			preemption we don't need to do this as any task becoming available
-			will automatically get the processor anyway. */
-			taskYIELD();
-		}
-		#endif /* configUSE_PREEMPTION */
+	uint32_t ulCount = 0U;
 
-		#if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
+		while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
 		{
-			/* When using preemption tasks of equal priority will be
-			timesliced.  If a task that is sharing the idle priority is ready
-			to run then the idle task should yield before the end of the
-			timeslice.
-
-			A critical region is not required here as we are just reading from
-			the list, and an occasional incorrect value will not matter.  If
-			the ready list at the idle priority contains more than one task
-			then a task other than the idle task is ready to execute. */
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
-			{
-				taskYIELD();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			pucStackByte -= portSTACK_GROWTH;
+			ulCount++;
 		}
-		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
 
-		#if ( configUSE_IDLE_HOOK == 1 )
-		{
-			extern void vApplicationIdleHook( void );
+		ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
 
-			/* Call the user defined function from within the idle task.  This
-			allows the application designer to add background functionality
-			without the overhead of a separate task.
-			NOTE: vApplicationIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
-			CALL A FUNCTION THAT MIGHT BLOCK. */
-			vApplicationIdleHook();
-		}
-		#endif /* configUSE_IDLE_HOOK */
+		return ( uint16_t ) ulCount;
+	}
 
-		/* This conditional compilation should use inequality to 0, not equality
-		to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
-		user defined low power mode	implementations require
-		configUSE_TICKLESS_IDLE to be set to a value other than 1. */
-		#if ( configUSE_TICKLESS_IDLE != 0 )
-		{
-		TickType_t xExpectedIdleTime;
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) */
+/*-----------------------------------------------------------*/
 
-			/* It is not desirable to suspend then resume the scheduler on
-			each iteration of the idle task.  Therefore, a preliminary
-			test of the expected idle time is performed without the
-			scheduler suspended.  The result here is not necessarily
-			valid. */
-			xExpectedIdleTime = prvGetExpectedIdleTime();
+#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
 
-			if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
-			{
-				vTaskSuspendAll();
-				{
-					/* Now the scheduler is suspended, the expected idle
-					time can be sampled again, and this time its value can
-					be used. */
-					configASSERT( xNextTaskUnblockTime >= xTickCount );
-					xExpectedIdleTime = prvGetExpectedIdleTime();
+	UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	uint8_t *pucEndOfStack;
+	UBaseType_t uxReturn;
 
-					if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
-					{
-						traceLOW_POWER_IDLE_BEGIN();
-						portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
-						traceLOW_POWER_IDLE_END();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				( void ) xTaskResumeAll();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		#if portSTACK_GROWTH < 0
+		{
+			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
 		}
-		#endif /* configUSE_TICKLESS_IDLE */
+		#else
+		{
+			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+		}
+		#endif
+
+		uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+		return uxReturn;
 	}
-}
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
 /*-----------------------------------------------------------*/
 
-#if( configUSE_TICKLESS_IDLE != 0 )
+#if ( INCLUDE_vTaskDelete == 1 )
 
-	eSleepModeStatus eTaskConfirmSleepModeStatus( void )
+	static void prvDeleteTCB( TCB_t *pxTCB )
 	{
-	/* The idle task exists in addition to the application tasks. */
-	const UBaseType_t uxNonApplicationTasks = 1;
-	eSleepModeStatus eReturn = eStandardSleep;
+		/* This call is required specifically for the TriCore port.  It must be
+		above the vPortFree() calls.  The call is also used by ports/demos that
+		want to allocate and clean RAM statically. */
+		portCLEAN_UP_TCB( pxTCB );
 
-		if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
+		/* Free up the memory allocated by the scheduler for the task.  It is up
+		to the task to free any memory allocated at the application level. */
+		#if ( configUSE_NEWLIB_REENTRANT == 1 )
 		{
-			/* A task was made ready while the scheduler was suspended. */
-			eReturn = eAbortSleep;
+			_reclaim_reent( &( pxTCB->xNewLib_reent ) );
 		}
-		else if( xYieldPending != pdFALSE )
+		#endif /* configUSE_NEWLIB_REENTRANT */
+
+		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
 		{
-			/* A yield was pended while the scheduler was suspended. */
-			eReturn = eAbortSleep;
+			/* The task can only have been allocated dynamically - free both
+			the stack and TCB. */
+			vPortFree( pxTCB->pxStack );
+			vPortFree( pxTCB );
 		}
-		else
+		#elif( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE == 1 )
 		{
-			/* If all the tasks are in the suspended list (which might mean they
-			have an infinite block time rather than actually being suspended)
-			then it is safe to turn all clocks off and just wait for external
-			interrupts. */
-			if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+			/* The task could have been allocated statically or dynamically, so
+			check what was statically allocated before trying to free the
+			memory. */
+			if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
 			{
-				eReturn = eNoTasksWaitingTimeout;
+				/* Both the stack and TCB were allocated dynamically, so both
+				must be freed. */
+				vPortFree( pxTCB->pxStack );
+				vPortFree( pxTCB );
+			}
+			else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+			{
+				/* Only the stack was statically allocated, so the TCB is the
+				only memory that must be freed. */
+				vPortFree( pxTCB );
 			}
 			else
 			{
+				/* Neither the stack nor the TCB were allocated dynamically, so
+				nothing needs to be freed. */
+				configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB	)
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-
-		return eReturn;
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 	}
 
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+static void prvResetNextTaskUnblockTime( void )
+{
+#if( configUSE_TIMING_WHEEL_DELAYS == 0 )
+TCB_t *pxTCB;
 
-	void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet, BaseType_t xIndex, void *pvValue )
+	if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
 	{
-	TCB_t *pxTCB;
+		/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+		the maximum possible value so it is	extremely unlikely that the
+		if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+		there is an item in the delayed list. */
+		xNextTaskUnblockTime = portMAX_DELAY;
+	}
+	else
+	{
+		/* The new current delayed list is not empty, get the value of
+		the item at the head of the delayed list.  This is the time at
+		which the task at the head of the delayed list should be removed
+		from the Blocked state. */
+		( pxTCB ) = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
+	}
+}
+#else /* configUSE_TIMING_WHEEL_DELAYS */
+const TickType_t xTimeNow = xTickCount;
+TickType_t xCycleMask, xSlotDistance, xItemDistance, xNextDistance = portMAX_DELAY;
+BaseType_t xFound = pdFALSE;
+UBaseType_t uxLevel, uxSlot, uxShift;
+uint32_t ulMap;
+List_t *pxList;
+ListItem_t const *pxListItem, *pxListEnd;
+
+	/* All the tasks in one slot are due within the span of ticks covered by
+	that slot, so a slot only needs to be searched if its first tick comes
+	before the earliest wake time found so far.  Distances are measured forward
+	from the current tick count so wake times that have overflowed sort after
+	those that have not. */
+	for( uxLevel = ( UBaseType_t ) 0U; uxLevel < taskWHEEL_LEVELS; uxLevel++ )
+	{
+		uxShift = uxLevel * configTIMING_WHEEL_SLOT_BITS;
 
-		if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+		/* The slots of this level repeat every ( xCycleMask + 1 ) ticks. */
+		xCycleMask = ( taskWHEEL_SLOT_MASK << uxShift ) | ( ( ( TickType_t ) 1U << uxShift ) - ( TickType_t ) 1U );
+
+		for( uxSlot = ( UBaseType_t ) 0U, ulMap = ulDelayWheelMap[ uxLevel ]; ulMap != 0UL; uxSlot++, ulMap >>= 1UL )
 		{
-			pxTCB = prvGetTCBFromHandle( xTaskToSet );
-			pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+			if( ( ulMap & 1UL ) == 0UL )
+			{
+				continue;
+			}
+
+			pxList = &( xDelayWheel[ ( uxLevel * taskWHEEL_SLOTS ) + uxSlot ] );
+
+			if( listLIST_IS_EMPTY( pxList ) != pdFALSE )
+			{
+				/* The tasks that were in this slot have since left it. */
+				ulDelayWheelMap[ uxLevel ] &= ~( 1UL << uxSlot );
+				continue;
+			}
+
+			/* Distance to the next tick count at which this slot is reached. */
+			xSlotDistance = ( ( ( TickType_t ) uxSlot << uxShift ) - xTimeNow ) & xCycleMask;
+
+			if( ( xFound != pdFALSE ) && ( xSlotDistance >= xNextDistance ) )
+			{
+				continue;
+			}
+
+			if( uxLevel == ( UBaseType_t ) 0U )
+			{
+				/* Level 0 slots hold a single wake time. */
+				xNextDistance = xSlotDistance;
+				xFound = pdTRUE;
+			}
+			else
+			{
+				pxListEnd = listGET_END_MARKER( pxList );
+
+				for( pxListItem = listGET_HEAD_ENTRY( pxList ); pxListItem != pxListEnd; pxListItem = listGET_NEXT( pxListItem ) )
+				{
+					xItemDistance = listGET_LIST_ITEM_VALUE( pxListItem ) - xTimeNow;
+
+					if( ( xFound == pdFALSE ) || ( xItemDistance < xNextDistance ) )
+					{
+						xNextDistance = xItemDistance;
+						xFound = pdTRUE;
+					}
+				}
+			}
 		}
 	}
 
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+	if( ( xFound == pdFALSE ) || ( ( TickType_t ) ( xTimeNow + xNextDistance ) < xTimeNow ) )
+	{
+		/* There are no Blocked tasks, or the earliest wake time is after the
+		tick count next overflows.  As with the sorted delayed list the time is
+		recalculated when the tick count wraps. */
+		xNextTaskUnblockTime = portMAX_DELAY;
+	}
+	else
+	{
+		xNextTaskUnblockTime = xTimeNow + xNextDistance;
+	}
+}
+#endif /* configUSE_TIMING_WHEEL_DELAYS */
 /*-----------------------------------------------------------*/
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
 
-	void *pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery, BaseType_t xIndex )
+	TaskHandle_t xTaskGetCurrentTaskHandle( void )
 	{
-	void *pvReturn = NULL;
-	TCB_t *pxTCB;
+	TaskHandle_t xReturn;
 
-		if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
-		{
-			pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-			pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
-		}
-		else
-		{
-			pvReturn = NULL;
-		}
+		/* A critical section is not required as this is not called from
+		an interrupt and the current TCB will always be the same for any
+		individual execution thread. */
+		xReturn = pxCurrentTCB;
 
-		return pvReturn;
+		return xReturn;
 	}
 
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( portUSING_MPU_WRAPPERS == 1 )
+#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 
-	void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify, const MemoryRegion_t * const xRegions )
+	BaseType_t xTaskGetSchedulerState( void )
 	{
-	TCB_t *pxTCB;
+	BaseType_t xReturn;
 
-		/* If null is passed in here then we are modifying the MPU settings of
-		the calling task. */
-		pxTCB = prvGetTCBFromHandle( xTaskToModify );
+		if( xSchedulerRunning == pdFALSE )
+		{
+			xReturn = taskSCHEDULER_NOT_STARTED;
+		}
+		else
+		{
+			if( taskSCHEDULER_SUSPENDED_BY_CALLER() == pdFALSE )
+			{
+				xReturn = taskSCHEDULER_RUNNING;
+			}
+			else
+			{
+				xReturn = taskSCHEDULER_SUSPENDED;
+			}
+		}
 
-		vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
+		return xReturn;
 	}
 
-#endif /* portUSING_MPU_WRAPPERS */
+#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-static void prvInitialiseTaskLists( void )
-{
-UBaseType_t uxPriority;
+#if ( configUSE_MUTEXES == 1 )
 
-	for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+	static void prvSetInheritedPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority )
 	{
-		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
-	}
+	const UBaseType_t uxPriorityUsedOnEntry = pxTCB->uxPriority;
+	List_t *pxEventList;
 
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
-	vListInitialise( &xPendingReadyList );
+		/* Only reset the event list item value if the value is not being used
+		for anything else. */
+		if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
-	#if ( INCLUDE_vTaskDelete == 1 )
-	{
-		vListInitialise( &xTasksWaitingTermination );
-	}
-	#endif /* INCLUDE_vTaskDelete */
+			/* Tasks waiting on a queue or mutex are held in priority order, so
+			a blocked task is moved to the position for its new priority - in
+			particular a mutex holder that is itself waiting for a mutex must be
+			the first to get that mutex if it inherits the highest priority. */
+			pxEventList = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
 
-	#if ( INCLUDE_vTaskSuspend == 1 )
-	{
-		vListInitialise( &xSuspendedTaskList );
-	}
-	#endif /* INCLUDE_vTaskSuspend */
+			if( ( pxEventList != NULL ) && ( pxEventList != &xPendingReadyList ) )
+			{
+				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				vListInsert( pxEventList, &( pxTCB->xEventListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-	using list2. */
-	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
-}
-/*-----------------------------------------------------------*/
+			#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+			{
+				prvReorderMultipleObjectWaitRecords( pxTCB );
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-static void prvCheckTasksWaitingTermination( void )
-{
+		/* If the task being modified is in the ready state it will need to be
+		moved into a new list. */
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+		{
+			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				taskRESET_READY_PRIORITY( uxPriorityUsedOnEntry );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-	/** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
+			/* Change the priority before being moved into the new list. */
+			pxTCB->uxPriority = uxNewPriority;
+			prvAddTaskToReadyList( pxTCB );
+		}
+		else
+		{
+			/* Just change the priority. */
+			pxTCB->uxPriority = uxNewPriority;
+		}
+	}
+	/*-----------------------------------------------------------*/
 
-	#if ( INCLUDE_vTaskDelete == 1 )
+	BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
 	{
-		BaseType_t xListIsEmpty;
+	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+	BaseType_t xReturn = pdFALSE;
 
-		/* ucTasksDeleted is used to prevent vTaskSuspendAll() being called
-		too often in the idle task. */
-		while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+		/* If the mutex was given back by an interrupt while the queue was
+		locked then the mutex holder might now be NULL. */
+		if( pxMutexHolder != NULL )
 		{
-			vTaskSuspendAll();
+			/* If the holder of the mutex has a priority below the priority of
+			the task attempting to obtain the mutex then it will temporarily
+			inherit the priority of the task attempting to obtain the mutex. */
+			if( pxTCB->uxPriority < pxCurrentTCB->uxPriority )
+			{
+				prvSetInheritedPriority( pxTCB, pxCurrentTCB->uxPriority );
+				traceTASK_PRIORITY_INHERIT( pxTCB, pxCurrentTCB->uxPriority );
+			}
+			else
 			{
-				xListIsEmpty = listLIST_IS_EMPTY( &xTasksWaitingTermination );
+				mtCOVERAGE_TEST_MARKER();
 			}
-			( void ) xTaskResumeAll();
 
-			if( xListIsEmpty == pdFALSE )
+			/* The holder may already have inherited the same or a higher
+			priority from another task, but its priority still depends on the
+			calling task if the calling task is above its base priority. */
+			if( pxTCB->uxBasePriority < pxCurrentTCB->uxPriority )
 			{
-				TCB_t *pxTCB;
-
-				taskENTER_CRITICAL();
-				{
-					pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-					--uxCurrentNumberOfTasks;
-					--uxDeletedTasksWaitingCleanUp;
-				}
-				taskEXIT_CRITICAL();
-
-				prvDeleteTCB( pxTCB );
+				xReturn = pdTRUE;
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
 	}
-	#endif /* INCLUDE_vTaskDelete */
-}
+
+#endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_MUTEXES == 1 )
 
-	void vTaskGetInfo( TaskHandle_t xTask, TaskStatus_t *pxTaskStatus, BaseType_t xGetFreeStackSpace, eTaskState eState )
+	BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
 	{
-	TCB_t *pxTCB;
+	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+	BaseType_t xReturn = pdFALSE;
 
-		/* xTask is NULL then get the state of the calling task. */
-		pxTCB = prvGetTCBFromHandle( xTask );
+		if( pxMutexHolder != NULL )
+		{
+			/* A task can only have an inherited priority if it holds the mutex.
+			If the mutex is held by a task then it cannot be given from an
+			interrupt, and if a mutex is given by the holding task then it must
+			be the running state task. */
+			configASSERT( pxTCB == pxCurrentTCB );
 
-		pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
-		pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName [ 0 ] );
-		pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
-		pxTaskStatus->pxStackBase = pxTCB->pxStack;
-		pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+			configASSERT( pxTCB->uxMutexesHeld );
+			( pxTCB->uxMutexesHeld )--;
 
-		#if ( INCLUDE_vTaskSuspend == 1 )
-		{
-			/* If the task is in the suspended list then there is a chance it is
-			actually just blocked indefinitely - so really it should be reported as
-			being in the Blocked state. */
-			if( pxTaskStatus->eCurrentState == eSuspended )
+			/* Has the holder of the mutex inherited the priority of another
+			task? */
+			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
 			{
-				vTaskSuspendAll();
+				/* Only disinherit if no other mutexes are held. */
+				if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
 				{
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+					/* A task can only have an inherited priority if it holds
+					the mutex.  If the mutex is held by a task then it cannot be
+					given from an interrupt, and if a mutex is given by the
+					holding	task then it must be the running state task.  Remove
+					the	holding task from the ready	list. */
+					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
 					{
-						pxTaskStatus->eCurrentState = eBlocked;
+						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
 					}
-				}
-				xTaskResumeAll();
-			}
-		}
-		#endif /* INCLUDE_vTaskSuspend */
-
-		#if ( configUSE_MUTEXES == 1 )
-		{
-			pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
-		}
-		#else
-		{
-			pxTaskStatus->uxBasePriority = 0;
-		}
-		#endif
 
-		#if ( configGENERATE_RUN_TIME_STATS == 1 )
-		{
-			pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
-		}
-		#else
-		{
-			pxTaskStatus->ulRunTimeCounter = 0;
-		}
-		#endif
+					/* Disinherit the priority before adding the task into the
+					new	ready list. */
+					traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
+					pxTCB->uxPriority = pxTCB->uxBasePriority;
 
-		/* Obtaining the task state is a little fiddly, so is only done if the value
-		of eState passed into this function is eInvalid - otherwise the state is
-		just set to whatever is passed in. */
-		if( eState != eInvalid )
-		{
-			pxTaskStatus->eCurrentState = eState;
-		}
-		else
-		{
-			pxTaskStatus->eCurrentState = eTaskGetState( xTask );
-		}
+					/* Reset the event list item value.  It cannot be in use for
+					any other purpose if this task is running, and it must be
+					running to give back the mutex. */
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					prvAddTaskToReadyList( pxTCB );
 
-		/* Obtaining the stack space takes some time, so the xGetFreeStackSpace
-		parameter is provided to allow it to be skipped. */
-		if( xGetFreeStackSpace != pdFALSE )
-		{
-			#if ( portSTACK_GROWTH > 0 )
-			{
-				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+					/* Return true to indicate that a context switch is required.
+					This is only actually required in the corner case whereby
+					multiple mutexes were held and the mutexes were given back
+					in an order different to that in which they were taken.
+					If a context switch did not occur when the first mutex was
+					returned, even if a task was waiting on it, then a context
+					switch should occur when the last mutex is returned whether
+					a task is waiting on it or not. */
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
-			#else
+			else
 			{
-				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+				mtCOVERAGE_TEST_MARKER();
 			}
-			#endif
 		}
 		else
 		{
-			pxTaskStatus->usStackHighWaterMark = 0;
+			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return xReturn;
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_MUTEXES == 1 )
 
-	static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t *pxTaskStatusArray, List_t *pxList, eTaskState eState )
+	BaseType_t xTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, const UBaseType_t uxHighestPriorityWaitingTask )
 	{
-	volatile TCB_t *pxNextTCB, *pxFirstTCB;
-	UBaseType_t uxTask = 0;
+	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+	UBaseType_t uxPriorityToUse;
+	BaseType_t xReturn = pdFALSE;
 
-		if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+		/* The mutex may have been given back while the calling task was
+		timing out. */
+		if( pxMutexHolder != NULL )
 		{
-			listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList );
+			/* The holder must keep the priority of the tasks still waiting for
+			the mutex, and cannot go below its own base priority. */
+			if( pxTCB->uxBasePriority < uxHighestPriorityWaitingTask )
+			{
+				uxPriorityToUse = uxHighestPriorityWaitingTask;
+			}
+			else
+			{
+				uxPriorityToUse = pxTCB->uxBasePriority;
+			}
 
-			/* Populate an TaskStatus_t structure within the
-			pxTaskStatusArray array for each task that is referenced from
-			pxList.  See the definition of TaskStatus_t in task.h for the
-			meaning of each TaskStatus_t structure member. */
-			do
+			/* If the holder holds other mutexes then its priority may have
+			been inherited through one of those, so, as in
+			xTaskPriorityDisinherit(), it keeps its priority until it gives
+			the last of them back.  The same applies if uxMutexesHeld is 0
+			because the holder has taken a fast mutex but not yet counted
+			it. */
+			if( ( pxTCB->uxPriority > uxPriorityToUse ) && ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 1 ) )
 			{
-				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList );
-				vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
-				uxTask++;
-			} while( pxNextTCB != pxFirstTCB );
+				/* The calling task is waiting for the mutex, so cannot be the
+				holder. */
+				configASSERT( pxTCB != pxCurrentTCB );
+
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
+				prvSetInheritedPriority( pxTCB, uxPriorityToUse );
+
+				#if( configNUMBER_OF_CORES > 1 )
+				{
+					/* A task of higher priority may now be able to run on the
+					core the holder is running on. */
+					if( taskTASK_IS_RUNNING( pxTCB ) )
+					{
+						prvYieldCore( pxTCB->xTaskRunState );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configNUMBER_OF_CORES */
+
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 
-		return uxTask;
+		return xReturn;
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
+#if ( configUSE_CEILING_MUTEXES == 1 )
 
-	static uint16_t prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+	UBaseType_t uxTaskPriorityRaiseToCeiling( const UBaseType_t uxCeilingPriority )
 	{
-	uint32_t ulCount = 0U;
+	UBaseType_t uxPriorityBeforeCeiling = tskIDLE_PRIORITY;
 
-		while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+		/* If the mutex is taken before the scheduler has been started then
+		there is no task to raise. */
+		if( pxCurrentTCB != NULL )
 		{
-			pucStackByte -= portSTACK_GROWTH;
-			ulCount++;
-		}
-
-		ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
-
-		return ( uint16_t ) ulCount;
-	}
-
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) */
-/*-----------------------------------------------------------*/
+			/* A task above the ceiling would be lowered by the ceiling, so the
+			ceiling was chosen incorrectly. */
+			configASSERT( pxCurrentTCB->uxBasePriority <= uxCeilingPriority );
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
-
-	UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
-	{
-	TCB_t *pxTCB;
-	uint8_t *pucEndOfStack;
-	UBaseType_t uxReturn;
-
-		pxTCB = prvGetTCBFromHandle( xTask );
+			uxPriorityBeforeCeiling = pxCurrentTCB->uxPriority;
 
-		#if portSTACK_GROWTH < 0
-		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+			/* Raising the priority of the running task can never make it
+			necessary to yield. */
+			if( pxCurrentTCB->uxPriority < uxCeilingPriority )
+			{
+				traceTASK_PRIORITY_INHERIT( pxCurrentTCB, uxCeilingPriority );
+				prvSetInheritedPriority( pxCurrentTCB, uxCeilingPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-		#else
+		else
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
-		}
-		#endif
-
-		uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
-
-		return uxReturn;
-	}
-
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
-/*-----------------------------------------------------------*/
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-#if ( INCLUDE_vTaskDelete == 1 )
+		return uxPriorityBeforeCeiling;
+	}
+	/*-----------------------------------------------------------*/
 
-	static void prvDeleteTCB( TCB_t *pxTCB )
+	BaseType_t xTaskPriorityCeilingRelease( TaskHandle_t const pxMutexHolder, const UBaseType_t uxCeilingPriority, const UBaseType_t uxPriorityBeforeCeiling )
 	{
-		/* This call is required specifically for the TriCore port.  It must be
-		above the vPortFree() calls.  The call is also used by ports/demos that
-		want to allocate and clean RAM statically. */
-		portCLEAN_UP_TCB( pxTCB );
+	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+	UBaseType_t uxPriorityToUse, uxPriority, uxPriorityUsedOnEntry;
+	BaseType_t xReturn = pdFALSE;
 
-		/* Free up the memory allocated by the scheduler for the task.  It is up
-		to the task to free any memory allocated at the application level. */
-		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		if( pxMutexHolder != NULL )
 		{
-			_reclaim_reent( &( pxTCB->xNewLib_reent ) );
-		}
-		#endif /* configUSE_NEWLIB_REENTRANT */
+			/* As in xTaskPriorityDisinherit(), the mutex can only be given
+			back by the running task. */
+			configASSERT( pxTCB == pxCurrentTCB );
 
-		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
-		{
-			/* The task can only have been allocated dynamically - free both
-			the stack and TCB. */
-			vPortFree( pxTCB->pxStack );
-			vPortFree( pxTCB );
-		}
-		#elif( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE == 1 )
-		{
-			/* The task could have been allocated statically or dynamically, so
-			check what was statically allocated before trying to free the
-			memory. */
-			if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+			configASSERT( pxTCB->uxMutexesHeld );
+			( pxTCB->uxMutexesHeld )--;
+
+			if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
 			{
-				/* Both the stack and TCB were allocated dynamically, so both
-				must be freed. */
-				vPortFree( pxTCB->pxStack );
-				vPortFree( pxTCB );
+				/* No mutexes are held, so nothing can require the task to run
+				above its base priority. */
+				uxPriorityToUse = pxTCB->uxBasePriority;
 			}
-			else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+			else if( pxTCB->uxPriority == uxCeilingPriority )
 			{
-				/* Only the stack was statically allocated, so the TCB is the
-				only memory that must be freed. */
-				vPortFree( pxTCB );
+				/* Return to the priority the task had when it took the mutex,
+				which covers the ceilings of any mutexes taken before it.  The
+				base priority may have been raised since. */
+				if( uxPriorityBeforeCeiling > pxTCB->uxBasePriority )
+				{
+					uxPriorityToUse = uxPriorityBeforeCeiling;
+				}
+				else
+				{
+					uxPriorityToUse = pxTCB->uxBasePriority;
+				}
+			}
+			else
+			{
+				/* The task has since been raised above the ceiling by another
+				mutex, so keeps its priority until that mutex is given back. */
+				uxPriorityToUse = pxTCB->uxPriority;
+			}
+
+			if( uxPriorityToUse < pxTCB->uxPriority )
+			{
+				uxPriorityUsedOnEntry = pxTCB->uxPriority;
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
+				prvSetInheritedPriority( pxTCB, uxPriorityToUse );
+
+				/* Only request a context switch if a task that was held off
+				by the ceiling is ready to run, so taking and giving a mutex
+				that no other task wanted does not enter the scheduler. */
+				for( uxPriority = uxPriorityToUse + ( UBaseType_t ) 1U; ( uxPriority <= uxPriorityUsedOnEntry ) && ( xReturn == pdFALSE ); uxPriority++ )
+				{
+					if( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxPriority ] ) ) == pdFALSE )
+					{
+						xReturn = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
 			}
 			else
 			{
-				/* Neither the stack nor the TCB were allocated dynamically, so
-				nothing needs to be freed. */
-				configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB	)
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
 	}
 
-#endif /* INCLUDE_vTaskDelete */
+#endif /* configUSE_CEILING_MUTEXES */
 /*-----------------------------------------------------------*/
 
-static void prvResetNextTaskUnblockTime( void )
-{
-TCB_t *pxTCB;
+#if ( configUSE_MUTEXES == 1 )
 
-	if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+	void vTaskSetBlockingMutex( void *pvMutex )
 	{
-		/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-		the maximum possible value so it is	extremely unlikely that the
-		if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-		there is an item in the delayed list. */
-		xNextTaskUnblockTime = portMAX_DELAY;
+		/* Only the calling task writes its own pvBlockingMutex member, and a
+		pointer is written atomically, so no critical section is needed. */
+		pxCurrentTCB->pvBlockingMutex = pvMutex;
 	}
-	else
+	/*-----------------------------------------------------------*/
+
+	void *pvTaskGetBlockingMutex( TaskHandle_t xTask )
 	{
-		/* The new current delayed list is not empty, get the value of
-		the item at the head of the delayed list.  This is the time at
-		which the task at the head of the delayed list should be removed
-		from the Blocked state. */
-		( pxTCB ) = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
-		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
-	}
-}
-/*-----------------------------------------------------------*/
+	TCB_t * const pxTCB = ( TCB_t * ) xTask;
+	void *pvReturn = NULL;
+	const List_t *pxEventList;
 
-#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+		configASSERT( pxTCB );
 
-	TaskHandle_t xTaskGetCurrentTaskHandle( void )
-	{
-	TaskHandle_t xReturn;
+		/* The mutex is only reported while the task is still in an event list,
+		so a task that has been unblocked - by the mutex being given, or by
+		timing out - but has not yet run to clear pvBlockingMutex is not
+		reported as waiting. */
+		pxEventList = ( const List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
 
-		/* A critical section is not required as this is not called from
-		an interrupt and the current TCB will always be the same for any
-		individual execution thread. */
-		xReturn = pxCurrentTCB;
+		if( ( pxEventList != NULL ) && ( pxEventList != &xPendingReadyList ) )
+		{
+			pvReturn = pxTCB->pvBlockingMutex;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-		return xReturn;
+		return pvReturn;
 	}
 
-#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+#endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+#if ( ( portCRITICAL_NESTING_IN_TCB == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
 
-	BaseType_t xTaskGetSchedulerState( void )
+	void vTaskEnterCritical( void )
 	{
-	BaseType_t xReturn;
+		portDISABLE_INTERRUPTS();
 
-		if( xSchedulerRunning == pdFALSE )
+		if( xSchedulerRunning != pdFALSE )
 		{
-			xReturn = taskSCHEDULER_NOT_STARTED;
+			( pxCurrentTCB->uxCriticalNesting )++;
+
+			/* This is not the interrupt safe version of the enter critical
+			function so	assert() if it is being called from an interrupt
+			context.  Only API functions that end in "FromISR" can be used in an
+			interrupt.  Only assert if the critical nesting count is 1 to
+			protect against recursive calls if the assert function also uses a
+			critical section. */
+			if( pxCurrentTCB->uxCriticalNesting == 1 )
+			{
+				portASSERT_IF_IN_ISR();
+			}
 		}
 		else
 		{
-			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-			{
-				xReturn = taskSCHEDULER_RUNNING;
-			}
-			else
-			{
-				xReturn = taskSCHEDULER_SUSPENDED;
-			}
+			mtCOVERAGE_TEST_MARKER();
 		}
-
-		return xReturn;
 	}
 
-#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
+#endif /* portCRITICAL_NESTING_IN_TCB */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( ( portCRITICAL_NESTING_IN_TCB == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
 
-	void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
+	void vTaskExitCritical( void )
 	{
-	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
-
-		/* If the mutex was given back by an interrupt while the queue was
-		locked then the mutex holder might now be NULL. */
-		if( pxMutexHolder != NULL )
+		if( xSchedulerRunning != pdFALSE )
 		{
-			/* If the holder of the mutex has a priority below the priority of
-			the task attempting to obtain the mutex then it will temporarily
-			inherit the priority of the task attempting to obtain the mutex. */
-			if( pxTCB->uxPriority < pxCurrentTCB->uxPriority )
+			if( pxCurrentTCB->uxCriticalNesting > 0U )
 			{
-				/* Adjust the mutex holder state to account for its new
-				priority.  Only reset the event list item value if the value is
-				not	being used for anything else. */
-				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-				{
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				( pxCurrentTCB->uxCriticalNesting )--;
 
-				/* If the task being modified is in the ready state it will need
-				to be moved into a new list. */
-				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+				if( pxCurrentTCB->uxCriticalNesting == 0U )
 				{
-					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-					{
-						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-
-					/* Inherit the priority before being moved into the new list. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
-					prvAddTaskToReadyList( pxTCB );
+					portENABLE_INTERRUPTS();
 				}
 				else
 				{
-					/* Just inherit the priority. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
+					mtCOVERAGE_TEST_MARKER();
 				}
-
-				traceTASK_PRIORITY_INHERIT( pxTCB, pxCurrentTCB->uxPriority );
 			}
 			else
 			{
@@ -3764,68 +7502,85 @@ TCB_t *pxTCB;
 		}
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* portCRITICAL_NESTING_IN_TCB */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( configNUMBER_OF_CORES > 1 )
 
-	BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
+	void vTaskEnterCritical( void )
 	{
-	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
-	BaseType_t xReturn = pdFALSE;
+	BaseType_t xCoreID;
 
-		if( pxMutexHolder != NULL )
+		portDISABLE_INTERRUPTS();
+
+		if( xSchedulerRunning != pdFALSE )
 		{
-			/* A task can only have an inherited priority if it holds the mutex.
-			If the mutex is held by a task then it cannot be given from an
-			interrupt, and if a mutex is given by the holding task then it must
-			be the running state task. */
-			configASSERT( pxTCB == pxCurrentTCB );
+			/* Interrupts are disabled so the task cannot move to another core
+			before the count is updated. */
+			xCoreID = portGET_CORE_ID();
 
-			configASSERT( pxTCB->uxMutexesHeld );
-			( pxTCB->uxMutexesHeld )--;
+			if( pxCurrentTCBs[ xCoreID ]->uxCriticalNesting == 0U )
+			{
+				/* The task lock is always taken before the ISR lock. */
+				taskGET_TASK_LOCK( xCoreID );
+				taskGET_ISR_LOCK( xCoreID );
+			}
 
-			/* Has the holder of the mutex inherited the priority of another
-			task? */
-			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
+			( pxCurrentTCBs[ xCoreID ]->uxCriticalNesting )++;
+
+			/* This is not the interrupt safe version of the enter critical
+			function so	assert() if it is being called from an interrupt
+			context.  Only API functions that end in "FromISR" can be used in an
+			interrupt.  Only assert if the critical nesting count is 1 to
+			protect against recursive calls if the assert function also uses a
+			critical section. */
+			if( pxCurrentTCBs[ xCoreID ]->uxCriticalNesting == 1 )
 			{
-				/* Only disinherit if no other mutexes are held. */
-				if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
-				{
-					/* A task can only have an inherited priority if it holds
-					the mutex.  If the mutex is held by a task then it cannot be
-					given from an interrupt, and if a mutex is given by the
-					holding	task then it must be the running state task.  Remove
-					the	holding task from the ready	list. */
-					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-					{
-						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+				portASSERT_IF_IN_ISR();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
 
-					/* Disinherit the priority before adding the task into the
-					new	ready list. */
-					traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
-					pxTCB->uxPriority = pxTCB->uxBasePriority;
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
 
-					/* Reset the event list item value.  It cannot be in use for
-					any other purpose if this task is running, and it must be
-					running to give back the mutex. */
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					prvAddTaskToReadyList( pxTCB );
+#if ( configNUMBER_OF_CORES > 1 )
+
+	void vTaskExitCritical( void )
+	{
+	BaseType_t xCoreID, xYieldCurrentTask;
+
+		if( xSchedulerRunning != pdFALSE )
+		{
+			xCoreID = portGET_CORE_ID();
+
+			if( pxCurrentTCBs[ xCoreID ]->uxCriticalNesting > 0U )
+			{
+				( pxCurrentTCBs[ xCoreID ]->uxCriticalNesting )--;
 
-					/* Return true to indicate that a context switch is required.
-					This is only actually required in the corner case whereby
-					multiple mutexes were held and the mutexes were given back
-					in an order different to that in which they were taken.
-					If a context switch did not occur when the first mutex was
-					returned, even if a task was waiting on it, then a context
-					switch should occur when the last mutex is returned whether
-					a task is waiting on it or not. */
-					xReturn = pdTRUE;
+				if( pxCurrentTCBs[ xCoreID ]->uxCriticalNesting == 0U )
+				{
+					/* A yield requested from within the critical section was
+					deferred by vTaskYieldWithinAPI() - perform it now the locks
+					are released. */
+					xYieldCurrentTask = xYieldPendings[ xCoreID ];
+
+					taskRELEASE_ISR_LOCK( xCoreID );
+					taskRELEASE_TASK_LOCK( xCoreID );
+					portENABLE_INTERRUPTS();
+
+					if( xYieldCurrentTask != pdFALSE )
+					{
+						portYIELD();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 				else
 				{
@@ -3841,56 +7596,179 @@ TCB_t *pxTCB;
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+	}
 
-		return xReturn;
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+	UBaseType_t uxTaskEnterCriticalFromISR( void )
+	{
+	UBaseType_t uxSavedInterruptStatus = 0;
+	BaseType_t xCoreID;
+
+		/* Unlike the task level critical section only the ISR lock is taken,
+		as an interrupt can occur while its core holds the task lock. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+
+		if( xSchedulerRunning != pdFALSE )
+		{
+			xCoreID = portGET_CORE_ID();
+			taskGET_ISR_LOCK( xCoreID );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxSavedInterruptStatus;
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* configNUMBER_OF_CORES */
 /*-----------------------------------------------------------*/
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+#if ( configNUMBER_OF_CORES > 1 )
 
-	void vTaskEnterCritical( void )
+	void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus )
 	{
-		portDISABLE_INTERRUPTS();
+	BaseType_t xCoreID;
 
 		if( xSchedulerRunning != pdFALSE )
 		{
-			( pxCurrentTCB->uxCriticalNesting )++;
+			xCoreID = portGET_CORE_ID();
+			taskRELEASE_ISR_LOCK( xCoreID );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-			/* This is not the interrupt safe version of the enter critical
-			function so	assert() if it is being called from an interrupt
-			context.  Only API functions that end in "FromISR" can be used in an
-			interrupt.  Only assert if the critical nesting count is 1 to
-			protect against recursive calls if the assert function also uses a
-			critical section. */
-			if( pxCurrentTCB->uxCriticalNesting == 1 )
+		portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+	void vTaskYieldWithinAPI( void )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xCoreID, xDeferYield;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+		{
+			xCoreID = portGET_CORE_ID();
+			xDeferYield = ( pxCurrentTCBs[ xCoreID ]->uxCriticalNesting > 0U ) ? pdTRUE : pdFALSE;
+
+			if( xDeferYield != pdFALSE )
 			{
-				portASSERT_IF_IN_ISR();
+				/* The kernel locks are held, so the yield is performed by
+				vTaskExitCritical() once they have been released. */
+				xYieldPendings[ xCoreID ] = pdTRUE;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+
+		if( xDeferYield == pdFALSE )
+		{
+			portYIELD();
+		}
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+	static TCB_t *prvGetCurrentTCB( void )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+		{
+			pxTCB = pxCurrentTCBs[ portGET_CORE_ID() ];
+		}
+		portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+
+		return pxTCB;
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+	static BaseType_t prvSchedulerSuspendedByCallingCore( void )
+	{
+	BaseType_t xReturn = pdFALSE;
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* The task lock is held for as long as the scheduler is suspended, and
+		only the core that holds the task lock can write its own ID to
+		xTaskLockOwner.  Interrupts are masked so the calling task cannot change
+		core between the two reads.  A core that has suspended the scheduler
+		always sees its own non-zero uxSchedulerSuspended, so when it reads as
+		zero - the common case, tested on every blocking API call - there is no
+		need to mask interrupts at all. */
+		if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+		{
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+			{
+				if( ( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE ) && ( xTaskLockOwner == portGET_CORE_ID() ) )
+				{
+					xReturn = pdTRUE;
+				}
 			}
+			portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return xReturn;
 	}
 
-#endif /* portCRITICAL_NESTING_IN_TCB */
+#endif /* configNUMBER_OF_CORES */
 /*-----------------------------------------------------------*/
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+#if ( configNUMBER_OF_CORES > 1 )
 
-	void vTaskExitCritical( void )
+	void vTaskCoreAffinitySet( const TaskHandle_t xTask, UBaseType_t uxCoreAffinityMask )
 	{
-		if( xSchedulerRunning != pdFALSE )
+	TCB_t *pxTCB;
+	BaseType_t xCoreID;
+
+		taskENTER_CRITICAL();
 		{
-			if( pxCurrentTCB->uxCriticalNesting > 0U )
+			pxTCB = prvGetTCBFromHandle( xTask );
+			pxTCB->uxCoreAffinityMask = uxCoreAffinityMask;
+
+			if( xSchedulerRunning != pdFALSE )
 			{
-				( pxCurrentTCB->uxCriticalNesting )--;
+				if( taskTASK_IS_RUNNING( pxTCB ) )
+				{
+					/* Move the task off its current core if that core is no
+					longer allowed. */
+					xCoreID = pxTCB->xTaskRunState;
 
-				if( pxCurrentTCB->uxCriticalNesting == 0U )
+					if( ( uxCoreAffinityMask & taskCORE_BIT( xCoreID ) ) == 0U )
+					{
+						prvYieldCore( xCoreID );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
 				{
-					portENABLE_INTERRUPTS();
+					/* The task may now be able to preempt a core it could
+					not run on before. */
+					prvYieldForTask( pxTCB );
 				}
 				else
 				{
@@ -3902,13 +7780,55 @@ TCB_t *pxTCB;
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		else
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+	UBaseType_t uxTaskCoreAffinityGet( const TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxCoreAffinityMask;
+
+		taskENTER_CRITICAL();
 		{
-			mtCOVERAGE_TEST_MARKER();
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxCoreAffinityMask = pxTCB->uxCoreAffinityMask;
 		}
+		taskEXIT_CRITICAL();
+
+		return uxCoreAffinityMask;
 	}
 
-#endif /* portCRITICAL_NESTING_IN_TCB */
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+	TaskHandle_t xTaskGetCurrentTaskHandleForCore( const BaseType_t xCoreID )
+	{
+		configASSERT( ( xCoreID >= 0 ) && ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) );
+		return ( TaskHandle_t ) pxCurrentTCBs[ xCoreID ];
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
+
+	TaskHandle_t xTaskGetIdleTaskHandleForCore( const BaseType_t xCoreID )
+	{
+		/* If xTaskGetIdleTaskHandleForCore() is called before the scheduler
+		has been started then the handle will be NULL. */
+		configASSERT( ( xCoreID >= 0 ) && ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) );
+		configASSERT( ( xIdleTaskHandles[ xCoreID ] != NULL ) );
+		return xIdleTaskHandles[ xCoreID ];
+	}
+
+#endif /* configNUMBER_OF_CORES */
 /*-----------------------------------------------------------*/
 
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
@@ -3937,6 +7857,64 @@ TCB_t *pxTCB;
 #endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
 /*-----------------------------------------------------------*/
 
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+	static char *prvWriteRunTimeToBuffer( char *pcBuffer, const RunTimeCounter_t ulRunTime, const RunTimeCounter_t ulTotalTimeDiv100 )
+	{
+	uint32_t ulStatsAsPercentage;
+
+		/* What percentage of the total run time does ulRunTime represent?
+		This will always be rounded down to the nearest integer.
+		ulTotalTimeDiv100 has already been divided by 100. */
+		ulStatsAsPercentage = ( uint32_t ) ( ulRunTime / ulTotalTimeDiv100 );
+
+		if( ulStatsAsPercentage > 0UL )
+		{
+			#if ( configUSE_64_BIT_RUN_TIME_COUNTERS == 1 )
+			{
+				/* The run time might not fit in an unsigned long. */
+				sprintf( pcBuffer, "\t%llu\t\t%u%%\r\n", ( unsigned long long ) ulRunTime, ( unsigned int ) ulStatsAsPercentage );
+			}
+			#elif defined( portLU_PRINTF_SPECIFIER_REQUIRED )
+			{
+				sprintf( pcBuffer, "\t%lu\t\t%lu%%\r\n", ( unsigned long ) ulRunTime, ( unsigned long ) ulStatsAsPercentage );
+			}
+			#else
+			{
+				/* sizeof( int ) == sizeof( long ) so a smaller
+				printf() library can be used. */
+				sprintf( pcBuffer, "\t%u\t\t%u%%\r\n", ( unsigned int ) ulRunTime, ( unsigned int ) ulStatsAsPercentage );
+			}
+			#endif
+		}
+		else
+		{
+			/* If the percentage is zero here then less than 1% of the total
+			run time has been consumed. */
+			#if ( configUSE_64_BIT_RUN_TIME_COUNTERS == 1 )
+			{
+				sprintf( pcBuffer, "\t%llu\t\t<1%%\r\n", ( unsigned long long ) ulRunTime );
+			}
+			#elif defined( portLU_PRINTF_SPECIFIER_REQUIRED )
+			{
+				sprintf( pcBuffer, "\t%lu\t\t<1%%\r\n", ( unsigned long ) ulRunTime );
+			}
+			#else
+			{
+				/* sizeof( int ) == sizeof( long ) so a smaller
+				printf() library can be used. */
+				sprintf( pcBuffer, "\t%u\t\t<1%%\r\n", ( unsigned int ) ulRunTime );
+			}
+			#endif
+		}
+
+		/* Return the new end of string. */
+		return pcBuffer + strlen( pcBuffer );
+	}
+
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	void vTaskList( char * pcWriteBuffer )
@@ -4038,7 +8016,7 @@ TCB_t *pxTCB;
 	{
 	TaskStatus_t *pxTaskStatusArray;
 	volatile UBaseType_t uxArraySize, x;
-	uint32_t ulTotalTime, ulStatsAsPercentage;
+	RunTimeCounter_t ulTotalTime;
 
 		#if( configUSE_TRACE_FACILITY != 1 )
 		{
@@ -4097,66 +8075,227 @@ TCB_t *pxTCB;
 				/* Create a human readable table from the binary data. */
 				for( x = 0; x < uxArraySize; x++ )
 				{
-					/* What percentage of the total run time has the task used?
-					This will always be rounded down to the nearest integer.
-					ulTotalRunTimeDiv100 has already been divided by 100. */
-					ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
-
 					/* Write the task name to the string, padding with
 					spaces so it can be printed in tabular form more
 					easily. */
 					pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
+					pcWriteBuffer = prvWriteRunTimeToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].ulRunTimeCounter, ulTotalTime );
+				}
+
+				#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+				{
+					/* Time spent in interrupts is shown as a row of its own
+					as it is not included in the time of any task. */
+					pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, "ISR" );
+					pcWriteBuffer = prvWriteRunTimeToBuffer( pcWriteBuffer, ulTaskGetISRRunTimeCounter(), ulTotalTime );
+				}
+				#endif
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
+			is 0 then vPortFree() will be #defined to nothing. */
+			vPortFree( pxTaskStatusArray );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_BINARY_TASK_STATS == 1 )
+
+	static uint8_t *prvPackStatsValue( uint8_t *pucRecord, uint32_t ulValue, size_t xBytes )
+	{
+		while( xBytes > ( size_t ) 0 )
+		{
+			*pucRecord = ( uint8_t ) ulValue;
+			pucRecord++;
+			ulValue >>= 8;
+			xBytes--;
+		}
+
+		return pucRecord;
+	}
+	/*-----------------------------------------------------------*/
+
+	static uint8_t *prvPackStatsRunTime( uint8_t *pucRecord, const RunTimeCounter_t ulRunTime )
+	{
+		/* Run times are always written as 64-bit values, so the layout does
+		not depend on configUSE_64_BIT_RUN_TIME_COUNTERS. */
+		pucRecord = prvPackStatsValue( pucRecord, ( uint32_t ) ulRunTime, sizeof( uint32_t ) );
+
+		#if( configUSE_64_BIT_RUN_TIME_COUNTERS == 1 )
+		{
+			pucRecord = prvPackStatsValue( pucRecord, ( uint32_t ) ( ulRunTime >> 32 ), sizeof( uint32_t ) );
+		}
+		#else
+		{
+			pucRecord = prvPackStatsValue( pucRecord, 0UL, sizeof( uint32_t ) );
+		}
+		#endif
+
+		return pucRecord;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskStatsBegin( TaskStatsCursor_t * const pxCursor )
+	{
+		configASSERT( pxCursor );
 
-					if( ulStatsAsPercentage > 0UL )
+		vTaskSnapshotBegin( &( pxCursor->xSnapshot ) );
+		pxCursor->xStage = taskSTATS_STAGE_HEADER;
+		pxCursor->uxTasksWritten = ( UBaseType_t ) 0U;
+	}
+	/*-----------------------------------------------------------*/
+
+	size_t xTaskGetStatsRecords( TaskStatsCursor_t * const pxCursor, uint8_t * const pucBuffer, const size_t xBufferLength )
+	{
+	uint8_t *pucNext = pucBuffer, *pucRecord;
+	size_t xRemaining = xBufferLength, x;
+	BaseType_t xBufferFull = pdFALSE;
+	TaskStatus_t xTaskStatus;
+	RunTimeCounter_t ulISRRunTime;
+	uint8_t ucFlags;
+
+		configASSERT( pxCursor );
+		configASSERT( pucBuffer );
+
+		/* Records are never split, so the buffer must be able to hold the
+		largest one. */
+		configASSERT( xBufferLength >= tskSTATS_MAX_RECORD_LENGTH );
+
+		/* Each record starts with its type and its length in bytes, including
+		those two bytes, followed by little endian values.  See the description
+		of the layout in task.h. */
+		while( ( pxCursor->xStage != taskSTATS_STAGE_DONE ) && ( xBufferFull == pdFALSE ) )
+		{
+			pucRecord = pucNext;
+
+			if( pxCursor->xStage == taskSTATS_STAGE_HEADER )
+			{
+				if( xRemaining >= tskSTATS_HEADER_RECORD_LENGTH )
+				{
+					ucFlags = 0U;
+					#if( configGENERATE_RUN_TIME_STATS == 1 )
 					{
-						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-						{
-							sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
-						}
-						#else
+						ucFlags |= tskSTATS_FLAG_RUN_TIME;
+					}
+					#endif
+					#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+					{
+						ucFlags |= tskSTATS_FLAG_ISR_RUN_TIME;
+					}
+					#endif
+
+					*pucNext++ = tskSTATS_RECORD_HEADER;
+					*pucNext++ = ( uint8_t ) tskSTATS_HEADER_RECORD_LENGTH;
+					*pucNext++ = ( uint8_t ) 'F';
+					*pucNext++ = ( uint8_t ) 'R';
+					*pucNext++ = ( uint8_t ) 'T';
+					*pucNext++ = ( uint8_t ) 'S';
+					*pucNext++ = ( uint8_t ) tskSTATS_FORMAT_VERSION;
+					*pucNext++ = ( uint8_t ) configNUMBER_OF_CORES;
+					*pucNext++ = ( uint8_t ) configMAX_TASK_NAME_LEN;
+					*pucNext++ = ucFlags;
+					pucNext = prvPackStatsValue( pucNext, ( uint32_t ) configTICK_RATE_HZ, sizeof( uint32_t ) );
+					pucNext = prvPackStatsValue( pucNext, ( uint32_t ) xTaskGetTickCount(), sizeof( uint32_t ) );
+
+					pxCursor->xStage = taskSTATS_STAGE_TASKS;
+				}
+				else
+				{
+					xBufferFull = pdTRUE;
+				}
+			}
+			else if( pxCursor->xStage == taskSTATS_STAGE_TASKS )
+			{
+				if( xRemaining < tskSTATS_TASK_RECORD_LENGTH )
+				{
+					xBufferFull = pdTRUE;
+				}
+				else if( uxTaskSnapshotRead( &( pxCursor->xSnapshot ), &xTaskStatus, 1, pdTRUE ) == ( UBaseType_t ) 0U )
+				{
+					/* Every task has been written, or the set of tasks changed
+					and the snapshot was abandoned.  The end record says
+					which. */
+					pxCursor->xStage = taskSTATS_STAGE_END;
+				}
+				else
+				{
+					*pucNext++ = tskSTATS_RECORD_TASK;
+					*pucNext++ = ( uint8_t ) tskSTATS_TASK_RECORD_LENGTH;
+					pucNext = prvPackStatsValue( pucNext, ( uint32_t ) xTaskStatus.xTaskNumber, sizeof( uint32_t ) );
+					pucNext = prvPackStatsRunTime( pucNext, xTaskStatus.ulRunTimeCounter );
+					pucNext = prvPackStatsValue( pucNext, ( uint32_t ) xTaskStatus.usStackHighWaterMark, sizeof( uint16_t ) );
+					*pucNext++ = ( uint8_t ) xTaskStatus.eCurrentState;
+					*pucNext++ = ( uint8_t ) xTaskStatus.uxCurrentPriority;
+					*pucNext++ = ( uint8_t ) xTaskStatus.uxBasePriority;
+
+					/* The name is copied byte by byte, and padded with zeros,
+					so the field is always the same length. */
+					for( x = ( size_t ) 0; x < ( size_t ) configMAX_TASK_NAME_LEN; x++ )
+					{
+						*pucNext = ( uint8_t ) xTaskStatus.pcTaskName[ x ];
+
+						if( xTaskStatus.pcTaskName[ x ] == 0x00 )
 						{
-							/* sizeof( int ) == sizeof( long ) so a smaller
-							printf() library can be used. */
-							sprintf( pcWriteBuffer, "\t%u\t\t%u%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage );
+							break;
 						}
-						#endif
+
+						pucNext++;
 					}
-					else
+
+					for( ; x < ( size_t ) configMAX_TASK_NAME_LEN; x++ )
 					{
-						/* If the percentage is zero here then the task has
-						consumed less than 1% of the total run time. */
-						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-						{
-							sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter );
-						}
-						#else
-						{
-							/* sizeof( int ) == sizeof( long ) so a smaller
-							printf() library can be used. */
-							sprintf( pcWriteBuffer, "\t%u\t\t<1%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter );
-						}
-						#endif
+						*pucNext++ = 0x00;
 					}
 
-					pcWriteBuffer += strlen( pcWriteBuffer );
+					( pxCursor->uxTasksWritten )++;
 				}
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				if( xRemaining >= tskSTATS_END_RECORD_LENGTH )
+				{
+					#if( configGENERATE_ISR_RUN_TIME_STATS == 1 )
+					{
+						ulISRRunTime = ulTaskGetISRRunTimeCounter();
+					}
+					#else
+					{
+						ulISRRunTime = 0;
+					}
+					#endif
+
+					*pucNext++ = tskSTATS_RECORD_END;
+					*pucNext++ = ( uint8_t ) tskSTATS_END_RECORD_LENGTH;
+					pucNext = prvPackStatsRunTime( pucNext, pxCursor->xSnapshot.ulTotalRunTime );
+					pucNext = prvPackStatsRunTime( pucNext, ulISRRunTime );
+					pucNext = prvPackStatsValue( pucNext, ( uint32_t ) pxCursor->uxTasksWritten, sizeof( uint16_t ) );
+					*pucNext++ = ( uint8_t ) xTaskSnapshotIsValid( &( pxCursor->xSnapshot ) );
+
+					pxCursor->xStage = taskSTATS_STAGE_DONE;
+				}
+				else
+				{
+					xBufferFull = pdTRUE;
+				}
 			}
 
-			/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
-			is 0 then vPortFree() will be #defined to nothing. */
-			vPortFree( pxTaskStatusArray );
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
+			xRemaining -= ( size_t ) ( pucNext - pucRecord );
 		}
+
+		return ( size_t ) ( pucNext - pucBuffer );
 	}
 
-#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+#endif /* configUSE_BINARY_TASK_STATS */
 /*-----------------------------------------------------------*/
 
 TickType_t uxTaskResetEventItemValue( void )
@@ -4190,6 +8329,62 @@ TickType_t uxReturn;
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+	void vTaskIncrementMutexHeldCount( TaskHandle_t xMutexHolder )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) xMutexHolder;
+
+		/* If the mutex was taken before any tasks were created then there is
+		no task to count it against. */
+		if( pxTCB != NULL )
+		{
+			/* Only the task itself changes its mutex held count, so the count
+			can be changed without a critical section. */
+			( pxTCB->uxMutexesHeld )++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	BaseType_t xTaskDecrementMutexHeldCount( TaskHandle_t xMutexHolder )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) xMutexHolder;
+	BaseType_t xReturn = pdTRUE;
+
+		/* If the mutex was taken and given back before any tasks were created
+		then there is no task to count it against. */
+		if( pxTCB != NULL )
+		{
+			/* Only the task itself changes its mutex held count, so the count
+			can be changed without a critical section.  No other task can be
+			raising the priority of the calling task through the mutex being
+			given back, as it was given back without any task waiting for it. */
+			configASSERT( pxTCB->uxMutexesHeld );
+
+			if( ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 1 ) && ( pxTCB->uxPriority != pxTCB->uxBasePriority ) )
+			{
+				xReturn = pdFALSE;
+			}
+			else
+			{
+				( pxTCB->uxMutexesHeld )--;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
 	uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
@@ -4420,17 +8615,40 @@ TickType_t uxReturn;
 				}
 				#endif
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				#if( configNUMBER_OF_CORES == 1 )
 				{
-					/* The notified task has a priority above the currently
-					executing task so a yield is required. */
-					taskYIELD_IF_USING_PREEMPTION();
+					if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
+					{
+						/* The notified task has a priority above the currently
+						executing task so a yield is required. */
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
-				else
+				#else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					prvYieldForTask( pxTCB );
 				}
+				#endif /* configNUMBER_OF_CORES */
 			}
+			#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+				else if( ( ucOriginalNotifyState == taskWAITING_MULTIPLE_OBJECTS ) && ( taskIS_WAITING_FOR_MULTIPLE_OBJECTS( pxTCB ) ) )
+				{
+					/* The task is waiting for the notification as one of
+					several objects, so is in an event list of its own. */
+					if( xTaskRemoveFromEventList( ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) ) != pdFALSE )
+					{
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
@@ -4525,6 +8743,7 @@ TickType_t uxReturn;
 			{
 				/* The task should not have been on an event list. */
 				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+				taskSTAMP_WAKE_FROM_ISR( pxTCB );
 
 				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 				{
@@ -4538,27 +8757,75 @@ TickType_t uxReturn;
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				#if( configNUMBER_OF_CORES == 1 )
 				{
-					/* The notified task has a priority above the currently
-					executing task so a yield is required. */
-					if( pxHigherPriorityTaskWoken != NULL )
+					if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
 					{
-						*pxHigherPriorityTaskWoken = pdTRUE;
+						/* The notified task has a priority above the currently
+						executing task so a yield is required. */
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							/* Mark that a yield is pending in case the user is not
+							using the "xHigherPriorityTaskWoken" parameter to an ISR
+							safe FreeRTOS function. */
+							xYieldPending = pdTRUE;
+						}
 					}
 					else
 					{
-						/* Mark that a yield is pending in case the user is not
-						using the "xHigherPriorityTaskWoken" parameter to an ISR
-						safe FreeRTOS function. */
-						xYieldPending = pdTRUE;
+						mtCOVERAGE_TEST_MARKER();
 					}
 				}
-				else
+				#else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* Other cores are interrupted directly.  The yield pending
+					flag of this core is always left set. */
+					if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+					{
+						prvYieldForTask( pxTCB );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					if( ( xYieldPending != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
+				#endif /* configNUMBER_OF_CORES */
 			}
+			#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+				else if( ( ucOriginalNotifyState == taskWAITING_MULTIPLE_OBJECTS ) && ( taskIS_WAITING_FOR_MULTIPLE_OBJECTS( pxTCB ) ) )
+				{
+					/* The task is waiting for the notification as one of
+					several objects, so is in an event list of its own. */
+					if( xTaskRemoveFromEventList( ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) ) != pdFALSE )
+					{
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
 		}
 		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
@@ -4615,6 +8882,7 @@ TickType_t uxReturn;
 			{
 				/* The task should not have been on an event list. */
 				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+				taskSTAMP_WAKE_FROM_ISR( pxTCB );
 
 				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 				{
@@ -4628,27 +8896,75 @@ TickType_t uxReturn;
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				#if( configNUMBER_OF_CORES == 1 )
 				{
-					/* The notified task has a priority above the currently
-					executing task so a yield is required. */
-					if( pxHigherPriorityTaskWoken != NULL )
+					if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
 					{
-						*pxHigherPriorityTaskWoken = pdTRUE;
+						/* The notified task has a priority above the currently
+						executing task so a yield is required. */
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							/* Mark that a yield is pending in case the user is not
+							using the "xHigherPriorityTaskWoken" parameter in an ISR
+							safe FreeRTOS function. */
+							xYieldPending = pdTRUE;
+						}
 					}
 					else
 					{
-						/* Mark that a yield is pending in case the user is not
-						using the "xHigherPriorityTaskWoken" parameter in an ISR
-						safe FreeRTOS function. */
-						xYieldPending = pdTRUE;
+						mtCOVERAGE_TEST_MARKER();
 					}
 				}
-				else
+				#else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* Other cores are interrupted directly.  The yield pending
+					flag of this core is always left set. */
+					if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+					{
+						prvYieldForTask( pxTCB );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					if( ( xYieldPending != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
+				#endif /* configNUMBER_OF_CORES */
 			}
+			#if( configUSE_MULTIPLE_OBJECT_WAITS == 1 )
+				else if( ( ucOriginalNotifyState == taskWAITING_MULTIPLE_OBJECTS ) && ( taskIS_WAITING_FOR_MULTIPLE_OBJECTS( pxTCB ) ) )
+				{
+					/* The task is waiting for the notification as one of
+					several objects, so is in an event list of its own. */
+					if( xTaskRemoveFromEventList( ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) ) != pdFALSE )
+					{
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			#endif /* configUSE_MULTIPLE_OBJECT_WAITS */
 		}
 		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 	}
@@ -4689,6 +9005,98 @@ TickType_t uxReturn;
 /*-----------------------------------------------------------*/
 
 
+#if( configUSE_TIMING_WHEEL_DELAYS == 1 )
+
+	static void prvWheelInsert( ListItem_t * const pxListItem, const TickType_t xTimeNow )
+	{
+	const TickType_t xTimeToWake = listGET_LIST_ITEM_VALUE( pxListItem );
+	TickType_t xDistance = xTimeToWake - xTimeNow;
+	UBaseType_t uxLevel = ( UBaseType_t ) 0U, uxSlot;
+
+		/* Use the lowest level whose span of slots reaches the wake time.
+		The wake time then lies within the slot that level next reaches, so
+		the task is either due when a level 0 slot is reached, or is moved
+		down a level when a higher level slot is reached. */
+		while( xDistance > taskWHEEL_SLOT_MASK )
+		{
+			xDistance >>= configTIMING_WHEEL_SLOT_BITS;
+			uxLevel++;
+		}
+
+		uxSlot = ( UBaseType_t ) ( ( xTimeToWake >> ( uxLevel * configTIMING_WHEEL_SLOT_BITS ) ) & taskWHEEL_SLOT_MASK );
+
+		/* Tasks are appended so tasks with equal wake times are unblocked in
+		the order in which they blocked. */
+		vListInsertEnd( &( xDelayWheel[ ( uxLevel * taskWHEEL_SLOTS ) + uxSlot ] ), pxListItem );
+		ulDelayWheelMap[ uxLevel ] |= ( 1UL << uxSlot );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvWheelCascade( const TickType_t xTimeNow )
+	{
+	UBaseType_t uxLevel = ( UBaseType_t ) 1U, uxTopLevel = ( UBaseType_t ) 0U, uxSlot;
+	List_t *pxList;
+	ListItem_t *pxListItem;
+
+		/* Find the highest level with a slot boundary at xTimeNow. */
+		while( ( uxLevel < taskWHEEL_LEVELS ) && ( ( xTimeNow & ( ( ( TickType_t ) 1U << ( uxLevel * configTIMING_WHEEL_SLOT_BITS ) ) - ( TickType_t ) 1U ) ) == ( TickType_t ) 0U ) )
+		{
+			uxTopLevel = uxLevel;
+			uxLevel++;
+		}
+
+		/* Work downwards, as tasks moved out of a higher level slot can land
+		in the lower level slot that starts at the same tick. */
+		for( uxLevel = uxTopLevel; uxLevel > ( UBaseType_t ) 0U; uxLevel-- )
+		{
+			uxSlot = ( UBaseType_t ) ( ( xTimeNow >> ( uxLevel * configTIMING_WHEEL_SLOT_BITS ) ) & taskWHEEL_SLOT_MASK );
+			pxList = &( xDelayWheel[ ( uxLevel * taskWHEEL_SLOTS ) + uxSlot ] );
+
+			while( listLIST_IS_EMPTY( pxList ) == pdFALSE )
+			{
+				pxListItem = listGET_HEAD_ENTRY( pxList );
+				( void ) uxListRemove( pxListItem );
+				prvWheelInsert( pxListItem, xTimeNow );
+			}
+
+			ulDelayWheelMap[ uxLevel ] &= ~( 1UL << uxSlot );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvAddCurrentTaskToDelayWheel( TickType_t xTimeToWake, const TickType_t xConstTickCount )
+	{
+		/* The level 0 slot for the current tick has already been processed,
+		so a wake time equal to the current tick count (a zero block time) is
+		treated as the next tick - which is also when the sorted delayed list
+		would unblock the task. */
+		if( xTimeToWake == xConstTickCount )
+		{
+			xTimeToWake++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+		prvWheelInsert( &( pxCurrentTCB->xStateListItem ), xConstTickCount );
+
+		/* xNextTaskUnblockTime only tracks wake times that have not
+		overflowed. */
+		if( ( xTimeToWake > xConstTickCount ) && ( xTimeToWake < xNextTaskUnblockTime ) )
+		{
+			xNextTaskUnblockTime = xTimeToWake;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_TIMING_WHEEL_DELAYS */
+/*-----------------------------------------------------------*/
+
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseType_t xCanBlockIndefinitely )
 {
 TickType_t xTimeToWake;
@@ -4732,33 +9140,41 @@ const TickType_t xConstTickCount = xTickCount;
 			kernel will manage it correctly. */
 			xTimeToWake = xConstTickCount + xTicksToWait;
 
-			/* The list item will be inserted in wake time order. */
-			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
-
-			if( xTimeToWake < xConstTickCount )
-			{
-				/* Wake time has overflowed.  Place this item in the overflow
-				list. */
-				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
-			}
-			else
+			#if( configUSE_TIMING_WHEEL_DELAYS == 0 )
 			{
-				/* The wake time has not overflowed, so the current block list
-				is used. */
-				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				/* The list item will be inserted in wake time order. */
+				listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-				/* If the task entering the blocked state was placed at the
-				head of the list of blocked tasks then xNextTaskUnblockTime
-				needs to be updated too. */
-				if( xTimeToWake < xNextTaskUnblockTime )
+				if( xTimeToWake < xConstTickCount )
 				{
-					xNextTaskUnblockTime = xTimeToWake;
+					/* Wake time has overflowed.  Place this item in the overflow
+					list. */
+					vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* The wake time has not overflowed, so the current block list
+					is used. */
+					vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+					/* If the task entering the blocked state was placed at the
+					head of the list of blocked tasks then xNextTaskUnblockTime
+					needs to be updated too. */
+					if( xTimeToWake < xNextTaskUnblockTime )
+					{
+						xNextTaskUnblockTime = xTimeToWake;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 			}
+			#else
+			{
+				prvAddCurrentTaskToDelayWheel( xTimeToWake, xConstTickCount );
+			}
+			#endif
 		}
 	}
 	#else /* INCLUDE_vTaskSuspend */
@@ -4768,31 +9184,39 @@ const TickType_t xConstTickCount = xTickCount;
 		will manage it correctly. */
 		xTimeToWake = xConstTickCount + xTicksToWait;
 
-		/* The list item will be inserted in wake time order. */
-		listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
-
-		if( xTimeToWake < xConstTickCount )
-		{
-			/* Wake time has overflowed.  Place this item in the overflow list. */
-			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
-		}
-		else
+		#if( configUSE_TIMING_WHEEL_DELAYS == 0 )
 		{
-			/* The wake time has not overflowed, so the current block list is used. */
-			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			/* The list item will be inserted in wake time order. */
+			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-			/* If the task entering the blocked state was placed at the head of the
-			list of blocked tasks then xNextTaskUnblockTime needs to be updated
-			too. */
-			if( xTimeToWake < xNextTaskUnblockTime )
+			if( xTimeToWake < xConstTickCount )
 			{
-				xNextTaskUnblockTime = xTimeToWake;
+				/* Wake time has overflowed.  Place this item in the overflow list. */
+				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* The wake time has not overflowed, so the current block list is used. */
+				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+				/* If the task entering the blocked state was placed at the head of the
+				list of blocked tasks then xNextTaskUnblockTime needs to be updated
+				too. */
+				if( xTimeToWake < xNextTaskUnblockTime )
+				{
+					xNextTaskUnblockTime = xTimeToWake;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 		}
+		#else
+		{
+			prvAddCurrentTaskToDelayWheel( xTimeToWake, xConstTickCount );
+		}
+		#endif
 
 		/* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
 		( void ) xCanBlockIndefinitely;
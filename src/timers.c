@@ -100,6 +100,45 @@ configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
 /* Misc definitions. */
 #define tmrNO_DELAY		( TickType_t ) 0U
 
+#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+
+	/* Active timers are held in a hierarchical timing wheel.  Each level of the
+	wheel has tmrWHEEL_SLOTS slots.  A slot in level 0 covers a single tick, a
+	slot in level 1 covers tmrWHEEL_SLOTS ticks, and so on, with enough levels
+	to cover the full range of TickType_t.  A timer is placed in the level of
+	the highest group of configTIMING_WHEEL_SLOT_BITS bits in which its expiry
+	time differs from xTimerWheelTime, in the slot selected by its expiry time,
+	so starting a timer does not depend on the number of timers that are
+	already active.  When the wheel time reaches the start of a slot above level
+	0 the timers in that slot are moved down the wheel, so every timer
+	referenced from a level 0 slot expires at exactly the tick that slot
+	represents.  A timer can only be placed below a slot that already holds a
+	timer with the same expiry time once that slot has been moved down, so
+	timers with equal expiry times expire in the order in which they were
+	started - as they would from the sorted lists. */
+	#if( configUSE_16_BIT_TICKS == 1 )
+		#define tmrWHEEL_TICK_BITS		( 16U )
+	#else
+		#define tmrWHEEL_TICK_BITS		( 32U )
+	#endif
+
+	#define tmrWHEEL_SLOTS				( ( UBaseType_t ) 1U << configTIMING_WHEEL_SLOT_BITS )
+	#define tmrWHEEL_SLOT_MASK			( ( TickType_t ) tmrWHEEL_SLOTS - ( TickType_t ) 1U )
+	#define tmrWHEEL_LEVELS				( ( tmrWHEEL_TICK_BITS + configTIMING_WHEEL_SLOT_BITS - 1U ) / configTIMING_WHEEL_SLOT_BITS )
+
+	/* The list that references the timers that expire at xTimerWheelTime, and
+	the list that references the timers that expire after the tick count next
+	overflows. */
+	#define tmrEXPIRED_TIMER_LIST()		( &( xTimerWheel[ xTimerWheelTime & tmrWHEEL_SLOT_MASK ] ) )
+	#define tmrOVERFLOW_TIMER_LIST()	( &xOverflowTimerList )
+
+#else
+
+	#define tmrEXPIRED_TIMER_LIST()		( pxCurrentTimerList )
+	#define tmrOVERFLOW_TIMER_LIST()	( pxOverflowTimerList )
+
+#endif /* configUSE_TIMING_WHEEL_TIMERS */
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl
 {
@@ -164,10 +203,21 @@ static variables must be declared volatile. */
 /* The list in which active timers are stored.  Timers are referenced in expire
 time order, with the nearest expiry time at the front of the list.  Only the
 timer service task is allowed to access these lists. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if( configUSE_TIMING_WHEEL_TIMERS == 0 )
+
+	PRIVILEGED_DATA static List_t xActiveTimerList1;
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+
+#else
+
+	PRIVILEGED_DATA static List_t xTimerWheel[ tmrWHEEL_LEVELS * tmrWHEEL_SLOTS ];	/*< Active timers that expire before the tick count next overflows, one list per slot, level 0 first. */
+	PRIVILEGED_DATA static uint32_t ulTimerWheelMap[ tmrWHEEL_LEVELS ];			/*< One bit per slot that may reference a timer.  A set bit can be stale, a clear bit is never wrong. */
+	PRIVILEGED_DATA static TickType_t xTimerWheelTime = ( TickType_t ) 0U;			/*< The time the wheel has been advanced to.  Only ever moved to the start of a slot that references a timer, and back to 0 when the tick count overflows. */
+	PRIVILEGED_DATA static List_t xOverflowTimerList;								/*< Active timers that expire after the tick count next overflows, in the order in which they were started. */
+
+#endif
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -254,6 +304,32 @@ static void prvInitialiseNewTimer(	const char * const pcTimerName,
 									void * const pvTimerID,
 									TimerCallbackFunction_t pxCallbackFunction,
 									Timer_t *pxNewTimer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+
+	/*
+	 * Place a timer, the expiry time of which is already held in its list
+	 * item, in the slot of the timing wheel that matches the expiry time.
+	 */
+	static void prvInsertTimerInWheel( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the first slot of the timing wheel ahead of xTimerWheelTime that
+	 * references a timer, setting *pxSlotTime to the tick at which the slot
+	 * starts and *puxLevel to the level of the slot.  Returns NULL if the wheel
+	 * does not reference any timers.
+	 */
+	static List_t *prvGetNextWheelSlot( TickType_t * const pxSlotTime, UBaseType_t * const puxLevel ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Advance xTimerWheelTime to the start of the slot returned by
+	 * prvGetNextWheelSlot().  Returns pdTRUE if the slot is in level 0, in
+	 * which case the timers it references have expired.  Otherwise the timers
+	 * are moved down the wheel and pdFALSE is returned.
+	 */
+	static BaseType_t prvAdvanceTimerWheel( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMING_WHEEL_TIMERS */
 /*-----------------------------------------------------------*/
 
 BaseType_t xTimerCreateTimerTask( void )
@@ -498,7 +574,7 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
-Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( tmrEXPIRED_TIMER_LIST() );
 
 	/* Remove the timer from the list of active timers.  A check has already
 	been performed to ensure the list is not empty. */
@@ -590,7 +666,27 @@ BaseType_t xTimerListsWereSwitched;
 			if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
 			{
 				( void ) xTaskResumeAll();
-				prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+
+				#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+				{
+					/* xNextExpireTime is the start of the next wheel slot that
+					references a timer.  Only a level 0 slot holds timers that
+					have expired, the timers in a higher level slot are just
+					moved down the wheel. */
+					if( prvAdvanceTimerWheel() != pdFALSE )
+					{
+						prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#else
+				{
+					prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+				}
+				#endif
 			}
 			else
 			{
@@ -604,7 +700,7 @@ BaseType_t xTimerListsWereSwitched;
 				{
 					/* The current timer list is empty - is the overflow list
 					also empty? */
-					xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					xListWasEmpty = listLIST_IS_EMPTY( tmrOVERFLOW_TIMER_LIST() );
 				}
 
 				vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
@@ -634,24 +730,47 @@ BaseType_t xTimerListsWereSwitched;
 static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
 {
 TickType_t xNextExpireTime;
+#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+	UBaseType_t uxLevel;
+#endif
 
-	/* Timers are listed in expiry time order, with the head of the list
-	referencing the task that will expire first.  Obtain the time at which
-	the timer with the nearest expiry time will expire.  If there are no
-	active timers then just set the next expire time to 0.  That will cause
-	this task to unblock when the tick count overflows, at which point the
-	timer lists will be switched and the next expiry time can be
-	re-assessed.  */
-	*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-	if( *pxListWasEmpty == pdFALSE )
+	#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		/* The timer service task next has to act when the wheel reaches the
+		first slot that references a timer.  For a level 0 slot that is the
+		expiry time of the timers in the slot. */
+		if( prvGetNextWheelSlot( &xNextExpireTime, &uxLevel ) != NULL )
+		{
+			*pxListWasEmpty = pdFALSE;
+		}
+		else
+		{
+			/* Ensure the task unblocks when the tick count rolls over. */
+			*pxListWasEmpty = pdTRUE;
+			xNextExpireTime = ( TickType_t ) 0U;
+		}
 	}
-	else
+	#else
 	{
-		/* Ensure the task unblocks when the tick count rolls over. */
-		xNextExpireTime = ( TickType_t ) 0U;
+		/* Timers are listed in expiry time order, with the head of the list
+		referencing the task that will expire first.  Obtain the time at which
+		the timer with the nearest expiry time will expire.  If there are no
+		active timers then just set the next expire time to 0.  That will cause
+		this task to unblock when the tick count overflows, at which point the
+		timer lists will be switched and the next expiry time can be
+		re-assessed.  */
+		*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+		if( *pxListWasEmpty == pdFALSE )
+		{
+			xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		}
+		else
+		{
+			/* Ensure the task unblocks when the tick count rolls over. */
+			xNextExpireTime = ( TickType_t ) 0U;
+		}
 	}
+	#endif /* configUSE_TIMING_WHEEL_TIMERS */
 
 	return xNextExpireTime;
 }
@@ -699,7 +818,17 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		}
 		else
 		{
-			vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+			{
+				/* Timers that expire after the tick count overflows are moved
+				into the wheel when it does, in the order they were started. */
+				vListInsertEnd( &xOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			}
+			#else
+			{
+				vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			}
+			#endif
 		}
 	}
 	else
@@ -713,7 +842,15 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		}
 		else
 		{
-			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+			{
+				prvInsertTimerInWheel( pxTimer );
+			}
+			#else
+			{
+				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			}
+			#endif
 		}
 	}
 
@@ -871,20 +1008,39 @@ TickType_t xTimeNow;
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
-List_t *pxTemp;
 Timer_t *pxTimer;
 BaseType_t xResult;
+#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+	UBaseType_t uxLevel;
+#else
+	List_t *pxTemp;
+#endif
 
 	/* The tick count has overflowed.  The timer lists must be switched.
 	If there are any timers still referenced from the current timer list
 	then they must have expired and should be processed before the lists
-	are switched. */
+	are switched.  When the timing wheel is used that means advancing the
+	wheel until it is empty. */
+	#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+	while( prvGetNextWheelSlot( &xNextExpireTime, &uxLevel ) != NULL )
+	#else
 	while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+	#endif
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+		{
+			if( prvAdvanceTimerWheel() == pdFALSE )
+			{
+				/* Timers were only moved down the wheel. */
+				continue;
+			}
+		}
+		#endif
+
+		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( tmrEXPIRED_TIMER_LIST() );
 
 		/* Remove the timer from the list. */
-		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( tmrEXPIRED_TIMER_LIST() );
 		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
 		traceTIMER_EXPIRED( pxTimer );
 
@@ -906,7 +1062,16 @@ BaseType_t xResult;
 			{
 				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
 				listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
-				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+
+				#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+				{
+					prvInsertTimerInWheel( pxTimer );
+				}
+				#else
+				{
+					vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				}
+				#endif
 			}
 			else
 			{
@@ -921,12 +1086,147 @@ BaseType_t xResult;
 		}
 	}
 
-	pxTemp = pxCurrentTimerList;
-	pxCurrentTimerList = pxOverflowTimerList;
-	pxOverflowTimerList = pxTemp;
+	#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+	{
+		/* The wheel is empty, so can be restarted from the new tick count
+		epoch with the timers that were waiting for the overflow. */
+		xTimerWheelTime = ( TickType_t ) 0U;
+
+		while( listLIST_IS_EMPTY( &xOverflowTimerList ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( &xOverflowTimerList );
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+			prvInsertTimerInWheel( pxTimer );
+		}
+	}
+	#else
+	{
+		pxTemp = pxCurrentTimerList;
+		pxCurrentTimerList = pxOverflowTimerList;
+		pxOverflowTimerList = pxTemp;
+	}
+	#endif /* configUSE_TIMING_WHEEL_TIMERS */
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+
+	static void prvInsertTimerInWheel( Timer_t * const pxTimer )
+	{
+	const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+	const TickType_t xDifferentBits = xExpiryTime ^ xTimerWheelTime;
+	UBaseType_t uxLevel = ( UBaseType_t ) 0U, uxSlot;
+
+		/* Timers that have already expired are never placed in the wheel. */
+		configASSERT( xExpiryTime >= xTimerWheelTime );
+
+		/* Use the level of the highest group of bits in which the expiry time
+		differs from the wheel time.  The timer then stays in that level until
+		the wheel time reaches the start of its slot. */
+		while( ( uxLevel < ( tmrWHEEL_LEVELS - 1U ) ) && ( ( xDifferentBits >> ( ( uxLevel + 1U ) * configTIMING_WHEEL_SLOT_BITS ) ) != ( TickType_t ) 0U ) )
+		{
+			uxLevel++;
+		}
+
+		uxSlot = ( UBaseType_t ) ( ( xExpiryTime >> ( uxLevel * configTIMING_WHEEL_SLOT_BITS ) ) & tmrWHEEL_SLOT_MASK );
+
+		/* Timers are appended so timers with equal expiry times expire in the
+		order in which they were started. */
+		vListInsertEnd( &( xTimerWheel[ ( uxLevel * tmrWHEEL_SLOTS ) + uxSlot ] ), &( pxTimer->xTimerListItem ) );
+		ulTimerWheelMap[ uxLevel ] |= ( 1UL << uxSlot );
+	}
+	/*-----------------------------------------------------------*/
+
+	static List_t *prvGetNextWheelSlot( TickType_t * const pxSlotTime, UBaseType_t * const puxLevel )
+	{
+	List_t *pxSlot = NULL;
+	UBaseType_t uxLevel, uxSlot, uxShift;
+	TickType_t xLevelMask;
+
+		/* Every slot of a level starts after all the slots of the level below
+		that can reference a timer, so the first level with an occupied slot
+		ahead of the wheel time holds the next slot. */
+		for( uxLevel = ( UBaseType_t ) 0U; ( pxSlot == NULL ) && ( uxLevel < tmrWHEEL_LEVELS ); uxLevel++ )
+		{
+			uxShift = uxLevel * configTIMING_WHEEL_SLOT_BITS;
+			uxSlot = ( UBaseType_t ) ( ( xTimerWheelTime >> uxShift ) & tmrWHEEL_SLOT_MASK );
+
+			/* Above level 0 the timers in the slot the wheel time is in have
+			already been moved down the wheel. */
+			if( uxLevel != ( UBaseType_t ) 0U )
+			{
+				uxSlot++;
+			}
+
+			for( ; ( pxSlot == NULL ) && ( uxSlot < tmrWHEEL_SLOTS ); uxSlot++ )
+			{
+				if( ( ulTimerWheelMap[ uxLevel ] & ( 1UL << uxSlot ) ) == 0UL )
+				{
+					continue;
+				}
+
+				if( listLIST_IS_EMPTY( &( xTimerWheel[ ( uxLevel * tmrWHEEL_SLOTS ) + uxSlot ] ) ) != pdFALSE )
+				{
+					/* The timers that were in this slot have since been
+					stopped or restarted. */
+					ulTimerWheelMap[ uxLevel ] &= ~( 1UL << uxSlot );
+					continue;
+				}
+
+				pxSlot = &( xTimerWheel[ ( uxLevel * tmrWHEEL_SLOTS ) + uxSlot ] );
+
+				/* The slot starts when the bits of this level equal uxSlot and
+				the bits of the levels below are all zero. */
+				xLevelMask = ( tmrWHEEL_SLOT_MASK << uxShift ) | ( ( ( TickType_t ) 1U << uxShift ) - ( TickType_t ) 1U );
+				*pxSlotTime = ( xTimerWheelTime & ~xLevelMask ) | ( ( TickType_t ) uxSlot << uxShift );
+				*puxLevel = uxLevel;
+			}
+		}
+
+		return pxSlot;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvAdvanceTimerWheel( void )
+	{
+	List_t *pxSlot;
+	Timer_t *pxTimer;
+	TickType_t xSlotTime = ( TickType_t ) 0U;
+	UBaseType_t uxLevel = ( UBaseType_t ) 0U;
+	BaseType_t xReturn;
+
+		pxSlot = prvGetNextWheelSlot( &xSlotTime, &uxLevel );
+		configASSERT( pxSlot );
+
+		xTimerWheelTime = xSlotTime;
+
+		if( uxLevel == ( UBaseType_t ) 0U )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			/* Every timer that could have been placed in a lower level slot
+			with the same expiry time as a timer in this slot was started after
+			it, so moving the timers down in order keeps timers with equal
+			expiry times in the order in which they were started. */
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				prvInsertTimerInWheel( pxTimer );
+			}
+
+			ulTimerWheelMap[ uxLevel ] &= ~( 1UL << ( ( xSlotTime >> ( uxLevel * configTIMING_WHEEL_SLOT_BITS ) ) & tmrWHEEL_SLOT_MASK ) );
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TIMING_WHEEL_TIMERS */
+/*-----------------------------------------------------------*/
+
 static void prvCheckForValidListAndQueue( void )
 {
 	/* Check that the list from which active timers are referenced, and the
@@ -936,10 +1236,25 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			#if( configUSE_TIMING_WHEEL_TIMERS == 1 )
+			{
+			UBaseType_t uxSlot;
+
+				for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( tmrWHEEL_LEVELS * tmrWHEEL_SLOTS ); uxSlot++ )
+				{
+					vListInitialise( &( xTimerWheel[ uxSlot ] ) );
+				}
+
+				vListInitialise( &xOverflowTimerList );
+			}
+			#else
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#endif /* configUSE_TIMING_WHEEL_TIMERS */
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
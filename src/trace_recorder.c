@@ -0,0 +1,246 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include the trace recorder.  This #if is closed at the very bottom of this
+file. */
+#if( configUSE_TRACE_RECORDER == 1 )
+
+/* The recorder data.  It is not static so it can be located by name from a
+debugger or a linker map file, and dumped from RAM. */
+PRIVILEGED_DATA TraceRecorder_t xTraceRecorder =
+{
+	{ 'F', 'R', 'T', 'R', 'A', 'C', 'E', '\0' },
+	traceRECORDER_FORMAT_VERSION,
+	( uint32_t ) configTRACE_RECORDER_EVENTS,
+	( uint32_t ) configTRACE_RECORDER_TASK_NAMES,
+	( uint32_t ) traceRECORDER_NAME_LENGTH,
+	( uint32_t ) configTRACE_RECORDER_TIMESTAMP_HZ,
+	( uint32_t ) configNUMBER_OF_CORES,
+	1UL,	/* Enabled. */
+	0UL,	/* ulWriteIndex. */
+	{ { 0UL } },
+	{ { 0UL } }
+};
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Claim the index of the next event.  Lock free if the port provides
+ * portATOMIC_COMPARE_AND_SWAP_U32(), otherwise interrupts are masked for the
+ * few instructions it takes to increment the index.
+ */
+static uint32_t prvClaimEventIndex( void ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvClaimEventIndex( void )
+{
+uint32_t ulIndex;
+
+	#ifdef portATOMIC_COMPARE_AND_SWAP_U32
+	{
+		do
+		{
+			ulIndex = xTraceRecorder.ulWriteIndex;
+		} while( portATOMIC_COMPARE_AND_SWAP_U32( &( xTraceRecorder.ulWriteIndex ), ulIndex + 1UL, ulIndex ) == pdFALSE );
+	}
+	#else
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* Only single core builds get here, so portSET_INTERRUPT_MASK_FROM_ISR()
+		does not take any kernel locks. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulIndex = xTraceRecorder.ulWriteIndex;
+			xTraceRecorder.ulWriteIndex = ulIndex + 1UL;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	#endif /* portATOMIC_COMPARE_AND_SWAP_U32 */
+
+	return ulIndex;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecordEvent( uint8_t ucEvent, uint32_t ulParam1, uint32_t ulParam2 )
+{
+uint32_t ulIndex;
+volatile TraceEvent_t *pxEvent;
+
+	if( xTraceRecorder.ulEnabled != 0UL )
+	{
+		ulIndex = prvClaimEventIndex();
+		pxEvent = &( xTraceRecorder.xEvents[ ulIndex & ( ( uint32_t ) configTRACE_RECORDER_EVENTS - 1UL ) ] );
+
+		/* Mark the slot as being written, so a dump taken part way through
+		does not pair the sequence number of the old event with the data of
+		the new one. */
+		pxEvent->ulSequence = 0UL;
+		portMEMORY_BARRIER();
+
+		pxEvent->ulTimestamp = ( uint32_t ) configTRACE_RECORDER_TIMESTAMP();
+		pxEvent->ulParam1 = ulParam1;
+		pxEvent->ulParam2 = ulParam2;
+		pxEvent->ucEvent = ucEvent;
+
+		#if( configNUMBER_OF_CORES > 1 )
+		{
+			pxEvent->ucCore = ( uint8_t ) portGET_CORE_ID();
+		}
+		#else
+		{
+			pxEvent->ucCore = 0U;
+		}
+		#endif /* configNUMBER_OF_CORES */
+
+		/* The sequence number is written last to mark the event complete. */
+		portMEMORY_BARRIER();
+		pxEvent->ulSequence = ulIndex + 1UL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecordTaskName( uint32_t ulTaskNumber, const char *pcName ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+TraceTaskName_t *pxEntry;
+UBaseType_t x;
+
+	/* Task numbers start at 1.  Tasks are created from within a critical
+	section, so entries are never written by two tasks at once. */
+	pxEntry = &( xTraceRecorder.xTaskNames[ ( ulTaskNumber - 1UL ) & ( ( uint32_t ) configTRACE_RECORDER_TASK_NAMES - 1UL ) ] );
+	pxEntry->ulTaskNumber = 0UL;
+
+	for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) traceRECORDER_NAME_LENGTH; x++ )
+	{
+		if( ( x < ( UBaseType_t ) configMAX_TASK_NAME_LEN ) && ( pcName[ x ] != 0x00 ) )
+		{
+			pxEntry->cName[ x ] = pcName[ x ];
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	/* Pad the remainder of the entry, so the dump does not contain the end of
+	the name of the task that used the entry before. */
+	for( ; x < ( UBaseType_t ) traceRECORDER_NAME_LENGTH; x++ )
+	{
+		pxEntry->cName[ x ] = 0x00;
+	}
+
+	pxEntry->ulTaskNumber = ulTaskNumber;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStart( void )
+{
+	xTraceRecorder.ulEnabled = 1UL;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStop( void )
+{
+	xTraceRecorder.ulEnabled = 0UL;
+
+	/* Events already being written by other cores or interrupts complete
+	within a few instructions, so by the time the data is dumped they will be
+	complete. */
+	portMEMORY_BARRIER();
+}
+/*-----------------------------------------------------------*/
+
+const void *pvTraceRecorderGetData( void )
+{
+	return ( const void * ) &xTraceRecorder;
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include the trace recorder.  If you want to include the trace recorder then
+ensure configUSE_TRACE_RECORDER is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_TRACE_RECORDER == 1 */
+
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""Decode the binary task statistics stream written by xTaskGetStatsRecords().
+
+The stream is read from a file, or from stdin if no file is given, and printed
+as the tables vTaskList() and vTaskGetRunTimeStats() produce, or as CSV.  A
+file can hold any number of streams, one after the other.  The record layout
+is described above tskSTATS_FORMAT_VERSION in include/task.h.
+
+    python3 tools/freertos_stats.py capture.bin
+    python3 tools/freertos_stats.py --csv capture.bin > stats.csv
+"""
+
+import argparse
+import struct
+import sys
+
+FORMAT_VERSION = 1
+
+RECORD_HEADER = 1
+RECORD_TASK = 2
+RECORD_END = 3
+
+FLAG_RUN_TIME = 0x01
+FLAG_ISR_RUN_TIME = 0x02
+
+# eTaskState values, shown with the letters used by vTaskList().
+STATE_CHARS = {0: "X", 1: "R", 2: "B", 3: "S", 4: "D"}
+
+CSV_COLUMNS = ("snapshot", "tick_count", "complete", "name", "number", "state",
+               "priority", "base_priority", "stack_high_water_mark",
+               "run_time", "run_time_percent")
+
+
+class StatsFormatError(Exception):
+    pass
+
+
+class Snapshot:
+    def __init__(self, version, cores, name_length, flags, tick_rate, tick_count):
+        self.version = version
+        self.cores = cores
+        self.name_length = name_length
+        self.flags = flags
+        self.tick_rate = tick_rate
+        self.tick_count = tick_count
+        self.tasks = []
+        self.total_run_time = 0
+        self.isr_run_time = 0
+        self.complete = False
+        self.ended = False
+
+    def percent(self, run_time):
+        # vTaskGetRunTimeStats() rounds down, and shows "<1%" for zero.
+        if self.total_run_time < 100:
+            return None
+        return run_time // (self.total_run_time // 100)
+
+
+def parse_records(data):
+    """Yield ( type, payload ) for each record in data."""
+    offset = 0
+    while offset < len(data):
+        if len(data) - offset < 2:
+            raise StatsFormatError("truncated record at offset %d" % offset)
+        record_type, length = data[offset], data[offset + 1]
+        if length < 2 or offset + length > len(data):
+            raise StatsFormatError("bad record length %d at offset %d" % (length, offset))
+        yield record_type, data[offset + 2:offset + length]
+        offset += length
+
+
+def parse_stream(data):
+    """Return the list of snapshots held in data."""
+    snapshots = []
+    current = None
+
+    for record_type, payload in parse_records(data):
+        if record_type == RECORD_HEADER:
+            magic, version, cores, name_length, flags, tick_rate, tick_count = \
+                struct.unpack_from("<4sBBBBII", payload)
+            if magic != b"FRTS":
+                raise StatsFormatError("bad magic %r" % magic)
+            if version != FORMAT_VERSION:
+                raise StatsFormatError("unsupported format version %d" % version)
+            current = Snapshot(version, cores, name_length, flags, tick_rate, tick_count)
+            snapshots.append(current)
+        elif current is None or current.ended:
+            raise StatsFormatError("record type %d outside of a stream" % record_type)
+        elif record_type == RECORD_TASK:
+            number, run_time, stack, state, priority, base_priority = \
+                struct.unpack_from("<IQHBBB", payload)
+            name = payload[17:17 + current.name_length].split(b"\0", 1)[0]
+            current.tasks.append({
+                "name": name.decode("ascii", "replace"),
+                "number": number,
+                "state": STATE_CHARS.get(state, "?"),
+                "priority": priority,
+                "base_priority": base_priority,
+                "stack_high_water_mark": stack,
+                "run_time": run_time,
+            })
+        elif record_type == RECORD_END:
+            current.total_run_time, current.isr_run_time, count, complete = \
+                struct.unpack_from("<QQHB", payload)
+            if count != len(current.tasks):
+                raise StatsFormatError("end record counts %d tasks, stream has %d" % (count, len(current.tasks)))
+            current.complete = complete != 0
+            current.ended = True
+        else:
+            # Unknown record types are skipped, so older decoders can read
+            # streams that carry additional records.
+            pass
+
+    return snapshots
+
+
+def print_tables(snapshots, out):
+    for index, snapshot in enumerate(snapshots):
+        if index > 0:
+            out.write("\n")
+        status = "complete" if snapshot.complete else "INCOMPLETE - tasks were created or deleted"
+        if not snapshot.ended:
+            status = "TRUNCATED - no end record"
+        out.write("Tick %u (%u Hz), %d task(s), %s\n\n" % (snapshot.tick_count, snapshot.tick_rate, len(snapshot.tasks), status))
+
+        out.write("%-*s\tState\tPrio\tStack\tNum\n" % (snapshot.name_length, "Name"))
+        for task in snapshot.tasks:
+            out.write("%-*s\t%s\t%u\t%u\t%u\n" % (snapshot.name_length, task["name"], task["state"], task["priority"], task["stack_high_water_mark"], task["number"]))
+
+        if snapshot.flags & FLAG_RUN_TIME and snapshot.ended:
+            out.write("\n%-*s\tAbs Time\t%% Time\n" % (snapshot.name_length, "Name"))
+            rows = [(task["name"], task["run_time"]) for task in snapshot.tasks]
+            if snapshot.flags & FLAG_ISR_RUN_TIME:
+                rows.append(("ISR", snapshot.isr_run_time))
+            for name, run_time in rows:
+                percent = snapshot.percent(run_time)
+                percent = "<1%" if not percent else "%d%%" % percent
+                out.write("%-*s\t%u\t\t%s\n" % (snapshot.name_length, name, run_time, percent))
+
+
+def print_csv(snapshots, out):
+    out.write(",".join(CSV_COLUMNS) + "\n")
+    for index, snapshot in enumerate(snapshots):
+        for task in snapshot.tasks:
+            percent = snapshot.percent(task["run_time"]) if snapshot.flags & FLAG_RUN_TIME else None
+            row = (index, snapshot.tick_count, int(snapshot.complete), '"%s"' % task["name"].replace('"', '""'),
+                   task["number"], task["state"], task["priority"], task["base_priority"],
+                   task["stack_high_water_mark"], task["run_time"], "" if percent is None else percent)
+            out.write(",".join(str(value) for value in row) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("file", nargs="?", help="captured stream (default: stdin)")
+    parser.add_argument("--csv", action="store_true", help="write CSV instead of tables")
+    args = parser.parse_args()
+
+    if args.file:
+        with open(args.file, "rb") as stream:
+            data = stream.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    try:
+        snapshots = parse_stream(data)
+    except (StatsFormatError, struct.error) as error:
+        sys.stderr.write("freertos_stats: %s\n" % error)
+        return 1
+
+    if args.csv:
+        print_csv(snapshots, sys.stdout)
+    else:
+        print_tables(snapshots, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""Convert a dump of the kernel trace recorder to Chrome/Perfetto trace JSON.
+
+The input is a raw memory dump that contains the xTraceRecorder structure, for
+example written by a debugger ("dump binary memory trace.bin &xTraceRecorder
+...") or sent from the target using pvTraceRecorderGetData().  It can also be a
+larger RAM dump, in which case the recorder is located by its magic string.
+The layout is described above traceRECORDER_FORMAT_VERSION in
+include/trace_recorder.h.  Open the output in https://ui.perfetto.dev or
+chrome://tracing.
+
+    python3 tools/freertos_trace.py trace.bin > trace.json
+    python3 tools/freertos_trace.py --hz 72000000 ram.bin -o trace.json
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b"FRTRACE\0"
+FORMAT_VERSION = 1
+
+HEADER = struct.Struct("<8sIIIIIIII")
+EVENT = struct.Struct("<IIIIBBH")
+
+TASK_SWITCHED_IN = 1
+MALLOC = 40
+FREE = 41
+
+# Event code: ( name, what param1 identifies, name of param2 or None ).
+EVENTS = {
+    1: ("switched in", "task", "priority"),
+    2: ("create", "task", "priority"),
+    3: ("delete", "task", None),
+    4: ("ready", "task", None),
+    5: ("delay", "task", None),
+    6: ("delay until", "task", "wake_tick"),
+    7: ("suspend", "task", None),
+    8: ("resume", "task", None),
+    9: ("resume from ISR", "task", None),
+    10: ("priority set", "task", "priority"),
+    11: ("priority inherit", "task", "priority"),
+    12: ("priority disinherit", "task", "priority"),
+    13: ("deadline missed", "task", None),
+    14: ("budget exhausted", "task", None),
+    20: ("queue send", "queue", "items"),
+    21: ("queue send failed", "queue", None),
+    22: ("queue send from ISR", "queue", "items"),
+    23: ("queue receive", "queue", "items"),
+    24: ("queue receive failed", "queue", None),
+    25: ("queue receive from ISR", "queue", "items"),
+    26: ("block on queue send", "queue", None),
+    27: ("block on queue receive", "queue", None),
+    30: ("timer expired", "timer", None),
+    31: ("event group set bits", "event_group", "bits"),
+    40: ("malloc", "address", "size"),
+    41: ("free", "address", "size"),
+}
+
+
+class TraceFormatError(Exception):
+    pass
+
+
+class Recording:
+    def __init__(self, data, offset, endian):
+        fields = struct.unpack_from(endian + HEADER.format[1:], data, offset)
+        (_, self.version, self.event_count, self.name_count, self.name_length,
+         self.timestamp_hz, self.cores, self.enabled, self.write_index) = fields
+        if self.version != FORMAT_VERSION:
+            raise TraceFormatError("unsupported format version %d" % self.version)
+
+        offset += HEADER.size
+        name_size = 4 + self.name_length
+        end = offset + self.name_count * name_size + self.event_count * EVENT.size
+        if end > len(data):
+            raise TraceFormatError("dump is truncated, %d bytes short" % (end - len(data)))
+
+        self.names = {}
+        for index in range(self.name_count):
+            number, = struct.unpack_from(endian + "I", data, offset)
+            name = data[offset + 4:offset + name_size].split(b"\0", 1)[0]
+            if number != 0:
+                self.names[number] = name.decode("ascii", "replace")
+            offset += name_size
+
+        self.events = []
+        for index in range(self.event_count):
+            event = struct.unpack_from(endian + EVENT.format[1:], data, offset)
+            offset += EVENT.size
+            sequence = event[0]
+            # Skip empty slots, and slots that were being rewritten when the
+            # dump was taken.
+            if sequence != 0 and (sequence - 1) % self.event_count == index:
+                self.events.append(event[:6])
+        self.events.sort()
+
+    def task_name(self, number):
+        return self.names.get(number, "Task %u" % number)
+
+
+def find_recording(data):
+    offset = data.find(MAGIC)
+    if offset < 0:
+        raise TraceFormatError("no trace recorder found in the dump")
+    # The version word tells the byte order of the target.
+    for endian in ("<", ">"):
+        version, = struct.unpack_from(endian + "I", data, offset + len(MAGIC))
+        if version == FORMAT_VERSION:
+            return Recording(data, offset, endian)
+    raise TraceFormatError("unsupported format version")
+
+
+def unwrap_timestamps(events, hz):
+    """Extend the 32-bit timestamps, allowing for small steps backwards
+    between events recorded on different cores.  A step backwards of more than
+    a second means the timestamp clock was started after the event before it
+    was recorded - as when it is started by vTaskStartScheduler() - so the
+    earlier events are placed at the start of the trace."""
+    last = None
+    extended = 0
+    for event in events:
+        timestamp = event[1]
+        if last is not None:
+            delta = (timestamp - last) & 0xFFFFFFFF
+            if delta >= 0x80000000:
+                delta -= 0x100000000
+            if delta > -hz:
+                extended += delta
+        last = timestamp
+        yield extended, event
+
+
+def to_json(recording, hz):
+    scale = 1e6 / hz
+    trace = [{"ph": "M", "pid": 1, "name": "process_name", "args": {"name": "FreeRTOS"}}]
+    for core in range(recording.cores):
+        trace.append({"ph": "M", "pid": 1, "tid": core, "name": "thread_name", "args": {"name": "Core %d" % core}})
+
+    running = {}
+    heap = {}
+    heap_used = 0
+    first = None
+    timestamp = 0
+
+    for timestamp, event in unwrap_timestamps(recording.events, hz):
+        if first is None:
+            first = timestamp
+        microseconds = (timestamp - first) * scale
+        sequence, _, param1, param2, code, core = event
+        name, kind, param2_name = EVENTS.get(code, ("event %d" % code, "object", "param"))
+
+        if code == TASK_SWITCHED_IN:
+            previous = running.get(core)
+            if previous is not None:
+                trace.append(slice_event(recording, previous, core, microseconds))
+            running[core] = (microseconds, param1, param2)
+            continue
+
+        args = {}
+        if kind == "task":
+            label = "%s %s" % (recording.task_name(param1), name)
+            args["task"] = param1
+        else:
+            label = name
+            args[kind] = "0x%08x" % param1
+        if param2_name is not None:
+            args[param2_name] = param2
+        trace.append({"ph": "i", "s": "t", "pid": 1, "tid": core, "ts": microseconds, "name": label, "cat": kind, "args": args})
+
+        if code == MALLOC and param1 != 0:
+            heap[param1] = param2
+            heap_used += param2
+        elif code == FREE and param1 in heap:
+            heap_used -= heap.pop(param1)
+        else:
+            continue
+        trace.append({"ph": "C", "pid": 1, "ts": microseconds, "name": "heap", "args": {"bytes": heap_used}})
+
+    # Close the slices of the tasks still running when recording stopped.
+    if first is not None:
+        microseconds = (timestamp - first) * scale
+        for core, previous in sorted(running.items()):
+            trace.append(slice_event(recording, previous, core, microseconds))
+
+    return {"traceEvents": trace, "displayTimeUnit": "ns",
+            "otherData": {"events": len(recording.events),
+                          "lost": recording.write_index - len(recording.events),
+                          "timestamp_hz": hz}}
+
+
+def slice_event(recording, previous, core, end):
+    start, number, priority = previous
+    return {"ph": "X", "pid": 1, "tid": core, "ts": start, "dur": end - start,
+            "name": recording.task_name(number), "cat": "task",
+            "args": {"task": number, "priority": priority}}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("file", nargs="?", help="memory dump (default: stdin)")
+    parser.add_argument("-o", "--output", help="JSON file to write (default: stdout)")
+    parser.add_argument("--hz", type=int, help="timestamp frequency, overrides configTRACE_RECORDER_TIMESTAMP_HZ")
+    args = parser.parse_args()
+
+    if args.file:
+        with open(args.file, "rb") as stream:
+            data = stream.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    try:
+        recording = find_recording(data)
+    except (TraceFormatError, struct.error) as error:
+        sys.stderr.write("freertos_trace: %s\n" % error)
+        return 1
+
+    hz = args.hz or recording.timestamp_hz
+    if not hz:
+        sys.stderr.write("freertos_trace: timestamp frequency unknown, assuming 1 MHz (use --hz)\n")
+        hz = 1000000
+
+    result = json.dumps(to_json(recording, hz))
+    if args.output:
+        with open(args.output, "w") as stream:
+            stream.write(result)
+    else:
+        sys.stdout.write(result + "\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,129 @@
+/*
+ * Kernel configuration used by the host tests and benchmarks in this
+ * directory.  They run on the Linux/POSIX simulator port in port/GCC/Posix.
+ * The options that a test or benchmark varies are guarded with #ifndef, so
+ * the Makefile can set them on the compiler command line.
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+
+/* Host (Linux/POSIX simulator), so no STM32 headers are included. */
+#define configMCU_TYPE							4
+
+#define configUSE_PREEMPTION					1
+#define configUSE_TIME_SLICING					1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION	0
+#define configUSE_TICKLESS_IDLE					0
+#define configCPU_CLOCK_HZ						( ( unsigned long ) 1000000 )
+#define configTICK_RATE_HZ						( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES					( 10 )
+#define configMINIMAL_STACK_SIZE				( ( unsigned short ) 256 )
+#define configMAX_TASK_NAME_LEN					( 16 )
+#define configUSE_16_BIT_TICKS					0
+#define configIDLE_SHOULD_YIELD					1
+#define configTOTAL_HEAP_SIZE					( ( size_t ) ( 1024 * 1024 ) )
+
+#ifndef configNUMBER_OF_CORES
+	#define configNUMBER_OF_CORES				1
+#endif
+
+/* Synchronisation objects. */
+#define configUSE_MUTEXES						1
+#define configUSE_RECURSIVE_MUTEXES				1
+#define configUSE_COUNTING_SEMAPHORES			1
+#define configUSE_QUEUE_SETS					1
+#define configUSE_TASK_NOTIFICATIONS			1
+#define configUSE_STREAM_BUFFERS				1
+#define configUSE_FAST_MUTEXES					1
+#define configUSE_CONDITION_VARIABLES			1
+#define configUSE_MULTIPLE_OBJECT_WAITS			1
+#define configUSE_RW_LOCKS						1
+#define configQUEUE_REGISTRY_SIZE				0
+
+#ifndef configPRIORITY_INHERITANCE_DEPTH
+	#define configPRIORITY_INHERITANCE_DEPTH	1
+#endif
+
+#ifndef configUSE_QUEUE_BATCHES
+	#define configUSE_QUEUE_BATCHES				1
+#endif
+
+#ifndef configUSE_TIMING_WHEEL_DELAYS
+	#define configUSE_TIMING_WHEEL_DELAYS		0
+#endif
+
+#ifndef configUSE_TIMING_WHEEL_TIMERS
+	#define configUSE_TIMING_WHEEL_TIMERS		0
+#endif
+
+#ifndef configUSE_EDF_SCHEDULING
+	#define configUSE_EDF_SCHEDULING			0
+#endif
+
+/* Memory allocation. */
+#define configSUPPORT_DYNAMIC_ALLOCATION		1
+#define configSUPPORT_STATIC_ALLOCATION			0
+
+/* Hook functions. */
+#define configUSE_IDLE_HOOK						0
+#ifndef configUSE_TICK_HOOK
+	#define configUSE_TICK_HOOK					0
+#endif
+#define configUSE_MALLOC_FAILED_HOOK			1
+#define configCHECK_FOR_STACK_OVERFLOW			0
+
+/* Run time stats, counted in microseconds by the port. */
+#define configGENERATE_RUN_TIME_STATS			1
+#define configUSE_TRACE_FACILITY				1
+#define configUSE_STATS_FORMATTING_FUNCTIONS	0
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()		ulPortGetRunTimeCounterValue()
+
+/* Co-routines and software timers. */
+#define configUSE_CO_ROUTINES					0
+#define configMAX_CO_ROUTINE_PRIORITIES			( 2 )
+#define configUSE_TIMERS						1
+#define configTIMER_TASK_PRIORITY				( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH				10
+#define configTIMER_TASK_STACK_DEPTH			( configMINIMAL_STACK_SIZE * 2 )
+
+/* Optional API functions. */
+#define INCLUDE_vTaskPrioritySet				1
+#define INCLUDE_uxTaskPriorityGet				1
+#define INCLUDE_vTaskDelete						1
+#define INCLUDE_vTaskSuspend					1
+#define INCLUDE_vTaskDelayUntil					1
+#define INCLUDE_vTaskDelay						1
+#define INCLUDE_xTaskGetSchedulerState			1
+#define INCLUDE_xTaskGetCurrentTaskHandle		1
+#define INCLUDE_eTaskGetState					1
+#define INCLUDE_xTaskAbortDelay					1
+#define INCLUDE_xSemaphoreGetMutexHolder		1
+
+/* Benchmarks built with harnessTRACE_TASK_DELAY set to 1 time the kernel from
+the start of vTaskDelay() to the calling task being switched out, and define
+these two functions. */
+#if defined( harnessTRACE_TASK_DELAY ) && ( harnessTRACE_TASK_DELAY == 1 )
+	void vHarnessTraceDelayStart( void );
+	void vHarnessTraceSwitchedOut( void );
+	#define traceTASK_DELAY()			vHarnessTraceDelayStart()
+	#define traceTASK_SWITCHED_OUT()	vHarnessTraceSwitchedOut()
+#endif
+
+/* Likewise harnessTRACE_TIMER_COMMAND times the timer service task from it
+receiving a command to it being switched out. */
+#if defined( harnessTRACE_TIMER_COMMAND ) && ( harnessTRACE_TIMER_COMMAND == 1 )
+	void vHarnessTraceTimerCommand( void );
+	void vHarnessTraceSwitchedOut( void );
+	#define traceTIMER_COMMAND_RECEIVED( pxTimer, xMessageID, xMessageValue )	vHarnessTraceTimerCommand()
+	#define traceTASK_SWITCHED_OUT()	vHarnessTraceSwitchedOut()
+#endif
+
+/* A failed assert ends the test with the file and line of the assert. */
+void vAssertCalled( const char *pcFile, unsigned long ulLine );
+#define configASSERT( x ) if( ( x ) == 0 ) vAssertCalled( __FILE__, __LINE__ )
+
+#endif /* FREERTOS_CONFIG_H */
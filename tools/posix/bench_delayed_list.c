@@ -0,0 +1,177 @@
+/*
+ * Measures the cost of blocking a task with vTaskDelay() as the number of
+ * tasks that are already blocked grows, for the sorted delayed task lists and
+ * for the timing wheel (configUSE_TIMING_WHEEL_DELAYS).
+ *
+ * The control task blocks with a delay longer than that of any other task,
+ * which is the worst case for the sorted list as the whole list is walked to
+ * find the insertion point.  A lower priority task wakes it straight away
+ * with xTaskAbortDelay(), so each iteration is one block, one wake and two
+ * context switches.
+ *
+ * Two figures are given.  The kernel time is from the start of vTaskDelay()
+ * to the control task being switched out, timed with the trace macros, which
+ * is where the delayed list is updated.  The round trip also includes the
+ * wake and the context switches of this port, which vary by more than the
+ * walk costs, so each figure is the best of several runs.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "harness.h"
+
+#define mainITERATIONS			( 10000UL )
+#define mainRUNS				( 5 )
+
+/* The stack of a task on this port only holds the data of its host thread,
+so the blocked tasks are given small stacks to fit more of them in the heap. */
+#define mainBLOCKED_STACK_SIZE	( configMINIMAL_STACK_SIZE / 4 )
+
+/* The blocked tasks wake long after the benchmark has ended, and the control
+task blocks for longer still. */
+#define mainBLOCKED_DELAY		( ( TickType_t ) 100000 )
+#define mainCONTROL_DELAY		( ( TickType_t ) 200000 )
+
+#define mainBLOCKED_PRIORITY	( tskIDLE_PRIORITY + 1 )
+#define mainWAKER_PRIORITY		( tskIDLE_PRIORITY + 2 )
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 3 )
+
+static void prvControlTask( void *pvParameters );
+
+static TaskHandle_t xControlTask;
+
+/* The number of blocked tasks to measure with. */
+static const UBaseType_t uxBlockedCounts[] = { 0, 200, 800 };
+
+/* Written by the trace macros.  ullDelayStart is 0 when the task being
+switched out did not call vTaskDelay(). */
+static uint64_t ullDelayStart, ullKernelTime;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, &xControlTask );
+
+	/* Returns once the control task has ended the scheduler. */
+	vTaskStartScheduler();
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vHarnessTraceDelayStart( void )
+{
+	ullDelayStart = ullHarnessGetNanoseconds();
+}
+/*-----------------------------------------------------------*/
+
+void vHarnessTraceSwitchedOut( void )
+{
+	if( ullDelayStart != 0 )
+	{
+		ullKernelTime += ullHarnessGetNanoseconds() - ullDelayStart;
+		ullDelayStart = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBlockedTask( void *pvParameters )
+{
+UBaseType_t uxIndex = ( UBaseType_t ) pvParameters;
+
+	/* Spread the wake times so the sorted list is not trivially ordered. */
+	for( ;; )
+	{
+		vTaskDelay( mainBLOCKED_DELAY + ( TickType_t ) ( ( uxIndex * 37U ) % 1000U ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWakerTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	/* Only runs while the control task is blocked. */
+	for( ;; )
+	{
+		( void ) xTaskAbortDelay( xControlTask );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeDelays( double *pdKernel, double *pdRoundTrip )
+{
+uint64_t ullStart, ullElapsed;
+uint32_t ul;
+BaseType_t xRun;
+
+	*pdKernel = 0.0;
+	*pdRoundTrip = 0.0;
+
+	for( xRun = 0; xRun < mainRUNS; xRun++ )
+	{
+		ullKernelTime = 0;
+		ullStart = ullHarnessGetNanoseconds();
+
+		for( ul = 0; ul < mainITERATIONS; ul++ )
+		{
+			vTaskDelay( mainCONTROL_DELAY );
+		}
+
+		ullElapsed = ullHarnessGetNanoseconds() - ullStart;
+
+		if( ( xRun == 0 ) || ( ( double ) ullKernelTime < *pdKernel ) )
+		{
+			*pdKernel = ( double ) ullKernelTime;
+		}
+
+		if( ( xRun == 0 ) || ( ( double ) ullElapsed < *pdRoundTrip ) )
+		{
+			*pdRoundTrip = ( double ) ullElapsed;
+		}
+	}
+
+	*pdKernel /= ( double ) mainITERATIONS;
+	*pdRoundTrip /= ( double ) mainITERATIONS;
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+TaskHandle_t xWaker;
+UBaseType_t uxBlocked = 0, uxCount;
+BaseType_t xCreated;
+double dKernel, dRoundTrip;
+
+	( void ) pvParameters;
+
+	xTaskCreate( prvWakerTask, "Wake", configMINIMAL_STACK_SIZE, NULL, mainWAKER_PRIORITY, &xWaker );
+
+	for( uxCount = 0; uxCount < ( sizeof( uxBlockedCounts ) / sizeof( uxBlockedCounts[ 0 ] ) ); uxCount++ )
+	{
+		while( uxBlocked < uxBlockedCounts[ uxCount ] )
+		{
+			xCreated = xTaskCreate( prvBlockedTask, "Blk", mainBLOCKED_STACK_SIZE, ( void * ) uxBlocked, mainBLOCKED_PRIORITY, NULL );
+			configASSERT( xCreated == pdPASS );
+			( void ) xCreated;
+			uxBlocked++;
+		}
+
+		/* The waker would stop the new tasks running, so let them block
+		first. */
+		vTaskSuspend( xWaker );
+		vTaskDelay( 2 );
+		vTaskResume( xWaker );
+
+		prvTimeDelays( &dKernel, &dRoundTrip );
+
+		vHarnessPrintf( "%s, %3u other tasks blocked: %5.0f ns in the kernel to block, %5.0f ns per block and wake\n",
+						( configUSE_TIMING_WHEEL_DELAYS == 1 ) ? "timing wheel" : "sorted list ",
+						( unsigned ) uxBlocked, dKernel, dRoundTrip );
+	}
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
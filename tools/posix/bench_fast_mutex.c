@@ -0,0 +1,95 @@
+/*
+ * Measures the time taken to take and give back a mutex no other task wants,
+ * for a fast mutex and for a mutex created with xSemaphoreCreateMutex().
+ *
+ * The fast mutex is taken and given back with one atomic compare and swap
+ * each, where the queue based mutex enters a critical section for each.  The
+ * benchmark is built for 1 and 2 cores, as critical sections cost more on
+ * more than one core.  On more than one core the running task is looked up
+ * with interrupts masked, which on this port is a system call, so that cost
+ * dominates the figures for both kinds of mutex.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "fast_mutex.h"
+
+#include "harness.h"
+
+#define mainITERATIONS			( 1000000UL )
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 1 )
+
+static void prvControlTask( void *pvParameters );
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, NULL );
+
+	/* Returns once the control task has ended the scheduler. */
+	vTaskStartScheduler();
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+static double prvTimeFastMutex( FastMutexHandle_t xFastMutex )
+{
+uint64_t ullStart;
+uint32_t ul;
+
+	ullStart = ullHarnessGetNanoseconds();
+
+	for( ul = 0; ul < mainITERATIONS; ul++ )
+	{
+		( void ) xFastMutexLock( xFastMutex, portMAX_DELAY );
+		( void ) xFastMutexUnlock( xFastMutex );
+	}
+
+	return ( double ) ( ullHarnessGetNanoseconds() - ullStart ) / ( double ) mainITERATIONS;
+}
+/*-----------------------------------------------------------*/
+
+static double prvTimeQueueMutex( SemaphoreHandle_t xMutex )
+{
+uint64_t ullStart;
+uint32_t ul;
+
+	ullStart = ullHarnessGetNanoseconds();
+
+	for( ul = 0; ul < mainITERATIONS; ul++ )
+	{
+		( void ) xSemaphoreTake( xMutex, portMAX_DELAY );
+		( void ) xSemaphoreGive( xMutex );
+	}
+
+	return ( double ) ( ullHarnessGetNanoseconds() - ullStart ) / ( double ) mainITERATIONS;
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+FastMutexHandle_t xFastMutex;
+SemaphoreHandle_t xMutex;
+double dFast, dQueue;
+
+	( void ) pvParameters;
+
+	xFastMutex = xFastMutexCreate();
+	xMutex = xSemaphoreCreateMutex();
+	configASSERT( ( xFastMutex != NULL ) && ( xMutex != NULL ) );
+
+	/* Warm up, then measure. */
+	( void ) prvTimeFastMutex( xFastMutex );
+	( void ) prvTimeQueueMutex( xMutex );
+	dFast = prvTimeFastMutex( xFastMutex );
+	dQueue = prvTimeQueueMutex( xMutex );
+
+	vHarnessPrintf( "%d core(s), uncontended take and give: fast mutex %.1f ns/op, queue mutex %.1f ns/op\n",
+					configNUMBER_OF_CORES, dFast, dQueue );
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,231 @@
+/*
+ * Replays a trace of pvPortMalloc() and vPortFree() calls and reports how long
+ * each call took, for the heap implementation the program is built with
+ * (mainHEAP is 4 for heap_4.c or 6 for heap_6.c).
+ *
+ * The trace is generated from a fixed seed, so every build replays the same
+ * calls.  Blocks of mixed sizes are allocated and freed in random order,
+ * which fragments the heap - heap_4.c walks its free list to find a block, so
+ * its worst case grows with the fragmentation, where heap_6.c finds a block in
+ * a bounded number of steps.
+ *
+ * The trace is replayed before the scheduler is started so no tick interrupt
+ * lands within a call.  It is replayed several times, the heap being emptied
+ * in between, and the shortest time taken by each call is kept, so a call the
+ * host happened to preempt does not count as the worst case.  Every call
+ * includes the critical section entered by xTaskResumeAll(), which on this
+ * port is a system call, so the figures that matter are the differences.
+ */
+
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "harness.h"
+
+#define mainTRACE_LENGTH		( 100000UL )
+#define mainRUNS				( 5 )
+#define mainSLOTS				( 4096U )
+
+#ifndef mainHEAP
+	#define mainHEAP			4
+#endif
+
+/* The trace never has more than this many bytes allocated, so it can be
+replayed without running out of heap however the heap is fragmented. */
+#define mainMAX_LIVE_BYTES		( configTOTAL_HEAP_SIZE / 3 )
+
+#if( mainHEAP == 6 )
+	/* heap_6.c is given the same amount of memory as heap_4.c has. */
+	static uint8_t ucHeapRegion[ configTOTAL_HEAP_SIZE ] __attribute__( ( aligned( portBYTE_ALIGNMENT ) ) );
+#endif
+
+/* One call in the trace.  usSize is 0 for a vPortFree() call. */
+typedef struct TRACE_CALL
+{
+	uint16_t usSlot;
+	uint16_t usSize;
+} TraceCall_t;
+
+static TraceCall_t xTrace[ mainTRACE_LENGTH ];
+
+/* The shortest time taken by each call over the runs. */
+static uint32_t ulCallTime[ mainTRACE_LENGTH ];
+
+static void *pvSlots[ mainSLOTS ];
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+static uint32_t ulSeed = 0x12345678UL;
+
+	ulSeed = ( ulSeed * 1103515245UL ) + 12345UL;
+	return ulSeed >> 8;
+}
+/*-----------------------------------------------------------*/
+
+static uint16_t prvRandomSize( void )
+{
+uint32_t ulClass = prvRandom() % 100UL;
+uint16_t usSize;
+
+	/* Mostly small objects, some buffers and the occasional stack. */
+	if( ulClass < 70UL )
+	{
+		usSize = ( uint16_t ) ( 16UL + ( prvRandom() % 112UL ) );
+	}
+	else if( ulClass < 95UL )
+	{
+		usSize = ( uint16_t ) ( 128UL + ( prvRandom() % 896UL ) );
+	}
+	else
+	{
+		usSize = ( uint16_t ) ( 1024UL + ( prvRandom() % 7168UL ) );
+	}
+
+	return usSize;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGenerateTrace( void )
+{
+static uint16_t usLiveSize[ mainSLOTS ];
+size_t xLiveBytes = 0;
+uint32_t ulCall;
+uint16_t usSlot, usSize;
+
+	ulCall = 0;
+
+	while( ulCall < mainTRACE_LENGTH )
+	{
+		usSlot = ( uint16_t ) ( prvRandom() % mainSLOTS );
+		usSize = prvRandomSize();
+
+		if( usLiveSize[ usSlot ] != 0 )
+		{
+			/* Free a used slot. */
+			xLiveBytes -= usLiveSize[ usSlot ];
+			usLiveSize[ usSlot ] = 0;
+			xTrace[ ulCall ].usSlot = usSlot;
+			xTrace[ ulCall ].usSize = 0;
+			ulCall++;
+		}
+		else if( ( xLiveBytes + usSize ) <= mainMAX_LIVE_BYTES )
+		{
+			/* Allocate into a free slot. */
+			usLiveSize[ usSlot ] = usSize;
+			xLiveBytes += usSize;
+			xTrace[ ulCall ].usSlot = usSlot;
+			xTrace[ ulCall ].usSize = usSize;
+			ulCall++;
+		}
+		else
+		{
+			/* Over the budget, so pick another slot. */
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvReplayTrace( BaseType_t xFirstRun )
+{
+uint64_t ullStart;
+uint32_t ulCall, ulTime;
+UBaseType_t uxSlot;
+
+	for( ulCall = 0; ulCall < mainTRACE_LENGTH; ulCall++ )
+	{
+		uxSlot = xTrace[ ulCall ].usSlot;
+
+		if( xTrace[ ulCall ].usSize != 0 )
+		{
+			ullStart = ullHarnessGetNanoseconds();
+			pvSlots[ uxSlot ] = pvPortMalloc( xTrace[ ulCall ].usSize );
+			ulTime = ( uint32_t ) ( ullHarnessGetNanoseconds() - ullStart );
+		}
+		else
+		{
+			ullStart = ullHarnessGetNanoseconds();
+			vPortFree( pvSlots[ uxSlot ] );
+			ulTime = ( uint32_t ) ( ullHarnessGetNanoseconds() - ullStart );
+			pvSlots[ uxSlot ] = NULL;
+		}
+
+		if( ( xFirstRun != pdFALSE ) || ( ulTime < ulCallTime[ ulCall ] ) )
+		{
+			ulCallTime[ ulCall ] = ulTime;
+		}
+	}
+
+	/* Empty the heap for the next run. */
+	for( uxSlot = 0; uxSlot < mainSLOTS; uxSlot++ )
+	{
+		vPortFree( pvSlots[ uxSlot ] );
+		pvSlots[ uxSlot ] = NULL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompareTimes( const void *pv1, const void *pv2 )
+{
+uint32_t ul1 = *( const uint32_t * ) pv1, ul2 = *( const uint32_t * ) pv2;
+
+	return ( ul1 > ul2 ) - ( ul1 < ul2 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvReport( const char *pcCall, BaseType_t xMalloc )
+{
+static uint32_t ulTimes[ mainTRACE_LENGTH ];
+uint32_t ulCall, ulCount = 0;
+uint64_t ullTotal = 0;
+
+	for( ulCall = 0; ulCall < mainTRACE_LENGTH; ulCall++ )
+	{
+		if( ( xTrace[ ulCall ].usSize != 0 ) == ( xMalloc != pdFALSE ) )
+		{
+			ulTimes[ ulCount ] = ulCallTime[ ulCall ];
+			ullTotal += ulCallTime[ ulCall ];
+			ulCount++;
+		}
+	}
+
+	qsort( ulTimes, ulCount, sizeof( ulTimes[ 0 ] ), prvCompareTimes );
+
+	vHarnessPrintf( "heap_%d, %-12s %6u calls: mean %4.0f ns, 99.9%% %5u ns, worst %5u ns\n",
+					mainHEAP, pcCall, ( unsigned ) ulCount, ( double ) ullTotal / ( double ) ulCount,
+					( unsigned ) ulTimes[ ( ulCount * 999UL ) / 1000UL ], ( unsigned ) ulTimes[ ulCount - 1UL ] );
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+BaseType_t xRun;
+
+	#if( mainHEAP == 6 )
+	{
+	const HeapRegion_t xHeapRegions[] =
+	{
+		{ ucHeapRegion, sizeof( ucHeapRegion ) },
+		{ NULL, 0 }
+	};
+
+		vPortDefineHeapRegions( xHeapRegions );
+	}
+	#endif
+
+	prvGenerateTrace();
+
+	for( xRun = 0; xRun < mainRUNS; xRun++ )
+	{
+		prvReplayTrace( ( xRun == 0 ) ? pdTRUE : pdFALSE );
+	}
+
+	prvReport( "pvPortMalloc", pdTRUE );
+	prvReport( "vPortFree", pdFALSE );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,197 @@
+/*
+ * Measures queue throughput in items per second when items are sent and
+ * received one at a time with xQueueSend() and xQueueReceive(), and in
+ * batches with xQueueSendMultiple() and xQueueReceiveMultiple().
+ *
+ * Fill and drain: one task fills the queue and empties it again, so the
+ * figures are the cost of entering the kernel for each item or each batch.
+ *
+ * Producer to consumer: a producer sends to a consumer of higher priority that
+ * is blocked on the queue.  One at a time, every item unblocks the consumer
+ * and so costs two context switches.  In batches the consumer is unblocked
+ * once per batch.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#include "harness.h"
+
+#define mainQUEUE_LENGTH		( 64U )
+#define mainBATCH				( 16U )
+#define mainFILL_ROUNDS			( 20000UL )
+#define mainTRANSFER_ITEMS		( 200000UL )
+
+#define mainPRODUCER_PRIORITY	( tskIDLE_PRIORITY + 1 )
+#define mainCONSUMER_PRIORITY	( tskIDLE_PRIORITY + 2 )
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 3 )
+
+static void prvControlTask( void *pvParameters );
+
+static QueueHandle_t xQueue;
+static TaskHandle_t xControlTask;
+
+/* pdTRUE while the producer to consumer test uses batches. */
+static volatile BaseType_t xUseBatches;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xQueue = xQueueCreate( mainQUEUE_LENGTH, sizeof( uint32_t ) );
+	configASSERT( xQueue );
+
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, &xControlTask );
+
+	/* Returns once the control task has ended the scheduler. */
+	vTaskStartScheduler();
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+static double prvFillAndDrain( BaseType_t xBatches )
+{
+uint32_t ulItems[ mainQUEUE_LENGTH ];
+uint64_t ullStart;
+uint32_t ulRound;
+UBaseType_t uxItem;
+size_t xMoved;
+
+	for( uxItem = 0; uxItem < mainQUEUE_LENGTH; uxItem++ )
+	{
+		ulItems[ uxItem ] = ( uint32_t ) uxItem;
+	}
+
+	ullStart = ullHarnessGetNanoseconds();
+
+	for( ulRound = 0; ulRound < mainFILL_ROUNDS; ulRound++ )
+	{
+		if( xBatches != pdFALSE )
+		{
+			for( uxItem = 0; uxItem < mainQUEUE_LENGTH; uxItem += mainBATCH )
+			{
+				xMoved = xQueueSendMultiple( xQueue, &( ulItems[ uxItem ] ), mainBATCH, 0 );
+				configASSERT( xMoved == mainBATCH );
+			}
+
+			for( uxItem = 0; uxItem < mainQUEUE_LENGTH; uxItem += mainBATCH )
+			{
+				xMoved = xQueueReceiveMultiple( xQueue, &( ulItems[ uxItem ] ), mainBATCH, 0 );
+				configASSERT( xMoved == mainBATCH );
+			}
+
+			( void ) xMoved;
+		}
+		else
+		{
+			for( uxItem = 0; uxItem < mainQUEUE_LENGTH; uxItem++ )
+			{
+				( void ) xQueueSend( xQueue, &( ulItems[ uxItem ] ), 0 );
+			}
+
+			for( uxItem = 0; uxItem < mainQUEUE_LENGTH; uxItem++ )
+			{
+				( void ) xQueueReceive( xQueue, &( ulItems[ uxItem ] ), 0 );
+			}
+		}
+	}
+
+	/* Each item is sent once and received once. */
+	return ( double ) ( mainFILL_ROUNDS * mainQUEUE_LENGTH ) * 1000000000.0 / ( double ) ( ullHarnessGetNanoseconds() - ullStart );
+}
+/*-----------------------------------------------------------*/
+
+static void prvProducerTask( void *pvParameters )
+{
+uint32_t ulItems[ mainBATCH ] = { 0 };
+uint32_t ulSent = 0, ulToSend;
+
+	( void ) pvParameters;
+
+	while( ulSent < mainTRANSFER_ITEMS )
+	{
+		if( xUseBatches != pdFALSE )
+		{
+			/* Send no more than the consumer expects, so the queue is left
+			empty. */
+			ulToSend = mainTRANSFER_ITEMS - ulSent;
+
+			if( ulToSend > mainBATCH )
+			{
+				ulToSend = mainBATCH;
+			}
+
+			ulSent += ( uint32_t ) xQueueSendMultiple( xQueue, ulItems, ulToSend, portMAX_DELAY );
+		}
+		else if( xQueueSend( xQueue, ulItems, portMAX_DELAY ) == pdPASS )
+		{
+			ulSent++;
+		}
+	}
+
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvConsumerTask( void *pvParameters )
+{
+uint32_t ulItems[ mainBATCH ];
+uint32_t ulReceived = 0;
+
+	( void ) pvParameters;
+
+	while( ulReceived < mainTRANSFER_ITEMS )
+	{
+		if( xUseBatches != pdFALSE )
+		{
+			ulReceived += ( uint32_t ) xQueueReceiveMultiple( xQueue, ulItems, mainBATCH, portMAX_DELAY );
+		}
+		else if( xQueueReceive( xQueue, ulItems, portMAX_DELAY ) == pdPASS )
+		{
+			ulReceived++;
+		}
+	}
+
+	xTaskNotifyGive( xControlTask );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static double prvProducerToConsumer( BaseType_t xBatches )
+{
+uint64_t ullStart;
+
+	xUseBatches = xBatches;
+	ullStart = ullHarnessGetNanoseconds();
+
+	xTaskCreate( prvConsumerTask, "Cons", configMINIMAL_STACK_SIZE, NULL, mainCONSUMER_PRIORITY, NULL );
+	xTaskCreate( prvProducerTask, "Prod", configMINIMAL_STACK_SIZE, NULL, mainPRODUCER_PRIORITY, NULL );
+	( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+	return ( double ) mainTRANSFER_ITEMS * 1000000000.0 / ( double ) ( ullHarnessGetNanoseconds() - ullStart );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+double dSingle, dBatch;
+
+	( void ) pvParameters;
+
+	/* Warm up, then measure. */
+	( void ) prvFillAndDrain( pdFALSE );
+	dSingle = prvFillAndDrain( pdFALSE );
+	dBatch = prvFillAndDrain( pdTRUE );
+	vHarnessPrintf( "fill and drain:       one at a time %9.0f items/s, batches of %u %9.0f items/s\n",
+					dSingle, mainBATCH, dBatch );
+
+	dSingle = prvProducerToConsumer( pdFALSE );
+	dBatch = prvProducerToConsumer( pdTRUE );
+	vHarnessPrintf( "producer to consumer: one at a time %9.0f items/s, batches of %u %9.0f items/s\n",
+					dSingle, mainBATCH, dBatch );
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,158 @@
+/*
+ * Measures how queue throughput scales with configNUMBER_OF_CORES.
+ *
+ * mainPAIRS independent producer/consumer pairs each pass items through their
+ * own queue.  On an SMP build the two tasks of a pair share a core, and the
+ * pairs are spread evenly over the cores, so the only state the cores share
+ * is the kernel itself.  The benchmark is built for 1, 2 and 4 cores.  The
+ * host needs at least that many CPUs for the figures to show any scaling, as
+ * each simulated core is a host thread.
+ */
+
+#include <stdio.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#include "harness.h"
+
+#define mainPAIRS				( 4 )
+#define mainQUEUE_LENGTH		( 16 )
+#define mainWORK_PER_ITEM		( 200 )
+#define mainWARM_UP_TICKS		( ( TickType_t ) 200 )
+#define mainMEASURE_TICKS		( ( TickType_t ) 2000 )
+
+#define mainWORKER_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define mainCONTROL_PRIORITY	( configMAX_PRIORITIES - 2 )
+
+static void prvProducerTask( void *pvParameters );
+static void prvConsumerTask( void *pvParameters );
+static void prvControlTask( void *pvParameters );
+
+static QueueHandle_t xQueues[ mainPAIRS ];
+
+/* Items received by each consumer, each on its own cache line. */
+static volatile struct
+{
+	uint32_t ulItems;
+	uint8_t ucPad[ 60 ];
+} xReceived[ mainPAIRS ];
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+UBaseType_t uxPair;
+TaskHandle_t xProducer, xConsumer;
+
+	for( uxPair = 0; uxPair < mainPAIRS; uxPair++ )
+	{
+		xQueues[ uxPair ] = xQueueCreate( mainQUEUE_LENGTH, sizeof( uint32_t ) );
+		configASSERT( xQueues[ uxPair ] );
+
+		xTaskCreate( prvProducerTask, "Prod", configMINIMAL_STACK_SIZE, ( void * ) uxPair, mainWORKER_PRIORITY, &xProducer );
+		xTaskCreate( prvConsumerTask, "Cons", configMINIMAL_STACK_SIZE, ( void * ) uxPair, mainWORKER_PRIORITY, &xConsumer );
+
+		#if( configNUMBER_OF_CORES > 1 )
+		{
+			vTaskCoreAffinitySet( xProducer, ( UBaseType_t ) 1U << ( uxPair % configNUMBER_OF_CORES ) );
+			vTaskCoreAffinitySet( xConsumer, ( UBaseType_t ) 1U << ( uxPair % configNUMBER_OF_CORES ) );
+		}
+		#else
+		{
+			( void ) xProducer;
+			( void ) xConsumer;
+		}
+		#endif
+	}
+
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, NULL );
+
+	/* Returns once the control task has ended the scheduler. */
+	vTaskStartScheduler();
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvDoWork( uint32_t ulValue )
+{
+volatile uint32_t ulWork = ulValue;
+uint32_t ul;
+
+	/* Stands in for the processing of an item. */
+	for( ul = 0; ul < mainWORK_PER_ITEM; ul++ )
+	{
+		ulWork = ( ulWork * 1103515245UL ) + 12345UL;
+	}
+
+	return ulWork;
+}
+/*-----------------------------------------------------------*/
+
+static void prvProducerTask( void *pvParameters )
+{
+QueueHandle_t xQueue = xQueues[ ( UBaseType_t ) pvParameters ];
+uint32_t ulValue = 0;
+
+	for( ;; )
+	{
+		ulValue = prvDoWork( ulValue );
+		( void ) xQueueSend( xQueue, &ulValue, portMAX_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvConsumerTask( void *pvParameters )
+{
+UBaseType_t uxPair = ( UBaseType_t ) pvParameters;
+uint32_t ulValue;
+
+	for( ;; )
+	{
+		if( xQueueReceive( xQueues[ uxPair ], &ulValue, portMAX_DELAY ) == pdPASS )
+		{
+			( void ) prvDoWork( ulValue );
+			xReceived[ uxPair ].ulItems++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvTotalReceived( void )
+{
+uint32_t ulTotal = 0;
+UBaseType_t uxPair;
+
+	for( uxPair = 0; uxPair < mainPAIRS; uxPair++ )
+	{
+		ulTotal += xReceived[ uxPair ].ulItems;
+	}
+
+	return ulTotal;
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+uint32_t ulStartItems, ulItems;
+uint64_t ullStart, ullElapsed;
+
+	( void ) pvParameters;
+
+	vTaskDelay( mainWARM_UP_TICKS );
+
+	ulStartItems = prvTotalReceived();
+	ullStart = ullHarnessGetNanoseconds();
+	vTaskDelay( mainMEASURE_TICKS );
+	ulItems = prvTotalReceived() - ulStartItems;
+	ullElapsed = ullHarnessGetNanoseconds() - ullStart;
+
+	vHarnessPrintf( "%d core(s), %d producer/consumer pairs: %.0f items/s\n",
+					configNUMBER_OF_CORES, mainPAIRS,
+					( double ) ulItems * 1000000000.0 / ( double ) ullElapsed );
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
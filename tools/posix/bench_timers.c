@@ -0,0 +1,150 @@
+/*
+ * Measures the cost of resetting a software timer with xTimerReset() as the
+ * number of other active timers grows, for the sorted timer lists and for the
+ * timing wheel (configUSE_TIMING_WHEEL_TIMERS).
+ *
+ * The timer that is reset has a period longer than that of any other timer,
+ * which is the worst case for the sorted list as the whole list is walked to
+ * find the insertion point.  The timer service task has a higher priority
+ * than the task that resets the timer, so it processes each command as soon
+ * as it is sent.
+ *
+ * Two figures are given.  The kernel time is from the timer service task
+ * receiving the command to it being switched out again, timed with the trace
+ * macros, which is where the timer is taken out of and put back into the
+ * active timers.  The round trip also includes sending the command and the
+ * context switches of this port, which vary by more than the walk costs, so
+ * each figure is the best of several runs.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include "harness.h"
+
+#define mainITERATIONS			( 10000UL )
+#define mainRUNS				( 5 )
+
+/* The other timers expire long after the benchmark has ended, and the timer
+that is reset expires later still. */
+#define mainOTHER_PERIOD		( ( TickType_t ) 100000 )
+#define mainRESET_PERIOD		( ( TickType_t ) 200000 )
+
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 1 )
+
+static void prvControlTask( void *pvParameters );
+
+/* The number of other active timers to measure with. */
+static const UBaseType_t uxTimerCounts[] = { 0, 300 };
+
+/* Written by the trace macros.  ullCommandStart is 0 when the task being
+switched out did not receive a timer command. */
+static uint64_t ullCommandStart, ullKernelTime;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, NULL );
+
+	/* Returns once the control task has ended the scheduler. */
+	vTaskStartScheduler();
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vHarnessTraceTimerCommand( void )
+{
+	ullCommandStart = ullHarnessGetNanoseconds();
+}
+/*-----------------------------------------------------------*/
+
+void vHarnessTraceSwitchedOut( void )
+{
+	if( ullCommandStart != 0 )
+	{
+		ullKernelTime += ullHarnessGetNanoseconds() - ullCommandStart;
+		ullCommandStart = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCallback( TimerHandle_t xTimer )
+{
+	/* The timers do not expire while the benchmark runs. */
+	( void ) xTimer;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeResets( TimerHandle_t xTimer, double *pdKernel, double *pdRoundTrip )
+{
+uint64_t ullStart, ullElapsed;
+uint32_t ul;
+BaseType_t xRun;
+
+	*pdKernel = 0.0;
+	*pdRoundTrip = 0.0;
+
+	for( xRun = 0; xRun < mainRUNS; xRun++ )
+	{
+		ullKernelTime = 0;
+		ullStart = ullHarnessGetNanoseconds();
+
+		for( ul = 0; ul < mainITERATIONS; ul++ )
+		{
+			( void ) xTimerReset( xTimer, 0 );
+		}
+
+		ullElapsed = ullHarnessGetNanoseconds() - ullStart;
+
+		if( ( xRun == 0 ) || ( ( double ) ullKernelTime < *pdKernel ) )
+		{
+			*pdKernel = ( double ) ullKernelTime;
+		}
+
+		if( ( xRun == 0 ) || ( ( double ) ullElapsed < *pdRoundTrip ) )
+		{
+			*pdRoundTrip = ( double ) ullElapsed;
+		}
+	}
+
+	*pdKernel /= ( double ) mainITERATIONS;
+	*pdRoundTrip /= ( double ) mainITERATIONS;
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+TimerHandle_t xResetTimer, xOtherTimer;
+UBaseType_t uxTimers = 0, uxCount;
+double dKernel, dRoundTrip;
+
+	( void ) pvParameters;
+
+	xResetTimer = xTimerCreate( "Reset", mainRESET_PERIOD, pdFALSE, NULL, prvTimerCallback );
+	configASSERT( xResetTimer );
+
+	for( uxCount = 0; uxCount < ( sizeof( uxTimerCounts ) / sizeof( uxTimerCounts[ 0 ] ) ); uxCount++ )
+	{
+		while( uxTimers < uxTimerCounts[ uxCount ] )
+		{
+			/* Spread the expiry times so the sorted list is not trivially
+			ordered. */
+			xOtherTimer = xTimerCreate( "Other", mainOTHER_PERIOD + ( TickType_t ) ( ( uxTimers * 37U ) % 1000U ), pdFALSE, NULL, prvTimerCallback );
+			configASSERT( xOtherTimer );
+			configASSERT( xTimerStart( xOtherTimer, 0 ) == pdPASS );
+			uxTimers++;
+		}
+
+		prvTimeResets( xResetTimer, &dKernel, &dRoundTrip );
+
+		vHarnessPrintf( "%-12s %3u other timers active: %5.0f ns in the timer task per reset, %5.0f ns per reset\n",
+						( configUSE_TIMING_WHEEL_TIMERS == 1 ) ? "timing wheel" : "sorted list",
+						( unsigned ) uxTimers, dKernel, dRoundTrip );
+	}
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,88 @@
+/*
+ * Helpers shared by the host tests and benchmarks that run the kernel on the
+ * Linux/POSIX simulator port, and the application hooks the kernel expects.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "harness.h"
+
+/*-----------------------------------------------------------*/
+
+void vHarnessPrintf( const char *pcFormat, ... )
+{
+va_list xArgs;
+BaseType_t xSchedulerRunning;
+
+	xSchedulerRunning = ( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED );
+
+	if( xSchedulerRunning != pdFALSE )
+	{
+		vTaskSuspendAll();
+	}
+
+	va_start( xArgs, pcFormat );
+	( void ) vprintf( pcFormat, xArgs );
+	va_end( xArgs );
+	( void ) fflush( stdout );
+
+	if( xSchedulerRunning != pdFALSE )
+	{
+		( void ) xTaskResumeAll();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vHarnessPass( const char *pcTestName )
+{
+	vHarnessPrintf( "PASS %s\n", pcTestName );
+	exit( EXIT_SUCCESS );
+}
+/*-----------------------------------------------------------*/
+
+void vHarnessFail( const char *pcFile, int iLine, const char *pcCheck )
+{
+	vHarnessPrintf( "FAIL %s:%d: %s\n", pcFile, iLine, pcCheck );
+	exit( EXIT_FAILURE );
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullHarnessGetNanoseconds( void )
+{
+struct timespec xNow;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+void vHarnessSpinTicks( TickType_t xTicks )
+{
+TickType_t xStart;
+
+	xStart = xTaskGetTickCount();
+
+	while( ( xTaskGetTickCount() - xStart ) < xTicks )
+	{
+		/* Busy, not blocked. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char *pcFile, unsigned long ulLine )
+{
+	vHarnessFail( pcFile, ( int ) ulLine, "configASSERT()" );
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationMallocFailedHook( void )
+{
+	vHarnessFail( __FILE__, __LINE__, "pvPortMalloc() failed" );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,38 @@
+/*
+ * Helpers shared by the host tests and benchmarks that run the kernel on the
+ * Linux/POSIX simulator port.
+ */
+
+#ifndef HARNESS_H
+#define HARNESS_H
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+/* Fail the test, reporting the file and line of the check, if x is false. */
+#define harnessCHECK( x ) if( ( x ) == 0 ) vHarnessFail( __FILE__, __LINE__, #x )
+
+/*
+ * Print a line with the scheduler suspended, so a tick cannot switch the
+ * calling task out while it holds the host C library's stdio lock.
+ */
+void vHarnessPrintf( const char *pcFormat, ... );
+
+/*
+ * Report the result of a test and end the process.  vHarnessFail() exits
+ * with a non-zero status so 'make test' stops at the first failure.
+ */
+void vHarnessPass( const char *pcTestName );
+void vHarnessFail( const char *pcFile, int iLine, const char *pcCheck );
+
+/* Monotonic host time in nanoseconds, for timing benchmark loops. */
+uint64_t ullHarnessGetNanoseconds( void );
+
+/*
+ * Keep the calling task running, without blocking, until xTicks ticks have
+ * passed.  Used to stand in for a task doing xTicks of work.
+ */
+void vHarnessSpinTicks( TickType_t xTicks );
+
+#endif /* HARNESS_H */
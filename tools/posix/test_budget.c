@@ -0,0 +1,233 @@
+/*
+ * Checks that execution budgets (configUSE_TASK_BUDGETS) throttle a task that
+ * never blocks to its budget in each period, that a lower priority task gets
+ * the rest of the period, and that a task holding a mutex is not throttled
+ * until it has given the mutex back.
+ *
+ * Execution is measured in ticks by the tick hook, which charges each tick to
+ * the task it interrupted - the same task the kernel charges the tick to.
+ *
+ * Throttle test: a runaway task is given a budget, and a task of lower
+ * priority is always ready to run.  The control task samples the ticks each
+ * has run at every period boundary.
+ *
+ * Mutex test: the runaway task runs for several budgets with a mutex held.
+ * It must not be throttled until it gives the mutex back, and must then be
+ * throttled for the rest of the period.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "harness.h"
+
+#define mainLOW_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define mainRUNAWAY_PRIORITY	( tskIDLE_PRIORITY + 2 )
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 4 )
+
+#define mainBUDGET				( ( TickType_t ) 20 )
+#define mainPERIOD				( ( TickType_t ) 100 )
+#define mainPERIODS				( 5 )
+
+/* The number of budgets the runaway task runs for with the mutex held. */
+#define mainBUDGETS_HELD		( 2 )
+
+/* Ticks the control task, the timer task and the idle task may be charged
+with in a period. */
+#define mainOTHER_TICKS			( 2 )
+
+/* Indexes into ulTicksRun[]. */
+#define mainRUNAWAY				( 0 )
+#define mainLOW					( 1 )
+#define mainTASKS				( 2 )
+
+static void prvControlTask( void *pvParameters );
+
+static TaskHandle_t xTasks[ mainTASKS ];
+static SemaphoreHandle_t xMutex;
+
+/* Updated by the tick hook. */
+static volatile uint32_t ulTicksRun[ mainTASKS ];
+
+/* Set by the runaway task when it gives the mutex back. */
+static volatile uint32_t ulTicksRunWithMutex;
+static volatile TickType_t xMutexGivenTime;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xMutex = xSemaphoreCreateMutex();
+	configASSERT( xMutex );
+
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, NULL );
+	vTaskStartScheduler();
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationTickHook( void )
+{
+TaskHandle_t xCurrentTask = xTaskGetCurrentTaskHandle();
+UBaseType_t uxTask;
+
+	for( uxTask = 0; uxTask < mainTASKS; uxTask++ )
+	{
+		if( xCurrentTask == xTasks[ uxTask ] )
+		{
+			ulTicksRun[ uxTask ]++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBusyTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Busy, never blocks. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMutexHolderTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	harnessCHECK( xSemaphoreTake( xMutex, 0 ) == pdPASS );
+
+	while( ulTicksRun[ mainRUNAWAY ] < ( uint32_t ) ( mainBUDGET * mainBUDGETS_HELD ) )
+	{
+		/* Busy, with the mutex held. */
+	}
+
+	ulTicksRunWithMutex = ulTicksRun[ mainRUNAWAY ];
+	xMutexGivenTime = xTaskGetTickCount();
+	harnessCHECK( xSemaphoreGive( xMutex ) == pdPASS );
+
+	prvBusyTask( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvStartTasks( TaskFunction_t pxRunawayCode )
+{
+UBaseType_t uxTask;
+TickType_t xPeriodStart;
+
+	for( uxTask = 0; uxTask < mainTASKS; uxTask++ )
+	{
+		ulTicksRun[ uxTask ] = 0;
+	}
+
+	/* The control task has the highest priority, so the budget is set before
+	the runaway task first runs.  Budget periods start when vTaskSetBudget()
+	is called, which the tick count cannot move past with the scheduler
+	suspended. */
+	vTaskSuspendAll();
+	{
+		xTaskCreate( pxRunawayCode, "Run", configMINIMAL_STACK_SIZE, NULL, mainRUNAWAY_PRIORITY, &( xTasks[ mainRUNAWAY ] ) );
+		xTaskCreate( prvBusyTask, "Low", configMINIMAL_STACK_SIZE, NULL, mainLOW_PRIORITY, &( xTasks[ mainLOW ] ) );
+		vTaskSetBudget( xTasks[ mainRUNAWAY ], mainBUDGET, mainPERIOD );
+		xPeriodStart = xTaskGetTickCount();
+	}
+	( void ) xTaskResumeAll();
+
+	return xPeriodStart;
+}
+/*-----------------------------------------------------------*/
+
+static void prvDeleteTasks( void )
+{
+UBaseType_t uxTask;
+
+	for( uxTask = 0; uxTask < mainTASKS; uxTask++ )
+	{
+		vTaskDelete( xTasks[ uxTask ] );
+		xTasks[ uxTask ] = NULL;
+	}
+
+	/* Let the idle task free them. */
+	vTaskDelay( 2 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvThrottleTest( void )
+{
+TickType_t xPeriodStart;
+uint32_t ulRunaway = 0, ulLow = 0, ulRunawayInPeriod, ulLowInPeriod;
+BaseType_t xPeriod;
+
+	xPeriodStart = prvStartTasks( prvBusyTask );
+
+	for( xPeriod = 0; xPeriod < mainPERIODS; xPeriod++ )
+	{
+		vTaskDelayUntil( &xPeriodStart, mainPERIOD );
+
+		ulRunawayInPeriod = ulTicksRun[ mainRUNAWAY ] - ulRunaway;
+		ulLowInPeriod = ulTicksRun[ mainLOW ] - ulLow;
+		ulRunaway += ulRunawayInPeriod;
+		ulLow += ulLowInPeriod;
+
+		/* The runaway task is throttled for the rest of the period once it has
+		used its budget, and the lower priority task runs instead. */
+		harnessCHECK( ulRunawayInPeriod == ( uint32_t ) mainBUDGET );
+		harnessCHECK( ulLowInPeriod >= ( uint32_t ) ( mainPERIOD - mainBUDGET - mainOTHER_TICKS ) );
+	}
+
+	harnessCHECK( uxTaskGetBudgetOverruns( xTasks[ mainRUNAWAY ] ) == mainPERIODS );
+
+	vHarnessPrintf( "throttled: %u periods of %u ticks, runaway task ran %u ticks, lower priority task %u ticks\n",
+					( unsigned ) mainPERIODS, ( unsigned ) mainPERIOD, ( unsigned ) ulRunaway, ( unsigned ) ulLow );
+
+	prvDeleteTasks();
+}
+/*-----------------------------------------------------------*/
+
+static void prvMutexTest( void )
+{
+TickType_t xPeriodStart;
+
+	ulTicksRunWithMutex = 0;
+	xPeriodStart = prvStartTasks( prvMutexHolderTask );
+
+	/* Half way through the first period the runaway task has run for several
+	budgets and given the mutex back. */
+	vTaskDelayUntil( &xPeriodStart, mainPERIOD / 2 );
+	harnessCHECK( ulTicksRunWithMutex == ( uint32_t ) ( mainBUDGET * mainBUDGETS_HELD ) );
+	harnessCHECK( xMutexGivenTime < xPeriodStart );
+
+	/* It was throttled on the first tick after it gave the mutex back, and
+	stays throttled until the end of the period. */
+	harnessCHECK( eTaskGetState( xTasks[ mainRUNAWAY ] ) == eBlocked );
+	harnessCHECK( uxTaskGetBudgetOverruns( xTasks[ mainRUNAWAY ] ) == 1 );
+	harnessCHECK( ulTicksRun[ mainRUNAWAY ] <= ulTicksRunWithMutex + 1 );
+
+	vTaskDelayUntil( &xPeriodStart, mainPERIOD / 2 );
+	harnessCHECK( ulTicksRun[ mainRUNAWAY ] <= ulTicksRunWithMutex + 1 );
+
+	/* In the next period it gets its budget again. */
+	vTaskDelayUntil( &xPeriodStart, mainPERIOD );
+	harnessCHECK( ulTicksRun[ mainRUNAWAY ] <= ulTicksRunWithMutex + 1 + ( uint32_t ) mainBUDGET );
+	harnessCHECK( uxTaskGetBudgetOverruns( xTasks[ mainRUNAWAY ] ) == 2 );
+
+	vHarnessPrintf( "mutex: runaway task ran %u ticks with the mutex held, budget %u ticks\n",
+					( unsigned ) ulTicksRunWithMutex, ( unsigned ) mainBUDGET );
+
+	prvDeleteTasks();
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	prvThrottleTest();
+	prvMutexTest();
+
+	vHarnessPass( "task budgets" );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,118 @@
+/*
+ * Checks that xCondVarWait() cannot miss a signal sent by a higher priority
+ * task that was blocked on the mutex.
+ *
+ * The waiter holds the mutex, and the signaller has a higher priority and is
+ * blocked trying to take it.  Giving the mutex back inside xCondVarWait()
+ * makes the signaller ready.  If the signaller could run before the waiter is
+ * on the list of waiting tasks, its signal would find the list empty and the
+ * waiter would time out even though the condition variable was signalled.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "condition_variable.h"
+
+#include "harness.h"
+
+#define mainWAITER_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define mainSIGNALLER_PRIORITY	( tskIDLE_PRIORITY + 3 )
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 4 )
+
+#define mainITERATIONS			( 200 )
+#define mainWAIT_TICKS			( ( TickType_t ) 50 )
+
+static void prvControlTask( void *pvParameters );
+static void prvWaiterTask( void *pvParameters );
+static void prvSignallerTask( void *pvParameters );
+
+static SemaphoreHandle_t xMutex;
+static CondVarHandle_t xCondVar;
+static TaskHandle_t xControlTask, xSignallerTask;
+
+/* Set by the signaller, with the mutex held, before it signals. */
+static volatile BaseType_t xConditionMet;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xMutex = xSemaphoreCreateMutex();
+	xCondVar = xCondVarCreate();
+	configASSERT( ( xMutex != NULL ) && ( xCondVar != NULL ) );
+
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, &xControlTask );
+	vTaskStartScheduler();
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSignallerTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	/* Wait until the waiter holds the mutex, then block on the mutex. */
+	( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+	harnessCHECK( xSemaphoreTake( xMutex, portMAX_DELAY ) == pdPASS );
+
+	xConditionMet = pdTRUE;
+	vCondVarSignal( xCondVar );
+
+	harnessCHECK( xSemaphoreGive( xMutex ) == pdPASS );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaiterTask( void *pvParameters )
+{
+BaseType_t xResult;
+
+	( void ) pvParameters;
+
+	harnessCHECK( xSemaphoreTake( xMutex, 0 ) == pdPASS );
+
+	/* Let the signaller block on the mutex.  On a single core it preempts
+	this task and blocks straight away, on more than one it may run on another
+	core. */
+	xTaskNotifyGive( xSignallerTask );
+
+	while( eTaskGetState( xSignallerTask ) != eBlocked )
+	{
+		taskYIELD();
+	}
+
+	harnessCHECK( xConditionMet == pdFALSE );
+
+	xResult = xCondVarWait( xCondVar, xMutex, mainWAIT_TICKS );
+
+	harnessCHECK( xConditionMet != pdFALSE );
+	harnessCHECK( xResult == pdPASS );
+	harnessCHECK( xSemaphoreGetMutexHolder( xMutex ) == xTaskGetCurrentTaskHandle() );
+	harnessCHECK( uxTaskPriorityGet( NULL ) == mainWAITER_PRIORITY );
+
+	harnessCHECK( xSemaphoreGive( xMutex ) == pdPASS );
+	xTaskNotifyGive( xControlTask );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+uint32_t ulIteration;
+
+	( void ) pvParameters;
+
+	for( ulIteration = 0; ulIteration < mainITERATIONS; ulIteration++ )
+	{
+		xConditionMet = pdFALSE;
+		xTaskCreate( prvSignallerTask, "Sig", configMINIMAL_STACK_SIZE, NULL, mainSIGNALLER_PRIORITY, &xSignallerTask );
+		xTaskCreate( prvWaiterTask, "Wait", configMINIMAL_STACK_SIZE, NULL, mainWAITER_PRIORITY, NULL );
+
+		harnessCHECK( ulTaskNotifyTake( pdTRUE, mainWAIT_TICKS * 2 ) != 0 );
+	}
+
+	vHarnessPass( "condition variable signal from a task blocked on the mutex" );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,230 @@
+/*
+ * Checks the critical section profiler (configUSE_CRITICAL_PROFILER).  The
+ * POSIX port's run time counter, which the profiler uses by default, counts
+ * microseconds.
+ *
+ * Known length test: a critical section and a scheduler suspension that each
+ * last a known time must be recorded against the file and line of their
+ * taskENTER_CRITICAL() and vTaskSuspendAll() calls, in the histogram bucket
+ * that holds that time.
+ *
+ * Nesting test: only the outermost taskENTER_CRITICAL() and vTaskSuspendAll()
+ * are timed, for the whole of the nested region, and the inner calls are not
+ * recorded as sites at all.
+ *
+ * Full table test: once configCRITICAL_PROFILER_SITES sites have been seen the
+ * durations of further sites are counted as unrecorded, while the sites
+ * already in the table are still recorded.
+ */
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "harness.h"
+
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 1 )
+
+/* Each region lasts at least mainREGION_US microseconds, and the check allows
+it to overrun up to the end of the bucket that holds mainREGION_US, which is
+more than the host can be expected to delay the test by. */
+#define mainREGION_US			( 1500UL )
+#define mainREGION_BUCKET		( 11 )	/* 1024 to 2047 microseconds. */
+#define mainREGION_REPEATS		( 3 )
+
+/* Lines that are not in this file, used to make sites that are. */
+#define mainSYNTHETIC_LINE		( ( UBaseType_t ) 100000U )
+#define mainEXTRA_SITES			( 3 )
+
+static void prvControlTask( void *pvParameters );
+
+static CriticalProfileSite_t xSites[ configCRITICAL_PROFILER_SITES ];
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, NULL );
+	vTaskStartScheduler();
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBusyMicroseconds( uint32_t ulMicroseconds )
+{
+uint64_t ullEnd = ullHarnessGetNanoseconds() + ( ( uint64_t ) ulMicroseconds * 1000ULL );
+
+	while( ullHarnessGetNanoseconds() < ullEnd )
+	{
+		/* Busy, and cannot be switched out. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* Returns the site recorded for uxLine of this file, or NULL if there is
+none. */
+static const CriticalProfileSite_t *prvFindSite( UBaseType_t uxLine, eProfiledRegion eRegion, uint32_t *pulUnrecorded )
+{
+UBaseType_t uxSites, uxSite;
+
+	uxSites = uxTaskGetCriticalProfile( xSites, configCRITICAL_PROFILER_SITES, pulUnrecorded );
+
+	for( uxSite = 0; uxSite < uxSites; uxSite++ )
+	{
+		if( ( xSites[ uxSite ].uxLine == uxLine ) && ( xSites[ uxSite ].eRegion == eRegion ) && ( strcmp( xSites[ uxSite ].pcFile, __FILE__ ) == 0 ) )
+		{
+			return &( xSites[ uxSite ] );
+		}
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckRegion( UBaseType_t uxLine, eProfiledRegion eRegion, uint32_t ulCount )
+{
+const CriticalProfileSite_t *pxSite = prvFindSite( uxLine, eRegion, NULL );
+
+	harnessCHECK( pxSite != NULL );
+	harnessCHECK( pxSite->ulCount == ulCount );
+	harnessCHECK( pxSite->ulBuckets[ mainREGION_BUCKET ] == ulCount );
+	harnessCHECK( pxSite->ulMaxDuration >= mainREGION_US );
+	harnessCHECK( pxSite->ulMaxDuration < ( 1UL << mainREGION_BUCKET ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvKnownLengthTest( void )
+{
+UBaseType_t uxCriticalLine = 0, uxSuspendLine = 0;
+BaseType_t xRepeat;
+
+	for( xRepeat = 0; xRepeat < mainREGION_REPEATS; xRepeat++ )
+	{
+		/* Each call is on the same line as the __LINE__ that records it. */
+		uxCriticalLine = ( UBaseType_t ) __LINE__; taskENTER_CRITICAL();
+		{
+			prvBusyMicroseconds( mainREGION_US );
+		}
+		taskEXIT_CRITICAL();
+
+		uxSuspendLine = ( UBaseType_t ) __LINE__; vTaskSuspendAll();
+		{
+			prvBusyMicroseconds( mainREGION_US );
+		}
+		( void ) xTaskResumeAll();
+	}
+
+	prvCheckRegion( uxCriticalLine, eProfiledCriticalSection, mainREGION_REPEATS );
+	prvCheckRegion( uxSuspendLine, eProfiledSchedulerSuspension, mainREGION_REPEATS );
+
+	/* A site is either a critical section or a suspension. */
+	harnessCHECK( prvFindSite( uxCriticalLine, eProfiledSchedulerSuspension, NULL ) == NULL );
+	harnessCHECK( prvFindSite( uxSuspendLine, eProfiledCriticalSection, NULL ) == NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvNestingTest( void )
+{
+UBaseType_t uxOuterLine, uxInnerLine;
+
+	/* Each part takes a third of the time, so only the outer region lasts
+	long enough to reach the bucket. */
+	uxOuterLine = ( UBaseType_t ) __LINE__; taskENTER_CRITICAL();
+	{
+		prvBusyMicroseconds( mainREGION_US / 3 );
+
+		uxInnerLine = ( UBaseType_t ) __LINE__; taskENTER_CRITICAL();
+		{
+			prvBusyMicroseconds( mainREGION_US / 3 );
+		}
+		taskEXIT_CRITICAL();
+
+		prvBusyMicroseconds( mainREGION_US / 3 );
+	}
+	taskEXIT_CRITICAL();
+
+	prvCheckRegion( uxOuterLine, eProfiledCriticalSection, 1 );
+	harnessCHECK( prvFindSite( uxInnerLine, eProfiledCriticalSection, NULL ) == NULL );
+
+	uxOuterLine = ( UBaseType_t ) __LINE__; vTaskSuspendAll();
+	{
+		prvBusyMicroseconds( mainREGION_US / 3 );
+
+		uxInnerLine = ( UBaseType_t ) __LINE__; vTaskSuspendAll();
+		{
+			prvBusyMicroseconds( mainREGION_US / 3 );
+		}
+		( void ) xTaskResumeAll();
+
+		prvBusyMicroseconds( mainREGION_US / 3 );
+	}
+	( void ) xTaskResumeAll();
+
+	prvCheckRegion( uxOuterLine, eProfiledSchedulerSuspension, 1 );
+	harnessCHECK( prvFindSite( uxInnerLine, eProfiledSchedulerSuspension, NULL ) == NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEnterAndExitAt( UBaseType_t uxLine )
+{
+	/* What taskENTER_CRITICAL() and taskEXIT_CRITICAL() expand to, with a
+	line that is not the line of the call. */
+	portENTER_CRITICAL();
+	vTaskProfileEnterCritical( __FILE__, uxLine );
+	vTaskProfileExitCritical();
+	portEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static void prvFullTableTest( void )
+{
+UBaseType_t uxSites, uxSite;
+uint32_t ulUnrecorded;
+
+	uxSites = uxTaskGetCriticalProfile( xSites, configCRITICAL_PROFILER_SITES, &ulUnrecorded );
+	harnessCHECK( ulUnrecorded == 0 );
+
+	/* Fill the table. */
+	for( uxSite = uxSites; uxSite < ( UBaseType_t ) configCRITICAL_PROFILER_SITES; uxSite++ )
+	{
+		prvEnterAndExitAt( mainSYNTHETIC_LINE + uxSite );
+	}
+
+	harnessCHECK( uxTaskGetCriticalProfile( xSites, configCRITICAL_PROFILER_SITES, &ulUnrecorded ) == configCRITICAL_PROFILER_SITES );
+	harnessCHECK( ulUnrecorded == 0 );
+
+	/* New sites are counted as unrecorded... */
+	for( uxSite = 0; uxSite < mainEXTRA_SITES; uxSite++ )
+	{
+		prvEnterAndExitAt( mainSYNTHETIC_LINE + configCRITICAL_PROFILER_SITES + uxSite );
+	}
+
+	/* ...while a site that is already in the table is still recorded. */
+	prvEnterAndExitAt( mainSYNTHETIC_LINE + ( configCRITICAL_PROFILER_SITES - 1 ) );
+
+	harnessCHECK( prvFindSite( mainSYNTHETIC_LINE + configCRITICAL_PROFILER_SITES, eProfiledCriticalSection, &ulUnrecorded ) == NULL );
+	harnessCHECK( ulUnrecorded == mainEXTRA_SITES );
+	harnessCHECK( prvFindSite( mainSYNTHETIC_LINE + ( configCRITICAL_PROFILER_SITES - 1 ), eProfiledCriticalSection, NULL )->ulCount == 2 );
+
+	vTaskResetCriticalProfile();
+	harnessCHECK( prvFindSite( mainSYNTHETIC_LINE + ( configCRITICAL_PROFILER_SITES - 1 ), eProfiledCriticalSection, &ulUnrecorded ) == NULL );
+	harnessCHECK( ulUnrecorded == 0 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	/* Forget the sites seen while the scheduler was started. */
+	vTaskResetCriticalProfile();
+
+	prvKnownLengthTest();
+	prvNestingTest();
+	prvFullTableTest();
+
+	vHarnessPass( "critical section profiler" );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,274 @@
+/*
+ * Runs a periodic task set with a utilisation of 97% under earliest deadline
+ * first scheduling (configUSE_EDF_SCHEDULING set to 1), where every job must
+ * meet its deadline, and under rate monotonic fixed priorities, where the
+ * same set cannot be scheduled and jobs of the longer period task must miss.
+ *
+ * Periodic test: the tasks release their jobs with vTaskDelayUntil(), and each
+ * job runs for a fixed number of ticks.  Execution is measured in ticks by the
+ * tick hook, which charges each tick to the task it interrupted, so the time
+ * a task is preempted for is not counted as work.  A job misses its deadline
+ * if it completes more than a period after its release.
+ *
+ * Late wake test (EDF only): a deadline task blocks on a notification for
+ * longer than its relative deadline.  When it is unblocked it must start a
+ * new job rather than keep the deadline that passed while it was blocked, so
+ * a task whose deadline is earlier than the new one runs first and no miss is
+ * counted.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "harness.h"
+
+#define mainCONTROL_PRIORITY	( configMAX_PRIORITIES - 1 )
+
+/* The rate monotonic priorities, used when EDF scheduling is not. */
+#define mainSHORT_PERIOD_PRIORITY	( tskIDLE_PRIORITY + 2 )
+#define mainLONG_PERIOD_PRIORITY	( tskIDLE_PRIORITY + 1 )
+
+#define mainTASKS				( 2 )
+#define mainHYPERPERIOD			( ( TickType_t ) 350 )
+#define mainHYPERPERIODS		( 5 )
+#define mainSTART_DELAY			( ( TickType_t ) 10 )
+
+/* The late wake test. */
+#define mainSPORADIC_DEADLINE	( ( TickType_t ) 10 )
+#define mainURGENT_DEADLINE		( ( TickType_t ) 5 )
+#define mainSPORADIC_BLOCK		( ( TickType_t ) 50 )
+
+typedef struct PERIODIC_TASK
+{
+	TickType_t xExecutionTime;
+	TickType_t xPeriod;
+	UBaseType_t uxPriority;
+} PeriodicTask_t;
+
+/* 20/50 + 40/70 = 97%, above the 83% rate monotonic bound for two tasks. */
+static const PeriodicTask_t xTaskSet[ mainTASKS ] =
+{
+	{ 20, 50, mainSHORT_PERIOD_PRIORITY },
+	{ 40, 70, mainLONG_PERIOD_PRIORITY }
+};
+
+static void prvControlTask( void *pvParameters );
+
+static TaskHandle_t xControlTask;
+static TaskHandle_t xPeriodicTasks[ mainTASKS ];
+static TickType_t xStartTime;
+
+/* Updated by the tick hook. */
+static volatile uint32_t ulTicksRun[ mainTASKS ];
+
+static volatile uint32_t ulJobs[ mainTASKS ], ulMisses[ mainTASKS ];
+static volatile TickType_t xWorstResponse[ mainTASKS ];
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+	/* The tasks of the late wake test, in the order they ran. */
+	static TaskHandle_t xRunOrder[ 2 ];
+	static volatile UBaseType_t uxRuns;
+#endif
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, &xControlTask );
+	vTaskStartScheduler();
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationTickHook( void )
+{
+TaskHandle_t xCurrentTask = xTaskGetCurrentTaskHandle();
+UBaseType_t uxTask;
+
+	for( uxTask = 0; uxTask < mainTASKS; uxTask++ )
+	{
+		if( xCurrentTask == xPeriodicTasks[ uxTask ] )
+		{
+			ulTicksRun[ uxTask ]++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvPeriodicTask( void *pvParameters )
+{
+const UBaseType_t uxTask = ( UBaseType_t ) pvParameters;
+const PeriodicTask_t * const pxTask = &( xTaskSet[ uxTask ] );
+const uint32_t ulJobCount = ( uint32_t ) ( ( mainHYPERPERIOD * mainHYPERPERIODS ) / pxTask->xPeriod );
+TickType_t xLastWakeTime = xStartTime, xResponse;
+uint32_t ulTarget;
+
+	/* Release the first jobs of all the tasks at the same time. */
+	vTaskDelayUntil( &xLastWakeTime, mainSTART_DELAY );
+
+	while( ulJobs[ uxTask ] < ulJobCount )
+	{
+		ulTarget = ulTicksRun[ uxTask ] + ( uint32_t ) pxTask->xExecutionTime;
+
+		while( ulTicksRun[ uxTask ] < ulTarget )
+		{
+			/* Busy, not blocked. */
+		}
+
+		/* xLastWakeTime is the release time of the job. */
+		xResponse = xTaskGetTickCount() - xLastWakeTime;
+
+		if( xResponse > pxTask->xPeriod )
+		{
+			ulMisses[ uxTask ]++;
+		}
+
+		if( xResponse > xWorstResponse[ uxTask ] )
+		{
+			xWorstResponse[ uxTask ] = xResponse;
+		}
+
+		ulJobs[ uxTask ]++;
+		vTaskDelayUntil( &xLastWakeTime, pxTask->xPeriod );
+	}
+
+	xTaskNotifyGive( xControlTask );
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPeriodicTest( void )
+{
+UBaseType_t uxTask;
+uint32_t ulTotalMisses = 0;
+
+	xStartTime = xTaskGetTickCount();
+
+	for( uxTask = 0; uxTask < mainTASKS; uxTask++ )
+	{
+		#if( configUSE_EDF_SCHEDULING == 1 )
+		{
+			xTaskCreateWithDeadline( prvPeriodicTask, "Per", configMINIMAL_STACK_SIZE, ( void * ) uxTask, 0, xTaskSet[ uxTask ].xPeriod, &( xPeriodicTasks[ uxTask ] ) );
+		}
+		#else
+		{
+			xTaskCreate( prvPeriodicTask, "Per", configMINIMAL_STACK_SIZE, ( void * ) uxTask, xTaskSet[ uxTask ].uxPriority, &( xPeriodicTasks[ uxTask ] ) );
+		}
+		#endif
+	}
+
+	for( uxTask = 0; uxTask < mainTASKS; uxTask++ )
+	{
+		harnessCHECK( ulTaskNotifyTake( pdFALSE, mainHYPERPERIOD * ( mainHYPERPERIODS + 2 ) ) != 0 );
+	}
+
+	for( uxTask = 0; uxTask < mainTASKS; uxTask++ )
+	{
+		vHarnessPrintf( "%s: C=%u T=%u, %u jobs, %u missed, worst response %u ticks\n",
+						( configUSE_EDF_SCHEDULING == 1 ) ? "EDF" : "fixed priority",
+						( unsigned ) xTaskSet[ uxTask ].xExecutionTime, ( unsigned ) xTaskSet[ uxTask ].xPeriod,
+						( unsigned ) ulJobs[ uxTask ], ( unsigned ) ulMisses[ uxTask ], ( unsigned ) xWorstResponse[ uxTask ] );
+
+		#if( configUSE_EDF_SCHEDULING == 1 )
+		{
+			harnessCHECK( uxTaskGetDeadlineMisses( xPeriodicTasks[ uxTask ] ) == 0 );
+		}
+		#endif
+
+		ulTotalMisses += ulMisses[ uxTask ];
+		vTaskDelete( xPeriodicTasks[ uxTask ] );
+		xPeriodicTasks[ uxTask ] = NULL;
+	}
+
+	#if( configUSE_EDF_SCHEDULING == 1 )
+	{
+		harnessCHECK( ulTotalMisses == 0 );
+	}
+	#else
+	{
+		/* The shorter period task always runs first, so only the other can
+		miss. */
+		harnessCHECK( ulMisses[ 0 ] == 0 );
+		harnessCHECK( ulTotalMisses > 0 );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvSporadicTask( void *pvParameters )
+	{
+		( void ) pvParameters;
+
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		xRunOrder[ uxRuns ] = xTaskGetCurrentTaskHandle();
+		uxRuns++;
+
+		/* A delay that also outlasts the deadline starts another job. */
+		vTaskDelay( mainSPORADIC_DEADLINE * 2 );
+		harnessCHECK( uxTaskGetDeadlineMisses( NULL ) == 0 );
+
+		xTaskNotifyGive( xControlTask );
+		vTaskSuspend( NULL );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvUrgentTask( void *pvParameters )
+	{
+		( void ) pvParameters;
+
+		xRunOrder[ uxRuns ] = xTaskGetCurrentTaskHandle();
+		uxRuns++;
+
+		xTaskNotifyGive( xControlTask );
+		vTaskSuspend( NULL );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvLateWakeTest( void )
+	{
+	TaskHandle_t xSporadic, xUrgent;
+
+		xTaskCreateWithDeadline( prvSporadicTask, "Spor", configMINIMAL_STACK_SIZE, NULL, mainSPORADIC_DEADLINE, mainSPORADIC_DEADLINE, &xSporadic );
+		vTaskDelay( mainSPORADIC_BLOCK );
+
+		/* The deadline of the sporadic task's first job has passed.  Waking
+		it starts a job with a deadline after that of the urgent task. */
+		uxRuns = 0;
+		xTaskNotifyGive( xSporadic );
+		xTaskCreateWithDeadline( prvUrgentTask, "Urg", configMINIMAL_STACK_SIZE, NULL, mainURGENT_DEADLINE, mainURGENT_DEADLINE, &xUrgent );
+
+		harnessCHECK( ulTaskNotifyTake( pdFALSE, mainSPORADIC_BLOCK ) != 0 );
+		harnessCHECK( ulTaskNotifyTake( pdFALSE, mainSPORADIC_BLOCK ) != 0 );
+		harnessCHECK( uxRuns == 2 );
+		harnessCHECK( xRunOrder[ 0 ] == xUrgent );
+		harnessCHECK( xRunOrder[ 1 ] == xSporadic );
+		harnessCHECK( uxTaskGetDeadlineMisses( xSporadic ) == 0 );
+
+		vTaskDelete( xSporadic );
+		vTaskDelete( xUrgent );
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	prvPeriodicTest();
+
+	#if( configUSE_EDF_SCHEDULING == 1 )
+	{
+		prvLateWakeTest();
+		vHarnessPass( "EDF schedules a 97% task set without misses" );
+	}
+	#else
+	{
+		vHarnessPass( "fixed priorities miss deadlines of a 97% task set" );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,190 @@
+/*
+ * Checks the mutual exclusion and priority inheritance of fast mutexes.
+ *
+ * Inheritance test: L takes the mutex, then H blocks on it with a timeout.
+ * While H waits L runs at the priority of H, and once H times out L drops back
+ * to its own priority.  H then waits without a timeout and gets the mutex as
+ * soon as L gives it back.
+ *
+ * Exclusion test: tasks of different priorities repeatedly take the mutex,
+ * some with short timeouts, and update a counter with a read, a yield and a
+ * write that would lose updates if two tasks held the mutex at once.  On more
+ * than one core the tasks are spread over the cores.  Afterwards every task
+ * must be back at its own priority.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fast_mutex.h"
+
+#include "harness.h"
+
+#define mainLOW_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define mainHIGH_PRIORITY		( tskIDLE_PRIORITY + 4 )
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 5 )
+#define mainCHECK_PRIORITY		( tskIDLE_PRIORITY + 6 )
+
+#define mainWAIT_TICKS			( ( TickType_t ) 10 )
+
+#define mainWORKERS				( 4 )
+#define mainWORKER_LOOPS		( 2000 )
+
+static void prvControlTask( void *pvParameters );
+
+static FastMutexHandle_t xFastMutex;
+static TaskHandle_t xControlTask;
+
+/* The number of times the mutex was taken, which is only updated with the
+mutex held, and the number of attempts that timed out. */
+static volatile uint32_t ulTaken, ulTimedOut;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xFastMutex = xFastMutexCreate();
+	configASSERT( xFastMutex );
+
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, &xControlTask );
+	vTaskStartScheduler();
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvLowTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	harnessCHECK( xFastMutexLock( xFastMutex, 0 ) == pdPASS );
+	harnessCHECK( xFastMutexGetHolder( xFastMutex ) == xTaskGetCurrentTaskHandle() );
+
+	/* Hold the mutex until told to give it back. */
+	( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+	harnessCHECK( xFastMutexUnlock( xFastMutex ) == pdPASS );
+	harnessCHECK( uxTaskPriorityGet( NULL ) == mainLOW_PRIORITY );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInheritanceCheckTask( void *pvParameters )
+{
+TaskHandle_t xLow = ( TaskHandle_t ) pvParameters;
+
+	/* Check the holder half way through the wait of the control task. */
+	vTaskDelay( mainWAIT_TICKS / 2 );
+	harnessCHECK( uxTaskPriorityGet( xLow ) == mainHIGH_PRIORITY );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInheritanceTest( void )
+{
+TaskHandle_t xLow;
+
+	xTaskCreate( prvLowTask, "L", configMINIMAL_STACK_SIZE, NULL, mainLOW_PRIORITY, &xLow );
+	vTaskDelay( 1 );
+	harnessCHECK( xFastMutexGetHolder( xFastMutex ) == xLow );
+
+	/* A task that is not the holder cannot give the mutex back. */
+	harnessCHECK( xFastMutexUnlock( xFastMutex ) == pdFAIL );
+
+	/* Wait at the priority of H until the wait times out. */
+	xTaskCreate( prvInheritanceCheckTask, "Chk", configMINIMAL_STACK_SIZE, xLow, mainCHECK_PRIORITY, NULL );
+	vTaskPrioritySet( NULL, mainHIGH_PRIORITY );
+	harnessCHECK( xFastMutexLock( xFastMutex, mainWAIT_TICKS ) == pdFAIL );
+	harnessCHECK( uxTaskPriorityGet( xLow ) == mainLOW_PRIORITY );
+
+	/* Wait again, this time until L gives the mutex back. */
+	xTaskNotifyGive( xLow );
+	harnessCHECK( xFastMutexLock( xFastMutex, portMAX_DELAY ) == pdPASS );
+	harnessCHECK( xFastMutexGetHolder( xFastMutex ) == xTaskGetCurrentTaskHandle() );
+	harnessCHECK( xFastMutexUnlock( xFastMutex ) == pdPASS );
+	harnessCHECK( xFastMutexGetHolder( xFastMutex ) == NULL );
+
+	vTaskPrioritySet( NULL, mainCONTROL_PRIORITY );
+	vTaskDelay( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWorkerTask( void *pvParameters )
+{
+UBaseType_t uxWorker = ( UBaseType_t ) pvParameters;
+TickType_t xTicksToWait;
+uint32_t ulLoop, ulValue;
+
+	/* Half of the workers give up if they cannot take the mutex quickly. */
+	xTicksToWait = ( ( uxWorker & 1U ) != 0U ) ? ( TickType_t ) 1 : portMAX_DELAY;
+
+	for( ulLoop = 0; ulLoop < mainWORKER_LOOPS; ulLoop++ )
+	{
+		if( xFastMutexLock( xFastMutex, xTicksToWait ) == pdPASS )
+		{
+			ulValue = ulTaken;
+
+			if( ( ulLoop & 7U ) == 0U )
+			{
+				taskYIELD();
+			}
+
+			ulTaken = ulValue + 1UL;
+			harnessCHECK( xFastMutexUnlock( xFastMutex ) == pdPASS );
+		}
+		else
+		{
+			taskENTER_CRITICAL();
+			{
+				ulTimedOut++;
+			}
+			taskEXIT_CRITICAL();
+		}
+	}
+
+	harnessCHECK( uxTaskPriorityGet( NULL ) == mainLOW_PRIORITY + uxWorker );
+	xTaskNotifyGive( xControlTask );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvExclusionTest( void )
+{
+UBaseType_t uxWorker;
+TaskHandle_t xWorker;
+
+	for( uxWorker = 0; uxWorker < mainWORKERS; uxWorker++ )
+	{
+		xTaskCreate( prvWorkerTask, "Work", configMINIMAL_STACK_SIZE, ( void * ) uxWorker, mainLOW_PRIORITY + uxWorker, &xWorker );
+
+		#if( configNUMBER_OF_CORES > 1 )
+		{
+			vTaskCoreAffinitySet( xWorker, ( UBaseType_t ) 1U << ( uxWorker % configNUMBER_OF_CORES ) );
+		}
+		#else
+		{
+			( void ) xWorker;
+		}
+		#endif
+	}
+
+	for( uxWorker = 0; uxWorker < mainWORKERS; uxWorker++ )
+	{
+		harnessCHECK( ulTaskNotifyTake( pdFALSE, pdMS_TO_TICKS( 60000 ) ) != 0 );
+	}
+
+	vHarnessPrintf( "%d core(s): %u locks taken, %u timed out\n", configNUMBER_OF_CORES, ( unsigned ) ulTaken, ( unsigned ) ulTimedOut );
+	harnessCHECK( ( ulTaken + ulTimedOut ) == ( mainWORKERS * mainWORKER_LOOPS ) );
+	harnessCHECK( xFastMutexGetHolder( xFastMutex ) == NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	prvInheritanceTest();
+	prvExclusionTest();
+
+	vHarnessPass( "fast mutex" );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,221 @@
+/*
+ * Checks that a task blocked in xWaitForMultipleObjects() can be deleted, and
+ * that it keeps its place among the tasks waiting on a queue when its priority
+ * changes.
+ *
+ * Deletion test: a task waiting for two queues and an event group is deleted,
+ * and its stack is reused by a new task that overwrites it.  Sending to the
+ * queues and setting the bits afterwards must not find the records of the
+ * deleted task.
+ *
+ * Priority test: A and B wait for the same queue, B with the higher priority.
+ * A is then raised above B, once with vTaskPrioritySet() and once by
+ * inheriting the priority of a task that blocks on a mutex A holds.  An item
+ * sent to the queue must then unblock A rather than B.
+ */
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "multi_wait.h"
+
+#include "harness.h"
+
+#define mainA_PRIORITY			( tskIDLE_PRIORITY + 1 )
+#define mainB_PRIORITY			( tskIDLE_PRIORITY + 2 )
+#define mainRAISED_PRIORITY		( tskIDLE_PRIORITY + 3 )
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 4 )
+
+#define mainBIT					( ( EventBits_t ) 0x01 )
+#define mainSTACK_SIZE			( configMINIMAL_STACK_SIZE * 2 )
+
+static void prvControlTask( void *pvParameters );
+
+static QueueHandle_t xQueue1, xQueue2;
+static EventGroupHandle_t xEventGroup;
+static SemaphoreHandle_t xMutex;
+static TaskHandle_t xControlTask;
+
+/* The task that was unblocked by the item sent in the priority test. */
+static volatile TaskHandle_t xUnblockedTask;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xQueue1 = xQueueCreate( 1, sizeof( uint32_t ) );
+	xQueue2 = xQueueCreate( 1, sizeof( uint32_t ) );
+	xEventGroup = xEventGroupCreate();
+	xMutex = xSemaphoreCreateMutex();
+	configASSERT( ( xQueue1 != NULL ) && ( xQueue2 != NULL ) && ( xEventGroup != NULL ) && ( xMutex != NULL ) );
+
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, &xControlTask );
+	vTaskStartScheduler();
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseObjects( WaitObject_t *pxObjects )
+{
+	pxObjects[ 0 ].eType = eWaitForQueue;
+	pxObjects[ 0 ].pvObject = xQueue1;
+	pxObjects[ 1 ].eType = eWaitForQueue;
+	pxObjects[ 1 ].pvObject = xQueue2;
+	pxObjects[ 2 ].eType = eWaitForEventBits;
+	pxObjects[ 2 ].pvObject = xEventGroup;
+	pxObjects[ 2 ].uxBitsToWaitFor = mainBIT;
+	pxObjects[ 2 ].xWaitForAllBits = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvDeletedTask( void *pvParameters )
+{
+WaitObject_t xObjects[ 3 ];
+
+	( void ) pvParameters;
+
+	prvInitialiseObjects( xObjects );
+	( void ) xWaitForMultipleObjects( xObjects, 3, portMAX_DELAY );
+
+	/* Should have been deleted before any object became ready. */
+	vHarnessFail( __FILE__, __LINE__, "deleted task ran" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvOverwriteTask( void *pvParameters )
+{
+volatile uint8_t ucBuffer[ mainSTACK_SIZE ];
+
+	( void ) pvParameters;
+
+	/* Overwrite as much of the reused stack as is safe. */
+	memset( ( void * ) ucBuffer, 0xff, sizeof( ucBuffer ) );
+	xTaskNotifyGive( xControlTask );
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvDeletionTest( void )
+{
+TaskHandle_t xDeleted, xOverwrite;
+uint32_t ulValue = 0;
+
+	xTaskCreate( prvDeletedTask, "Del", mainSTACK_SIZE, NULL, mainA_PRIORITY, &xDeleted );
+	vTaskDelay( 2 );
+	harnessCHECK( eTaskGetState( xDeleted ) == eBlocked );
+
+	/* Let the idle task free the stack, then reuse it. */
+	vTaskDelete( xDeleted );
+	vTaskDelay( 2 );
+	xTaskCreate( prvOverwriteTask, "Ovr", mainSTACK_SIZE, NULL, mainA_PRIORITY, &xOverwrite );
+	harnessCHECK( ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( 1000 ) ) != 0 );
+
+	harnessCHECK( xQueueSend( xQueue1, &ulValue, 0 ) == pdPASS );
+	harnessCHECK( xQueueSend( xQueue2, &ulValue, 0 ) == pdPASS );
+	( void ) xEventGroupSetBits( xEventGroup, mainBIT );
+
+	harnessCHECK( xQueueReceive( xQueue1, &ulValue, 0 ) == pdPASS );
+	harnessCHECK( xQueueReceive( xQueue2, &ulValue, 0 ) == pdPASS );
+	( void ) xEventGroupClearBits( xEventGroup, mainBIT );
+
+	vTaskDelete( xOverwrite );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitingTask( void *pvParameters )
+{
+WaitObject_t xObjects[ 3 ];
+uint32_t ulValue;
+BaseType_t xHoldMutex = ( BaseType_t ) pvParameters;
+
+	if( xHoldMutex != pdFALSE )
+	{
+		harnessCHECK( xSemaphoreTake( xMutex, 0 ) == pdPASS );
+	}
+
+	prvInitialiseObjects( xObjects );
+	harnessCHECK( xWaitForMultipleObjects( xObjects, 3, portMAX_DELAY ) == 0 );
+	harnessCHECK( xQueueReceive( xQueue1, &ulValue, 0 ) == pdPASS );
+	xUnblockedTask = xTaskGetCurrentTaskHandle();
+
+	if( xHoldMutex != pdFALSE )
+	{
+		harnessCHECK( xSemaphoreGive( xMutex ) == pdPASS );
+	}
+
+	xTaskNotifyGive( xControlTask );
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMutexTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	harnessCHECK( xSemaphoreTake( xMutex, portMAX_DELAY ) == pdPASS );
+	harnessCHECK( xSemaphoreGive( xMutex ) == pdPASS );
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPriorityTest( BaseType_t xInherit )
+{
+TaskHandle_t xA, xB, xHigh = NULL;
+uint32_t ulValue = 0;
+
+	xUnblockedTask = NULL;
+	xTaskCreate( prvWaitingTask, "A", mainSTACK_SIZE, ( void * ) xInherit, mainA_PRIORITY, &xA );
+	xTaskCreate( prvWaitingTask, "B", mainSTACK_SIZE, ( void * ) pdFALSE, mainB_PRIORITY, &xB );
+	vTaskDelay( 2 );
+	harnessCHECK( ( eTaskGetState( xA ) == eBlocked ) && ( eTaskGetState( xB ) == eBlocked ) );
+
+	if( xInherit != pdFALSE )
+	{
+		xTaskCreate( prvMutexTask, "Mtx", mainSTACK_SIZE, NULL, mainRAISED_PRIORITY, &xHigh );
+		vTaskDelay( 2 );
+	}
+	else
+	{
+		vTaskPrioritySet( xA, mainRAISED_PRIORITY );
+	}
+
+	harnessCHECK( uxTaskPriorityGet( xA ) == mainRAISED_PRIORITY );
+
+	/* A now has the highest priority of the tasks waiting for the queue. */
+	harnessCHECK( xQueueSend( xQueue1, &ulValue, 0 ) == pdPASS );
+	harnessCHECK( ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( 1000 ) ) != 0 );
+	harnessCHECK( xUnblockedTask == xA );
+
+	/* Let B go, then clean up. */
+	harnessCHECK( xQueueSend( xQueue1, &ulValue, 0 ) == pdPASS );
+	harnessCHECK( ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( 1000 ) ) != 0 );
+	harnessCHECK( xUnblockedTask == xB );
+
+	vTaskDelete( xA );
+	vTaskDelete( xB );
+
+	if( xHigh != NULL )
+	{
+		vTaskDelete( xHigh );
+	}
+
+	vTaskDelay( 2 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	prvDeletionTest();
+	prvPriorityTest( pdFALSE );
+	prvPriorityTest( pdTRUE );
+
+	vHarnessPass( "multiple object wait" );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,226 @@
+/*
+ * Checks priority inheritance through a chain of mutex holders
+ * (configPRIORITY_INHERITANCE_DEPTH), and that the holders drop back to the
+ * right priority when the high priority waiter times out.
+ *
+ * Chain test: L holds mutex 1, N holds mutex 2 and blocks on mutex 1, M holds
+ * mutex 3 and blocks on mutex 2, then H blocks on mutex 3.  L needs
+ * mainWORK_TICKS of CPU time to release mutex 1, and a hog task with a
+ * priority between N and H wants the CPU for mainHOG_TICKS.  With a depth of
+ * at least 3 the priority of H reaches L, so the hog cannot delay the chain.
+ * With a depth of 1 only M inherits from H, L runs at the priority of N, and
+ * H is held up for as long as the hog runs.
+ *
+ * Timeout test: L2 holds mutex 1, N2 holds mutex 2 and blocks on mutex 1, and
+ * H2 blocks on mutex 2 with a timeout.  While H2 waits N2 (and L2 if the
+ * depth allows) run at the priority of H2.  Once H2 times out both drop back
+ * to the priority of N2, which is still blocked on mutex 1.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "harness.h"
+
+#define mainLOW_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define mainMEDIUM_PRIORITY		( tskIDLE_PRIORITY + 2 )
+#define mainHOG_PRIORITY		( tskIDLE_PRIORITY + 4 )
+#define mainHIGH_PRIORITY		( tskIDLE_PRIORITY + 6 )
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 7 )
+#define mainCHECK_PRIORITY		( tskIDLE_PRIORITY + 8 )
+
+#define mainWORK_TICKS			( ( TickType_t ) 20 )
+#define mainHOG_TICKS			( ( TickType_t ) 200 )
+#define mainWAIT_TICKS			( ( TickType_t ) 10 )
+
+static void prvControlTask( void *pvParameters );
+static void prvLowTask( void *pvParameters );
+static void prvMiddleTask( void *pvParameters );
+static void prvHogTask( void *pvParameters );
+
+static SemaphoreHandle_t xMutex1, xMutex2, xMutex3;
+
+/* The mutex each chain task takes first, and the one it then blocks on. */
+typedef struct
+{
+	SemaphoreHandle_t xHeld;
+	SemaphoreHandle_t xWanted;
+} ChainLink_t;
+
+static ChainLink_t xLinkN, xLinkM;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xMutex1 = xSemaphoreCreateMutex();
+	xMutex2 = xSemaphoreCreateMutex();
+	xMutex3 = xSemaphoreCreateMutex();
+	configASSERT( ( xMutex1 != NULL ) && ( xMutex2 != NULL ) && ( xMutex3 != NULL ) );
+
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, NULL );
+	vTaskStartScheduler();
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvLowTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	harnessCHECK( xSemaphoreTake( xMutex1, 0 ) == pdPASS );
+
+	/* Wait for the rest of the chain to form, then do the work that must
+	complete before mutex 1 can be released. */
+	( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+	vHarnessSpinTicks( mainWORK_TICKS );
+
+	harnessCHECK( xSemaphoreGive( xMutex1 ) == pdPASS );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMiddleTask( void *pvParameters )
+{
+ChainLink_t *pxLink = ( ChainLink_t * ) pvParameters;
+
+	harnessCHECK( xSemaphoreTake( pxLink->xHeld, 0 ) == pdPASS );
+	harnessCHECK( xSemaphoreTake( pxLink->xWanted, portMAX_DELAY ) == pdPASS );
+	harnessCHECK( xSemaphoreGive( pxLink->xWanted ) == pdPASS );
+	harnessCHECK( xSemaphoreGive( pxLink->xHeld ) == pdPASS );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHogTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	vHarnessSpinTicks( mainHOG_TICKS );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvChainTest( void )
+{
+TaskHandle_t xLow, xMiddleN, xMiddleM;
+TickType_t xStart, xBlocked;
+
+	/* Each task runs until it blocks as soon as the control task delays, so
+	the chain is built from the tail end. */
+	xTaskCreate( prvLowTask, "L", configMINIMAL_STACK_SIZE, NULL, mainLOW_PRIORITY, &xLow );
+	vTaskDelay( 1 );
+
+	xLinkN.xHeld = xMutex2;
+	xLinkN.xWanted = xMutex1;
+	xTaskCreate( prvMiddleTask, "N", configMINIMAL_STACK_SIZE, &xLinkN, mainMEDIUM_PRIORITY, &xMiddleN );
+	vTaskDelay( 1 );
+
+	xLinkM.xHeld = xMutex3;
+	xLinkM.xWanted = xMutex2;
+	xTaskCreate( prvMiddleTask, "M", configMINIMAL_STACK_SIZE, &xLinkM, mainMEDIUM_PRIORITY, &xMiddleM );
+	vTaskDelay( 1 );
+
+	harnessCHECK( eTaskGetState( xMiddleN ) == eBlocked );
+	harnessCHECK( eTaskGetState( xMiddleM ) == eBlocked );
+
+	/* Let L start its work, then make the hog ready while the control task,
+	standing in for H, blocks on the end of the chain. */
+	xTaskNotifyGive( xLow );
+	vTaskPrioritySet( NULL, mainHIGH_PRIORITY );
+	xTaskCreate( prvHogTask, "Hog", configMINIMAL_STACK_SIZE, NULL, mainHOG_PRIORITY, NULL );
+
+	xStart = xTaskGetTickCount();
+	harnessCHECK( xSemaphoreTake( xMutex3, portMAX_DELAY ) == pdPASS );
+	xBlocked = xTaskGetTickCount() - xStart;
+	harnessCHECK( xSemaphoreGive( xMutex3 ) == pdPASS );
+
+	vTaskPrioritySet( NULL, mainCONTROL_PRIORITY );
+	vHarnessPrintf( "depth %d: blocked for %u ticks on a 3 mutex chain\n", configPRIORITY_INHERITANCE_DEPTH, ( unsigned ) xBlocked );
+
+	#if( configPRIORITY_INHERITANCE_DEPTH >= 3 )
+	{
+		/* The hog never ran ahead of the chain. */
+		harnessCHECK( xBlocked < ( mainHOG_TICKS / 2 ) );
+	}
+	#else
+	{
+		/* L was held off by the hog. */
+		harnessCHECK( xBlocked >= ( mainHOG_TICKS / 2 ) );
+	}
+	#endif
+
+	/* Let the hog finish. */
+	vTaskDelay( mainHOG_TICKS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInheritanceCheckTask( void *pvParameters )
+{
+TaskHandle_t *pxHolders = ( TaskHandle_t * ) pvParameters;
+
+	/* Check the holders half way through the wait of the control task. */
+	vTaskDelay( mainWAIT_TICKS / 2 );
+
+	harnessCHECK( uxTaskPriorityGet( pxHolders[ 1 ] ) == mainHIGH_PRIORITY );
+
+	#if( configPRIORITY_INHERITANCE_DEPTH >= 2 )
+	{
+		harnessCHECK( uxTaskPriorityGet( pxHolders[ 0 ] ) == mainHIGH_PRIORITY );
+	}
+	#else
+	{
+		harnessCHECK( uxTaskPriorityGet( pxHolders[ 0 ] ) == mainMEDIUM_PRIORITY );
+	}
+	#endif
+
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeoutTest( void )
+{
+static TaskHandle_t xHolders[ 2 ];
+
+	xTaskCreate( prvLowTask, "L2", configMINIMAL_STACK_SIZE, NULL, mainLOW_PRIORITY, &( xHolders[ 0 ] ) );
+	vTaskDelay( 1 );
+
+	xLinkN.xHeld = xMutex2;
+	xLinkN.xWanted = xMutex1;
+	xTaskCreate( prvMiddleTask, "N2", configMINIMAL_STACK_SIZE, &xLinkN, mainMEDIUM_PRIORITY, &( xHolders[ 1 ] ) );
+	vTaskDelay( 1 );
+
+	/* N2 blocking on mutex 1 raised L2 to the priority of N2. */
+	harnessCHECK( uxTaskPriorityGet( xHolders[ 0 ] ) == mainMEDIUM_PRIORITY );
+
+	/* Block on mutex 2 at the priority of H2 until the wait times out. */
+	xTaskCreate( prvInheritanceCheckTask, "Chk", configMINIMAL_STACK_SIZE, xHolders, mainCHECK_PRIORITY, NULL );
+	vTaskPrioritySet( NULL, mainHIGH_PRIORITY );
+	harnessCHECK( xSemaphoreTake( xMutex2, mainWAIT_TICKS ) == pdFAIL );
+	vTaskPrioritySet( NULL, mainCONTROL_PRIORITY );
+
+	/* Both holders are back at the priority of N2, which is still blocked on
+	mutex 1. */
+	harnessCHECK( uxTaskPriorityGet( xHolders[ 1 ] ) == mainMEDIUM_PRIORITY );
+	harnessCHECK( uxTaskPriorityGet( xHolders[ 0 ] ) == mainMEDIUM_PRIORITY );
+
+	/* Release the chain. */
+	xTaskNotifyGive( xHolders[ 0 ] );
+	vTaskDelay( mainWORK_TICKS * 2 );
+	harnessCHECK( xSemaphoreGetMutexHolder( xMutex1 ) == NULL );
+	harnessCHECK( xSemaphoreGetMutexHolder( xMutex2 ) == NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	prvChainTest();
+	prvTimeoutTest();
+
+	vHarnessPass( "priority inheritance" );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,283 @@
+/*
+ * Checks that reader-writer locks let readers in together, prefer writers,
+ * time out cleanly and wake waiting tasks in priority order.
+ *
+ * Overlap test: several readers take the lock and hold it across a delay.
+ * All of them must be inside the lock at the same time.
+ *
+ * Writer preference test: while a reader holds the lock a writer blocks on
+ * it.  A new reader must then be refused even though only readers hold the
+ * lock, and the writer must get the lock as soon as the reader gives it back.
+ *
+ * Timeout test: a write lock that times out behind a reader, and a read lock
+ * that times out behind a writer, must return pdFAIL and leave the lock as it
+ * was - no writer still counted as waiting, so new readers get in, and no
+ * reader counted as holding the lock, so a writer gets in once it is free.
+ * The writer must not keep a priority inherited from the reader that timed
+ * out.
+ *
+ * Wake order test: writers of different priorities block on a lock held for
+ * writing.  When it is given back they must get it highest priority first.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rw_lock.h"
+
+#include "harness.h"
+
+#define mainLOW_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 5 )
+
+#define mainREADERS				( 4 )
+#define mainHOLD_TICKS			( ( TickType_t ) 20 )
+#define mainWAIT_TICKS			( ( TickType_t ) 10 )
+#define mainWRITERS				( 3 )
+
+static void prvControlTask( void *pvParameters );
+
+static RWLockHandle_t xRWLock;
+static TaskHandle_t xControlTask;
+
+/* Updated with the lock held for reading, so only in a critical section. */
+static volatile UBaseType_t uxReadersInside, uxMostReadersInside;
+
+/* The priorities of the writers in the order they got the lock. */
+static volatile UBaseType_t uxWriteOrder[ mainWRITERS ], uxWrites;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xRWLock = xRWLockCreate();
+	configASSERT( xRWLock );
+
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, &xControlTask );
+	vTaskStartScheduler();
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvOverlapReaderTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	harnessCHECK( xRWLockReadLock( xRWLock, portMAX_DELAY ) == pdPASS );
+
+	taskENTER_CRITICAL();
+	{
+		uxReadersInside++;
+
+		if( uxReadersInside > uxMostReadersInside )
+		{
+			uxMostReadersInside = uxReadersInside;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	vTaskDelay( mainHOLD_TICKS );
+
+	taskENTER_CRITICAL();
+	{
+		uxReadersInside--;
+	}
+	taskEXIT_CRITICAL();
+
+	harnessCHECK( xRWLockReadUnlock( xRWLock ) == pdPASS );
+	xTaskNotifyGive( xControlTask );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvOverlapTest( void )
+{
+UBaseType_t uxReader;
+
+	for( uxReader = 0; uxReader < mainREADERS; uxReader++ )
+	{
+		xTaskCreate( prvOverlapReaderTask, "Rd", configMINIMAL_STACK_SIZE, NULL, mainLOW_PRIORITY + uxReader, NULL );
+	}
+
+	for( uxReader = 0; uxReader < mainREADERS; uxReader++ )
+	{
+		harnessCHECK( ulTaskNotifyTake( pdFALSE, mainHOLD_TICKS * 10 ) != 0 );
+	}
+
+	harnessCHECK( uxMostReadersInside == mainREADERS );
+	harnessCHECK( uxReadersInside == 0 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHolderTask( void *pvParameters )
+{
+BaseType_t xWrite = ( BaseType_t ) pvParameters;
+
+	/* Take the lock, hold it until told to give it back, then report back. */
+	if( xWrite != pdFALSE )
+	{
+		harnessCHECK( xRWLockWriteLock( xRWLock, 0 ) == pdPASS );
+	}
+	else
+	{
+		harnessCHECK( xRWLockReadLock( xRWLock, 0 ) == pdPASS );
+	}
+
+	xTaskNotifyGive( xControlTask );
+	( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+	if( xWrite != pdFALSE )
+	{
+		harnessCHECK( xRWLockWriteUnlock( xRWLock ) == pdPASS );
+	}
+	else
+	{
+		harnessCHECK( xRWLockReadUnlock( xRWLock ) == pdPASS );
+	}
+
+	xTaskNotifyGive( xControlTask );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static TaskHandle_t prvCreateHolder( BaseType_t xWrite )
+{
+TaskHandle_t xHolder;
+
+	xTaskCreate( prvHolderTask, "Hold", configMINIMAL_STACK_SIZE, ( void * ) xWrite, mainLOW_PRIORITY, &xHolder );
+	harnessCHECK( ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( 1000 ) ) != 0 );
+
+	return xHolder;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReleaseHolder( TaskHandle_t xHolder )
+{
+	xTaskNotifyGive( xHolder );
+	harnessCHECK( ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( 1000 ) ) != 0 );
+	vTaskDelay( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitingWriterTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	harnessCHECK( xRWLockWriteLock( xRWLock, portMAX_DELAY ) == pdPASS );
+
+	uxWriteOrder[ uxWrites ] = uxTaskPriorityGet( NULL );
+	uxWrites++;
+
+	harnessCHECK( xRWLockWriteUnlock( xRWLock ) == pdPASS );
+	xTaskNotifyGive( xControlTask );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriterPreferenceTest( void )
+{
+TaskHandle_t xReader, xWriter;
+
+	xReader = prvCreateHolder( pdFALSE );
+
+	xTaskCreate( prvWaitingWriterTask, "Wr", configMINIMAL_STACK_SIZE, NULL, mainLOW_PRIORITY, &xWriter );
+	vTaskDelay( 2 );
+	harnessCHECK( eTaskGetState( xWriter ) == eBlocked );
+
+	/* Only a reader holds the lock, but a writer is waiting for it. */
+	harnessCHECK( xRWLockReadLock( xRWLock, mainWAIT_TICKS ) == pdFAIL );
+
+	uxWrites = 0;
+	xTaskNotifyGive( xReader );
+	harnessCHECK( ulTaskNotifyTake( pdFALSE, pdMS_TO_TICKS( 1000 ) ) != 0 );
+	harnessCHECK( ulTaskNotifyTake( pdFALSE, pdMS_TO_TICKS( 1000 ) ) != 0 );
+	harnessCHECK( uxWrites == 1 );
+
+	/* With the writer gone readers get in again. */
+	harnessCHECK( xRWLockReadLock( xRWLock, 0 ) == pdPASS );
+	harnessCHECK( xRWLockReadUnlock( xRWLock ) == pdPASS );
+	vTaskDelay( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimeoutTest( void )
+{
+TaskHandle_t xHolder;
+
+	/* A writer times out behind a reader. */
+	xHolder = prvCreateHolder( pdFALSE );
+	harnessCHECK( xRWLockWriteLock( xRWLock, mainWAIT_TICKS ) == pdFAIL );
+
+	/* No writer is left counted as waiting, so readers are not held off. */
+	harnessCHECK( xRWLockReadLock( xRWLock, 0 ) == pdPASS );
+	harnessCHECK( xRWLockReadUnlock( xRWLock ) == pdPASS );
+	prvReleaseHolder( xHolder );
+
+	/* Both readers have gone, so there is no reader left to give it back. */
+	harnessCHECK( xRWLockReadUnlock( xRWLock ) == pdFAIL );
+
+	/* A reader times out behind a lower priority writer that it raised. */
+	xHolder = prvCreateHolder( pdTRUE );
+	harnessCHECK( xRWLockReadLock( xRWLock, mainWAIT_TICKS ) == pdFAIL );
+	harnessCHECK( uxTaskPriorityGet( xHolder ) == mainLOW_PRIORITY );
+
+	/* The reader that timed out is not counted as holding the lock. */
+	harnessCHECK( xRWLockReadUnlock( xRWLock ) == pdFAIL );
+	prvReleaseHolder( xHolder );
+
+	harnessCHECK( xRWLockWriteLock( xRWLock, 0 ) == pdPASS );
+	harnessCHECK( xRWLockWriteUnlock( xRWLock ) == pdPASS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWakeOrderTest( void )
+{
+/* Created in an order that is neither ascending nor descending priority. */
+const UBaseType_t uxPriorities[ mainWRITERS ] = { mainLOW_PRIORITY, mainLOW_PRIORITY + 2, mainLOW_PRIORITY + 1 };
+TaskHandle_t xWriters[ mainWRITERS ];
+UBaseType_t uxWriter;
+
+	harnessCHECK( xRWLockWriteLock( xRWLock, 0 ) == pdPASS );
+
+	for( uxWriter = 0; uxWriter < mainWRITERS; uxWriter++ )
+	{
+		xTaskCreate( prvWaitingWriterTask, "Wr", configMINIMAL_STACK_SIZE, NULL, uxPriorities[ uxWriter ], &( xWriters[ uxWriter ] ) );
+	}
+
+	vTaskDelay( 2 );
+
+	for( uxWriter = 0; uxWriter < mainWRITERS; uxWriter++ )
+	{
+		harnessCHECK( eTaskGetState( xWriters[ uxWriter ] ) == eBlocked );
+	}
+
+	/* Each writer gives the lock back as soon as it has it, which wakes the
+	next, so the order does not depend on how many cores there are. */
+	uxWrites = 0;
+	harnessCHECK( xRWLockWriteUnlock( xRWLock ) == pdPASS );
+
+	for( uxWriter = 0; uxWriter < mainWRITERS; uxWriter++ )
+	{
+		harnessCHECK( ulTaskNotifyTake( pdFALSE, pdMS_TO_TICKS( 1000 ) ) != 0 );
+	}
+
+	harnessCHECK( uxWrites == mainWRITERS );
+	harnessCHECK( uxWriteOrder[ 0 ] == mainLOW_PRIORITY + 2 );
+	harnessCHECK( uxWriteOrder[ 1 ] == mainLOW_PRIORITY + 1 );
+	harnessCHECK( uxWriteOrder[ 2 ] == mainLOW_PRIORITY );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	prvOverlapTest();
+	prvWriterPreferenceTest();
+	prvTimeoutTest();
+	prvWakeOrderTest();
+
+	vRWLockDelete( xRWLock );
+	vHarnessPass( "reader-writer lock" );
+}
+/*-----------------------------------------------------------*/
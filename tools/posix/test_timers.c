@@ -0,0 +1,197 @@
+/*
+ * Checks the order in which software timer callbacks are called, for the
+ * sorted timer lists and for the timing wheel (configUSE_TIMING_WHEEL_TIMERS).
+ * Both builds must call the callbacks in the same order - the order of the
+ * expiry times, and for equal expiry times the order in which the timers were
+ * started.
+ *
+ * The scheduler starts just before the tick count overflows
+ * (configINITIAL_TICK_COUNT), so some one-shot timers expire before the
+ * overflow and some after it, and the auto-reload timers are reloaded across
+ * it.  Groups of timers are given equal expiry times and are started in an
+ * order that is not the order of their IDs.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include "harness.h"
+
+#define mainCONTROL_PRIORITY	( tskIDLE_PRIORITY + 1 )
+
+#define mainONE_SHOT_TIMERS		( 48U )
+#define mainAUTO_RELOAD_TIMERS	( 8U )
+#define mainAUTO_RELOAD_PERIOD	( ( TickType_t ) 260 )
+#define mainAUTO_RELOAD_ROUNDS	( 6U )
+#define mainTIMERS				( mainONE_SHOT_TIMERS + mainAUTO_RELOAD_TIMERS )
+#define mainCALLBACKS			( mainONE_SHOT_TIMERS + ( mainAUTO_RELOAD_TIMERS * mainAUTO_RELOAD_ROUNDS ) )
+
+/* Used to start the one-shot timers in an order that is not their ID order.
+Must have no factor in common with mainONE_SHOT_TIMERS. */
+#define mainSTART_STRIDE		( 29U )
+
+/* The expiry times of the one-shot timers, relative to when they are started.
+The tick count overflows about 1000 ticks after the scheduler starts, so half
+of them expire after the overflow.  None equals a multiple of the auto-reload
+period. */
+static const TickType_t xOneShotPeriods[] = { 300, 700, 1100, 1500 };
+
+typedef struct CALLBACK_RECORD
+{
+	UBaseType_t uxTimerID;
+	TickType_t xExpiryOffset;
+} CallbackRecord_t;
+
+static void prvControlTask( void *pvParameters );
+
+static TaskHandle_t xControlTask;
+static TimerHandle_t xTimers[ mainTIMERS ];
+static TickType_t xStartTime;
+
+/* Written by the timer callback, in the context of the timer service task. */
+static CallbackRecord_t xCallbacks[ mainCALLBACKS ];
+static volatile UBaseType_t uxCallbackCount;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xTaskCreate( prvControlTask, "Ctrl", configMINIMAL_STACK_SIZE, NULL, mainCONTROL_PRIORITY, &xControlTask );
+	vTaskStartScheduler();
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCallback( TimerHandle_t xTimer )
+{
+	if( uxCallbackCount < mainCALLBACKS )
+	{
+		xCallbacks[ uxCallbackCount ].uxTimerID = ( UBaseType_t ) pvTimerGetTimerID( xTimer );
+		xCallbacks[ uxCallbackCount ].xExpiryOffset = xTaskGetTickCount() - xStartTime;
+	}
+
+	uxCallbackCount++;
+
+	if( uxCallbackCount == mainCALLBACKS )
+	{
+		xTaskNotifyGive( xControlTask );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvOneShotTimerStartedAt( UBaseType_t uxRank )
+{
+	return ( uxRank * mainSTART_STRIDE ) % mainONE_SHOT_TIMERS;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGetExpectedOrder( CallbackRecord_t *pxExpected )
+{
+CallbackRecord_t xRecord;
+UBaseType_t uxCount = 0, uxRank, uxRound, uxTimer, uxIndex;
+
+	/* Every callback, in the order the timers were started... */
+	for( uxRank = 0; uxRank < mainONE_SHOT_TIMERS; uxRank++ )
+	{
+		uxTimer = prvOneShotTimerStartedAt( uxRank );
+		pxExpected[ uxCount ].uxTimerID = uxTimer;
+		pxExpected[ uxCount ].xExpiryOffset = xOneShotPeriods[ uxTimer % ( sizeof( xOneShotPeriods ) / sizeof( xOneShotPeriods[ 0 ] ) ) ];
+		uxCount++;
+	}
+
+	for( uxRound = 1; uxRound <= mainAUTO_RELOAD_ROUNDS; uxRound++ )
+	{
+		for( uxTimer = mainONE_SHOT_TIMERS; uxTimer < mainTIMERS; uxTimer++ )
+		{
+			pxExpected[ uxCount ].uxTimerID = uxTimer;
+			pxExpected[ uxCount ].xExpiryOffset = mainAUTO_RELOAD_PERIOD * ( TickType_t ) uxRound;
+			uxCount++;
+		}
+	}
+
+	/* ...then a stable sort by expiry time. */
+	for( uxIndex = 1; uxIndex < uxCount; uxIndex++ )
+	{
+		xRecord = pxExpected[ uxIndex ];
+
+		for( uxRank = uxIndex; ( uxRank > 0 ) && ( pxExpected[ uxRank - 1 ].xExpiryOffset > xRecord.xExpiryOffset ); uxRank-- )
+		{
+			pxExpected[ uxRank ] = pxExpected[ uxRank - 1 ];
+		}
+
+		pxExpected[ uxRank ] = xRecord;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+static CallbackRecord_t xExpected[ mainCALLBACKS ];
+UBaseType_t uxTimer, uxRank;
+TickType_t xPeriod;
+
+	( void ) pvParameters;
+
+	for( uxTimer = 0; uxTimer < mainTIMERS; uxTimer++ )
+	{
+		if( uxTimer < mainONE_SHOT_TIMERS )
+		{
+			xPeriod = xOneShotPeriods[ uxTimer % ( sizeof( xOneShotPeriods ) / sizeof( xOneShotPeriods[ 0 ] ) ) ];
+			xTimers[ uxTimer ] = xTimerCreate( "1S", xPeriod, pdFALSE, ( void * ) uxTimer, prvTimerCallback );
+		}
+		else
+		{
+			xTimers[ uxTimer ] = xTimerCreate( "AR", mainAUTO_RELOAD_PERIOD, pdTRUE, ( void * ) uxTimer, prvTimerCallback );
+		}
+
+		configASSERT( xTimers[ uxTimer ] );
+	}
+
+	/* Start every timer from the same time, so timers with equal periods have
+	equal expiry times however long starting them takes.  The timer service
+	task has the higher priority, so processes each command as it is sent. */
+	xStartTime = xTaskGetTickCount();
+
+	for( uxRank = 0; uxRank < mainONE_SHOT_TIMERS; uxRank++ )
+	{
+		harnessCHECK( xTimerGenericCommand( xTimers[ prvOneShotTimerStartedAt( uxRank ) ], tmrCOMMAND_START, xStartTime, NULL, 0 ) == pdPASS );
+	}
+
+	for( uxTimer = mainONE_SHOT_TIMERS; uxTimer < mainTIMERS; uxTimer++ )
+	{
+		harnessCHECK( xTimerGenericCommand( xTimers[ uxTimer ], tmrCOMMAND_START, xStartTime, NULL, 0 ) == pdPASS );
+	}
+
+	harnessCHECK( ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( 5000 ) ) != 0 );
+
+	for( uxTimer = mainONE_SHOT_TIMERS; uxTimer < mainTIMERS; uxTimer++ )
+	{
+		harnessCHECK( xTimerStop( xTimers[ uxTimer ], 0 ) == pdPASS );
+	}
+
+	/* The tick count has overflowed, and no further callbacks are made. */
+	harnessCHECK( xTaskGetTickCount() < xStartTime );
+	vTaskDelay( mainAUTO_RELOAD_PERIOD * 2 );
+	harnessCHECK( uxCallbackCount == mainCALLBACKS );
+
+	prvGetExpectedOrder( xExpected );
+
+	for( uxRank = 0; uxRank < mainCALLBACKS; uxRank++ )
+	{
+		if( xCallbacks[ uxRank ].uxTimerID != xExpected[ uxRank ].uxTimerID )
+		{
+			vHarnessPrintf( "callback %u: timer %u, expected timer %u\n", ( unsigned ) uxRank,
+							( unsigned ) xCallbacks[ uxRank ].uxTimerID, ( unsigned ) xExpected[ uxRank ].uxTimerID );
+			harnessCHECK( xCallbacks[ uxRank ].uxTimerID == xExpected[ uxRank ].uxTimerID );
+		}
+
+		/* A callback can be late if the host delays the timer service task,
+		but never early. */
+		harnessCHECK( xCallbacks[ uxRank ].xExpiryOffset >= xExpected[ uxRank ].xExpiryOffset );
+	}
+
+	vHarnessPass( ( configUSE_TIMING_WHEEL_TIMERS == 1 ) ? "timer order, timing wheel" : "timer order, sorted lists" );
+}
+/*-----------------------------------------------------------*/